@@ -17,6 +17,39 @@ std::wstring AbstractBaseDecoder::GetName()
     return this->decoderName;
 }
 
+const wchar_t* AbstractBaseDecoder::GetLastErrorMessage()
+{
+    DecoderErrorLog::Render(this->m_errorLog.GetLast(), this->m_errorMessage, MAX_ERROR_SIZE);
+    return this->m_errorMessage;
+}
+
+DecoderErrorRecord AbstractBaseDecoder::GetLastErrorRecord()
+{
+    return this->m_errorLog.GetLast();
+}
+
+bool AbstractBaseDecoder::GetPcmAnalysisResult(PcmAnalysisResult& resultRef)
+{
+    if (this->m_pcmAnalyzerPtr == nullptr)
+    {
+        return false;
+    }
+
+    resultRef = this->m_pcmAnalyzerPtr->GetResult();
+    return true;
+}
+
+bool AbstractBaseDecoder::GetAccurateRipChecksumResult(AccurateRipChecksumResult& resultRef)
+{
+    if (this->m_accurateRipChecksumPtr == nullptr)
+    {
+        return false;
+    }
+
+    resultRef = this->m_accurateRipChecksumPtr->GetResult();
+    return true;
+}
+
 #pragma endregion Overridden_Base_Class_Functions_Region
 
 #pragma region Public_Member_Functions_Region
@@ -40,4 +73,29 @@ bool AbstractBaseDecoder::IsDecoderMemoryBufferIsEnabled() const
     return this->m_decoderMemoryBufferIsEnabled;
 }
 
+void AbstractBaseDecoder::RecordError(DecoderErrorCode code)
+{
+    DecoderErrorRecord record{};
+    record.code = code;
+    this->m_errorLog.Add(record);
+}
+
+void AbstractBaseDecoder::RecordCountError(DecoderErrorCode code, long long count)
+{
+    DecoderErrorRecord record{};
+    record.code = code;
+    record.detail = count;
+    this->m_errorLog.Add(record);
+}
+
+void AbstractBaseDecoder::RecordTimeError(DecoderErrorCode code, unsigned long long position, unsigned long timeBase)
+{
+    DecoderErrorRecord record{};
+    record.code = code;
+    // When the time base is unknown, the error is still reported with a time (i.e. 0m 00s).
+    record.position = (timeBase > 0UL) ? position : 0ULL;
+    record.timeBase = (timeBase > 0UL) ? timeBase : 1UL;
+    this->m_errorLog.Add(record);
+}
+
 #pragma endregion Protected_Member_Functions_Region
\ No newline at end of file
@@ -0,0 +1,463 @@
+#include "AccurateRipChecksum.h"
+#include "CpuDispatch.h"
+#include <algorithm>
+#include <cstring>
+
+#pragma region SIMD_ADJUSTMENT_FOR_COMPILATION_TARGET
+#ifdef CPU_DISPATCH_X86_ENABLED
+// The multiply-accumulate (SSE2, AVX2) and CRC32 (PCLMULQDQ) variants are chosen at runtime, see BindChecksumKernels().
+
+#include <immintrin.h>
+
+#endif
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+// The sample packing uses SSE2 without dispatch, since SSE2 is the baseline of these compilation targets.
+// _M_X64 is defined when the compilation target is x64, which always supports SSE2.
+// _M_IX86_FP is 2 when the compilation target is x86, and SSE2 code generation is enabled (i.e. /arch:SSE2, the default).
+
+#define ACCURATERIP_CHECKSUM_SSE2_ENABLED
+#include <emmintrin.h>
+
+#endif
+#pragma endregion SIMD_ADJUSTMENT_FOR_COMPILATION_TARGET
+
+namespace AccurateRipChecksumSupport
+{
+    /// <summary>
+    /// Purpose: The number of samples at the start of the first Track that are excluded. The sample at position 2939 is included, as in the reference implementation.
+    /// </summary>
+    constexpr auto FIRST_TRACK_SKIPPED_FRAME_COUNT = ACCURATERIP_SKIPPED_FRAME_COUNT - 2ULL;
+
+    /// <summary>
+    /// Purpose: The CRC32 Lookup Tables (reflected polynomial 0xEDB88320) for the 'Slicing-by-8' algorithm, which processes 8 bytes per step.
+    /// </summary>
+    struct Crc32Tables
+    {
+        uint32_t values[8][256];
+
+        Crc32Tables()
+        {
+            for (uint32_t index = 0; index < 256; ++index)
+            {
+                uint32_t crc = index;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc & 1UL) ? (crc >> 1) ^ 0xEDB88320UL : (crc >> 1);
+                }
+                this->values[0][index] = crc;
+            }
+
+            for (uint32_t index = 0; index < 256; ++index)
+            {
+                for (int slice = 1; slice < 8; ++slice)
+                {
+                    uint32_t previous = this->values[slice - 1][index];
+                    this->values[slice][index] = (previous >> 8) ^ this->values[0][previous & 0xFF];
+                }
+            }
+        }
+    };
+
+    const Crc32Tables& GetCrc32Tables()
+    {
+        static const Crc32Tables tables{}; // Initialized once, on first use.
+        return tables;
+    }
+
+    /// <summary>
+    /// Purpose: Updates the CRC32 using 8 bytes per step.
+    /// </summary>
+    uint32_t UpdateCrc32Scalar(uint32_t crc, const unsigned char* dataPtr, size_t size)
+    {
+        const uint32_t (&table)[8][256] = GetCrc32Tables().values;
+
+        while (size >= 8)
+        {
+            uint32_t low;
+            uint32_t high;
+            memcpy(&low, dataPtr, sizeof(low));
+            memcpy(&high, dataPtr + 4, sizeof(high));
+            low ^= crc;
+
+            crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+                table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+
+            dataPtr += 8;
+            size -= 8;
+        }
+
+        while (size > 0)
+        {
+            crc = (crc >> 8) ^ table[0][(crc ^ *dataPtr) & 0xFF];
+            ++dataPtr;
+            --size;
+        }
+
+        return crc;
+    }
+
+#ifdef CPU_DISPATCH_X86_ENABLED
+    /// <summary>
+    /// Purpose: Updates the CRC32 by folding 64 bytes per step using carry-less multiplication, then reduces the folded 128-bits to the CRC32 (Barrett reduction).
+    /// The constants are powers of x modulo the reflected polynomial. The bytes after the last whole 16 bytes use the scalar CRC32.
+    /// URI: https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/fast-crc-computation-generic-polynomials-pclmulqdq-paper.pdf
+    /// </summary>
+    CPU_DISPATCH_TARGET("pclmul,sse4.1") uint32_t UpdateCrc32Pclmul(uint32_t crc, const unsigned char* dataPtr, size_t size)
+    {
+        if (size < 64)
+        {
+            return UpdateCrc32Scalar(crc, dataPtr, size);
+        }
+
+        alignas(16) static const uint64_t k1k2[2] = { 0x0154442BD4ULL, 0x01C6E41596ULL };
+        alignas(16) static const uint64_t k3k4[2] = { 0x01751997D0ULL, 0x00CCAA009EULL };
+        alignas(16) static const uint64_t k5k0[2] = { 0x0163CD6124ULL, 0x0000000000ULL };
+        alignas(16) static const uint64_t polynomial[2] = { 0x01DB710641ULL, 0x01F7011641ULL };
+
+        __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + 0x00));
+        __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + 0x10));
+        __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + 0x20));
+        __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + 0x30));
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+        dataPtr += 64;
+        size -= 64;
+
+        // Fold 4 x 128-bits in parallel.
+        __m128i constants = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+        while (size >= 64)
+        {
+            __m128i x5 = _mm_clmulepi64_si128(x1, constants, 0x00);
+            __m128i x6 = _mm_clmulepi64_si128(x2, constants, 0x00);
+            __m128i x7 = _mm_clmulepi64_si128(x3, constants, 0x00);
+            __m128i x8 = _mm_clmulepi64_si128(x4, constants, 0x00);
+
+            x1 = _mm_clmulepi64_si128(x1, constants, 0x11);
+            x2 = _mm_clmulepi64_si128(x2, constants, 0x11);
+            x3 = _mm_clmulepi64_si128(x3, constants, 0x11);
+            x4 = _mm_clmulepi64_si128(x4, constants, 0x11);
+
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + 0x00)));
+            x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + 0x10)));
+            x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + 0x20)));
+            x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + 0x30)));
+
+            dataPtr += 64;
+            size -= 64;
+        }
+
+        // Fold the 4 x 128-bits into 128-bits, then fold the remaining whole 16 bytes.
+        constants = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+        __m128i x5 = _mm_clmulepi64_si128(x1, constants, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, constants, 0x11), x2), x5);
+        x5 = _mm_clmulepi64_si128(x1, constants, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, constants, 0x11), x3), x5);
+        x5 = _mm_clmulepi64_si128(x1, constants, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, constants, 0x11), x4), x5);
+
+        while (size >= 16)
+        {
+            x5 = _mm_clmulepi64_si128(x1, constants, 0x00);
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, constants, 0x11), _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr))), x5);
+            dataPtr += 16;
+            size -= 16;
+        }
+
+        // Fold 128-bits to 64-bits.
+        const __m128i lowMask = _mm_setr_epi32(-1, 0, -1, 0);
+        x2 = _mm_clmulepi64_si128(x1, constants, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+        constants = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, lowMask), constants, 0x00), x2);
+
+        // Barrett reduction to 32-bits.
+        constants = _mm_load_si128(reinterpret_cast<const __m128i*>(polynomial));
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, lowMask), constants, 0x10);
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, lowMask), constants, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        crc = static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+        return UpdateCrc32Scalar(crc, dataPtr, size);
+    }
+#endif
+
+    /// <summary>
+    /// Purpose: Multiplies each packed sample by its position (mod 2^32), and adds the low and the high 32-bits of the products to the sums.
+    /// </summary>
+    /// <param name="position">The 1-based position of the first sample in the Track (mod 2^32).</param>
+    void MultiplyAccumulateScalar(const uint32_t* packedPtr, size_t frameCount, uint32_t position, uint32_t& lowSumRef, uint32_t& highSumRef)
+    {
+        for (size_t frameIndex = 0; frameIndex < frameCount; ++frameIndex, ++position)
+        {
+            uint64_t product = static_cast<uint64_t>(packedPtr[frameIndex]) * position;
+            lowSumRef += static_cast<uint32_t>(product);
+            highSumRef += static_cast<uint32_t>(product >> 32);
+        }
+    }
+
+#ifdef CPU_DISPATCH_X86_ENABLED
+    /// <summary>
+    /// Purpose: The 32x32 -> 64-bit multiply (PMULUDQ) uses the even lanes, so the odd lanes are shifted down and multiplied separately.
+    /// Each 64-bit product leaves its low 32-bits in an even lane, and its high 32-bits in an odd lane. The lanes are summed mod 2^32.
+    /// </summary>
+    CPU_DISPATCH_TARGET("sse2") void MultiplyAccumulateSse2(const uint32_t* packedPtr, size_t frameCount, uint32_t position, uint32_t& lowSumRef, uint32_t& highSumRef)
+    {
+        size_t frameIndex = 0;
+        if (frameCount >= 4)
+        {
+            __m128i multiplier = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(position)), _mm_setr_epi32(0, 1, 2, 3));
+            const __m128i multiplierStep = _mm_set1_epi32(4);
+            __m128i sum = _mm_setzero_si128();
+
+            for (; frameIndex + 4 <= frameCount; frameIndex += 4)
+            {
+                __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packedPtr + frameIndex));
+                __m128i evenProducts = _mm_mul_epu32(samples, multiplier);
+                __m128i oddProducts = _mm_mul_epu32(_mm_srli_epi64(samples, 32), _mm_srli_epi64(multiplier, 32));
+                sum = _mm_add_epi32(sum, _mm_add_epi32(evenProducts, oddProducts));
+                multiplier = _mm_add_epi32(multiplier, multiplierStep);
+            }
+
+            uint32_t lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sum);
+            lowSumRef += lanes[0] + lanes[2];
+            highSumRef += lanes[1] + lanes[3];
+        }
+
+        MultiplyAccumulateScalar(packedPtr + frameIndex, frameCount - frameIndex, position + static_cast<uint32_t>(frameIndex), lowSumRef, highSumRef);
+    }
+
+    /// <summary>
+    /// Purpose: The same as MultiplyAccumulateSse2(), using 8 samples per step.
+    /// </summary>
+    CPU_DISPATCH_TARGET("avx2") void MultiplyAccumulateAvx2(const uint32_t* packedPtr, size_t frameCount, uint32_t position, uint32_t& lowSumRef, uint32_t& highSumRef)
+    {
+        size_t frameIndex = 0;
+        if (frameCount >= 8)
+        {
+            __m256i multiplier = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(position)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            const __m256i multiplierStep = _mm256_set1_epi32(8);
+            __m256i sum = _mm256_setzero_si256();
+
+            for (; frameIndex + 8 <= frameCount; frameIndex += 8)
+            {
+                __m256i samples = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(packedPtr + frameIndex));
+                __m256i evenProducts = _mm256_mul_epu32(samples, multiplier);
+                __m256i oddProducts = _mm256_mul_epu32(_mm256_srli_epi64(samples, 32), _mm256_srli_epi64(multiplier, 32));
+                sum = _mm256_add_epi32(sum, _mm256_add_epi32(evenProducts, oddProducts));
+                multiplier = _mm256_add_epi32(multiplier, multiplierStep);
+            }
+
+            uint32_t lanes[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), sum);
+            lowSumRef += lanes[0] + lanes[2] + lanes[4] + lanes[6];
+            highSumRef += lanes[1] + lanes[3] + lanes[5] + lanes[7];
+        }
+
+        MultiplyAccumulateScalar(packedPtr + frameIndex, frameCount - frameIndex, position + static_cast<uint32_t>(frameIndex), lowSumRef, highSumRef);
+    }
+#endif
+
+    typedef uint32_t (*UpdateCrc32Function)(uint32_t crc, const unsigned char* dataPtr, size_t size);
+    typedef void (*MultiplyAccumulateFunction)(const uint32_t* packedPtr, size_t frameCount, uint32_t position, uint32_t& lowSumRef, uint32_t& highSumRef);
+
+    /// <summary>
+    /// Purpose: The kernel variants chosen for the CPU.
+    /// </summary>
+    struct ChecksumKernels
+    {
+        UpdateCrc32Function updateCrc32FunctionPtr{ UpdateCrc32Scalar };
+        MultiplyAccumulateFunction multiplyAccumulateFunctionPtr{ MultiplyAccumulateScalar };
+    };
+
+    ChecksumKernels BindChecksumKernels()
+    {
+        ChecksumKernels kernels{};
+        const char* crc32VariantNamePtr = "SLICING-BY-8";
+        const char* multiplyAccumulateVariantNamePtr = "SCALAR";
+
+        #ifdef CPU_DISPATCH_X86_ENABLED
+        const CpuFeatures& featuresRef = CpuDispatch::GetFeatures();
+        if (featuresRef.pclmul && featuresRef.sse42)
+        {
+            kernels.updateCrc32FunctionPtr = UpdateCrc32Pclmul;
+            crc32VariantNamePtr = "PCLMUL";
+        }
+
+        if (featuresRef.avx2)
+        {
+            kernels.multiplyAccumulateFunctionPtr = MultiplyAccumulateAvx2;
+            multiplyAccumulateVariantNamePtr = "AVX2";
+        }
+        else if (featuresRef.sse2)
+        {
+            kernels.multiplyAccumulateFunctionPtr = MultiplyAccumulateSse2;
+            multiplyAccumulateVariantNamePtr = "SSE2";
+        }
+        #endif
+
+        CpuDispatch::RecordVariant("CRC32", crc32VariantNamePtr);
+        CpuDispatch::RecordVariant("AccurateRip", multiplyAccumulateVariantNamePtr);
+        return kernels;
+    }
+
+    const ChecksumKernels& GetChecksumKernels()
+    {
+        static const ChecksumKernels kernels = BindChecksumKernels(); // Bound once, on first use.
+        return kernels;
+    }
+
+    /// <summary>
+    /// Purpose: Packs a stereo sample as (Right << 16) | Left, which is also the byte order of the samples in a CD Image.
+    /// </summary>
+    inline uint32_t PackSample(int32_t left, int32_t right)
+    {
+        return (static_cast<uint32_t>(right) << 16) | (static_cast<uint32_t>(left) & 0xFFFFUL);
+    }
+}
+
+AccurateRipChecksum::AccurateRipChecksum()
+{
+    this->m_tailRingBuffer.resize(static_cast<size_t>(ACCURATERIP_SKIPPED_FRAME_COUNT));
+}
+
+AccurateRipChecksum::~AccurateRipChecksum()
+{
+
+}
+
+#pragma region Public_Member_Functions_Region
+
+void AccurateRipChecksum::AddPlanar(const int32_t* const channelPtrs[], unsigned long frameCount)
+{
+    this->m_packedScratch.resize(frameCount);
+    const int32_t* leftPtr = channelPtrs[0];
+    const int32_t* rightPtr = channelPtrs[1];
+    uint32_t* packedPtr = this->m_packedScratch.data();
+    size_t frameIndex = 0;
+
+    #ifdef ACCURATERIP_CHECKSUM_SSE2_ENABLED
+    const __m128i lowMask = _mm_set1_epi32(0xFFFF);
+    for (; frameIndex + 4 <= frameCount; frameIndex += 4)
+    {
+        __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(leftPtr + frameIndex));
+        __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rightPtr + frameIndex));
+        __m128i packed = _mm_or_si128(_mm_and_si128(left, lowMask), _mm_slli_epi32(right, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(packedPtr + frameIndex), packed);
+    }
+    #endif
+
+    for (; frameIndex < frameCount; ++frameIndex)
+    {
+        packedPtr[frameIndex] = AccurateRipChecksumSupport::PackSample(leftPtr[frameIndex], rightPtr[frameIndex]);
+    }
+
+    this->AddPacked(packedPtr, frameCount);
+}
+
+void AccurateRipChecksum::AddInterleaved(const int32_t* samplePtr, unsigned long frameCount)
+{
+    this->m_packedScratch.resize(frameCount);
+    uint32_t* packedPtr = this->m_packedScratch.data();
+    size_t frameIndex = 0;
+
+    #ifdef ACCURATERIP_CHECKSUM_SSE2_ENABLED
+    for (; frameIndex + 4 <= frameCount; frameIndex += 4)
+    {
+        // Narrowing the interleaved 32-bit samples to 16-bits gives Left, Right, Left, Right... which is the packed layout.
+        // The samples are 16-bit, so the saturation never changes a value.
+        __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samplePtr + frameIndex * 2));
+        __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samplePtr + frameIndex * 2 + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(packedPtr + frameIndex), _mm_packs_epi32(first, second));
+    }
+    #endif
+
+    for (; frameIndex < frameCount; ++frameIndex)
+    {
+        packedPtr[frameIndex] = AccurateRipChecksumSupport::PackSample(samplePtr[frameIndex * 2], samplePtr[frameIndex * 2 + 1]);
+    }
+
+    this->AddPacked(packedPtr, frameCount);
+}
+
+AccurateRipChecksumResult AccurateRipChecksum::GetResult() const
+{
+    // Sum the products of the last samples, which are excluded from the last Track.
+    uint32_t lastTrackSkippedLowSum = 0UL;
+    uint32_t lastTrackSkippedHighSum = 0UL;
+    unsigned long long tailStart = (this->m_frameCount > ACCURATERIP_SKIPPED_FRAME_COUNT) ? this->m_frameCount - ACCURATERIP_SKIPPED_FRAME_COUNT : 0ULL;
+    for (unsigned long long position = tailStart; position < this->m_frameCount; ++position)
+    {
+        uint64_t product = static_cast<uint64_t>(this->m_tailRingBuffer[static_cast<size_t>(position % ACCURATERIP_SKIPPED_FRAME_COUNT)]) * static_cast<uint32_t>(position + 1ULL);
+        lastTrackSkippedLowSum += static_cast<uint32_t>(product);
+        lastTrackSkippedHighSum += static_cast<uint32_t>(product >> 32);
+    }
+
+    AccurateRipChecksumResult result{};
+    result.frameCount = this->m_frameCount;
+
+    result.accurateRipV1 = this->m_productLowSum;
+    result.accurateRipV1FirstTrack = this->m_productLowSum - this->m_firstTrackSkippedLowSum;
+    result.accurateRipV1LastTrack = this->m_productLowSum - lastTrackSkippedLowSum;
+
+    result.accurateRipV2 = this->m_productLowSum + this->m_productHighSum;
+    result.accurateRipV2FirstTrack = result.accurateRipV2 - (this->m_firstTrackSkippedLowSum + this->m_firstTrackSkippedHighSum);
+    result.accurateRipV2LastTrack = result.accurateRipV2 - (lastTrackSkippedLowSum + lastTrackSkippedHighSum);
+
+    result.crc32 = ~this->m_crc32;
+    return result;
+}
+
+bool AccurateRipChecksum::IsSupportedFormat(unsigned long sampleRate, unsigned long channelCount, unsigned long bitsPerSample)
+{
+    return sampleRate == ACCURATERIP_SAMPLE_RATE && channelCount == ACCURATERIP_CHANNEL_COUNT && bitsPerSample == ACCURATERIP_BITS_PER_SAMPLE;
+}
+
+uint32_t AccurateRipChecksum::UpdateCrc32(uint32_t crc, const unsigned char* dataPtr, size_t size)
+{
+    return AccurateRipChecksumSupport::GetChecksumKernels().updateCrc32FunctionPtr(crc, dataPtr, size);
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+void AccurateRipChecksum::AddPacked(const uint32_t* packedPtr, size_t frameCount)
+{
+    size_t frameIndex = 0;
+    uint32_t lowSum = this->m_productLowSum;
+    uint32_t highSum = this->m_productHighSum;
+
+    // The first samples of the Track are also summed separately, so they can be excluded from the first Track.
+    while (frameIndex < frameCount && this->m_frameCount + frameIndex < AccurateRipChecksumSupport::FIRST_TRACK_SKIPPED_FRAME_COUNT)
+    {
+        uint64_t product = static_cast<uint64_t>(packedPtr[frameIndex]) * static_cast<uint32_t>(this->m_frameCount + frameIndex + 1ULL);
+        this->m_firstTrackSkippedLowSum += static_cast<uint32_t>(product);
+        this->m_firstTrackSkippedHighSum += static_cast<uint32_t>(product >> 32);
+        lowSum += static_cast<uint32_t>(product);
+        highSum += static_cast<uint32_t>(product >> 32);
+        ++frameIndex;
+    }
+
+    const AccurateRipChecksumSupport::ChecksumKernels& kernelsRef = AccurateRipChecksumSupport::GetChecksumKernels();
+    kernelsRef.multiplyAccumulateFunctionPtr(packedPtr + frameIndex, frameCount - frameIndex, static_cast<uint32_t>(this->m_frameCount + frameIndex + 1ULL), lowSum, highSum);
+
+    this->m_productLowSum = lowSum;
+    this->m_productHighSum = highSum;
+
+    // The packed samples are the PCM bytes in CD Image order (16-bit little-endian, Left then Right).
+    this->m_crc32 = kernelsRef.updateCrc32FunctionPtr(this->m_crc32, reinterpret_cast<const unsigned char*>(packedPtr), frameCount * sizeof(uint32_t));
+
+    // Keep the last samples, which are excluded from the last Track.
+    size_t tailCount = (std::min)(frameCount, static_cast<size_t>(ACCURATERIP_SKIPPED_FRAME_COUNT));
+    for (size_t tailIndex = frameCount - tailCount; tailIndex < frameCount; ++tailIndex)
+    {
+        this->m_tailRingBuffer[static_cast<size_t>((this->m_frameCount + tailIndex) % ACCURATERIP_SKIPPED_FRAME_COUNT)] = packedPtr[tailIndex];
+    }
+
+    this->m_frameCount += frameCount;
+}
+
+#pragma endregion Private_Member_Functions_Region
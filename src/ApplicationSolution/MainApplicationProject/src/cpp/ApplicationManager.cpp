@@ -1,4 +1,5 @@
 ﻿#include "ApplicationManager.h"
+#include <cmath>
 
 using namespace std;
 
@@ -34,11 +35,11 @@ MainApplication::ApplicationManager::~ApplicationManager()
         this->executionManagerPtr = nullptr;
     }
 
-    for (map<wstring, list<wstring>*>::const_iterator iterator = this->filenameToErrorListMap.begin(); iterator != this->filenameToErrorListMap.end(); ++iterator)
+    for (map<wstring, list<DecoderErrorRecord>*>::const_iterator iterator = this->filenameToErrorListMap.begin(); iterator != this->filenameToErrorListMap.end(); ++iterator)
     {
         // The current Entry (Key-Value Pair) in the Entry Set.
         wstring key = iterator->first;
-        list<wstring>* value = iterator->second;
+        list<DecoderErrorRecord>* value = iterator->second;
         delete value;
         value = nullptr;
     }
@@ -144,7 +145,7 @@ void MainApplication::ApplicationManager::OpenFileDialogBox()
     ofn.lStructSize = sizeof(ofn); // The length in bytes of the structure.
     ofn.hwndOwner = this->hwndMainApplicationWindow; // Handle to the Parent Window.
     ofn.lpstrTitle = L"Select File(s)"; // Customize the Dialog Title.
-    ofn.lpstrFilter = L"All Supported Types\0*.flac;*.fla;*.mp3;*.mp2;*.m2a;*.wv;*.ogg\0All Files (*.*)\0*.*\0";
+    ofn.lpstrFilter = L"All Supported Types\0*.flac;*.fla;*.mp3;*.mp2;*.m2a;*.wv;*.ogg;*.zip;*.tar;*.m3u;*.m3u8;*.md5;*.sfv;*.ffp;*.xxh64\0All Files (*.*)\0*.*\0";
     ofn.lpstrFile = szFileNamePtr; // Buffer to store the selected File Path.
     ofn.nMaxFile = MAX_BUFFER_SIZE; // The size in characters/bytes of the Buffer pointed to by lpstrFile.
     ofn.Flags = OFN_EXPLORER | OFN_FILEMUSTEXIST | OFN_PATHMUSTEXIST | OFN_ALLOWMULTISELECT | OFN_ENABLESIZING | OFN_HIDEREADONLY | OFN_ENABLEHOOK;
@@ -624,6 +625,30 @@ void MainApplication::ApplicationManager::AddFileSync(const wchar_t* filenamePtr
         // Add Supported Type.
         this->AddToFileList(filenamePtr);
     }
+    else if (ARCHIVE_SCANNING_ENABLED && ArchiveReader::IsArchiveType(filenamePtr))
+    {
+        // Add the Supported Types within the Archive.
+        std::function<void(const wchar_t*)> boundCallback = std::bind(&ApplicationManager::AddToFileList, this, std::placeholders::_1);
+        this->ScanArchiveWithCallback(boundCallback, filenamePtr);
+    }
+    else if (REMOTE_STREAMING_ENABLED && RemoteStreamSource::IsUrlListType(filenamePtr))
+    {
+        // Add the Supported Types listed by URL. Only a URL List that is opened directly is read, NOT one found while scanning a Folder.
+        std::vector<std::wstring> urls{};
+        RemoteStreamSource::ReadUrlList(filenamePtr, urls);
+        for (const std::wstring& urlRef : urls)
+        {
+            if (this->decoderManagerPtr->IsSupportedType(urlRef.c_str()))
+            {
+                this->AddToFileList(urlRef.c_str());
+            }
+        }
+    }
+    else if (SIDECAR_VERIFICATION_ENABLED && SidecarManifest::IsManifestType(filenamePtr))
+    {
+        // The Files listed by the manifest are verified when they are decoded.
+        SidecarManifest::AddManifest(filenamePtr);
+    }
 
     if (setPendingEventFlag == true)
     {
@@ -668,6 +693,10 @@ void MainApplication::ApplicationManager::SetPendingEvent()
         // Start the Timer used to periodically update the progress indicating 
         // the percentage of files that have been processed.
         StartTimer(this->timerStartTickCount);
+
+        // Measure the bytes read, and the size of the System File Cache, from the start of the scan.
+        StreamWrapper::ResetTotalBytesRead();
+        this->systemCacheSizeAtStartIsKnown = WinAPIUtils::GetSystemCacheSize(this->systemCacheSizeAtStart);
     }
     
     SetEvent(this->handlePendingEvent); // Sets the specified Event Object to the 'signaled state' (Available).
@@ -700,8 +729,15 @@ bool MainApplication::ApplicationManager::GetNextAvailableFilename(wstring& file
     }
     else
     {
-        filenameRef = this->listOfFilenames.front(); // Set the filename. (Copy) (Read Shared Data)
-        this->listOfFilenames.pop_front(); // Remove from filename from the List. (Modify Shared Data)
+        list<wstring>::iterator filenameIterator = this->listOfFilenames.begin();
+        if (VOLUME_ADMISSION_ENABLED)
+        {
+            // Prefer a File whose Volume admits another read, so the Thread does NOT wait on a busy Disk while the Files of other Volumes are pending.
+            filenameIterator = this->volumeAdmission.FindAdmissibleFile(this->listOfFilenames, VOLUME_ADMISSION_LOOKAHEAD_FILE_COUNT);
+        }
+
+        filenameRef = *filenameIterator; // Set the filename. (Copy) (Read Shared Data)
+        this->listOfFilenames.erase(filenameIterator); // Remove from filename from the List. (Modify Shared Data)
     }
 
     // Release ownership of the Critical Section.
@@ -717,7 +753,7 @@ bool MainApplication::ApplicationManager::GetNextAvailableFilename(wstring& file
     return wasRemovedFromList;
 }
 
-void MainApplication::ApplicationManager::SetEditWindowText(wchar_t* filenamePtr, wchar_t* errorMessagePtr)
+void MainApplication::ApplicationManager::SetEditWindowText(wchar_t* filenamePtr, DecoderErrorRecord* errorRecordPtr)
 {
     if (filenamePtr != nullptr)
     {
@@ -729,45 +765,28 @@ void MainApplication::ApplicationManager::SetEditWindowText(wchar_t* filenamePtr
         this->editWindowDisplayTextOutput = this->textOutputBuffer;
         
         // Determine the prefix size to use.
-        int prefixSize;
-        if (wcsstr(filenamePtr, FILE_NAMESPACE_UNC_PREFIX) != NULL)
-        {
-            // A substring match was found.
-            prefixSize = FILE_NAMESPACE_UNC_PREFIX_SIZE;
-        }
-        else if (wcsstr(filenamePtr, FILE_NAMESPACE_PREFIX) != NULL)
-        {
-            // A substring match was found.
-            prefixSize = FILE_NAMESPACE_PREFIX_SIZE;
-        }
-        else
-        {
-            // A substring match was NOT found.
-            // Do not adjust the prefix size.
-            prefixSize = 0;
-        }
+        int prefixSize = this->GetFilenamePrefixSize(filenamePtr);
 
         // Move the filename pointer forward the amount of the prefix size, to skip over the prefix characters.
         this->editWindowDisplayTextOutput += (filenamePtr + prefixSize);
 
         this->editWindowDisplayTextOutput += L"\r\n\r\nProcessing... please wait for the Final Report.";
 
-        if (errorMessagePtr != nullptr)
+        if (errorRecordPtr != nullptr)
         {
             wstring key = filenamePtr + prefixSize;
-            wstring value = errorMessagePtr;
             
             // If the Key is found, than the existing value List on the Heap is updated.
             // If the Key is not found a Key is inserted and a Value Pointer is inserted.
-            list<wstring>* valueList = this->filenameToErrorListMap[key]; 
+            list<DecoderErrorRecord>* valueList = this->filenameToErrorListMap[key]; 
             if (valueList == nullptr)
             {
                 // Create a new List (Value) on the Heap. All Lists created on the Heap must be cleaned up.
-                valueList = new list<wstring>;
+                valueList = new list<DecoderErrorRecord>;
                 this->filenameToErrorListMap[key] = valueList; // Update List Pointer (Value) in the Map.
             }
 
-            valueList->push_back(value);
+            valueList->push_back(*errorRecordPtr);
         }
         else
         {
@@ -811,6 +830,44 @@ void MainApplication::ApplicationManager::SetEditWindowText(wchar_t* filenamePtr
 
         // Create Text for Files Passed.
         this->CreateFilePassedText(outputFormat);
+
+        if (PCM_ANALYSIS_ENABLED)
+        {
+            // Create Text for Files with PCM findings.
+            this->CreateFileAnalysisText(outputFormat);
+        }
+
+        if (ACCURATERIP_CHECKSUM_ENABLED)
+        {
+            // Create Text for the checksums of the Files.
+            this->CreateFileChecksumText(outputFormat);
+        }
+
+        if (SIDECAR_VERIFICATION_ENABLED)
+        {
+            // Create Text for the manifest entries that did NOT match.
+            this->CreateSidecarVerificationText(outputFormat);
+        }
+
+        // Create Text for the SIMD kernel variants chosen for the CPU.
+        this->editWindowDisplayTextOutput += STR_CPU_DISPATCH;
+        this->editWindowDisplayTextOutput += CpuDispatch::GetReport();
+
+        if (VOLUME_ADMISSION_ENABLED)
+        {
+            // Create Text for the storage class and the reads of each Volume.
+            this->editWindowDisplayTextOutput += STR_VOLUME_ADMISSION;
+            this->editWindowDisplayTextOutput += this->volumeAdmission.GetReport();
+        }
+
+        // Create Text for the effect of the Cache Policy.
+        this->CreateCachePolicyText();
+
+        if (DECODER_TUNING_ENABLED)
+        {
+            // Create Text for the throughput of each candidate read and unpack size.
+            this->CreateDecoderTuningText();
+        }
     }
 
     // Output the final Text displayed in the Window.
@@ -823,10 +880,65 @@ void MainApplication::ApplicationManager::SetEditWindowText(wchar_t* filenamePtr
         filenamePtr = nullptr;
     }
 
-    if (errorMessagePtr != nullptr)
+    if (errorRecordPtr != nullptr)
+    {
+        delete errorRecordPtr;
+        errorRecordPtr = nullptr;
+    }
+}
+
+void MainApplication::ApplicationManager::AddFileAnalysisResult(wchar_t* filenamePtr, PcmAnalysisResult* analysisResultPtr)
+{
+    if (filenamePtr != nullptr && analysisResultPtr != nullptr)
+    {
+        wstring key = filenamePtr + this->GetFilenamePrefixSize(filenamePtr);
+        this->filenameToAnalysisResultMap[key] = *analysisResultPtr;
+    }
+
+    // Cleanup Allocations on the Heap. These were both allocated in the 'DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)' function.
+    if (filenamePtr != nullptr) {
+        delete[] filenamePtr;
+        filenamePtr = nullptr;
+    }
+
+    if (analysisResultPtr != nullptr)
+    {
+        delete analysisResultPtr;
+        analysisResultPtr = nullptr;
+    }
+}
+
+void MainApplication::ApplicationManager::AddFileChecksumResult(wchar_t* filenamePtr, AccurateRipChecksumResult* checksumResultPtr)
+{
+    if (filenamePtr != nullptr && checksumResultPtr != nullptr)
+    {
+        wstring key = filenamePtr + this->GetFilenamePrefixSize(filenamePtr);
+        this->filenameToChecksumResultMap[key] = *checksumResultPtr;
+    }
+
+    // Cleanup Allocations on the Heap. These were both allocated in the 'DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)' function.
+    if (filenamePtr != nullptr) {
+        delete[] filenamePtr;
+        filenamePtr = nullptr;
+    }
+
+    if (checksumResultPtr != nullptr)
+    {
+        delete checksumResultPtr;
+        checksumResultPtr = nullptr;
+    }
+}
+
+void MainApplication::ApplicationManager::AddTruncatedFile(wchar_t* filenamePtr)
+{
+    if (filenamePtr != nullptr)
     {
-        delete[] errorMessagePtr;
-        errorMessagePtr = nullptr;
+        wstring key = filenamePtr + this->GetFilenamePrefixSize(filenamePtr);
+        this->truncatedFilenameSet.insert(key);
+
+        // Cleanup Allocations on the Heap. This was allocated in the 'DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)' function.
+        delete[] filenamePtr;
+        filenamePtr = nullptr;
     }
 }
 
@@ -950,10 +1062,177 @@ wchar_t* MainApplication::ApplicationManager::GetSecondCommandLineArgument()
     return bufferPtr;
 }
 
-std::unique_ptr<PureAbstractBaseDecoder> MainApplication::ApplicationManager::OpenDecoder(const wchar_t* filenamePtr)
+unsigned long MainApplication::ApplicationManager::ReserveDecoderThreads(const wchar_t* filenamePtr)
+{
+    // Only the Decoders that split a File into Segments, or run a PCM Pipeline, can use more than the Decoder Thread.
+    unsigned long usableThreadCount = this->decoderManagerPtr->GetUsableSpareThreadCount(filenamePtr, static_cast<unsigned long>(this->maxCPUCount));
+
+    // The size is read before the Critical Section is entered. It was added to the queued bytes when the File was queued.
+    unsigned long long fileSize = 0ULL;
+    WinAPIUtils::GetFileSize(filenamePtr, fileSize);
+
+    // Request ownership of the Critical Section.
+    EnterCriticalSection(this->criticalSectionPtr);
+
+    // Access the Shared Resource.
+    this->queuedByteCount = (fileSize < this->queuedByteCount) ? (this->queuedByteCount - fileSize) : 0ULL; // (Modify Shared Data)
+
+    // Each queued File will need a CPU of its own, and the Files being decoded (with the Threads lent to them) already use theirs.
+    // Only the CPUs left over are idle at the end of the queue, so only they can be lent to the current File.
+    this->busyThreadCount += 1UL; // (Modify Shared Data)
+    unsigned long long committedThreadCount = static_cast<unsigned long long>(this->busyThreadCount) + this->listOfFilenames.size();
+    unsigned long spareThreadCount = (committedThreadCount < this->maxCPUCount) ? static_cast<unsigned long>(this->maxCPUCount - committedThreadCount) : 0UL;
+
+    unsigned long lentThreadCount = 0UL;
+    if (spareThreadCount > 0UL && usableThreadCount > 0UL && fileSize > 0ULL)
+    {
+        // The spare CPUs are lent in proportion to the share of the File in the bytes still to be read, so a File that is small
+        // next to the queued Files does NOT take the CPUs the larger Files could use once they are dequeued.
+        lentThreadCount = static_cast<unsigned long>((static_cast<double>(spareThreadCount) * static_cast<double>(fileSize)) / static_cast<double>(fileSize + this->queuedByteCount));
+        lentThreadCount = (lentThreadCount < usableThreadCount) ? lentThreadCount : usableThreadCount;
+
+        // Reserve the lent CPUs, so the next File does NOT count them as idle.
+        this->busyThreadCount += lentThreadCount; // (Modify Shared Data)
+    }
+
+    // Release ownership of the Critical Section.
+    LeaveCriticalSection(this->criticalSectionPtr);
+
+    return 1UL + lentThreadCount;
+}
+
+std::unique_ptr<PureAbstractBaseDecoder> MainApplication::ApplicationManager::OpenDecoder(const wchar_t* filenamePtr, unsigned long reservedThreadCount)
 {
     // Delegate to the Decoder Manager.
-    return this->decoderManagerPtr->OpenDecoderSmartPointer(filenamePtr);
+    return this->decoderManagerPtr->OpenDecoderSmartPointer(filenamePtr, reservedThreadCount);
+}
+
+void MainApplication::ApplicationManager::ReleaseDecoderThreads(unsigned long reservedThreadCount)
+{
+    // Request ownership of the Critical Section.
+    EnterCriticalSection(this->criticalSectionPtr);
+
+    // Access the Shared Resource.
+    this->busyThreadCount = (reservedThreadCount < this->busyThreadCount) ? (this->busyThreadCount - reservedThreadCount) : 0UL; // (Modify Shared Data)
+
+    // Release ownership of the Critical Section.
+    LeaveCriticalSection(this->criticalSectionPtr);
+}
+
+unique_ptr<PureAbstractBaseDecoder> MainApplication::ApplicationManager::OpenAdmittedDecoder(const wchar_t* filenamePtr, unsigned long reservedThreadCount)
+{
+    // Waits for a free read on the Volume of the File. The File is read into its Memory Buffer while it is opened, so the read ends when the Decoder is open.
+    // The admission is released before the File is decoded, so a rotational Disk admitting a single read still has its Files decoded concurrently.
+    VolumeAdmissionTicket admissionTicket = this->volumeAdmission.Admit(filenamePtr);
+    unique_ptr<PureAbstractBaseDecoder> decoderSmartPtr = this->OpenDecoder(filenamePtr, reservedThreadCount);
+    this->volumeAdmission.Release(admissionTicket);
+
+    return decoderSmartPtr;
+}
+
+void MainApplication::ApplicationManager::TuneDecoder(const wchar_t* filenamePtr)
+{
+    DecoderType decoderType = DecoderRegistry::FindByExtension(filenamePtr);
+    unsigned long sampleIndex = 0UL;
+    if (!this->decoderTuner.AcceptSample(decoderType, DECODER_TUNING_SAMPLE_STRIDE, DECODER_TUNING_SAMPLE_FILE_COUNT, sampleIndex))
+    {
+        // The File is NOT part of the sample.
+        return;
+    }
+
+    // The throughput is measured in bytes of the File, so the Files of every Decoder are on the same scale.
+    unsigned long long fileSize = 0ULL;
+    if (!WinAPIUtils::GetFileSize(filenamePtr, fileSize))
+    {
+        return;
+    }
+
+    // The File is decoded once before it is timed, so every candidate reads it from the OS File Cache, instead of only the candidates timed after the first.
+    double seconds = 0.0;
+    if (!this->DecodeForTuning(filenamePtr, DecoderTuning::GetProfile(), seconds))
+    {
+        // The File can NOT be decoded. Its error is reported when the File is verified.
+        return;
+    }
+
+    // Only the Decoders run by more than one Thread read their Files into a Memory Buffer.
+    const bool memoryBufferIsEnabled = this->maxCPUCount > 1UL;
+    for (size_t parameterIndex = 0; parameterIndex < DECODER_TUNING_PARAMETER_COUNT; ++parameterIndex)
+    {
+        DecoderTuningParameter parameter = static_cast<DecoderTuningParameter>(parameterIndex);
+        if (!DecoderTuning::IsUsedByDecoder(parameter, decoderType, memoryBufferIsEnabled))
+        {
+            continue;
+        }
+
+        // One parameter is changed at a time, from the current profile. The order of the candidates is rotated for each sampled File,
+        // so the same candidate is NOT always timed first (e.g. while the other Decoder Threads are still starting).
+        const std::vector<unsigned long>& candidateValuesRef = DecoderTuning::GetCandidateValues(parameter);
+        for (size_t candidateIndex = 0; candidateIndex < candidateValuesRef.size(); ++candidateIndex)
+        {
+            unsigned long value = candidateValuesRef[(candidateIndex + sampleIndex) % candidateValuesRef.size()];
+            DecoderTuningProfile candidateProfile = DecoderTuning::GetProfile();
+            DecoderTuning::SetValue(candidateProfile, parameter, value);
+
+            if (!this->DecodeForTuning(filenamePtr, candidateProfile, seconds))
+            {
+                return;
+            }
+
+            this->decoderTuner.AddMeasurement(parameter, value, fileSize, seconds);
+        }
+    }
+}
+
+bool MainApplication::ApplicationManager::DecodeForTuning(const wchar_t* filenamePtr, const DecoderTuningProfile& profileRef, double& secondsRef)
+{
+    // The Decoder reads the candidate values when it is opened, and on the calling Thread only.
+    DecoderTuningScope tuningScope(profileRef);
+
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/profileapi/nf-profileapi-queryperformancecounter
+    LARGE_INTEGER counterFrequency{};
+    LARGE_INTEGER startCounter{};
+    LARGE_INTEGER endCounter{};
+    QueryPerformanceFrequency(&counterFrequency);
+    QueryPerformanceCounter(&startCounter);
+
+    // Opened like every other Decoder, so the reads of the tuning mode are admitted with the other reads of the Volume.
+    unique_ptr<PureAbstractBaseDecoder> decoderSmartPtr{};
+    if (VOLUME_ADMISSION_ENABLED)
+    {
+        VolumeAdmissionTicket admissionTicket = this->volumeAdmission.Admit(filenamePtr);
+        decoderSmartPtr = this->decoderManagerPtr->OpenDecoderSmartPointer(filenamePtr);
+        this->volumeAdmission.Release(admissionTicket);
+    }
+    else
+    {
+        EnterCriticalSection(this->criticalSectionPtr);
+        decoderSmartPtr = this->decoderManagerPtr->OpenDecoderSmartPointer(filenamePtr);
+        LeaveCriticalSection(this->criticalSectionPtr);
+    }
+
+    if (decoderSmartPtr == nullptr)
+    {
+        return false;
+    }
+
+    unsigned long long decodedAudioDataTotal = decoderSmartPtr->GetDecodedAudioDataTotal();
+    const unsigned long long audioUnitBudget = (decodedAudioDataTotal / DECODE_PROGRESS_STEP_COUNT > 0ULL) ? (decodedAudioDataTotal / DECODE_PROGRESS_STEP_COUNT) : 1ULL;
+    long long audioUnitSizeRead = 0LL;
+    do
+    {
+        if (WaitForSingleObject(this->handleTerminateEvent, 0) == WAIT_OBJECT_0)
+        {
+            // The Decoder Threads are terminating.
+            return false;
+        }
+
+        audioUnitSizeRead = decoderSmartPtr->Decode(audioUnitBudget, DECODE_TIME_BUDGET_MILLISECONDS);
+    } while (audioUnitSizeRead > 0LL);
+
+    QueryPerformanceCounter(&endCounter);
+    secondsRef = static_cast<double>(endCounter.QuadPart - startCounter.QuadPart) / static_cast<double>(counterFrequency.QuadPart);
+    return audioUnitSizeRead == 0LL;
 }
 
 void MainApplication::ApplicationManager::IncrementFilesProcessed()
@@ -1044,6 +1323,8 @@ void MainApplication::ApplicationManager::ClearListOfFilenames()
     
     // Access the Shared Resource.
     this->listOfFilenames.clear(); // (Modify Shared Data)
+    this->queuedByteCount = 0ULL; // (Modify Shared Data)
+    this->volumeAdmission.ClearFiles();
 
     // Release ownership of the Critical Section.
     LeaveCriticalSection(this->criticalSectionPtr);
@@ -1302,6 +1583,32 @@ void MainApplication::ApplicationManager::ApplicationManagerStartup()
         this->maxCPUCount = 1UL;
     }
 
+    // Load the Decoder tuning profile of this machine, before any File is opened. The default sizes are used until a profile is saved by the tuning mode.
+    this->decoderTuningProfileFilename = this->GetDecoderTuningProfileFilename();
+    DecoderTuningProfile tuningProfile{};
+    DecoderTuning::LoadProfile(this->decoderTuningProfileFilename.c_str(), tuningProfile);
+    DecoderTuning::SetProfile(tuningProfile);
+
+    // Configure the number of concurrent reads of each Volume.
+    VolumeAdmissionLimits admissionLimits{};
+    admissionLimits.rotationalLimit = VOLUME_ADMISSION_ROTATIONAL_LIMIT;
+    admissionLimits.solidStateLimit = VOLUME_ADMISSION_SOLID_STATE_LIMIT;
+    admissionLimits.networkLimit = VOLUME_ADMISSION_NETWORK_LIMIT;
+    this->volumeAdmission.Configure(admissionLimits, VOLUME_STORAGE_CLASS_OVERRIDES);
+    this->volumeAdmission.SetExtentOrderingEnabled(VOLUME_ADMISSION_ENABLED && EXTENT_ORDERED_READING_ENABLED, EXTENT_ORDER_COMPARISON_ENABLED);
+
+    // Set how the Decoders use the System File Cache.
+    StreamWrapper::SetCachePolicy(STREAM_CACHE_POLICY);
+    StreamWrapper::SetSparseLoading(SPARSE_LOADING_ENABLED, SPARSE_LOADING_MINIMUM_SKIP_SIZE, SPARSE_LOADING_FRAMING_VALIDATION_ENABLED);
+
+    // Set the range requests of the Files on web servers.
+    RemoteStreamSettings remoteStreamSettings{};
+    remoteStreamSettings.rangeSize = REMOTE_STREAM_RANGE_SIZE;
+    remoteStreamSettings.prefetchRangeCount = REMOTE_STREAM_PREFETCH_RANGE_COUNT;
+    remoteStreamSettings.windowRangeCount = REMOTE_STREAM_WINDOW_RANGE_COUNT;
+    remoteStreamSettings.injectedLatencyMilliseconds = REMOTE_STREAM_INJECTED_LATENCY_MILLISECONDS;
+    RemoteStreamSource::Configure(remoteStreamSettings);
+
     // Configure the Decoder Memory Buffers.
     if (this->maxCPUCount > 1UL)
     {
@@ -1313,6 +1620,36 @@ void MainApplication::ApplicationManager::ApplicationManagerStartup()
         // Opened Decoders will NOT use Memory Buffers.
         this->decoderManagerPtr->SetDecoderMemoryBufferEnabled(false);
     }
+
+    // Configure the MP3 verification tier.
+    this->decoderManagerPtr->SetMP3DeepDecodeEnabled(MP3_DEEP_DECODE_ENABLED);
+
+    // Configure sampled verification.
+    unsigned long windowCount = 0UL;
+    if (SAMPLED_VERIFICATION_ENABLED)
+    {
+        windowCount = (SAMPLED_VERIFICATION_WINDOW_COUNT > 0UL) ? SAMPLED_VERIFICATION_WINDOW_COUNT
+            : SampledVerificationPlan::CalculateWindowCount(SAMPLED_VERIFICATION_CONFIDENCE, SAMPLED_VERIFICATION_DAMAGED_FRACTION);
+    }
+    this->decoderManagerPtr->SetSampledVerificationWindowCount(windowCount);
+
+    // Configure the PCM analysis.
+    this->decoderManagerPtr->SetPcmAnalysisEnabled(PCM_ANALYSIS_ENABLED);
+
+    // Configure the AccurateRip checksums.
+    this->decoderManagerPtr->SetAccurateRipChecksumEnabled(ACCURATERIP_CHECKSUM_ENABLED);
+
+    // Configure how the Decoder of each File is chosen.
+    this->decoderManagerPtr->SetMagicByteSniffingEnabled(MAGIC_BYTE_SNIFFING_ENABLED);
+
+    // Configure the MD5 signature hashing. With a single Decoder Thread, there is only one File to hash at a time.
+    this->decoderManagerPtr->SetMultiBufferMD5Enabled(MULTI_BUFFER_MD5_ENABLED && this->maxCPUCount > 1UL);
+
+    // Configure the second Thread per File, used when a File is given a spare CPU.
+    this->decoderManagerPtr->SetPcmPipelineEnabled(PCM_PIPELINE_ENABLED);
+
+    // Limit the SIMD kernel variants, before any File is decoded.
+    CpuDispatch::Initialize(CPU_DISPATCH_LEVEL);
 }
 
 void MainApplication::ApplicationManager::CreateSynchronizationSupport(HANDLE& handleTerminateEventRef, HANDLE& handlePendingEventRef)
@@ -1481,9 +1818,13 @@ void MainApplication::ApplicationManager::ScanFolderAsync(const wchar_t* folderP
         // Splice Operation Time Complexity: O(1) Constant Time.
         // URI: https://cplusplus.com/reference/list/list/splice/
         this->listOfFilenames.splice(std::end(this->listOfFilenames), this->executionManagerPtr->GetProcessedFileListRef()); // (Modify Shared Data)
+        this->queuedByteCount += this->executionManagerPtr->GetProcessedByteCount(); // (Modify Shared Data)
 
         // After splicing the Lists together, the Execution Manager List of processed File names should be empty.
         assert(this->executionManagerPtr->GetProcessedFileListRef().empty());
+
+        // Reset the size of the processed Files, which now belong to the queue.
+        this->executionManagerPtr->ClearProcessedFileList();
         
         this->totalFilesToProcess += processedFileListSize;  // (Modify Shared Data)
 
@@ -1570,6 +1911,16 @@ void MainApplication::ApplicationManager::rScanFolderWithCallback(const std::fun
                     // Use the Callback Function to perform an operation on the Supported Type (e.g. Adding a Supported Type to a List).
                     boundCallbackRef(pathName.c_str());
                 }
+                else if (ARCHIVE_SCANNING_ENABLED && ArchiveReader::IsArchiveType(pathName.c_str()))
+                {
+                    // The Archive is scanned like a Folder.
+                    this->ScanArchiveWithCallback(boundCallbackRef, pathName.c_str());
+                }
+                else if (SIDECAR_VERIFICATION_ENABLED && SidecarManifest::IsManifestType(pathName.c_str()))
+                {
+                    // The manifest is read before the Decoder Threads start, so the Files it lists are hashed as they are read.
+                    SidecarManifest::AddManifest(pathName.c_str());
+                }
             }
 
             // Continue the File Search.
@@ -1585,8 +1936,44 @@ void MainApplication::ApplicationManager::rScanFolderWithCallback(const std::fun
     // No Files were found in the current Directory. (Base Case)
 }
 
+void MainApplication::ApplicationManager::ScanArchiveWithCallback(const std::function<void(const wchar_t*)>& boundCallbackRef, const wchar_t* archiveFilenamePtr)
+{
+    // Only the directory of the Archive is read. A damaged Archive lists NO members.
+    std::vector<ArchiveMember> members{};
+    if (!ArchiveReader::ListMembers(archiveFilenamePtr, members))
+    {
+        return;
+    }
+
+    wstring memberPathPrefix = wstring(archiveFilenamePtr) + ARCHIVE_MEMBER_SEPARATOR;
+    for (const ArchiveMember& memberRef : members)
+    {
+        // Check for the Stopping State.
+        if (this->IsStoppingStateFlagEnabled())
+        {
+            break;
+        }
+
+        wstring memberPath = memberPathPrefix + memberRef.name;
+        if (this->decoderManagerPtr->IsSupportedType(memberPath.c_str()))
+        {
+            boundCallbackRef(memberPath.c_str());
+        }
+    }
+}
+
 void MainApplication::ApplicationManager::AddToFileList(const wchar_t* filenamePtr)
 {
+    if (VOLUME_ADMISSION_ENABLED)
+    {
+        // Read the physical location of the File, before the File can be taken by a Decoder Thread. (Thread-safe)
+        this->volumeAdmission.AddFile(filenamePtr);
+    }
+
+    // The size is read before the Critical Section is entered.
+    unsigned long long fileSize = 0ULL;
+    WinAPIUtils::GetFileSize(filenamePtr, fileSize);
+
     // Request ownership of the Critical Section.
     EnterCriticalSection(this->criticalSectionPtr);
     
@@ -1594,6 +1981,7 @@ void MainApplication::ApplicationManager::AddToFileList(const wchar_t* filenameP
 
     // Copies the C-style String to a new wstring object in the List.
     this->listOfFilenames.push_back(filenamePtr); // (Modify Shared Data)
+    this->queuedByteCount += fileSize; // (Modify Shared Data)
     this->totalFilesToProcess++;  // (Modify Shared Data)
     
     // Release ownership of the Critical Section.
@@ -1742,32 +2130,51 @@ void MainApplication::ApplicationManager::ResetEditWindowSuppport()
     this->filePassedList.clear();
 
     // Clean up the Heap Memory used for the Map.
-    for (map<wstring, list<wstring>*>::const_iterator iterator = this->filenameToErrorListMap.begin(); iterator != this->filenameToErrorListMap.end(); ++iterator)
+    for (map<wstring, list<DecoderErrorRecord>*>::const_iterator iterator = this->filenameToErrorListMap.begin(); iterator != this->filenameToErrorListMap.end(); ++iterator)
     {
         // The current Entry (Key-Value Pair) in the Entry Set.
         wstring key = iterator->first;
-        list<wstring>* value = iterator->second;
+        list<DecoderErrorRecord>* value = iterator->second;
         delete value;
         value = nullptr;
     }
 
     this->filenameToErrorListMap.clear();
+    SidecarManifest::Clear();
+    this->filenameToAnalysisResultMap.clear();
+    this->filenameToChecksumResultMap.clear();
+    this->truncatedFilenameSet.clear();
 }
 
 void MainApplication::ApplicationManager::CreateFileErroredText(wchar_t* outputFormat)
 {
     // Create Text for Files Errored.
     size_t errorCount = this->filenameToErrorListMap.size(); // NOTE: size_t varies in size on 32-bit and 64-bit platforms.
-    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, outputFormat, errorCount, (errorCount == 1) ? (STR_FILE) : (STR_FILES), STR_ERROR);  // Write to the buffer.
+    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, outputFormat, errorCount, (errorCount == 1) ? (STR_FILE) : (STR_FILES), SAMPLED_VERIFICATION_ENABLED ? STR_SAMPLED_ERROR : STR_ERROR);  // Write to the buffer.
 
     this->editWindowDisplayTextOutput += this->textOutputBuffer;
 
-    // Iterate over the Entry Set of the Map.
-    for (map<wstring, list<wstring>*>::const_iterator iterator = this->filenameToErrorListMap.begin(); iterator != this->filenameToErrorListMap.end(); ++iterator)
+    // The number of errors of each type, used for the summary.
+    unsigned long long errorCodeCounts[static_cast<size_t>(DecoderErrorCode::COUNT)]{};
+    wchar_t errorText[MAX_ERROR_SIZE]{};
+
+    // Order the Entry Set of the Map. The Files found truncated by the quick tail-only check are listed first, since they are the most common damage.
+    // Otherwise, the Map is sorted by filename.
+    typedef map<wstring, list<DecoderErrorRecord>*>::const_iterator EntryIterator;
+    list<EntryIterator> entryList{};
+    list<EntryIterator> truncatedEntryList{};
+    for (EntryIterator iterator = this->filenameToErrorListMap.begin(); iterator != this->filenameToErrorListMap.end(); ++iterator)
+    {
+        ((this->truncatedFilenameSet.count(iterator->first) > 0) ? truncatedEntryList : entryList).push_back(iterator);
+    }
+    entryList.splice(entryList.begin(), truncatedEntryList);
+
+    // Iterate over the ordered Entry Set of the Map.
+    for (list<EntryIterator>::const_iterator entryIterator = entryList.begin(); entryIterator != entryList.end(); ++entryIterator)
     {
         // The current Entry (Key-Value Pair) in the Entry Set.
-        wstring key = iterator->first;
-        list<wstring>* value = iterator->second;
+        wstring key = (*entryIterator)->first;
+        list<DecoderErrorRecord>* value = (*entryIterator)->second;
 
         // Add the filename to the output.
         this->editWindowDisplayTextOutput += L"\r\n";
@@ -1776,12 +2183,29 @@ void MainApplication::ApplicationManager::CreateFileErroredText(wchar_t* outputF
         if (!value->empty())
         {
             // Iterate over the value List.
-            for (list<wstring>::const_iterator it = value->begin(); it != value->end(); ++it)
+            for (list<DecoderErrorRecord>::const_iterator it = value->begin(); it != value->end(); ++it)
             {
-                // Add each error message for the filename to the output.
+                // Render each Error Record for the filename to the output.
+                DecoderErrorLog::Render(*it, errorText, MAX_ERROR_SIZE);
                 this->editWindowDisplayTextOutput += L"\t<";
-                this->editWindowDisplayTextOutput += *it;
+                this->editWindowDisplayTextOutput += errorText;
                 this->editWindowDisplayTextOutput += L">";
+
+                errorCodeCounts[static_cast<size_t>(it->code)]++;
+            }
+        }
+    }
+
+    if (errorCount > 1)
+    {
+        // Create Text for the number of errors of each type.
+        this->editWindowDisplayTextOutput += STR_ERROR_SUMMARY;
+        for (size_t codeIndex = 1; codeIndex < static_cast<size_t>(DecoderErrorCode::COUNT); codeIndex++)
+        {
+            if (errorCodeCounts[codeIndex] > 0ULL)
+            {
+                swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, STR_ERROR_SUMMARY_ENTRY, errorCodeCounts[codeIndex], DecoderErrorLog::GetCodeName(static_cast<DecoderErrorCode>(codeIndex))); // Write to the buffer.
+                this->editWindowDisplayTextOutput += this->textOutputBuffer;
             }
         }
     }
@@ -1791,7 +2215,7 @@ void MainApplication::ApplicationManager::CreateFilePassedText(wchar_t* outputFo
 {
     // Create Text for Files Passed.
     size_t passCount = this->filePassedList.size(); // NOTE: size_t varies in size on 32-bit and 64-bit platforms.
-    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, outputFormat, passCount, (passCount == 1) ? (STR_FILE) : (STR_FILES), STR_PASS); // Write to the buffer.
+    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, outputFormat, passCount, (passCount == 1) ? (STR_FILE) : (STR_FILES), SAMPLED_VERIFICATION_ENABLED ? STR_SAMPLED_PASS : STR_PASS); // Write to the buffer.
 
     this->editWindowDisplayTextOutput += this->textOutputBuffer;
     this->filePassedList.sort();
@@ -1802,6 +2226,226 @@ void MainApplication::ApplicationManager::CreateFilePassedText(wchar_t* outputFo
     }
 }
 
+void MainApplication::ApplicationManager::CreateFileAnalysisText(wchar_t* outputFormat)
+{
+    wstring findingsText{};
+    size_t findingsCount = 0; // NOTE: size_t varies in size on 32-bit and 64-bit platforms.
+
+    // Iterate over the Entry Set of the Map. The Map is sorted by filename.
+    for (map<wstring, PcmAnalysisResult>::const_iterator iterator = this->filenameToAnalysisResultMap.begin(); iterator != this->filenameToAnalysisResultMap.end(); ++iterator)
+    {
+        const PcmAnalysisResult& result = iterator->second;
+        const bool fileIsSilent = (result.frameCount > 0ULL && result.silentFrameCount == result.frameCount);
+        const double longestSilenceSeconds = (result.sampleRate > 0UL) ? static_cast<double>(result.longestSilentRunFrameCount) / result.sampleRate : 0.0;
+        const bool silenceIsLong = !fileIsSilent && longestSilenceSeconds >= PCM_ANALYSIS_SILENCE_THRESHOLD_SECONDS;
+        const bool dcOffsetIsLarge = result.dcOffset >= PCM_ANALYSIS_DC_OFFSET_THRESHOLD;
+
+        if (result.clippedRunCount == 0ULL && !dcOffsetIsLarge && !silenceIsLong && !fileIsSilent && !result.isDualMono)
+        {
+            // Nothing to report.
+            continue;
+        }
+
+        findingsCount++;
+        findingsText += L"\r\n";
+        findingsText += iterator->first;
+
+        // The Peak is listed with every finding, since it helps to judge the finding (e.g. clipping at a low Peak is NOT possible).
+        if (result.peak > 0.0)
+        {
+            swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, L"\t<PEAK %.2f dBFS>", 20.0 * log10(result.peak)); // Write to the buffer.
+            findingsText += this->textOutputBuffer;
+        }
+
+        if (result.clippedRunCount > 0ULL)
+        {
+            swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, L"\t<%llu %s>", result.clippedRunCount, (result.clippedRunCount == 1ULL) ? L"CLIPPED_RUN" : L"CLIPPED_RUNS"); // Write to the buffer.
+            findingsText += this->textOutputBuffer;
+        }
+
+        if (dcOffsetIsLarge)
+        {
+            swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, L"\t<DC_OFFSET %.2f%%>", result.dcOffset * 100.0); // Write to the buffer.
+            findingsText += this->textOutputBuffer;
+        }
+
+        if (fileIsSilent)
+        {
+            findingsText += L"\t<FULLY_SILENT>";
+        }
+        else if (silenceIsLong)
+        {
+            unsigned long long silenceSeconds = static_cast<unsigned long long>(longestSilenceSeconds);
+            swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, L"\t<DIGITAL_SILENCE %llum %02llus>", silenceSeconds / 60ULL, silenceSeconds % 60ULL); // Write to the buffer.
+            findingsText += this->textOutputBuffer;
+        }
+
+        if (result.isDualMono)
+        {
+            findingsText += L"\t<DUAL_MONO>";
+        }
+    }
+
+    // Create Text for Files with PCM findings.
+    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, outputFormat, findingsCount, (findingsCount == 1) ? (STR_FILE) : (STR_FILES), STR_PCM_FINDINGS); // Write to the buffer.
+    this->editWindowDisplayTextOutput += this->textOutputBuffer;
+    this->editWindowDisplayTextOutput += findingsText;
+}
+
+void MainApplication::ApplicationManager::CreateFileChecksumText(wchar_t* outputFormat)
+{
+    // Create Text for the checksums of the Files.
+    size_t checksumCount = this->filenameToChecksumResultMap.size(); // NOTE: size_t varies in size on 32-bit and 64-bit platforms.
+    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, outputFormat, checksumCount, (checksumCount == 1) ? (STR_FILE) : (STR_FILES), STR_ACCURATERIP_CHECKSUMS); // Write to the buffer.
+    this->editWindowDisplayTextOutput += this->textOutputBuffer;
+
+    // Iterate over the Entry Set of the Map. The Map is sorted by filename.
+    for (map<wstring, AccurateRipChecksumResult>::const_iterator iterator = this->filenameToChecksumResultMap.begin(); iterator != this->filenameToChecksumResultMap.end(); ++iterator)
+    {
+        const AccurateRipChecksumResult& result = iterator->second;
+
+        this->editWindowDisplayTextOutput += L"\r\n";
+        this->editWindowDisplayTextOutput += iterator->first;
+
+        // The AccurateRip checksums are listed for a middle Track, then for the first Track and the last Track of a Disc.
+        swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, STR_ACCURATERIP_CHECKSUM_ENTRY, result.crc32,
+            result.accurateRipV1, result.accurateRipV1FirstTrack, result.accurateRipV1LastTrack,
+            result.accurateRipV2, result.accurateRipV2FirstTrack, result.accurateRipV2LastTrack); // Write to the buffer.
+        this->editWindowDisplayTextOutput += this->textOutputBuffer;
+    }
+}
+
+void MainApplication::ApplicationManager::CreateSidecarVerificationText(wchar_t* outputFormat)
+{
+    std::vector<SidecarEntryResult> results = SidecarManifest::GetResults();
+    if (results.empty())
+    {
+        return; // NO manifests were found.
+    }
+
+    // A File that was NOT scanned (e.g. a File of an unsupported type, listed by the same manifest) is NOT listed.
+    std::wstring entriesText{};
+    size_t unmatchedCount = 0;
+    unsigned long long matchedCount = 0ULL;
+    for (const SidecarEntryResult& resultRef : results)
+    {
+        if (resultRef.verdict == SidecarVerdict::MATCH)
+        {
+            ++matchedCount;
+            continue;
+        }
+
+        if (resultRef.verdict == SidecarVerdict::NOT_VERIFIED && !this->decoderManagerPtr->IsSupportedType(resultRef.filename.c_str()))
+        {
+            continue;
+        }
+
+        ++unmatchedCount;
+        entriesText += L"\r\n";
+        entriesText += resultRef.filename.c_str() + this->GetFilenamePrefixSize(resultRef.filename.c_str());
+
+        swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, STR_SIDECAR_CHECKSUM_ENTRY, FileHasher::GetAlgorithmName(resultRef.algorithm),
+            (resultRef.verdict == SidecarVerdict::MISMATCH) ? L"MISMATCH" : L"NOT_VERIFIED"); // Write to the buffer.
+        entriesText += this->textOutputBuffer;
+        entriesText += resultRef.manifestFilename.c_str() + this->GetFilenamePrefixSize(resultRef.manifestFilename.c_str()); // The filename can be longer than the buffer.
+    }
+
+    // NOTE: size_t varies in size on 32-bit and 64-bit platforms.
+    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, outputFormat, unmatchedCount, (unmatchedCount == 1) ? (STR_FILE) : (STR_FILES), STR_SIDECAR_CHECKSUMS); // Write to the buffer.
+    this->editWindowDisplayTextOutput += this->textOutputBuffer;
+    this->editWindowDisplayTextOutput += entriesText;
+
+    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, STR_SIDECAR_CHECKSUM_MATCHES, matchedCount, (matchedCount == 1ULL) ? L"checksum" : L"checksums"); // Write to the buffer.
+    this->editWindowDisplayTextOutput += this->textOutputBuffer;
+}
+
+void MainApplication::ApplicationManager::CreateDecoderTuningText()
+{
+    // The fastest sizes are used from the next scan, and saved for the next startup.
+    DecoderTuningProfile bestProfile = this->decoderTuner.GetBestProfile(DecoderTuning::GetProfile());
+    DecoderTuning::SetProfile(bestProfile);
+    bool profileIsSaved = !this->decoderTuningProfileFilename.empty() && DecoderTuning::SaveProfile(this->decoderTuningProfileFilename.c_str(), bestProfile);
+
+    unsigned long sampleCount = this->decoderTuner.GetSampleCount();
+    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, STR_DECODER_TUNING, sampleCount, (sampleCount == 1UL) ? (STR_FILE) : (STR_FILES),
+        profileIsSaved ? (STR_DECODER_TUNING_SAVED) : (STR_DECODER_TUNING_NOT_SAVED)); // Write to the buffer.
+    this->editWindowDisplayTextOutput += this->textOutputBuffer;
+    this->editWindowDisplayTextOutput += this->decoderTuningProfileFilename; // The filename can be longer than the buffer.
+
+    this->editWindowDisplayTextOutput += this->decoderTuner.GetThroughputCurve(bestProfile);
+}
+
+void MainApplication::ApplicationManager::CreateCachePolicyText()
+{
+    const double BYTES_PER_MEGABYTE = 1000000.0;
+    double megabytesRead = StreamWrapper::GetTotalBytesRead() / BYTES_PER_MEGABYTE;
+    double megabytesPerSecond = (this->elapsedTimerCount > 0.0f) ? (megabytesRead / this->elapsedTimerCount) : 0.0;
+
+    swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, STR_CACHE_POLICY, StreamWrapper::GetCachePolicyName(StreamWrapper::GetCachePolicy()),
+        megabytesRead, megabytesPerSecond); // Write to the buffer.
+    this->editWindowDisplayTextOutput += this->textOutputBuffer;
+
+    if (SPARSE_LOADING_ENABLED)
+    {
+        swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, STR_SPARSE_LOADING, StreamWrapper::GetTotalBytesSkipped() / BYTES_PER_MEGABYTE); // Write to the buffer.
+        this->editWindowDisplayTextOutput += this->textOutputBuffer;
+    }
+
+    unsigned long long systemCacheSizeAtEnd = 0ULL;
+    if (this->systemCacheSizeAtStartIsKnown && WinAPIUtils::GetSystemCacheSize(systemCacheSizeAtEnd))
+    {
+        swprintf(this->textOutputBuffer, MAX_TEXT_SIZE, STR_CACHE_POLICY_RESIDENCY,
+            this->systemCacheSizeAtStart / BYTES_PER_MEGABYTE, systemCacheSizeAtEnd / BYTES_PER_MEGABYTE); // Write to the buffer.
+        this->editWindowDisplayTextOutput += this->textOutputBuffer;
+    }
+}
+
+wstring MainApplication::ApplicationManager::GetDecoderTuningProfileFilename() const
+{
+    wstring filename{};
+
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/shlobj_core/nf-shlobj_core-shgetknownfolderpath
+    PWSTR localAppDataPathPtr = nullptr;
+    if (SUCCEEDED(SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, nullptr, &localAppDataPathPtr)))
+    {
+        filename = localAppDataPathPtr;
+        filename += L"\\WinAudioDecodeR";
+
+        // Fails with ERROR_ALREADY_EXISTS after the first startup, which is expected.
+        CreateDirectory(filename.c_str(), nullptr);
+
+        // The Computer Name keeps the profiles of different machines apart, when the AppData Folder is shared (e.g. a redirected Folder).
+        // URI: https://learn.microsoft.com/en-us/windows/win32/api/winbase/nf-winbase-getcomputernamew
+        wchar_t computerName[MAX_COMPUTERNAME_LENGTH + 1]{};
+        DWORD computerNameSize = MAX_COMPUTERNAME_LENGTH + 1;
+        filename += L"\\DecoderTuning.";
+        filename += GetComputerName(computerName, &computerNameSize) ? computerName : L"LOCAL";
+        filename += L".profile";
+    }
+
+    // The Path is allocated by the Shell, even when the call fails.
+    CoTaskMemFree(localAppDataPathPtr);
+    return filename;
+}
+
+int MainApplication::ApplicationManager::GetFilenamePrefixSize(const wchar_t* filenamePtr) const
+{
+    if (wcsstr(filenamePtr, FILE_NAMESPACE_UNC_PREFIX) != NULL)
+    {
+        // A substring match was found.
+        return FILE_NAMESPACE_UNC_PREFIX_SIZE;
+    }
+    else if (wcsstr(filenamePtr, FILE_NAMESPACE_PREFIX) != NULL)
+    {
+        // A substring match was found.
+        return FILE_NAMESPACE_PREFIX_SIZE;
+    }
+
+    // A substring match was NOT found.
+    // Do not adjust the prefix size.
+    return 0;
+}
+
 void MainApplication::ApplicationManager::CreateEditWindow(HINSTANCE hInstance, HWND hwnd, HWND& hwndEditWindowRef, WNDPROC& wndprocEditProcedureRef)
 {
     // ANSI_VAR_FONT specifies a proportional font based on the Windows character set. MS Sans Serif is typically used.
@@ -0,0 +1,429 @@
+#include "ArchiveMemberSource.h"
+#include <windows.h>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <zlib.h>
+
+namespace ArchiveMemberSourceSupport
+{
+    /// <summary>
+    /// Purpose: The ZIP Local File Header is 30 bytes, followed by the name and the Extra Field (up to 65535 bytes each).
+    /// URI: https://pkware.cachefly.net/webdocs/casestudies/APPNOTE.TXT
+    /// </summary>
+    constexpr auto ZIP_LOCAL_HEADER_SIZE = 30ULL;
+    constexpr auto ZIP_LOCAL_HEADER_MAXIMUM_SIZE = ZIP_LOCAL_HEADER_SIZE + 65535ULL + 65535ULL;
+    constexpr auto ZIP_LOCAL_HEADER_SIGNATURE = 0x04034B50UL;
+
+    /// <summary>
+    /// Purpose: The size of the sliding window (1 MB), and the number of bytes kept from the previous window on a refill (64k).
+    /// </summary>
+    constexpr auto WINDOW_SIZE = 1048576UL;
+    constexpr auto WINDOW_RETAINED_SIZE = 65536UL;
+
+    inline unsigned long ReadLittleEndian16(const unsigned char* bytePtr)
+    {
+        return static_cast<unsigned long>(bytePtr[0]) | (static_cast<unsigned long>(bytePtr[1]) << 8);
+    }
+
+    inline unsigned long ReadLittleEndian32(const unsigned char* bytePtr)
+    {
+        return ReadLittleEndian16(bytePtr) | (ReadLittleEndian16(bytePtr + 2) << 16);
+    }
+
+    /// <summary>
+    /// Purpose: The input of a single inflate() call is limited to the range of its 32-bit counter.
+    /// </summary>
+    inline uInt GetInflateInputSize(unsigned long long remainingSize)
+    {
+        return (remainingSize < UINT_MAX) ? static_cast<uInt>(remainingSize) : UINT_MAX;
+    }
+}
+
+/// <summary>
+/// Purpose: No-arg Constructor.
+/// </summary>
+ArchiveMemberSource::ArchiveMemberSource()
+{
+
+}
+
+/// <summary>
+/// Purpose: Destructor
+/// </summary>
+ArchiveMemberSource::~ArchiveMemberSource()
+{
+    this->Close();
+}
+
+#pragma region Public_Member_Functions_Region
+
+bool ArchiveMemberSource::Open(const wchar_t* archiveFilenamePtr, const ArchiveMember& memberRef, bool sequentialScanIsEnabled)
+{
+    this->Close();
+
+    if (memberRef.isEncrypted || memberRef.compressionMethod == ArchiveCompressionMethod::UNSUPPORTED || memberRef.uncompressedSize == 0ULL ||
+        (memberRef.compressionMethod == ArchiveCompressionMethod::STORED && memberRef.compressedSize != memberRef.uncompressedSize))
+    {
+        return false;
+    }
+
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    DWORD flagsAndAttributes = FILE_ATTRIBUTE_NORMAL | (sequentialScanIsEnabled ? FILE_FLAG_SEQUENTIAL_SCAN : 0);
+    HANDLE hFile = CreateFile(archiveFilenamePtr, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, flagsAndAttributes, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(hFile, &fileSize) || memberRef.offset > static_cast<unsigned long long>(fileSize.QuadPart) ||
+        memberRef.compressedSize > static_cast<unsigned long long>(fileSize.QuadPart) - memberRef.offset)
+    {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    // Only the range of the member is mapped. The view must start at a multiple of the allocation granularity (64k).
+    // URI: https://learn.microsoft.com/en-us/windows/win32/memory/creating-a-view-within-a-file
+    SYSTEM_INFO systemInfo{};
+    GetSystemInfo(&systemInfo);
+    unsigned long long viewOffset = memberRef.offset - (memberRef.offset % systemInfo.dwAllocationGranularity);
+    unsigned long long viewEnd = memberRef.offset + memberRef.compressedSize + (memberRef.hasLocalHeader ? ArchiveMemberSourceSupport::ZIP_LOCAL_HEADER_MAXIMUM_SIZE : 0ULL);
+    if (viewEnd > static_cast<unsigned long long>(fileSize.QuadPart))
+    {
+        viewEnd = static_cast<unsigned long long>(fileSize.QuadPart);
+    }
+
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-createfilemappingw
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile
+    HANDLE hMapping = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hMapping != NULL)
+    {
+        this->m_viewPtr = MapViewOfFile(hMapping, FILE_MAP_READ, static_cast<DWORD>(viewOffset >> 32), static_cast<DWORD>(viewOffset & 0xFFFFFFFFULL), static_cast<SIZE_T>(viewEnd - viewOffset));
+        CloseHandle(hMapping); // The view keeps the mapping open.
+    }
+
+    CloseHandle(hFile);
+    if (this->m_viewPtr == nullptr)
+    {
+        return false;
+    }
+
+    const unsigned char* viewBytePtr = static_cast<const unsigned char*>(this->m_viewPtr);
+    size_t dataOffset = static_cast<size_t>(memberRef.offset - viewOffset);
+    size_t viewSize = static_cast<size_t>(viewEnd - viewOffset);
+    if (memberRef.hasLocalHeader)
+    {
+        // The Local File Header has its own name and Extra Field lengths, which may differ from the Central Directory.
+        const unsigned char* headerPtr = viewBytePtr + dataOffset;
+        if (dataOffset + ArchiveMemberSourceSupport::ZIP_LOCAL_HEADER_SIZE > viewSize ||
+            ArchiveMemberSourceSupport::ReadLittleEndian32(headerPtr) != ArchiveMemberSourceSupport::ZIP_LOCAL_HEADER_SIGNATURE)
+        {
+            this->Close();
+            return false;
+        }
+
+        dataOffset += static_cast<size_t>(ArchiveMemberSourceSupport::ZIP_LOCAL_HEADER_SIZE) + ArchiveMemberSourceSupport::ReadLittleEndian16(headerPtr + 26) + ArchiveMemberSourceSupport::ReadLittleEndian16(headerPtr + 28);
+    }
+
+    if (dataOffset > viewSize || memberRef.compressedSize > viewSize - dataOffset)
+    {
+        this->Close();
+        return false;
+    }
+
+    this->m_dataPtr = viewBytePtr + dataOffset;
+    this->m_member = memberRef;
+    return true;
+}
+
+void ArchiveMemberSource::Close()
+{
+    if (this->m_inflateIsInitialized)
+    {
+        inflateEnd(this->m_inflateStreamPtr.get());
+        this->m_inflateIsInitialized = false;
+    }
+
+    if (this->m_viewPtr != nullptr)
+    {
+        // URI: https://learn.microsoft.com/en-us/windows/win32/api/memoryapi/nf-memoryapi-unmapviewoffile
+        UnmapViewOfFile(this->m_viewPtr);
+        this->m_viewPtr = nullptr;
+    }
+
+    // Reset to default values.
+    this->m_dataPtr = nullptr;
+    this->m_member = ArchiveMember{};
+    this->m_inflateStreamPtr.reset();
+    this->m_inflateIsFinished = false;
+    this->m_compressedPosition = 0ULL;
+    this->m_window.clear();
+    this->m_window.shrink_to_fit();
+    this->m_windowStart = 0ULL;
+    this->m_windowLength = 0;
+    this->m_position = 0ULL;
+    this->m_isEOF = false;
+}
+
+bool ArchiveMemberSource::IsStored() const
+{
+    return this->m_dataPtr != nullptr && this->m_member.compressionMethod == ArchiveCompressionMethod::STORED;
+}
+
+const unsigned char* ArchiveMemberSource::GetStoredDataPtr() const
+{
+    return this->IsStored() ? this->m_dataPtr : nullptr;
+}
+
+unsigned long long ArchiveMemberSource::GetCompressedLength() const
+{
+    return this->m_member.compressedSize;
+}
+
+bool ArchiveMemberSource::InflateAll(unsigned char* destinationPtr)
+{
+    if (this->m_dataPtr == nullptr)
+    {
+        return false;
+    }
+
+    if (this->IsStored())
+    {
+        memcpy(destinationPtr, this->m_dataPtr, static_cast<size_t>(this->m_member.uncompressedSize));
+        return true;
+    }
+
+    // A ZIP member is a raw Deflate Stream, without the zlib header, so the Window Bits are negative.
+    // URI: https://www.zlib.net/manual.html#Advanced
+    z_stream inflateStream{};
+    if (inflateInit2(&inflateStream, -MAX_WBITS) != Z_OK)
+    {
+        return false;
+    }
+
+    unsigned long long compressedPosition = 0ULL;
+    unsigned long long outputPosition = 0ULL;
+    int result = Z_OK;
+    while (result == Z_OK)
+    {
+        if (inflateStream.avail_in == 0 && compressedPosition < this->m_member.compressedSize)
+        {
+            inflateStream.next_in = const_cast<Bytef*>(this->m_dataPtr + compressedPosition);
+            inflateStream.avail_in = ArchiveMemberSourceSupport::GetInflateInputSize(this->m_member.compressedSize - compressedPosition);
+            compressedPosition += inflateStream.avail_in;
+        }
+
+        if (inflateStream.avail_out == 0)
+        {
+            inflateStream.next_out = destinationPtr + outputPosition;
+            inflateStream.avail_out = ArchiveMemberSourceSupport::GetInflateInputSize(this->m_member.uncompressedSize - outputPosition);
+            outputPosition += inflateStream.avail_out;
+        }
+
+        // Z_BUF_ERROR means NO progress was possible (i.e. the member is truncated, or longer than its recorded size).
+        result = inflate(&inflateStream, Z_NO_FLUSH);
+    }
+
+    bool memberIsValid = (result == Z_STREAM_END && inflateStream.avail_out == 0 && outputPosition == this->m_member.uncompressedSize);
+    inflateEnd(&inflateStream);
+
+    // URI: https://www.zlib.net/manual.html#Checksum
+    if (memberIsValid && this->m_member.hasLocalHeader)
+    {
+        uLong checksum = crc32(0L, Z_NULL, 0);
+        for (unsigned long long position = 0ULL; position < this->m_member.uncompressedSize; )
+        {
+            uInt size = ArchiveMemberSourceSupport::GetInflateInputSize(this->m_member.uncompressedSize - position);
+            checksum = crc32(checksum, destinationPtr + position, size);
+            position += size;
+        }
+
+        memberIsValid = (checksum == this->m_member.crc32);
+    }
+
+    return memberIsValid;
+}
+
+size_t ArchiveMemberSource::Read(void* bufferPtr, size_t size)
+{
+    if (this->m_dataPtr == nullptr)
+    {
+        return 0;
+    }
+
+    if (this->IsStored())
+    {
+        size_t available = (this->m_position < this->m_member.uncompressedSize) ? static_cast<size_t>(this->m_member.uncompressedSize - this->m_position) : 0;
+        if (size > available)
+        {
+            size = available;
+            this->m_isEOF = true;
+        }
+
+        memcpy(bufferPtr, this->m_dataPtr + this->m_position, size);
+        this->m_position += size;
+        return size;
+    }
+
+    unsigned char* destinationPtr = static_cast<unsigned char*>(bufferPtr);
+    size_t bytesRead = 0;
+    while (bytesRead < size)
+    {
+        if (this->m_position >= this->m_member.uncompressedSize)
+        {
+            this->m_isEOF = true;
+            break;
+        }
+
+        // The window only slides forwards, so a position before the window is inflated again from the start of the member.
+        if ((!this->m_inflateIsInitialized || this->m_position < this->m_windowStart) && !this->RestartInflate())
+        {
+            break;
+        }
+
+        bool windowWasFilled = true;
+        while (windowWasFilled && this->m_position >= this->m_windowStart + this->m_windowLength)
+        {
+            windowWasFilled = this->FillWindow();
+        }
+
+        if (!windowWasFilled)
+        {
+            // The compressed data ended before the recorded size of the member.
+            this->m_isEOF = true;
+            break;
+        }
+
+        size_t windowOffset = static_cast<size_t>(this->m_position - this->m_windowStart);
+        size_t copySize = this->m_windowLength - windowOffset;
+        if (copySize > size - bytesRead)
+        {
+            copySize = size - bytesRead;
+        }
+
+        memcpy(destinationPtr + bytesRead, this->m_window.data() + windowOffset, copySize);
+        bytesRead += copySize;
+        this->m_position += copySize;
+    }
+
+    return bytesRead;
+}
+
+int ArchiveMemberSource::Seek(long long offset, int origin)
+{
+    long long length = this->Length();
+    long long position = 0LL;
+    switch (origin)
+    {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position = static_cast<long long>(this->m_position) + offset;
+            break;
+        case SEEK_END:
+            position = length + offset;
+            break;
+        default:
+            // Seek Error
+            return -1;
+    }
+
+    if (position < 0LL || position > length)
+    {
+        // Seek Error
+        return -1;
+    }
+
+    this->m_position = static_cast<unsigned long long>(position);
+    this->m_isEOF = false;
+    return 0;
+}
+
+long long ArchiveMemberSource::Tell() const
+{
+    return static_cast<long long>(this->m_position);
+}
+
+long long ArchiveMemberSource::Length() const
+{
+    return (this->m_dataPtr != nullptr) ? static_cast<long long>(this->m_member.uncompressedSize) : 0LL;
+}
+
+bool ArchiveMemberSource::EndOfFile() const
+{
+    return this->m_isEOF;
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+bool ArchiveMemberSource::RestartInflate()
+{
+    if (!this->m_inflateIsInitialized)
+    {
+        this->m_inflateStreamPtr = std::make_unique<z_stream>();
+        if (inflateInit2(this->m_inflateStreamPtr.get(), -MAX_WBITS) != Z_OK)
+        {
+            return false;
+        }
+
+        this->m_inflateIsInitialized = true;
+        this->m_window.resize(ArchiveMemberSourceSupport::WINDOW_SIZE);
+    }
+    else if (inflateReset(this->m_inflateStreamPtr.get()) != Z_OK)
+    {
+        return false;
+    }
+
+    this->m_inflateStreamPtr->avail_in = 0;
+    this->m_inflateIsFinished = false;
+    this->m_compressedPosition = 0ULL;
+    this->m_windowStart = 0ULL;
+    this->m_windowLength = 0;
+    return true;
+}
+
+bool ArchiveMemberSource::FillWindow()
+{
+    // Keep the end of the current window at the start of the next one.
+    size_t retainedSize = (this->m_windowLength < ArchiveMemberSourceSupport::WINDOW_RETAINED_SIZE) ? this->m_windowLength : ArchiveMemberSourceSupport::WINDOW_RETAINED_SIZE;
+    memmove(this->m_window.data(), this->m_window.data() + this->m_windowLength - retainedSize, retainedSize);
+    this->m_windowStart += this->m_windowLength - retainedSize;
+    this->m_windowLength = retainedSize;
+
+    if (this->m_inflateIsFinished)
+    {
+        return false;
+    }
+
+    z_stream& inflateStreamRef = *this->m_inflateStreamPtr;
+    inflateStreamRef.next_out = this->m_window.data() + retainedSize;
+    inflateStreamRef.avail_out = static_cast<uInt>(this->m_window.size() - retainedSize);
+
+    while (inflateStreamRef.avail_out > 0)
+    {
+        if (inflateStreamRef.avail_in == 0 && this->m_compressedPosition < this->m_member.compressedSize)
+        {
+            inflateStreamRef.next_in = const_cast<Bytef*>(this->m_dataPtr + this->m_compressedPosition);
+            inflateStreamRef.avail_in = ArchiveMemberSourceSupport::GetInflateInputSize(this->m_member.compressedSize - this->m_compressedPosition);
+            this->m_compressedPosition += inflateStreamRef.avail_in;
+        }
+
+        int result = inflate(&inflateStreamRef, Z_NO_FLUSH);
+        if (result != Z_OK)
+        {
+            // The end of the Deflate Stream, or damaged compressed data. Either way, NO more bytes can be inflated.
+            this->m_inflateIsFinished = true;
+            break;
+        }
+    }
+
+    this->m_windowLength = this->m_window.size() - inflateStreamRef.avail_out;
+    return this->m_windowLength > retainedSize;
+}
+
+#pragma endregion Private_Member_Functions_Region
@@ -0,0 +1,563 @@
+#include "ArchiveReader.h"
+#include <windows.h>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace ArchiveReaderSupport
+{
+    /// <summary>
+    /// Purpose: The ZIP End of Central Directory Record is 22 bytes, followed by a comment of up to 65535 bytes.
+    /// URI: https://pkware.cachefly.net/webdocs/casestudies/APPNOTE.TXT
+    /// </summary>
+    constexpr auto ZIP_END_RECORD_SIZE = 22UL;
+    constexpr auto ZIP_MAXIMUM_COMMENT_SIZE = 65535UL;
+    constexpr auto ZIP64_END_LOCATOR_SIZE = 20UL;
+    constexpr auto ZIP64_END_RECORD_SIZE = 56UL;
+    constexpr auto ZIP_CENTRAL_HEADER_SIZE = 46UL;
+
+    constexpr auto ZIP_END_RECORD_SIGNATURE = 0x06054B50UL;
+    constexpr auto ZIP64_END_LOCATOR_SIGNATURE = 0x07064B50UL;
+    constexpr auto ZIP64_END_RECORD_SIGNATURE = 0x06064B50UL;
+    constexpr auto ZIP_CENTRAL_HEADER_SIGNATURE = 0x02014B50UL;
+    constexpr auto ZIP64_EXTRA_FIELD_ID = 0x0001U;
+
+    /// <summary>
+    /// Purpose: A Central Directory larger than this is NOT read (i.e. a damaged size field), since it is read into Memory at once.
+    /// </summary>
+    constexpr auto MAXIMUM_CENTRAL_DIRECTORY_SIZE = 268435456ULL;
+
+    /// <summary>
+    /// Purpose: The TAR Blocks are 512 bytes. A GNU long name, or a pax Extended Header, larger than the limit is skipped.
+    /// URI: https://www.gnu.org/software/tar/manual/html_node/Standard.html
+    /// </summary>
+    constexpr auto TAR_BLOCK_SIZE = 512ULL;
+    constexpr auto TAR_MAXIMUM_EXTENDED_HEADER_SIZE = 65536ULL;
+
+    /// <summary>
+    /// Purpose: The number of Archive listings kept. Enough for the Archives whose members are waiting in the List of Filenames.
+    /// </summary>
+    constexpr auto MAXIMUM_CACHED_DIRECTORY_COUNT = 16UL;
+
+    /// <summary>
+    /// Purpose: The listing of an Archive, with its members indexed by name.
+    /// </summary>
+    struct ArchiveDirectory
+    {
+        std::vector<ArchiveMember> members{};
+        std::map<std::wstring, size_t> memberNameToIndexMap{};
+    };
+
+    /// <summary>
+    /// Purpose: A cached listing. The size and last write time of the Archive detect an Archive that was replaced since it was listed.
+    /// </summary>
+    struct CachedDirectory
+    {
+        std::wstring archiveFilename{};
+        unsigned long long fileSize{};
+        unsigned long long lastWriteTime{};
+        std::shared_ptr<const ArchiveDirectory> directoryPtr{};
+    };
+
+    std::mutex g_directoryCacheMutex{};
+    std::list<CachedDirectory> g_directoryCache{}; // Most recently used first.
+
+    inline unsigned long ReadLittleEndian16(const unsigned char* bytePtr)
+    {
+        return static_cast<unsigned long>(bytePtr[0]) | (static_cast<unsigned long>(bytePtr[1]) << 8);
+    }
+
+    inline unsigned long ReadLittleEndian32(const unsigned char* bytePtr)
+    {
+        return ReadLittleEndian16(bytePtr) | (ReadLittleEndian16(bytePtr + 2) << 16);
+    }
+
+    inline unsigned long long ReadLittleEndian64(const unsigned char* bytePtr)
+    {
+        return static_cast<unsigned long long>(ReadLittleEndian32(bytePtr)) | (static_cast<unsigned long long>(ReadLittleEndian32(bytePtr + 4)) << 32);
+    }
+
+    bool ReadAt(FILE* fileStreamPtr, unsigned long long offset, void* bufferPtr, size_t size)
+    {
+        return _fseeki64(fileStreamPtr, static_cast<long long>(offset), SEEK_SET) == 0 && fread(bufferPtr, 1, size, fileStreamPtr) == size;
+    }
+
+    bool EndsWithExtension(const std::wstring& filenameRef, const wchar_t* extensionPtr)
+    {
+        size_t extensionLength = wcslen(extensionPtr);
+        return filenameRef.size() > extensionLength && _wcsicmp(filenameRef.c_str() + filenameRef.size() - extensionLength, extensionPtr) == 0;
+    }
+
+    /// <summary>
+    /// Purpose: Converts a stored name to a Wide String. A name that is NOT valid UTF-8 is converted from the given Code Page instead.
+    /// URI: https://learn.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
+    /// </summary>
+    std::wstring ConvertName(const char* namePtr, size_t nameLength, bool isUtf8, UINT fallbackCodePage)
+    {
+        if (nameLength == 0)
+        {
+            return std::wstring{};
+        }
+
+        UINT codePage = isUtf8 ? CP_UTF8 : fallbackCodePage;
+        DWORD flags = isUtf8 ? MB_ERR_INVALID_CHARS : 0;
+        int wideLength = MultiByteToWideChar(codePage, flags, namePtr, static_cast<int>(nameLength), nullptr, 0);
+        if (wideLength <= 0 && isUtf8)
+        {
+            codePage = fallbackCodePage;
+            flags = 0;
+            wideLength = MultiByteToWideChar(codePage, flags, namePtr, static_cast<int>(nameLength), nullptr, 0);
+        }
+
+        if (wideLength <= 0)
+        {
+            return std::wstring{};
+        }
+
+        std::wstring name(static_cast<size_t>(wideLength), L'\0');
+        MultiByteToWideChar(codePage, flags, namePtr, static_cast<int>(nameLength), &name[0], wideLength);
+        return name;
+    }
+
+    /// <summary>
+    /// Purpose: Lists a ZIP Archive from its Central Directory, which is found through the End of Central Directory Record (or its ZIP64 version).
+    /// </summary>
+    bool ParseZipDirectory(FILE* fileStreamPtr, unsigned long long fileSize, std::vector<ArchiveMember>& membersRef)
+    {
+        if (fileSize < ZIP_END_RECORD_SIZE)
+        {
+            return false;
+        }
+
+        // The End Record is found by searching backwards from the end of the File, since the comment that follows it has a variable size.
+        size_t tailSize = static_cast<size_t>((fileSize < ZIP_END_RECORD_SIZE + ZIP_MAXIMUM_COMMENT_SIZE) ? fileSize : ZIP_END_RECORD_SIZE + ZIP_MAXIMUM_COMMENT_SIZE);
+        unsigned long long tailOffset = fileSize - tailSize;
+        std::vector<unsigned char> tail(tailSize);
+        if (!ReadAt(fileStreamPtr, tailOffset, tail.data(), tailSize))
+        {
+            return false;
+        }
+
+        size_t endRecordIndex = tailSize - ZIP_END_RECORD_SIZE;
+        while (ReadLittleEndian32(&tail[endRecordIndex]) != ZIP_END_RECORD_SIGNATURE || endRecordIndex + ZIP_END_RECORD_SIZE + ReadLittleEndian16(&tail[endRecordIndex + 20]) > tailSize)
+        {
+            if (endRecordIndex == 0)
+            {
+                return false;
+            }
+
+            --endRecordIndex;
+        }
+
+        const unsigned char* endRecordPtr = &tail[endRecordIndex];
+        unsigned long long entryCount = ReadLittleEndian16(endRecordPtr + 10);
+        unsigned long long directorySize = ReadLittleEndian32(endRecordPtr + 12);
+        unsigned long long directoryOffset = ReadLittleEndian32(endRecordPtr + 16);
+
+        // A ZIP64 Archive stores the real values in the ZIP64 End Record, which is found through the Locator just before the End Record.
+        unsigned long long endRecordOffset = tailOffset + endRecordIndex;
+        if (endRecordOffset >= ZIP64_END_LOCATOR_SIZE)
+        {
+            unsigned char locator[ZIP64_END_LOCATOR_SIZE]{};
+            if (ReadAt(fileStreamPtr, endRecordOffset - ZIP64_END_LOCATOR_SIZE, locator, sizeof(locator)) && ReadLittleEndian32(locator) == ZIP64_END_LOCATOR_SIGNATURE)
+            {
+                unsigned char zip64EndRecord[ZIP64_END_RECORD_SIZE]{};
+                if (!ReadAt(fileStreamPtr, ReadLittleEndian64(locator + 8), zip64EndRecord, sizeof(zip64EndRecord)) ||
+                    ReadLittleEndian32(zip64EndRecord) != ZIP64_END_RECORD_SIGNATURE)
+                {
+                    return false;
+                }
+
+                entryCount = ReadLittleEndian64(zip64EndRecord + 32);
+                directorySize = ReadLittleEndian64(zip64EndRecord + 40);
+                directoryOffset = ReadLittleEndian64(zip64EndRecord + 48);
+            }
+        }
+
+        if (directorySize > MAXIMUM_CENTRAL_DIRECTORY_SIZE || directoryOffset > fileSize || directorySize > fileSize - directoryOffset)
+        {
+            return false;
+        }
+
+        std::vector<unsigned char> directory(static_cast<size_t>(directorySize));
+        if (directorySize > 0 && !ReadAt(fileStreamPtr, directoryOffset, directory.data(), directory.size()))
+        {
+            return false;
+        }
+
+        size_t position = 0;
+        for (unsigned long long entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+        {
+            if (position + ZIP_CENTRAL_HEADER_SIZE > directory.size() || ReadLittleEndian32(&directory[position]) != ZIP_CENTRAL_HEADER_SIGNATURE)
+            {
+                return false;
+            }
+
+            const unsigned char* headerPtr = &directory[position];
+            unsigned long flags = ReadLittleEndian16(headerPtr + 8);
+            unsigned long method = ReadLittleEndian16(headerPtr + 10);
+            size_t nameLength = ReadLittleEndian16(headerPtr + 28);
+            size_t extraLength = ReadLittleEndian16(headerPtr + 30);
+            size_t commentLength = ReadLittleEndian16(headerPtr + 32);
+            size_t entrySize = ZIP_CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength;
+            if (position + entrySize > directory.size())
+            {
+                return false;
+            }
+
+            ArchiveMember member{};
+            member.crc32 = ReadLittleEndian32(headerPtr + 16);
+            member.compressedSize = ReadLittleEndian32(headerPtr + 20);
+            member.uncompressedSize = ReadLittleEndian32(headerPtr + 24);
+            member.offset = ReadLittleEndian32(headerPtr + 42);
+            member.hasLocalHeader = true;
+            member.isEncrypted = (flags & 0x0001) != 0;
+            member.compressionMethod = (method == 0) ? ArchiveCompressionMethod::STORED : ((method == 8) ? ArchiveCompressionMethod::DEFLATED : ArchiveCompressionMethod::UNSUPPORTED);
+
+            // The ZIP64 Extra Field holds the 64-bit value of each field set to 0xFFFFFFFF, in this order.
+            const unsigned char* extraPtr = headerPtr + ZIP_CENTRAL_HEADER_SIZE + nameLength;
+            size_t extraPosition = 0;
+            while (extraPosition + 4 <= extraLength)
+            {
+                unsigned long fieldId = ReadLittleEndian16(extraPtr + extraPosition);
+                size_t fieldSize = ReadLittleEndian16(extraPtr + extraPosition + 2);
+                if (extraPosition + 4 + fieldSize > extraLength)
+                {
+                    break;
+                }
+
+                if (fieldId == ZIP64_EXTRA_FIELD_ID)
+                {
+                    const unsigned char* fieldPtr = extraPtr + extraPosition + 4;
+                    size_t fieldPosition = 0;
+                    unsigned long long* valuePtrs[] = { &member.uncompressedSize, &member.compressedSize, &member.offset };
+                    for (unsigned long long* valuePtr : valuePtrs)
+                    {
+                        if (*valuePtr == 0xFFFFFFFFULL && fieldPosition + 8 <= fieldSize)
+                        {
+                            *valuePtr = ReadLittleEndian64(fieldPtr + fieldPosition);
+                            fieldPosition += 8;
+                        }
+                    }
+                }
+
+                extraPosition += 4 + fieldSize;
+            }
+
+            // The name is UTF-8 when flag bit 11 is set. Otherwise, it is in Code Page 437 (the original IBM PC character set).
+            member.name = ConvertName(reinterpret_cast<const char*>(headerPtr + ZIP_CENTRAL_HEADER_SIZE), nameLength, (flags & 0x0800) != 0, 437);
+            if (!member.name.empty() && member.name.back() != L'/')
+            {
+                membersRef.push_back(std::move(member));
+            }
+
+            position += entrySize;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Purpose: Reads a numeric TAR header field. The field is octal, or a big-endian base-256 number when its first byte has the high bit set (GNU, for sizes of 8 GB or more).
+    /// </summary>
+    unsigned long long ReadTarNumber(const unsigned char* fieldPtr, size_t fieldSize)
+    {
+        unsigned long long value = 0ULL;
+        if ((fieldPtr[0] & 0x80) != 0)
+        {
+            value = fieldPtr[0] & 0x7F;
+            for (size_t index = 1; index < fieldSize; ++index)
+            {
+                value = (value << 8) | fieldPtr[index];
+            }
+
+            return value;
+        }
+
+        for (size_t index = 0; index < fieldSize; ++index)
+        {
+            if (fieldPtr[index] >= '0' && fieldPtr[index] <= '7')
+            {
+                value = (value << 3) | static_cast<unsigned long long>(fieldPtr[index] - '0');
+            }
+            else if (fieldPtr[index] != ' ' || value != 0ULL)
+            {
+                break; // The field ends with a null or a space. Leading spaces are skipped.
+            }
+        }
+
+        return value;
+    }
+
+    /// <summary>
+    /// Purpose: Verifies the checksum of a TAR header, which is the sum of its bytes, with the checksum field taken as spaces.
+    /// </summary>
+    bool IsValidTarHeader(const unsigned char* headerPtr)
+    {
+        unsigned long long sum = 0ULL;
+        for (size_t index = 0; index < TAR_BLOCK_SIZE; ++index)
+        {
+            sum += (index >= 148 && index < 156) ? static_cast<unsigned long long>(' ') : headerPtr[index];
+        }
+
+        return sum == ReadTarNumber(headerPtr + 148, 8);
+    }
+
+    /// <summary>
+    /// Purpose: Finds the "path" record of a pax Extended Header, whose records have the form "<length> <keyword>=<value>\n".
+    /// URI: https://pubs.opengroup.org/onlinepubs/9699919799/utilities/pax.html
+    /// </summary>
+    bool FindPaxPath(const std::vector<unsigned char>& headerRef, std::string& pathRef)
+    {
+        size_t position = 0;
+        while (position < headerRef.size())
+        {
+            size_t recordLength = 0;
+            size_t index = position;
+            while (index < headerRef.size() && headerRef[index] >= '0' && headerRef[index] <= '9')
+            {
+                recordLength = recordLength * 10 + (headerRef[index] - '0');
+                ++index;
+            }
+
+            if (recordLength == 0 || position + recordLength > headerRef.size() || index >= headerRef.size() || headerRef[index] != ' ')
+            {
+                return false;
+            }
+
+            std::string record(reinterpret_cast<const char*>(&headerRef[index + 1]), position + recordLength - (index + 1));
+            if (record.compare(0, 5, "path=") == 0 && !record.empty() && record.back() == '\n')
+            {
+                pathRef = record.substr(5, record.size() - 6);
+                return true;
+            }
+
+            position += recordLength;
+        }
+
+        return false;
+    }
+
+    /// <summary>
+    /// Purpose: Lists a TAR Archive by walking its member headers. A GNU long name, or a pax path, replaces the name of the next member.
+    /// </summary>
+    bool ParseTarDirectory(FILE* fileStreamPtr, unsigned long long fileSize, std::vector<ArchiveMember>& membersRef)
+    {
+        unsigned char header[TAR_BLOCK_SIZE]{};
+        unsigned long long offset = 0ULL;
+        std::string pendingName{};
+
+        while (offset + TAR_BLOCK_SIZE <= fileSize && ReadAt(fileStreamPtr, offset, header, sizeof(header)))
+        {
+            // The Archive ends with zero-filled Blocks.
+            if (header[0] == 0 && memcmp(header, header + 1, TAR_BLOCK_SIZE - 1) == 0)
+            {
+                break;
+            }
+
+            if (!IsValidTarHeader(header))
+            {
+                // The first header must be valid, so the File is a TAR Archive. A damaged header later ends the listing.
+                return offset > 0ULL;
+            }
+
+            unsigned long long size = ReadTarNumber(header + 124, 12);
+            unsigned long long dataOffset = offset + TAR_BLOCK_SIZE;
+            char typeFlag = static_cast<char>(header[156]);
+            if (dataOffset > fileSize || size > fileSize - dataOffset)
+            {
+                return offset > 0ULL;
+            }
+
+            if (typeFlag == 'L' || typeFlag == 'x')
+            {
+                if (size <= TAR_MAXIMUM_EXTENDED_HEADER_SIZE)
+                {
+                    std::vector<unsigned char> extendedHeader(static_cast<size_t>(size));
+                    if (size > 0 && !ReadAt(fileStreamPtr, dataOffset, extendedHeader.data(), extendedHeader.size()))
+                    {
+                        return false;
+                    }
+
+                    if (typeFlag == 'L')
+                    {
+                        pendingName.assign(reinterpret_cast<const char*>(extendedHeader.data()), strnlen(reinterpret_cast<const char*>(extendedHeader.data()), extendedHeader.size()));
+                    }
+                    else
+                    {
+                        FindPaxPath(extendedHeader, pendingName);
+                    }
+                }
+            }
+            else
+            {
+                if (typeFlag == '0' || typeFlag == '\0' || typeFlag == '7')
+                {
+                    std::string name = pendingName;
+                    if (name.empty())
+                    {
+                        name.assign(reinterpret_cast<const char*>(header), strnlen(reinterpret_cast<const char*>(header), 100));
+
+                        // A ustar header holds the start of a long name in its prefix field.
+                        if (memcmp(header + 257, "ustar", 5) == 0 && header[345] != 0)
+                        {
+                            name = std::string(reinterpret_cast<const char*>(header + 345), strnlen(reinterpret_cast<const char*>(header + 345), 155)) + "/" + name;
+                        }
+                    }
+
+                    if (name.compare(0, 2, "./") == 0)
+                    {
+                        name.erase(0, 2);
+                    }
+
+                    // A pax path is UTF-8. The other names have NO defined encoding, but are usually UTF-8 (otherwise, the ANSI Code Page is assumed).
+                    ArchiveMember member{};
+                    member.name = ConvertName(name.c_str(), name.size(), true, CP_ACP);
+                    member.offset = dataOffset;
+                    member.compressedSize = size;
+                    member.uncompressedSize = size;
+                    if (!member.name.empty() && member.name.back() != L'/')
+                    {
+                        membersRef.push_back(std::move(member));
+                    }
+                }
+
+                pendingName.clear();
+            }
+
+            // The member data is padded to a whole number of Blocks.
+            offset = dataOffset + ((size + TAR_BLOCK_SIZE - 1) / TAR_BLOCK_SIZE) * TAR_BLOCK_SIZE;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Purpose: Finds the listing of an Archive in the cache, or reads the Archive and adds its listing to the cache.
+    /// </summary>
+    /// <returns>The listing. Otherwise, nullptr if the Archive can NOT be read.</returns>
+    std::shared_ptr<const ArchiveDirectory> FindDirectory(const wchar_t* archiveFilenamePtr)
+    {
+        // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getfileattributesexw
+        WIN32_FILE_ATTRIBUTE_DATA fileAttributeData{};
+        if (!GetFileAttributesEx(archiveFilenamePtr, GetFileExInfoStandard, &fileAttributeData))
+        {
+            return nullptr;
+        }
+
+        unsigned long long fileSize = (static_cast<unsigned long long>(fileAttributeData.nFileSizeHigh) << 32ULL) | fileAttributeData.nFileSizeLow;
+        unsigned long long lastWriteTime = (static_cast<unsigned long long>(fileAttributeData.ftLastWriteTime.dwHighDateTime) << 32ULL) | fileAttributeData.ftLastWriteTime.dwLowDateTime;
+
+        {
+            std::lock_guard<std::mutex> lock(g_directoryCacheMutex);
+            for (std::list<CachedDirectory>::iterator iterator = g_directoryCache.begin(); iterator != g_directoryCache.end(); ++iterator)
+            {
+                if (iterator->archiveFilename == archiveFilenamePtr)
+                {
+                    if (iterator->fileSize == fileSize && iterator->lastWriteTime == lastWriteTime)
+                    {
+                        g_directoryCache.splice(g_directoryCache.begin(), g_directoryCache, iterator);
+                        return g_directoryCache.front().directoryPtr;
+                    }
+
+                    g_directoryCache.erase(iterator);
+                    break;
+                }
+            }
+        }
+
+        // The Archive is read without holding the Mutex, so the other Threads can still find their listings.
+        FILE* fileStreamPtr = nullptr;
+        if (_wfopen_s(&fileStreamPtr, archiveFilenamePtr, L"rb") != 0 || fileStreamPtr == nullptr)
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<ArchiveDirectory> directoryPtr = std::make_shared<ArchiveDirectory>();
+        std::wstring archiveFilename(archiveFilenamePtr);
+        bool directoryWasRead = EndsWithExtension(archiveFilename, L".zip") ?
+            ParseZipDirectory(fileStreamPtr, fileSize, directoryPtr->members) : ParseTarDirectory(fileStreamPtr, fileSize, directoryPtr->members);
+        fclose(fileStreamPtr);
+
+        if (!directoryWasRead)
+        {
+            return nullptr;
+        }
+
+        // A repeated name refers to the last copy of the member, as when the Archive is extracted.
+        for (size_t memberIndex = 0; memberIndex < directoryPtr->members.size(); ++memberIndex)
+        {
+            directoryPtr->memberNameToIndexMap[directoryPtr->members[memberIndex].name] = memberIndex;
+        }
+
+        std::lock_guard<std::mutex> lock(g_directoryCacheMutex);
+        g_directoryCache.push_front(CachedDirectory{ archiveFilename, fileSize, lastWriteTime, directoryPtr });
+        if (g_directoryCache.size() > MAXIMUM_CACHED_DIRECTORY_COUNT)
+        {
+            g_directoryCache.pop_back();
+        }
+
+        return directoryPtr;
+    }
+}
+
+bool ArchiveReader::IsArchiveType(const wchar_t* filenamePtr)
+{
+    std::wstring filename(filenamePtr);
+    return ArchiveReaderSupport::EndsWithExtension(filename, L".zip") || ArchiveReaderSupport::EndsWithExtension(filename, L".tar");
+}
+
+bool ArchiveReader::SplitMemberPath(const wchar_t* pathPtr, std::wstring& archiveFilenameRef, std::wstring& memberNameRef)
+{
+    // The separator may also appear in the name of a Folder, so only a separator that follows an Archive File Extension is used.
+    std::wstring path(pathPtr);
+    size_t separatorPosition = path.find(ARCHIVE_MEMBER_SEPARATOR);
+    while (separatorPosition != std::wstring::npos)
+    {
+        std::wstring archiveFilename = path.substr(0, separatorPosition);
+        if (separatorPosition + 1 < path.size() && ArchiveReader::IsArchiveType(archiveFilename.c_str()))
+        {
+            archiveFilenameRef = archiveFilename;
+            memberNameRef = path.substr(separatorPosition + 1);
+            return true;
+        }
+
+        separatorPosition = path.find(ARCHIVE_MEMBER_SEPARATOR, separatorPosition + 1);
+    }
+
+    return false;
+}
+
+bool ArchiveReader::ListMembers(const wchar_t* archiveFilenamePtr, std::vector<ArchiveMember>& membersRef)
+{
+    std::shared_ptr<const ArchiveReaderSupport::ArchiveDirectory> directoryPtr = ArchiveReaderSupport::FindDirectory(archiveFilenamePtr);
+    if (directoryPtr == nullptr)
+    {
+        return false;
+    }
+
+    membersRef = directoryPtr->members;
+    return true;
+}
+
+bool ArchiveReader::FindMember(const wchar_t* archiveFilenamePtr, const std::wstring& memberNameRef, ArchiveMember& memberRef)
+{
+    std::shared_ptr<const ArchiveReaderSupport::ArchiveDirectory> directoryPtr = ArchiveReaderSupport::FindDirectory(archiveFilenamePtr);
+    if (directoryPtr == nullptr)
+    {
+        return false;
+    }
+
+    std::map<std::wstring, size_t>::const_iterator iterator = directoryPtr->memberNameToIndexMap.find(memberNameRef);
+    if (iterator == directoryPtr->memberNameToIndexMap.end())
+    {
+        return false;
+    }
+
+    memberRef = directoryPtr->members[iterator->second];
+    return true;
+}
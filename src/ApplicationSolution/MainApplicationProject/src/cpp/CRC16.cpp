@@ -0,0 +1,89 @@
+#include "CRC16.h"
+
+namespace CRC16Support
+{
+    /// <summary>
+    /// Purpose: The CRC-16 Lookup Tables used by the slice-by-8 CRC-16 calculations, built at compile time.
+    /// Polynomial 0x8005, processed either most significant bit first OR least significant bit first (i.e. Polynomial 0xA001 reflected).
+    /// 
+    /// Table [0] is the classic byte-at-a-time Lookup Table. Table [k] advances the result of Table [k - 1] by one more zero byte,
+    /// so 8 bytes can be folded into the CRC with 8 independent lookups.
+    /// </summary>
+    struct CRC16Tables
+    {
+        unsigned short values[8][256]{};
+
+        constexpr explicit CRC16Tables(bool reflected)
+        {
+            for (unsigned long index = 0UL; index < 256UL; ++index)
+            {
+                unsigned long crc = reflected ? index : (index << 8UL);
+                for (unsigned long bitIndex = 0UL; bitIndex < 8UL; ++bitIndex)
+                {
+                    if (reflected)
+                    {
+                        crc = ((crc & 0x0001UL) != 0UL) ? ((crc >> 1UL) ^ 0xA001UL) : (crc >> 1UL);
+                    }
+                    else
+                    {
+                        crc = ((crc & 0x8000UL) != 0UL) ? ((crc << 1UL) ^ 0x8005UL) : (crc << 1UL);
+                    }
+                }
+                this->values[0][index] = static_cast<unsigned short>(crc & 0xFFFFUL);
+            }
+
+            for (unsigned long tableIndex = 1UL; tableIndex < 8UL; ++tableIndex)
+            {
+                for (unsigned long index = 0UL; index < 256UL; ++index)
+                {
+                    unsigned long previous = this->values[tableIndex - 1][index];
+                    unsigned long advanced = reflected ? ((previous >> 8UL) ^ this->values[0][previous & 0xFFUL]) : ((previous << 8UL) ^ this->values[0][previous >> 8UL]);
+                    this->values[tableIndex][index] = static_cast<unsigned short>(advanced & 0xFFFFUL);
+                }
+            }
+        }
+    };
+
+    static constexpr CRC16Tables CRC16_TABLES{ false };
+    static constexpr CRC16Tables REFLECTED_CRC16_TABLES{ true };
+}
+
+unsigned short CRC16::Update(unsigned short crc, const unsigned char* dataPtr, size_t dataLength)
+{
+    const auto& table = CRC16Support::CRC16_TABLES.values;
+
+    while (dataLength >= 8)
+    {
+        crc = table[7][dataPtr[0] ^ (crc >> 8)] ^ table[6][dataPtr[1] ^ (crc & 0xFF)] ^ table[5][dataPtr[2]] ^ table[4][dataPtr[3]] ^
+            table[3][dataPtr[4]] ^ table[2][dataPtr[5]] ^ table[1][dataPtr[6]] ^ table[0][dataPtr[7]];
+        dataPtr += 8;
+        dataLength -= 8;
+    }
+
+    while (dataLength-- > 0)
+    {
+        crc = static_cast<unsigned short>((crc << 8) ^ table[0][(crc >> 8) ^ *dataPtr++]);
+    }
+
+    return crc;
+}
+
+unsigned short CRC16::UpdateReflected(unsigned short crc, const unsigned char* dataPtr, size_t dataLength)
+{
+    const auto& table = CRC16Support::REFLECTED_CRC16_TABLES.values;
+
+    while (dataLength >= 8)
+    {
+        crc = table[7][dataPtr[0] ^ (crc & 0xFF)] ^ table[6][dataPtr[1] ^ (crc >> 8)] ^ table[5][dataPtr[2]] ^ table[4][dataPtr[3]] ^
+            table[3][dataPtr[4]] ^ table[2][dataPtr[5]] ^ table[1][dataPtr[6]] ^ table[0][dataPtr[7]];
+        dataPtr += 8;
+        dataLength -= 8;
+    }
+
+    while (dataLength-- > 0)
+    {
+        crc = static_cast<unsigned short>((crc >> 8) ^ table[0][(crc ^ *dataPtr++) & 0xFF]);
+    }
+
+    return crc;
+}
@@ -0,0 +1,289 @@
+#include "CpuDispatch.h"
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+
+#pragma region CPUID_ADJUSTMENT_FOR_COMPILATION_TARGET
+#if defined(CPU_DISPATCH_X86_ENABLED) && defined(_MSC_VER)
+// MSVC provides the __cpuidex() and _xgetbv() intrinsics.
+
+#include <intrin.h>
+
+#elif defined(CPU_DISPATCH_X86_ENABLED)
+// GCC and Clang provide the __cpuid_count() macro. XGETBV is read using inline assembly, since _xgetbv() needs the XSAVE target.
+
+#include <cpuid.h>
+
+#endif
+#pragma endregion CPUID_ADJUSTMENT_FOR_COMPILATION_TARGET
+
+namespace CpuDispatchSupport
+{
+    constexpr const char* LEVEL_NAMES[] = { "SCALAR", "SSE2", "SSE4.2", "AVX2", "AVX512" };
+    constexpr auto LEVEL_COUNT = sizeof(LEVEL_NAMES) / sizeof(LEVEL_NAMES[0]);
+
+    /// <summary>
+    /// Purpose: The features, and the level they were limited to (or nullptr when NOT limited). Set once, on first use.
+    /// </summary>
+    struct DispatchState
+    {
+        CpuFeatures features{};
+        const char* limitLevelNamePtr{ nullptr };
+    };
+
+    std::mutex g_mutex{};
+    std::string g_levelName{}; // Set by Initialize().
+
+    /// <summary>
+    /// Purpose: The variant chosen for each kernel family, sorted by kernel family.
+    /// </summary>
+    std::map<std::string, const char*> g_variantMap{};
+
+#ifdef CPU_DISPATCH_X86_ENABLED
+    void QueryCpuId(unsigned int leaf, unsigned int subleaf, unsigned int registers[4])
+    {
+        #if defined(_MSC_VER)
+        int values[4]{};
+        __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (int index = 0; index < 4; ++index)
+        {
+            registers[index] = static_cast<unsigned int>(values[index]);
+        }
+        #else
+        __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+        #endif
+    }
+
+    /// <summary>
+    /// Purpose: Reads the XCR0 Register, which lists the Register states saved by the OS on a context switch.
+    /// </summary>
+    unsigned long long ReadExtendedControlRegister()
+    {
+        #if defined(_MSC_VER)
+        return _xgetbv(0);
+        #else
+        unsigned int low = 0U;
+        unsigned int high = 0U;
+        __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+        return (static_cast<unsigned long long>(high) << 32) | low;
+        #endif
+    }
+#endif
+
+    /// <summary>
+    /// Purpose: Detects the CPU features using the CPUID instruction.
+    /// URI: https://www.intel.com/content/www/us/en/developer/articles/technical/intel-sdm.html (Volume 2A, CPUID)
+    /// </summary>
+    CpuFeatures DetectFeatures()
+    {
+        CpuFeatures features{};
+
+        #ifdef CPU_DISPATCH_X86_ENABLED
+        unsigned int registers[4]{}; // EAX, EBX, ECX, EDX.
+        QueryCpuId(0U, 0U, registers);
+        unsigned int highestLeaf = registers[0];
+        if (highestLeaf < 1U)
+        {
+            return features;
+        }
+
+        QueryCpuId(1U, 0U, registers);
+        features.sse2 = (registers[3] & (1U << 26)) != 0U;
+        features.sse42 = (registers[2] & (1U << 20)) != 0U;
+        features.pclmul = (registers[2] & (1U << 1)) != 0U;
+
+        // The AVX Registers can only be used when the OS saves them (OSXSAVE, then the XMM and YMM state bits of XCR0).
+        bool osSavesYmm = false;
+        bool osSavesZmm = false;
+        if ((registers[2] & (1U << 27)) != 0U && (registers[2] & (1U << 28)) != 0U)
+        {
+            unsigned long long savedStates = ReadExtendedControlRegister();
+            osSavesYmm = (savedStates & 0x06ULL) == 0x06ULL;
+            osSavesZmm = osSavesYmm && (savedStates & 0xE0ULL) == 0xE0ULL; // The opmask, and the upper ZMM state bits.
+        }
+
+        if (highestLeaf >= 7U)
+        {
+            QueryCpuId(7U, 0U, registers);
+            features.avx2 = osSavesYmm && (registers[1] & (1U << 5)) != 0U;
+            features.avx512f = osSavesZmm && (registers[1] & (1U << 16)) != 0U;
+            features.sha = (registers[1] & (1U << 29)) != 0U;
+        }
+        #endif
+
+        return features;
+    }
+
+    /// <summary>
+    /// Purpose: Finds the level of an instruction set name. NOT case sensitive.
+    /// </summary>
+    /// <returns>TRUE if the name was found. Otherwise, FALSE.</returns>
+    bool FindLevel(const std::string& levelName, size_t& levelIndexRef)
+    {
+        std::string upperLevelName{};
+        for (char character : levelName)
+        {
+            upperLevelName += static_cast<char>(toupper(static_cast<unsigned char>(character)));
+        }
+
+        for (size_t levelIndex = 0; levelIndex < LEVEL_COUNT; ++levelIndex)
+        {
+            if (upperLevelName == LEVEL_NAMES[levelIndex])
+            {
+                levelIndexRef = levelIndex;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::string ReadEnvironmentVariable(const char* namePtr)
+    {
+        std::string value{};
+
+        #if defined(_MSC_VER)
+        char* valuePtr = nullptr;
+        size_t valueSize = 0;
+        if (_dupenv_s(&valuePtr, &valueSize, namePtr) == 0 && valuePtr != nullptr)
+        {
+            value = valuePtr;
+            free(valuePtr);
+        }
+        #else
+        const char* valuePtr = getenv(namePtr);
+        if (valuePtr != nullptr)
+        {
+            value = valuePtr;
+        }
+        #endif
+
+        return value;
+    }
+
+    /// <summary>
+    /// Purpose: Limits the features to an instruction set level. An unknown level is ignored, so a typing error never disables the kernels.
+    /// </summary>
+    /// <returns>TRUE if the features were limited. Otherwise, FALSE.</returns>
+    bool LimitFeatures(const std::string& levelName, DispatchState& stateRef)
+    {
+        size_t levelIndex = 0;
+        if (levelName.empty() || !FindLevel(levelName, levelIndex))
+        {
+            return false;
+        }
+
+        CpuDispatchLevel level = static_cast<CpuDispatchLevel>(levelIndex);
+        stateRef.limitLevelNamePtr = LEVEL_NAMES[levelIndex];
+
+        if (level < CpuDispatchLevel::AVX512)
+        {
+            stateRef.features.avx512f = false;
+        }
+
+        if (level < CpuDispatchLevel::AVX2)
+        {
+            stateRef.features.avx2 = false;
+        }
+
+        if (level < CpuDispatchLevel::SSE4_2)
+        {
+            stateRef.features.sse42 = false;
+            stateRef.features.pclmul = false;
+            stateRef.features.sha = false;
+        }
+
+        if (level < CpuDispatchLevel::SSE2)
+        {
+            stateRef.features.sse2 = false;
+        }
+
+        return true;
+    }
+
+    DispatchState CreateDispatchState()
+    {
+        DispatchState state{};
+        state.features = DetectFeatures();
+
+        std::string levelName{};
+        {
+            std::lock_guard<std::mutex> lock(g_mutex);
+            levelName = g_levelName;
+        }
+
+        if (levelName.empty())
+        {
+            levelName = ReadEnvironmentVariable(CPU_DISPATCH_ENVIRONMENT_VARIABLE);
+        }
+
+        LimitFeatures(levelName, state);
+        return state;
+    }
+
+    const DispatchState& GetDispatchState()
+    {
+        static const DispatchState state = CreateDispatchState(); // Initialized once, on first use.
+        return state;
+    }
+}
+
+void CpuDispatch::Initialize(const char* levelNamePtr)
+{
+    std::lock_guard<std::mutex> lock(CpuDispatchSupport::g_mutex);
+    CpuDispatchSupport::g_levelName = (levelNamePtr != nullptr) ? levelNamePtr : "";
+}
+
+const CpuFeatures& CpuDispatch::GetFeatures()
+{
+    return CpuDispatchSupport::GetDispatchState().features;
+}
+
+void CpuDispatch::RecordVariant(const char* familyNamePtr, const char* variantNamePtr)
+{
+    std::lock_guard<std::mutex> lock(CpuDispatchSupport::g_mutex);
+    CpuDispatchSupport::g_variantMap[familyNamePtr] = variantNamePtr;
+}
+
+std::wstring CpuDispatch::GetReport()
+{
+    const CpuDispatchSupport::DispatchState& stateRef = CpuDispatchSupport::GetDispatchState();
+    const CpuFeatures& featuresRef = stateRef.features;
+
+    std::string report{};
+    report += featuresRef.sse2 ? "SSE2 " : "";
+    report += featuresRef.sse42 ? "SSE4.2 " : "";
+    report += featuresRef.pclmul ? "PCLMUL " : "";
+    report += featuresRef.sha ? "SHA " : "";
+    report += featuresRef.avx2 ? "AVX2 " : "";
+    report += featuresRef.avx512f ? "AVX-512 " : "";
+    report += report.empty() ? "SCALAR " : "";
+
+    if (stateRef.limitLevelNamePtr != nullptr)
+    {
+        report += "(limited to ";
+        report += stateRef.limitLevelNamePtr;
+        report += ") ";
+    }
+
+    std::lock_guard<std::mutex> lock(CpuDispatchSupport::g_mutex);
+    const char* separatorPtr = "| ";
+    for (const auto& variantPair : CpuDispatchSupport::g_variantMap)
+    {
+        report += separatorPtr;
+        report += variantPair.first;
+        report += ": ";
+        report += variantPair.second;
+        separatorPtr = ", ";
+    }
+
+    if (report.back() == ' ')
+    {
+        report.pop_back();
+    }
+
+    // The names are ASCII, so each character widens unchanged.
+    return std::wstring(report.begin(), report.end());
+}
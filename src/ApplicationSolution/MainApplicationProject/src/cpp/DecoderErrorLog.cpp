@@ -0,0 +1,151 @@
+#include "DecoderErrorLog.h"
+#include <cwchar>
+
+namespace DecoderErrorLogSupport
+{
+    /// <summary>
+    /// Purpose: The text of an Error Code. The count based types also have a singular form, used for a count of 1 or when the error has a time.
+    /// </summary>
+    struct DecoderErrorCodeText
+    {
+        const wchar_t* name;
+        const wchar_t* singularName; // nullptr when the type is NOT count based.
+    };
+
+    // Indexed by DecoderErrorCode. Must be kept in the same order.
+    const DecoderErrorCodeText ERROR_CODE_TEXT[] =
+    {
+        { L"NONE", nullptr },
+
+        // General
+        { L"UNABLE_TO_OPEN_DECODER", nullptr },
+        { L"TRUNCATED", nullptr },
+        { L"LOST_SYNC", nullptr },
+        { L"LOST_SYNC @ END_OF_FILE", nullptr },
+        { L"SEEK_ERROR", nullptr },
+        { L"MD5_MISMATCH", nullptr },
+        { L"MISSING_SAMPLES", L"MISSING_SAMPLE" },
+        { L"EXTRA_SAMPLES", L"EXTRA_SAMPLE" },
+
+        // FLAC
+        { L"ID3v1_TAG_FOUND", nullptr },
+        { L"BAD_HEADER", nullptr },
+        { L"FRAME_CRC_MISMATCH", nullptr },
+        { L"UNPARSEABLE_STREAM", nullptr },
+        { L"BAD_METADATA", nullptr },
+        { L"DECODER_ABORTED", nullptr },
+        { L"MEMORY_ALLOCATION_ERROR", nullptr },
+        { L"OGG_LAYER_ERROR", nullptr },
+        { L"DECODER_ERROR", nullptr },
+        { L"DECODER_LOST_SYNC", nullptr },
+
+        // MP3
+        { L"UNRECOGNIZED_FORMAT", nullptr },
+        { L"BAD_ID3v2_TAG", nullptr },
+        { L"BAD_STARTING_SYNC", nullptr },
+        { L"BAD_APE_TAG", nullptr },
+        { L"BAD_LYRICS3v1_TAG", nullptr },
+        { L"BAD_LYRICS3v2_TAG", nullptr },
+        { L"CRC_ERROR", nullptr },
+        { L"DECODE_ERROR", nullptr },
+        { L"MISSING_FRAMES", L"MISSING_FRAME" },
+        { L"EXTRA_FRAMES", L"EXTRA_FRAME" },
+        { L"MISSING_BYTES", L"MISSING_BYTE" },
+        { L"EXTRA_BYTES", L"EXTRA_BYTE" },
+        { L"MUSIC_CRC_MISMATCH", nullptr },
+        { L"BIT_RESERVOIR_ERROR", nullptr },
+
+        // WavPack
+        { L"BAD_BLOCKS", L"BAD_BLOCK" },
+        { L"SAMPLE_COUNT_UNKNOWN_ERROR", L"SAMPLE_COUNT_UNKNOWN_ERROR" },
+
+        // Ogg-Vorbis
+        { L"OGG-VORBIS_HOLE", nullptr },
+        { L"OGG-VORBIS_EBADLINK", nullptr },
+        { L"UNREADABLE_OR_CORRUPT_HEADER", nullptr },
+        { L"READ_ERROR", nullptr },
+        { L"NON_VORBIS_DATA_IN_BITSTREAM", nullptr },
+        { L"VORBIS_VERSION_MISMATCH", nullptr },
+        { L"INVALID_VORBIS_HEADER", nullptr },
+        { L"DECODER_FAULT_OCCURRED", nullptr },
+    };
+
+    static_assert(sizeof(ERROR_CODE_TEXT) / sizeof(ERROR_CODE_TEXT[0]) == static_cast<size_t>(DecoderErrorCode::COUNT), "ERROR_CODE_TEXT must have one entry per DecoderErrorCode.");
+}
+
+DecoderErrorLog::DecoderErrorLog()
+{
+
+}
+
+DecoderErrorLog::~DecoderErrorLog()
+{
+
+}
+
+void DecoderErrorLog::Add(const DecoderErrorRecord& record)
+{
+    if (this->m_count < MAX_DECODER_ERROR_RECORD_COUNT)
+    {
+        this->m_records[this->m_count++] = record;
+    }
+    else
+    {
+        this->m_records[MAX_DECODER_ERROR_RECORD_COUNT - 1] = record;
+    }
+}
+
+size_t DecoderErrorLog::GetCount() const
+{
+    return this->m_count;
+}
+
+const DecoderErrorRecord& DecoderErrorLog::GetRecord(size_t index) const
+{
+    return this->m_records[index];
+}
+
+const DecoderErrorRecord& DecoderErrorLog::GetLast() const
+{
+    static const DecoderErrorRecord NO_ERROR_RECORD{};
+    return (this->m_count > 0) ? this->m_records[this->m_count - 1] : NO_ERROR_RECORD;
+}
+
+void DecoderErrorLog::Render(const DecoderErrorRecord& record, wchar_t* bufferPtr, size_t bufferSize)
+{
+    if (record.code == DecoderErrorCode::NONE)
+    {
+        bufferPtr[0] = L'\0';
+        return;
+    }
+
+    const DecoderErrorLogSupport::DecoderErrorCodeText& text = DecoderErrorLogSupport::ERROR_CODE_TEXT[static_cast<size_t>(record.code)];
+    unsigned long long timeSeconds = (record.timeBase > 0UL) ? record.position / record.timeBase : 0ULL;
+    int minutes = static_cast<int>(timeSeconds / 60ULL);
+    int seconds = static_cast<int>(timeSeconds % 60ULL);
+
+    if (record.code == DecoderErrorCode::LOST_SYNC_ID3v1_TAG_FOUND)
+    {
+        // The two errors are reported together.
+        swprintf(bufferPtr, bufferSize, L"<LOST_SYNC @ %dm %02ds> <ID3v1_TAG_FOUND>", minutes, seconds);
+    }
+    else if (record.timeBase > 0UL)
+    {
+        // e.g. "LOST_SYNC @ 1m 05s" or "BAD_BLOCK @ 1m 05s"
+        swprintf(bufferPtr, bufferSize, L"%ls @ %dm %02ds", (text.singularName != nullptr) ? text.singularName : text.name, minutes, seconds);
+    }
+    else if (text.singularName != nullptr)
+    {
+        // e.g. "12 MISSING_SAMPLES" or "1 MISSING_SAMPLE"
+        swprintf(bufferPtr, bufferSize, L"%lld %ls", record.detail, (record.detail == 1LL) ? text.singularName : text.name);
+    }
+    else
+    {
+        swprintf(bufferPtr, bufferSize, L"%ls", text.name);
+    }
+}
+
+const wchar_t* DecoderErrorLog::GetCodeName(DecoderErrorCode code)
+{
+    return DecoderErrorLogSupport::ERROR_CODE_TEXT[static_cast<size_t>(code)].name;
+}
@@ -7,10 +7,7 @@ using namespace std;
 /// </summary>
 DecoderManager::DecoderManager()
 {
-    this->PopulateFileExtensionToDecoderNameMap(FlacDecoder::FILE_EXTENSION_TYPES, FlacDecoder::DECODER_NAME);
-    this->PopulateFileExtensionToDecoderNameMap(MP3Decoder::FILE_EXTENSION_TYPES, MP3Decoder::DECODER_NAME);
-    this->PopulateFileExtensionToDecoderNameMap(WavPackDecoder::FILE_EXTENSION_TYPES, WavPackDecoder::DECODER_NAME);
-    this->PopulateFileExtensionToDecoderNameMap(OggVorbisDecoder::FILE_EXTENSION_TYPES, OggVorbisDecoder::DECODER_NAME);
+    // The File Extensions of the Decoders are registered at compile time. See DecoderRegistry.
 }
 
 #pragma region RULE_OF_FIVE_REGION
@@ -68,21 +65,20 @@ DecoderManager::~DecoderManager()
 
 std::unique_ptr<PureAbstractBaseDecoder> DecoderManager::OpenDecoderSmartPointer(const wchar_t* filenamePtr)
 {
-    PureAbstractBaseDecoder* decoderFilePtr = this->OpenDecoder(filenamePtr);
+    return this->OpenDecoderSmartPointer(filenamePtr, 1UL);
+}
+
+std::unique_ptr<PureAbstractBaseDecoder> DecoderManager::OpenDecoderSmartPointer(const wchar_t* filenamePtr, unsigned long availableThreadCount)
+{
+    PureAbstractBaseDecoder* decoderFilePtr = this->OpenDecoder(filenamePtr, availableThreadCount);
     unique_ptr<PureAbstractBaseDecoder> decoderFileSmartPtr(decoderFilePtr); // Convert Raw Pointer to a Smart Pointer.
     return decoderFileSmartPtr;
 }
 
 bool DecoderManager::IsSupportedType(const wchar_t* filenamePtr)
 {
-    if (FindDecoderType(filenamePtr).compare(UNSUPPORTED_TYPE) == 0)
-    {
-        return false;
-    }
-    else
-    {
-        return true;
-    }
+    // Called for every File found while scanning, so the File is NOT read. Only the File Extension is used.
+    return DecoderRegistry::FindByExtension(filenamePtr) != DecoderType::UNSUPPORTED;
 }
 
 void DecoderManager::SetDecoderMemoryBufferEnabled(bool value)
@@ -90,94 +86,136 @@ void DecoderManager::SetDecoderMemoryBufferEnabled(bool value)
     this->decoderMemoryBufferEnabled = value;
 }
 
-#pragma endregion Public_Member_Functions_Region
+void DecoderManager::SetMP3DeepDecodeEnabled(bool value)
+{
+    this->mp3DeepDecodeEnabled = value;
+}
 
-#pragma region Private_Member_Functions_Region
+void DecoderManager::SetSampledVerificationWindowCount(unsigned long value)
+{
+    this->sampledVerificationWindowCount = value;
+}
 
-void DecoderManager::PopulateFileExtensionToDecoderNameMap(const wchar_t* supportedTypesPtr, const wchar_t* decoderName)
+void DecoderManager::SetPcmAnalysisEnabled(bool value)
 {
-    // Iterate through the Array of null-terminated file extensions and populate the Map.
-    while (*supportedTypesPtr != NULL)
-    {
-        wstring supportedType(supportedTypesPtr);
+    this->pcmAnalysisEnabled = value;
+}
 
-        this->m_fileExtensionToDecoderNameMap.insert(std::make_pair(supportedType, decoderName));
+void DecoderManager::SetAccurateRipChecksumEnabled(bool value)
+{
+    this->accurateRipChecksumEnabled = value;
+}
 
-        // Increment the Pointer, by the size of the current Wide String + 1 (the +1 is to advance past the null-terminated characters '\0' within the string literal), 
-        // until it reaches the end and returns the final null-terminated character '\0', which is zero.
-        supportedTypesPtr += wcslen(supportedTypesPtr) + 1; 
-    }
+void DecoderManager::SetMagicByteSniffingEnabled(bool value)
+{
+    this->magicByteSniffingEnabled = value;
 }
 
-std::wstring DecoderManager::FindDecoderType(const wchar_t* filenamePtr) const
+void DecoderManager::SetPcmPipelineEnabled(bool value)
 {
-    // Returns a pointer to the last occurrence of wc in the C-style wide string filename. 
-    // The null-terminating character '\0' is considered part of the string.
+    this->pcmPipelineEnabled = value;
+}
 
-    wchar_t wc = L'.';
-    const wchar_t* lastOccurence = wcsrchr(filenamePtr, wc);
-    if (lastOccurence == NULL)
+void DecoderManager::SetMultiBufferMD5Enabled(bool value)
+{
+    if (value && this->multiBufferMD5ServicePtr == nullptr)
     {
-        // The character was not found in the string.
-        return UNSUPPORTED_TYPE;
+        this->multiBufferMD5ServicePtr = std::make_unique<MultiBufferMD5Service>();
     }
-    else {
-        // The character was found.
-        // Increment the pointer to the next position in the string, just past the found character.
-        lastOccurence++;
+    else if (!value)
+    {
+        this->multiBufferMD5ServicePtr.reset();
     }
+}
 
-    const wchar_t* lowerCaseKeyPtr = Utils::ToLowerCase(lastOccurence); // Creates a lowercase C-Style Wide String on the Heap.
-    wstring lowerCaseWString(lowerCaseKeyPtr);
-
-    wstring value{};
-    auto it = this->m_fileExtensionToDecoderNameMap.find(lowerCaseWString);
-    if (it != this->m_fileExtensionToDecoderNameMap.end()) {
-        // Value found.
-        value = it->second;
-    }
-    else
+unsigned long DecoderManager::GetUsableSpareThreadCount(const wchar_t* filenamePtr, unsigned long spareThreadCount) const
+{
+    // The same conditions as OpenDecoder(). A sampled File is neither split into Segments, nor given a PCM Pipeline.
+    const bool samplingIsEnabled = (this->sampledVerificationWindowCount > 0UL);
+    switch (DecoderRegistry::FindByExtension(filenamePtr))
     {
-        // Value not found.
-        value = UNSUPPORTED_TYPE;
+        case DecoderType::OGG_VORBIS:
+        {
+            const bool segmentsAreEnabled = this->decoderMemoryBufferEnabled && !samplingIsEnabled && !this->pcmAnalysisEnabled;
+            return segmentsAreEnabled ? spareThreadCount : 0UL;
+        }
+        case DecoderType::FLAC:
+        case DecoderType::WAV_PACK:
+        {
+            const bool pipelineIsEnabled = this->pcmPipelineEnabled && !samplingIsEnabled;
+            return (pipelineIsEnabled && spareThreadCount > 0UL) ? 1UL : 0UL;
+        }
+        default:
+            return 0UL;
     }
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
 
-    delete lowerCaseKeyPtr; // Clean up
-    lowerCaseKeyPtr = nullptr;
+DecoderType DecoderManager::FindDecoderType(const wchar_t* filenamePtr) const
+{
+    DecoderType decoderType = DecoderType::UNSUPPORTED;
+    if (this->magicByteSniffingEnabled)
+    {
+        decoderType = DecoderRegistry::FindByContent(filenamePtr);
+    }
 
-    return value;
+    if (decoderType == DecoderType::UNSUPPORTED)
+    {
+        // The content was NOT recognized, so the File Extension is used.
+        decoderType = DecoderRegistry::FindByExtension(filenamePtr);
+    }
 
+    return decoderType;
 }
 
-PureAbstractBaseDecoder* DecoderManager::OpenDecoder(const wchar_t* filenamePtr) const
+PureAbstractBaseDecoder* DecoderManager::OpenDecoder(const wchar_t* filenamePtr, unsigned long availableThreadCount) const
 {
     bool decoderIsOpen = false;
     
-    wstring decoderType = this->FindDecoderType(filenamePtr);
+    DecoderType decoderType = this->FindDecoderType(filenamePtr);
 
     PureAbstractBaseDecoder* decoderFilePtr = nullptr;
-    if (decoderType.compare(FlacDecoder::DECODER_NAME) == 0)
+    if (decoderType == DecoderType::FLAC)
     {
         // Creates a new Decoder object on the Heap.
-        decoderFilePtr = new FlacDecoder(filenamePtr, this->decoderMemoryBufferEnabled);
+        // The MD5 checking of the libFLAC Decoder is used, unless the MD5 signature is computed by the shared MD5 service or may be computed on the Pipeline Thread.
+        bool pipelineIsRequested = this->pcmPipelineEnabled && availableThreadCount > 1UL;
+        decoderFilePtr = new FlacDecoder(filenamePtr, this->decoderMemoryBufferEnabled, this->multiBufferMD5ServicePtr.get(), pipelineIsRequested);
         decoderIsOpen = ((FlacDecoder*)decoderFilePtr)->DecoderIsOpen();
     }
-    else if (decoderType.compare(MP3Decoder::DECODER_NAME) == 0)
+    else if (decoderType == DecoderType::MP3)
     {
         // Creates a new Decoder object on the Heap.
-        decoderFilePtr = new MP3Decoder(filenamePtr, this->decoderMemoryBufferEnabled);
+        if (this->mp3DeepDecodeEnabled)
+        {
+            decoderFilePtr = new MP3DeepDecoder(filenamePtr, this->decoderMemoryBufferEnabled);
+        }
+        else
+        {
+            decoderFilePtr = new MP3Decoder(filenamePtr, this->decoderMemoryBufferEnabled);
+        }
         decoderIsOpen = ((MP3Decoder*)decoderFilePtr)->DecoderIsOpen();
     }
-    else if (decoderType.compare(WavPackDecoder::DECODER_NAME) == 0)
+    else if (decoderType == DecoderType::WAV_PACK)
     {
         // Creates a new Decoder object on the Heap.
-        decoderFilePtr = new WavPackDecoder(filenamePtr, this->decoderMemoryBufferEnabled);
+        decoderFilePtr = new WavPackDecoder(filenamePtr, this->decoderMemoryBufferEnabled, this->multiBufferMD5ServicePtr.get());
         decoderIsOpen = ((WavPackDecoder*)decoderFilePtr)->DecoderIsOpen();
     }
-    else if (decoderType.compare(OggVorbisDecoder::DECODER_NAME) == 0)
+    else if (decoderType == DecoderType::OGG_VORBIS)
     {
         // Creates a new Decoder object on the Heap.
-        decoderFilePtr = new OggVorbisDecoder(filenamePtr, this->decoderMemoryBufferEnabled);
+        // Without a Memory Buffer, every seek is a real disk (or network share) seek. Open the Decoder in Streaming Mode, 
+        // so the File is decoded in a single forward pass without the open-time bisection of the File.
+        // A large resident File can be split into Segments, and verified using the available Threads.
+        // A sampled File needs to seek to each Window, so it is NOT opened in Streaming Mode, and is NOT split into Segments.
+        // An analyzed File must be decoded in order on a single Thread, so it is NOT split into Segments.
+        bool samplingIsEnabled = (this->sampledVerificationWindowCount > 0UL);
+        bool segmentsAreEnabled = !samplingIsEnabled && !this->pcmAnalysisEnabled;
+        decoderFilePtr = new OggVorbisDecoder(filenamePtr, this->decoderMemoryBufferEnabled, !this->decoderMemoryBufferEnabled && !samplingIsEnabled, segmentsAreEnabled ? availableThreadCount : 1UL);
         decoderIsOpen = ((OggVorbisDecoder*)decoderFilePtr)->DecoderIsOpen();
     }
 
@@ -187,6 +225,31 @@ PureAbstractBaseDecoder* DecoderManager::OpenDecoder(const wchar_t* filenamePtr)
         return nullptr;
     }
 
+    bool fileIsSampled = false;
+    if (decoderFilePtr != nullptr && this->sampledVerificationWindowCount > 0UL)
+    {
+        // A File that can NOT be sampled (e.g. the length is unknown) is fully decoded instead.
+        fileIsSampled = decoderFilePtr->EnableSampledVerification(this->sampledVerificationWindowCount);
+    }
+
+    if (decoderFilePtr != nullptr && this->pcmAnalysisEnabled && !fileIsSampled)
+    {
+        // A Decoder that does NOT decode the audio (e.g. MP3 Frame Header walk) is NOT analyzed.
+        decoderFilePtr->EnablePcmAnalysis();
+    }
+
+    if (decoderFilePtr != nullptr && this->accurateRipChecksumEnabled && !fileIsSampled)
+    {
+        // A lossy File, or a File that is NOT CD Audio, has NO checksums.
+        decoderFilePtr->EnableAccurateRipChecksum();
+    }
+
+    if (decoderFilePtr != nullptr && this->pcmPipelineEnabled && !fileIsSampled && availableThreadCount > 1UL)
+    {
+        // A spare Thread is available, so the per-sample work runs alongside the decode. Must be done after the analysis and checksums are enabled.
+        decoderFilePtr->EnablePcmPipeline();
+    }
+
     return decoderFilePtr;
 }
 
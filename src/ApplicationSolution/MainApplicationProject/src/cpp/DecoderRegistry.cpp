@@ -0,0 +1,233 @@
+#include "DecoderRegistry.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include "FlacDecoder.h"
+#include "MP3Decoder.h"
+#include "WavPackDecoder.h"
+#include "OggVorbisDecoder.h"
+#include "RemoteStreamSource.h"
+#include "StreamWrapper.h"
+
+namespace DecoderRegistrySupport
+{
+    /// <summary>
+    /// Purpose: A File Extension is packed into a 32-bit Key, one byte per character, so the longest File Extension is 4 characters.
+    /// </summary>
+    constexpr auto MAXIMUM_EXTENSION_LENGTH = 4U;
+
+    /// <summary>
+    /// Purpose: The Hash Table has 2^TABLE_BITS slots. The Key of an empty slot is 0, which is NOT a valid packed File Extension.
+    /// </summary>
+    constexpr auto TABLE_BITS = 4U;
+    constexpr auto TABLE_SIZE = 1U << TABLE_BITS;
+
+    /// <summary>
+    /// Purpose: The number of multipliers tried while searching for a Perfect Hash.
+    /// </summary>
+    constexpr auto MAXIMUM_MULTIPLIER_SEARCH_COUNT = 4096U;
+
+    struct ExtensionTable
+    {
+        uint32_t keys[TABLE_SIZE]{};
+        DecoderType types[TABLE_SIZE]{};
+        uint32_t multiplier{};
+        bool isPerfect{ false };
+    };
+
+    /// <summary>
+    /// Purpose: Multiplicative (Fibonacci) Hashing. The top TABLE_BITS bits of the product select the slot.
+    /// </summary>
+    constexpr uint32_t GetSlot(uint32_t key, uint32_t multiplier)
+    {
+        return static_cast<uint32_t>(key * multiplier) >> (32U - TABLE_BITS);
+    }
+
+    /// <summary>
+    /// Purpose: Inserts the null-separated File Extensions of a Decoder (e.g. L"flac\0fla\0").
+    /// </summary>
+    /// <returns>FALSE if a File Extension is too long, or its slot is already taken by another File Extension.</returns>
+    template <size_t N>
+    constexpr bool InsertExtensions(ExtensionTable& tableRef, const wchar_t (&extensions)[N], DecoderType type)
+    {
+        size_t index = 0;
+        while (index < N && extensions[index] != L'\0')
+        {
+            uint32_t key = 0U;
+            unsigned int length = 0U;
+            while (index < N && extensions[index] != L'\0')
+            {
+                if (length == MAXIMUM_EXTENSION_LENGTH)
+                {
+                    return false;
+                }
+
+                key |= static_cast<uint32_t>(extensions[index] & 0xFF) << (8U * length);
+                ++length;
+                ++index;
+            }
+            ++index; // Skip the null separator.
+
+            uint32_t slot = GetSlot(key, tableRef.multiplier);
+            if (tableRef.keys[slot] != 0U)
+            {
+                return false;
+            }
+
+            tableRef.keys[slot] = key;
+            tableRef.types[slot] = type;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Purpose: Builds the Hash Table at compile time, searching for a multiplier that places every File Extension in its own slot.
+    /// A new Decoder only needs to be added here, and to the DecoderType enumeration.
+    /// </summary>
+    constexpr ExtensionTable BuildExtensionTable()
+    {
+        uint32_t multiplier = 0x9E3779B1U; // 2^32 divided by the Golden Ratio, rounded to odd.
+        for (unsigned int attempt = 0U; attempt < MAXIMUM_MULTIPLIER_SEARCH_COUNT; ++attempt)
+        {
+            ExtensionTable table{};
+            table.multiplier = multiplier;
+            if (InsertExtensions(table, FlacDecoder::FILE_EXTENSION_TYPES, DecoderType::FLAC) &&
+                InsertExtensions(table, MP3Decoder::FILE_EXTENSION_TYPES, DecoderType::MP3) &&
+                InsertExtensions(table, WavPackDecoder::FILE_EXTENSION_TYPES, DecoderType::WAV_PACK) &&
+                InsertExtensions(table, OggVorbisDecoder::FILE_EXTENSION_TYPES, DecoderType::OGG_VORBIS))
+            {
+                table.isPerfect = true;
+                return table;
+            }
+
+            multiplier += 2U;
+        }
+
+        return ExtensionTable{};
+    }
+
+    constexpr ExtensionTable EXTENSION_TABLE = BuildExtensionTable();
+    static_assert(EXTENSION_TABLE.isPerfect, "No Perfect Hash was found for the File Extensions. Increase TABLE_BITS.");
+
+    /// <summary>
+    /// Purpose: Reads a 28-bit 'syncsafe' integer (7 bits per byte), as used by the ID3v2 Tag Header.
+    /// URI: https://id3.org/id3v2.4.0-structure
+    /// </summary>
+    inline unsigned long ReadSyncsafeInteger(const unsigned char* bytePtr)
+    {
+        return (static_cast<unsigned long>(bytePtr[0] & 0x7F) << 21) | (static_cast<unsigned long>(bytePtr[1] & 0x7F) << 14) |
+            (static_cast<unsigned long>(bytePtr[2] & 0x7F) << 7) | static_cast<unsigned long>(bytePtr[3] & 0x7F);
+    }
+}
+
+DecoderType DecoderRegistry::FindByExtension(const wchar_t* filenamePtr)
+{
+    // The path of a URL ends at its query or fragment (e.g. a pre-signed URL ends with "?X-Amz-Signature=...").
+    const wchar_t* endPtr = filenamePtr + (RemoteStreamSource::IsRemotePath(filenamePtr) ? wcscspn(filenamePtr, L"?#") : wcslen(filenamePtr));
+
+    // Find the last occurrence of '.' in the filename. The search stops at the last path separator, so a '.' in a Folder name
+    // (e.g. "C:\Music\Album.flac\track") is NOT taken as the File Extension.
+    const wchar_t* extensionPtr = endPtr;
+    while (extensionPtr != filenamePtr && *(extensionPtr - 1) != L'.' && *(extensionPtr - 1) != L'\\' && *(extensionPtr - 1) != L'/')
+    {
+        --extensionPtr;
+    }
+
+    if (extensionPtr == filenamePtr || *(extensionPtr - 1) != L'.')
+    {
+        return DecoderType::UNSUPPORTED;
+    }
+
+    // Pack the lowercase File Extension into the Key. Only ASCII File Extensions are registered.
+    uint32_t key = 0U;
+    unsigned int length = 0U;
+    for (; extensionPtr != endPtr; ++extensionPtr, ++length)
+    {
+        wchar_t character = *extensionPtr;
+        if (length == DecoderRegistrySupport::MAXIMUM_EXTENSION_LENGTH || character > 0x7F)
+        {
+            return DecoderType::UNSUPPORTED;
+        }
+
+        if (character >= L'A' && character <= L'Z')
+        {
+            character += (L'a' - L'A');
+        }
+
+        key |= static_cast<uint32_t>(character) << (8U * length);
+    }
+
+    if (key == 0U)
+    {
+        return DecoderType::UNSUPPORTED;
+    }
+
+    uint32_t slot = DecoderRegistrySupport::GetSlot(key, DecoderRegistrySupport::EXTENSION_TABLE.multiplier);
+    return (DecoderRegistrySupport::EXTENSION_TABLE.keys[slot] == key) ? DecoderRegistrySupport::EXTENSION_TABLE.types[slot] : DecoderType::UNSUPPORTED;
+}
+
+DecoderType DecoderRegistry::FindByContent(const wchar_t* filenamePtr)
+{
+    StreamWrapper stream{};
+    if (!stream.Open(filenamePtr, false))
+    {
+        return DecoderType::UNSUPPORTED;
+    }
+
+    unsigned char header[DECODER_REGISTRY_SNIFF_SIZE]{};
+    size_t size = stream.Read(header, sizeof(header));
+    DecoderType type = Sniff(header, size);
+
+    if (type == DecoderType::MP3 && size == sizeof(header) && memcmp(header, "ID3", 3) == 0)
+    {
+        // An ID3v2 Tag is NOT part of the MP3 format, and is also found in front of FLAC Streams. Look at the bytes after the Tag.
+        // The Tag size excludes the 10-byte Header, and the 10-byte Footer (when flag bit 4 is set).
+        long long tagSize = 10LL + DecoderRegistrySupport::ReadSyncsafeInteger(header + 6) + ((header[5] & 0x10) ? 10LL : 0LL);
+        if (stream.Seek(tagSize, SEEK_SET) == 0 && stream.Read(header, sizeof(header)) >= 4 && memcmp(header, "fLaC", 4) == 0)
+        {
+            type = DecoderType::FLAC;
+        }
+    }
+
+    stream.Close();
+    return type;
+}
+
+DecoderType DecoderRegistry::Sniff(const unsigned char* headerPtr, size_t size)
+{
+    if (size >= 4)
+    {
+        // URI: https://xiph.org/flac/format.html#stream
+        if (memcmp(headerPtr, "fLaC", 4) == 0)
+        {
+            return DecoderType::FLAC;
+        }
+
+        // URI: https://xiph.org/ogg/doc/framing.html
+        if (memcmp(headerPtr, "OggS", 4) == 0)
+        {
+            return DecoderType::OGG_VORBIS;
+        }
+
+        // URI: https://www.wavpack.com/WavPack5FileFormat.pdf
+        if (memcmp(headerPtr, "wvpk", 4) == 0)
+        {
+            return DecoderType::WAV_PACK;
+        }
+    }
+
+    if (size >= 3 && memcmp(headerPtr, "ID3", 3) == 0)
+    {
+        return DecoderType::MP3;
+    }
+
+    // An MPEG Audio Frame Sync (11 set bits), with a valid Version (NOT reserved) and Layer (NOT reserved).
+    if (size >= 2 && headerPtr[0] == 0xFF && (headerPtr[1] & 0xE0) == 0xE0 && (headerPtr[1] & 0x18) != 0x08 && (headerPtr[1] & 0x06) != 0x00)
+    {
+        return DecoderType::MP3;
+    }
+
+    return DecoderType::UNSUPPORTED;
+}
@@ -0,0 +1,290 @@
+#include "DecoderTuning.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cwchar>
+
+namespace DecoderTuningSupport
+{
+    constexpr const wchar_t* PARAMETER_NAMES[DECODER_TUNING_PARAMETER_COUNT] = { L"STREAM_READ_BLOCK_SIZE", L"OGG_VORBIS_READ_CHUNK_SIZE", L"WAVPACK_UNPACK_SAMPLE_COUNT" };
+
+    /// <summary>
+    /// Purpose: The candidate values of each parameter, in increasing order. A value loaded from a profile File must be within the range of its candidates.
+    /// An Ogg-Vorbis Packet holds at most 4096 Samples per channel (i.e. half of the largest common Block Size), so larger chunks are NOT swept.
+    /// </summary>
+    const std::vector<unsigned long> CANDIDATE_VALUES[DECODER_TUNING_PARAMETER_COUNT] =
+    {
+        { 16384UL, 32768UL, 65536UL, 131072UL, 262144UL, 1048576UL, 4194304UL },
+        { 256UL, 512UL, 1024UL, 2048UL, 4096UL, 8192UL },
+        { 1024UL, 2048UL, 4096UL, 8192UL, 16384UL, 32768UL, 65536UL }
+    };
+
+    constexpr auto MAX_PROFILE_LINE_SIZE = 256;
+    constexpr auto MAX_CURVE_LINE_SIZE = 256;
+
+    std::mutex g_mutex{};
+    DecoderTuningProfile g_profile{};
+
+    /// <summary>
+    /// Purpose: The profile of the active DecoderTuningScope of each Thread. NULL when NO Scope is active.
+    /// </summary>
+    thread_local const DecoderTuningProfile* g_threadProfilePtr = nullptr;
+
+    size_t ToIndex(DecoderTuningParameter parameter)
+    {
+        return static_cast<size_t>(parameter);
+    }
+}
+
+#pragma region DecoderTuning_Functions_Region
+
+DecoderTuningProfile DecoderTuning::GetProfile()
+{
+    if (DecoderTuningSupport::g_threadProfilePtr != nullptr)
+    {
+        return *DecoderTuningSupport::g_threadProfilePtr;
+    }
+
+    std::lock_guard<std::mutex> lock(DecoderTuningSupport::g_mutex);
+    return DecoderTuningSupport::g_profile;
+}
+
+void DecoderTuning::SetProfile(const DecoderTuningProfile& profileRef)
+{
+    std::lock_guard<std::mutex> lock(DecoderTuningSupport::g_mutex);
+    DecoderTuningSupport::g_profile = profileRef;
+}
+
+bool DecoderTuning::LoadProfile(const wchar_t* filenamePtr, DecoderTuningProfile& profileRef)
+{
+    FILE* filePtr = nullptr;
+    if (filenamePtr == nullptr || _wfopen_s(&filePtr, filenamePtr, L"r") != 0 || filePtr == nullptr)
+    {
+        return false;
+    }
+
+    wchar_t line[DecoderTuningSupport::MAX_PROFILE_LINE_SIZE]{};
+    while (fgetws(line, DecoderTuningSupport::MAX_PROFILE_LINE_SIZE, filePtr) != nullptr)
+    {
+        const wchar_t* separatorPtr = wcschr(line, L'=');
+        if (line[0] == L'#' || separatorPtr == nullptr)
+        {
+            // A comment, or NOT a "NAME=VALUE" line.
+            continue;
+        }
+
+        size_t nameLength = static_cast<size_t>(separatorPtr - line);
+        for (size_t parameterIndex = 0; parameterIndex < DECODER_TUNING_PARAMETER_COUNT; ++parameterIndex)
+        {
+            const wchar_t* parameterNamePtr = DecoderTuningSupport::PARAMETER_NAMES[parameterIndex];
+            if (wcslen(parameterNamePtr) != nameLength || wcsncmp(line, parameterNamePtr, nameLength) != 0)
+            {
+                continue;
+            }
+
+            // A value outside the swept range is ignored (e.g. a profile edited by hand), so a bad profile never slows down a scan.
+            const std::vector<unsigned long>& candidateValuesRef = DecoderTuningSupport::CANDIDATE_VALUES[parameterIndex];
+            unsigned long value = wcstoul(separatorPtr + 1, nullptr, 10);
+            if (value >= candidateValuesRef.front() && value <= candidateValuesRef.back())
+            {
+                DecoderTuning::SetValue(profileRef, static_cast<DecoderTuningParameter>(parameterIndex), value);
+            }
+        }
+    }
+
+    fclose(filePtr);
+    return true;
+}
+
+bool DecoderTuning::SaveProfile(const wchar_t* filenamePtr, const DecoderTuningProfile& profileRef)
+{
+    FILE* filePtr = nullptr;
+    if (filenamePtr == nullptr || _wfopen_s(&filePtr, filenamePtr, L"w") != 0 || filePtr == nullptr)
+    {
+        return false;
+    }
+
+    bool isWritten = fputws(L"# Decoder tuning profile. Measured on this machine by the tuning mode.\n", filePtr) >= 0;
+    for (size_t parameterIndex = 0; parameterIndex < DECODER_TUNING_PARAMETER_COUNT; ++parameterIndex)
+    {
+        DecoderTuningParameter parameter = static_cast<DecoderTuningParameter>(parameterIndex);
+        isWritten = isWritten && fwprintf(filePtr, L"%ls=%lu\n", DecoderTuning::GetParameterName(parameter), DecoderTuning::GetValue(profileRef, parameter)) >= 0;
+    }
+
+    // The profile is only complete when the File is closed successfully.
+    isWritten = (fclose(filePtr) == 0) && isWritten;
+    return isWritten;
+}
+
+const wchar_t* DecoderTuning::GetParameterName(DecoderTuningParameter parameter)
+{
+    return DecoderTuningSupport::PARAMETER_NAMES[DecoderTuningSupport::ToIndex(parameter)];
+}
+
+const std::vector<unsigned long>& DecoderTuning::GetCandidateValues(DecoderTuningParameter parameter)
+{
+    return DecoderTuningSupport::CANDIDATE_VALUES[DecoderTuningSupport::ToIndex(parameter)];
+}
+
+unsigned long DecoderTuning::GetValue(const DecoderTuningProfile& profileRef, DecoderTuningParameter parameter)
+{
+    switch (parameter)
+    {
+        case DecoderTuningParameter::STREAM_READ_BLOCK_SIZE:
+            return profileRef.streamReadBlockSize;
+        case DecoderTuningParameter::OGG_VORBIS_READ_CHUNK_SIZE:
+            return profileRef.oggVorbisReadChunkSize;
+        case DecoderTuningParameter::WAVPACK_UNPACK_SAMPLE_COUNT:
+            return profileRef.wavPackUnpackSampleCount;
+    }
+
+    return 0UL;
+}
+
+void DecoderTuning::SetValue(DecoderTuningProfile& profileRef, DecoderTuningParameter parameter, unsigned long value)
+{
+    switch (parameter)
+    {
+        case DecoderTuningParameter::STREAM_READ_BLOCK_SIZE:
+            profileRef.streamReadBlockSize = value;
+            break;
+        case DecoderTuningParameter::OGG_VORBIS_READ_CHUNK_SIZE:
+            profileRef.oggVorbisReadChunkSize = value;
+            break;
+        case DecoderTuningParameter::WAVPACK_UNPACK_SAMPLE_COUNT:
+            profileRef.wavPackUnpackSampleCount = value;
+            break;
+    }
+}
+
+bool DecoderTuning::IsUsedByDecoder(DecoderTuningParameter parameter, DecoderType decoderType, bool memoryBufferIsEnabled)
+{
+    switch (parameter)
+    {
+        case DecoderTuningParameter::STREAM_READ_BLOCK_SIZE:
+            return memoryBufferIsEnabled && decoderType != DecoderType::UNSUPPORTED;
+        case DecoderTuningParameter::OGG_VORBIS_READ_CHUNK_SIZE:
+            return decoderType == DecoderType::OGG_VORBIS;
+        case DecoderTuningParameter::WAVPACK_UNPACK_SAMPLE_COUNT:
+            return decoderType == DecoderType::WAV_PACK;
+    }
+
+    return false;
+}
+
+#pragma endregion DecoderTuning_Functions_Region
+
+#pragma region DecoderTuningScope_Member_Functions_Region
+
+DecoderTuningScope::DecoderTuningScope(const DecoderTuningProfile& profileRef) : m_profile(profileRef)
+{
+    DecoderTuningSupport::g_threadProfilePtr = &this->m_profile;
+}
+
+DecoderTuningScope::~DecoderTuningScope()
+{
+    DecoderTuningSupport::g_threadProfilePtr = nullptr;
+}
+
+#pragma endregion DecoderTuningScope_Member_Functions_Region
+
+#pragma region DecoderTuner_Member_Functions_Region
+
+DecoderTuner::DecoderTuner()
+{
+
+}
+
+DecoderTuner::~DecoderTuner()
+{
+
+}
+
+bool DecoderTuner::AcceptSample(DecoderType decoderType, unsigned long sampleStride, unsigned long sampleFileCount, unsigned long& sampleIndexRef)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    // The first File of each Decoder is always sampled, then every sampleStride-th File.
+    std::pair<unsigned long, unsigned long>& fileCountPairRef = this->m_decoderFileCountMap[decoderType];
+    unsigned long fileIndex = fileCountPairRef.first++;
+    if (decoderType == DecoderType::UNSUPPORTED || fileCountPairRef.second >= sampleFileCount || (sampleStride > 1UL && fileIndex % sampleStride != 0UL))
+    {
+        return false;
+    }
+
+    ++fileCountPairRef.second;
+    sampleIndexRef = this->m_sampleCount++;
+    return true;
+}
+
+void DecoderTuner::AddMeasurement(DecoderTuningParameter parameter, unsigned long value, unsigned long long byteCount, double seconds)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    Measurement& measurementRef = this->m_measurementMap[std::make_pair(parameter, value)];
+    measurementRef.byteCount += byteCount;
+    measurementRef.seconds += seconds;
+    ++measurementRef.fileCount;
+}
+
+unsigned long DecoderTuner::GetSampleCount() const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_sampleCount;
+}
+
+DecoderTuningProfile DecoderTuner::GetBestProfile(const DecoderTuningProfile& baseProfileRef) const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    DecoderTuningProfile bestProfile = baseProfileRef;
+    double bestThroughput[DECODER_TUNING_PARAMETER_COUNT]{};
+    for (const auto& measurementPair : this->m_measurementMap)
+    {
+        // Every candidate of a parameter is measured on the same Files, so the total bytes per total second are compared.
+        const Measurement& measurementRef = measurementPair.second;
+        if (measurementRef.seconds <= 0.0)
+        {
+            continue;
+        }
+
+        double throughput = static_cast<double>(measurementRef.byteCount) / measurementRef.seconds;
+        size_t parameterIndex = DecoderTuningSupport::ToIndex(measurementPair.first.first);
+        if (throughput > bestThroughput[parameterIndex])
+        {
+            bestThroughput[parameterIndex] = throughput;
+            DecoderTuning::SetValue(bestProfile, measurementPair.first.first, measurementPair.first.second);
+        }
+    }
+
+    return bestProfile;
+}
+
+std::wstring DecoderTuner::GetThroughputCurve(const DecoderTuningProfile& bestProfileRef) const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    std::wstring curve{};
+    wchar_t line[DecoderTuningSupport::MAX_CURVE_LINE_SIZE]{};
+    const DecoderTuningParameter* previousParameterPtr = nullptr;
+    for (const auto& measurementPair : this->m_measurementMap)
+    {
+        const DecoderTuningParameter& parameterRef = measurementPair.first.first;
+        if (previousParameterPtr == nullptr || *previousParameterPtr != parameterRef)
+        {
+            curve += L"\r\n";
+            curve += DecoderTuning::GetParameterName(parameterRef);
+            previousParameterPtr = &parameterRef;
+        }
+
+        const Measurement& measurementRef = measurementPair.second;
+        double megabytesPerSecond = (measurementRef.seconds > 0.0) ? (static_cast<double>(measurementRef.byteCount) / measurementRef.seconds / 1000000.0) : 0.0;
+        bool isBest = DecoderTuning::GetValue(bestProfileRef, parameterRef) == measurementPair.first.second;
+        swprintf(line, DecoderTuningSupport::MAX_CURVE_LINE_SIZE, L"\r\n\t%lu\t%.1f MB/s (%lu %ls)%ls", measurementPair.first.second, megabytesPerSecond,
+            measurementRef.fileCount, (measurementRef.fileCount == 1UL) ? L"File" : L"Files", isBest ? L"\t<BEST>" : L""); // Write to the buffer.
+        curve += line;
+    }
+
+    return curve;
+}
+
+#pragma endregion DecoderTuner_Member_Functions_Region
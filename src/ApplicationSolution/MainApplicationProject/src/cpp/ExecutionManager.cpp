@@ -80,11 +80,19 @@ bool MainApplication::ExecutionManager::IsFolderQueueEmpty()
 void MainApplication::ExecutionManager::AddToProcessedFileList(const wchar_t* filenamePtr)
 {
     this->processedFileList.push_back(filenamePtr);
+
+    // The size is read on the Folder Thread, so the Decoder Threads do NOT have to read it again.
+    unsigned long long fileSize = 0ULL;
+    if (WinAPIUtils::GetFileSize(filenamePtr, fileSize))
+    {
+        this->processedByteCount += fileSize;
+    }
 }
 
 void MainApplication::ExecutionManager::ClearProcessedFileList()
 {
     this->processedFileList.clear();
+    this->processedByteCount = 0ULL;
 }
 
 std::list<std::wstring>& MainApplication::ExecutionManager::GetProcessedFileListRef()
@@ -92,6 +100,11 @@ std::list<std::wstring>& MainApplication::ExecutionManager::GetProcessedFileList
     return this->processedFileList;
 }
 
+unsigned long long MainApplication::ExecutionManager::GetProcessedByteCount() const
+{
+    return this->processedByteCount;
+}
+
 bool MainApplication::ExecutionManager::IsRunningStateFlagEnabled() const
 {
     return this->runningStateFlagEnabled;
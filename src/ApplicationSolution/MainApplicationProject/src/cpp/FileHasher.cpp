@@ -0,0 +1,267 @@
+#include "FileHasher.h"
+#include "AccurateRipChecksum.h"
+#include <climits>
+#include <cstring>
+
+namespace FileHasherSupport
+{
+    /// <summary>
+    /// Purpose: The XXH64 primes.
+    /// </summary>
+    constexpr uint64_t XXH64_PRIME_1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t XXH64_PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t XXH64_PRIME_3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t XXH64_PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t XXH64_PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+    /// <summary>
+    /// Purpose: The offset of the MD5 signature in a FLAC File that starts with its STREAMINFO Block.
+    /// URI: https://www.rfc-editor.org/rfc/rfc9639#name-streaminfo
+    /// </summary>
+    constexpr auto FLAC_SIGNATURE_OFFSET = 26U;
+
+    inline uint64_t RotateLeft64(uint64_t value, unsigned int count)
+    {
+        return (value << count) | (value >> (64U - count));
+    }
+
+    inline uint64_t LoadLittleEndian64(const unsigned char* bytePtr)
+    {
+        uint64_t value = 0ULL;
+        for (int byteIndex = 7; byteIndex >= 0; --byteIndex)
+        {
+            value = (value << 8) | bytePtr[byteIndex];
+        }
+
+        return value;
+    }
+
+    inline uint64_t LoadLittleEndian32(const unsigned char* bytePtr)
+    {
+        return static_cast<uint64_t>(bytePtr[0]) | (static_cast<uint64_t>(bytePtr[1]) << 8) | (static_cast<uint64_t>(bytePtr[2]) << 16) | (static_cast<uint64_t>(bytePtr[3]) << 24);
+    }
+
+    inline uint64_t Xxh64Round(uint64_t accumulator, uint64_t lane)
+    {
+        accumulator += lane * XXH64_PRIME_2;
+        accumulator = RotateLeft64(accumulator, 31U);
+        return accumulator * XXH64_PRIME_1;
+    }
+
+    inline uint64_t Xxh64MergeAccumulator(uint64_t hash, uint64_t accumulator)
+    {
+        hash ^= Xxh64Round(0ULL, accumulator);
+        return hash * XXH64_PRIME_1 + XXH64_PRIME_4;
+    }
+}
+
+/// <summary>
+/// Purpose: Constructor. The XXH64 seed is 0, as used by xxhsum.
+/// </summary>
+FileHasher::FileHasher(unsigned int algorithmMask)
+{
+    this->m_algorithmMask = algorithmMask;
+    md5_init(&this->m_md5State);
+
+    this->m_xxh64Accumulators[0] = FileHasherSupport::XXH64_PRIME_1 + FileHasherSupport::XXH64_PRIME_2;
+    this->m_xxh64Accumulators[1] = FileHasherSupport::XXH64_PRIME_2;
+    this->m_xxh64Accumulators[2] = 0ULL;
+    this->m_xxh64Accumulators[3] = 0ULL - FileHasherSupport::XXH64_PRIME_1;
+}
+
+/// <summary>
+/// Purpose: Destructor
+/// </summary>
+FileHasher::~FileHasher()
+{
+
+}
+
+#pragma region Public_Member_Functions_Region
+
+unsigned int FileHasher::GetAlgorithmMask(FileHashAlgorithm algorithm)
+{
+    return 1U << static_cast<unsigned int>(algorithm);
+}
+
+const wchar_t* FileHasher::GetAlgorithmName(FileHashAlgorithm algorithm)
+{
+    switch (algorithm)
+    {
+        case FileHashAlgorithm::MD5:
+            return L"MD5";
+        case FileHashAlgorithm::CRC32:
+            return L"CRC32";
+        case FileHashAlgorithm::XXH64:
+            return L"XXH64";
+        default:
+            return L"FLAC_SIGNATURE";
+    }
+}
+
+void FileHasher::Update(const unsigned char* dataPtr, size_t size)
+{
+    if (this->m_headerSize < sizeof(this->m_header))
+    {
+        size_t headerCopySize = (size < sizeof(this->m_header) - this->m_headerSize) ? size : sizeof(this->m_header) - this->m_headerSize;
+        memcpy(this->m_header + this->m_headerSize, dataPtr, headerCopySize);
+        this->m_headerSize += headerCopySize;
+    }
+
+    this->m_totalSize += size;
+
+    if (this->m_algorithmMask & FileHasher::GetAlgorithmMask(FileHashAlgorithm::MD5))
+    {
+        // md5_append() takes an int size, so a large Block is added in parts.
+        const unsigned char* md5DataPtr = dataPtr;
+        size_t md5RemainingSize = size;
+        while (md5RemainingSize > 0)
+        {
+            int partSize = (md5RemainingSize < static_cast<size_t>(INT_MAX)) ? static_cast<int>(md5RemainingSize) : INT_MAX;
+            md5_append(&this->m_md5State, md5DataPtr, partSize);
+            md5DataPtr += partSize;
+            md5RemainingSize -= static_cast<size_t>(partSize);
+        }
+    }
+
+    if (this->m_algorithmMask & FileHasher::GetAlgorithmMask(FileHashAlgorithm::CRC32))
+    {
+        this->m_crc32 = AccurateRipChecksum::UpdateCrc32(this->m_crc32, dataPtr, size);
+    }
+
+    if (this->m_algorithmMask & FileHasher::GetAlgorithmMask(FileHashAlgorithm::XXH64))
+    {
+        // Complete the Stripe left by the previous Block, then add the whole Stripes in place, and keep the rest for the next Block.
+        if (this->m_xxh64StripeSize > 0)
+        {
+            size_t stripeCopySize = (size < sizeof(this->m_xxh64Stripe) - this->m_xxh64StripeSize) ? size : sizeof(this->m_xxh64Stripe) - this->m_xxh64StripeSize;
+            memcpy(this->m_xxh64Stripe + this->m_xxh64StripeSize, dataPtr, stripeCopySize);
+            this->m_xxh64StripeSize += stripeCopySize;
+            dataPtr += stripeCopySize;
+            size -= stripeCopySize;
+
+            if (this->m_xxh64StripeSize == sizeof(this->m_xxh64Stripe))
+            {
+                this->UpdateXxh64Stripes(this->m_xxh64Stripe, 1);
+                this->m_xxh64StripeSize = 0;
+            }
+        }
+
+        if (size > 0)
+        {
+            size_t stripeCount = size / sizeof(this->m_xxh64Stripe);
+            this->UpdateXxh64Stripes(dataPtr, stripeCount);
+
+            this->m_xxh64StripeSize = size - stripeCount * sizeof(this->m_xxh64Stripe);
+            memcpy(this->m_xxh64Stripe, dataPtr + stripeCount * sizeof(this->m_xxh64Stripe), this->m_xxh64StripeSize);
+        }
+    }
+}
+
+FileDigests FileHasher::Finish()
+{
+    FileDigests digests{};
+
+    if (this->m_algorithmMask & FileHasher::GetAlgorithmMask(FileHashAlgorithm::MD5))
+    {
+        md5_finish(&this->m_md5State, digests.md5);
+    }
+
+    if (this->m_algorithmMask & FileHasher::GetAlgorithmMask(FileHashAlgorithm::CRC32))
+    {
+        uint32_t crc32 = ~this->m_crc32;
+        for (int byteIndex = 0; byteIndex < 4; ++byteIndex)
+        {
+            digests.crc32[byteIndex] = static_cast<unsigned char>(crc32 >> (24 - 8 * byteIndex));
+        }
+    }
+
+    if (this->m_algorithmMask & FileHasher::GetAlgorithmMask(FileHashAlgorithm::XXH64))
+    {
+        const uint64_t (&accumulators)[4] = this->m_xxh64Accumulators;
+        uint64_t hash = FileHasherSupport::XXH64_PRIME_5;
+        if (this->m_totalSize >= sizeof(this->m_xxh64Stripe))
+        {
+            hash = FileHasherSupport::RotateLeft64(accumulators[0], 1U) + FileHasherSupport::RotateLeft64(accumulators[1], 7U) +
+                FileHasherSupport::RotateLeft64(accumulators[2], 12U) + FileHasherSupport::RotateLeft64(accumulators[3], 18U);
+            for (uint64_t accumulator : accumulators)
+            {
+                hash = FileHasherSupport::Xxh64MergeAccumulator(hash, accumulator);
+            }
+        }
+
+        hash += this->m_totalSize;
+
+        // Add the bytes after the last whole Stripe: 8 bytes at a time, then 4 bytes, then 1 byte at a time.
+        const unsigned char* tailPtr = this->m_xxh64Stripe;
+        size_t tailSize = this->m_xxh64StripeSize;
+        for (; tailSize >= 8; tailPtr += 8, tailSize -= 8)
+        {
+            hash ^= FileHasherSupport::Xxh64Round(0ULL, FileHasherSupport::LoadLittleEndian64(tailPtr));
+            hash = FileHasherSupport::RotateLeft64(hash, 27U) * FileHasherSupport::XXH64_PRIME_1 + FileHasherSupport::XXH64_PRIME_4;
+        }
+
+        if (tailSize >= 4)
+        {
+            hash ^= FileHasherSupport::LoadLittleEndian32(tailPtr) * FileHasherSupport::XXH64_PRIME_1;
+            hash = FileHasherSupport::RotateLeft64(hash, 23U) * FileHasherSupport::XXH64_PRIME_2 + FileHasherSupport::XXH64_PRIME_3;
+            tailPtr += 4;
+            tailSize -= 4;
+        }
+
+        for (; tailSize > 0; ++tailPtr, --tailSize)
+        {
+            hash ^= *tailPtr * FileHasherSupport::XXH64_PRIME_5;
+            hash = FileHasherSupport::RotateLeft64(hash, 11U) * FileHasherSupport::XXH64_PRIME_1;
+        }
+
+        // Avalanche.
+        hash ^= hash >> 33;
+        hash *= FileHasherSupport::XXH64_PRIME_2;
+        hash ^= hash >> 29;
+        hash *= FileHasherSupport::XXH64_PRIME_3;
+        hash ^= hash >> 32;
+
+        for (int byteIndex = 0; byteIndex < 8; ++byteIndex)
+        {
+            digests.xxh64[byteIndex] = static_cast<unsigned char>(hash >> (56 - 8 * byteIndex));
+        }
+    }
+
+    // The first Metadata Block of a FLAC Stream must be STREAMINFO (Block Type 0).
+    if (this->m_headerSize == sizeof(this->m_header) && memcmp(this->m_header, "fLaC", 4) == 0 && (this->m_header[4] & 0x7F) == 0)
+    {
+        memcpy(digests.flacSignature, this->m_header + FileHasherSupport::FLAC_SIGNATURE_OFFSET, sizeof(digests.flacSignature));
+        digests.flacSignatureIsKnown = true;
+    }
+
+    return digests;
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+void FileHasher::UpdateXxh64Stripes(const unsigned char* dataPtr, size_t stripeCount)
+{
+    uint64_t accumulator0 = this->m_xxh64Accumulators[0];
+    uint64_t accumulator1 = this->m_xxh64Accumulators[1];
+    uint64_t accumulator2 = this->m_xxh64Accumulators[2];
+    uint64_t accumulator3 = this->m_xxh64Accumulators[3];
+
+    // The four accumulators are independent, so the CPU overlaps their multiplications.
+    for (size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex, dataPtr += 32)
+    {
+        accumulator0 = FileHasherSupport::Xxh64Round(accumulator0, FileHasherSupport::LoadLittleEndian64(dataPtr));
+        accumulator1 = FileHasherSupport::Xxh64Round(accumulator1, FileHasherSupport::LoadLittleEndian64(dataPtr + 8));
+        accumulator2 = FileHasherSupport::Xxh64Round(accumulator2, FileHasherSupport::LoadLittleEndian64(dataPtr + 16));
+        accumulator3 = FileHasherSupport::Xxh64Round(accumulator3, FileHasherSupport::LoadLittleEndian64(dataPtr + 24));
+    }
+
+    this->m_xxh64Accumulators[0] = accumulator0;
+    this->m_xxh64Accumulators[1] = accumulator1;
+    this->m_xxh64Accumulators[2] = accumulator2;
+    this->m_xxh64Accumulators[3] = accumulator3;
+}
+
+#pragma endregion Private_Member_Functions_Region
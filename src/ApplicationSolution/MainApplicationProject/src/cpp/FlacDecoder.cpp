@@ -1,4 +1,70 @@
 #include "FlacDecoder.h"
+#include "CRC16.h"
+#include <cstring>
+
+/// <summary>
+/// Purpose: Contains the CRC functions used for validating Frames found in the tail of a FLAC File.
+/// URI: https://xiph.org/flac/format.html#frame_header
+/// URI: https://xiph.org/flac/format.html#frame_footer
+/// </summary>
+namespace FlacDecoderSupport
+{
+    /// <summary>
+    /// Purpose: Calculates the CRC-8 (Polynomial 0x07, initialized with 0) of a Frame Header.
+    /// </summary>
+    static inline unsigned char CalculateCRC8(const unsigned char* dataPtr, size_t size)
+    {
+        unsigned long crc = 0UL;
+        for (size_t index = 0; index < size; index++)
+        {
+            crc ^= dataPtr[index];
+            for (unsigned long bitIndex = 0UL; bitIndex < 8UL; ++bitIndex)
+            {
+                crc = ((crc & 0x80UL) != 0UL) ? ((crc << 1UL) ^ 0x07UL) : (crc << 1UL);
+            }
+        }
+        return static_cast<unsigned char>(crc & 0xFFUL);
+    }
+
+    /// <summary>
+    /// Purpose: The sizes of the Tags that a Tagger may append after the last Frame.
+    /// </summary>
+    constexpr auto ID3V1_TAG_SIZE = 128UL;
+    constexpr auto APE_TAG_FOOTER_SIZE = 32UL;
+    constexpr auto APE_TAG_FLAG_CONTAINS_HEADER = 0x80000000UL;
+
+    /// <summary>
+    /// Purpose: A trailing APEv2 Tag larger than this is NOT read, and the truncation check is skipped (16 MB).
+    /// </summary>
+    constexpr auto MAXIMUM_TRAILING_APE_TAG_SIZE = 16777216ULL;
+
+    /// <summary>
+    /// Purpose: Gets the size of the APEv2 Tag that ends at the end of the data, including its Header and Footer.
+    /// URI: https://wiki.hydrogenaud.io/index.php?title=APE_Tags_Header
+    /// </summary>
+    /// <returns>The size of the Tag, which can be larger than the data. Otherwise, 0 if the data does NOT end with an APEv2 Tag Footer.</returns>
+    static inline unsigned long long GetTrailingApeTagSize(const unsigned char* dataPtr, size_t size)
+    {
+        if (size < APE_TAG_FOOTER_SIZE || memcmp(dataPtr + size - APE_TAG_FOOTER_SIZE, "APETAGEX", 8) != 0)
+        {
+            return 0ULL;
+        }
+
+        // The Footer holds the ID, the version, the size of the items and the Footer, the item count, and the flags (all little-endian).
+        const unsigned char* footerPtr = dataPtr + size - APE_TAG_FOOTER_SIZE;
+        unsigned long tagSize = static_cast<unsigned long>(footerPtr[12]) | (static_cast<unsigned long>(footerPtr[13]) << 8) |
+            (static_cast<unsigned long>(footerPtr[14]) << 16) | (static_cast<unsigned long>(footerPtr[15]) << 24);
+        unsigned long flags = static_cast<unsigned long>(footerPtr[20]) | (static_cast<unsigned long>(footerPtr[21]) << 8) |
+            (static_cast<unsigned long>(footerPtr[22]) << 16) | (static_cast<unsigned long>(footerPtr[23]) << 24);
+
+        if (tagSize < APE_TAG_FOOTER_SIZE)
+        {
+            return 0ULL; // NOT a valid Footer.
+        }
+
+        return static_cast<unsigned long long>(tagSize) + (((flags & APE_TAG_FLAG_CONTAINS_HEADER) != 0UL) ? APE_TAG_FOOTER_SIZE : 0UL);
+    }
+}
 
 /// <summary>
 /// Purpose: No-arg Constructor.
@@ -13,9 +79,34 @@ FlacDecoder::FlacDecoder() : AbstractBaseDecoder(DECODER_NAME)
 /// </summary>
 /// <param name="filenamePtr"></param>
 /// <param name="memoryBufferIsEnabled"></param>
-FlacDecoder::FlacDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled) : FlacDecoder()
+FlacDecoder::FlacDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled) : FlacDecoder(filenamePtr, memoryBufferIsEnabled, nullptr)
+{
+
+}
+
+/// <summary>
+/// Purpose: With-args Constructor that opens the Decoder using the specified File, and computes the MD5 signature using the shared MD5 service.
+/// </summary>
+/// <param name="filenamePtr"></param>
+/// <param name="memoryBufferIsEnabled"></param>
+/// <param name="md5ServicePtr">The shared MD5 service. When NULL, the MD5 signature is computed by the Decoder.</param>
+FlacDecoder::FlacDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled, MultiBufferMD5Service* md5ServicePtr) : FlacDecoder(filenamePtr, memoryBufferIsEnabled, md5ServicePtr, false)
+{
+
+}
+
+/// <summary>
+/// Purpose: With-args Constructor that opens the Decoder using the specified File, for a File that may be decoded using the Pipeline Thread.
+/// </summary>
+/// <param name="filenamePtr"></param>
+/// <param name="memoryBufferIsEnabled"></param>
+/// <param name="md5ServicePtr">The shared MD5 service. When NULL, the MD5 signature is computed by the Decoder.</param>
+/// <param name="pcmPipelineIsRequested">TRUE when EnablePcmPipeline() may be called, so the MD5 signature must be computed from the decoded samples.</param>
+FlacDecoder::FlacDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled, MultiBufferMD5Service* md5ServicePtr, bool pcmPipelineIsRequested) : FlacDecoder()
 {
     this->m_decoderMemoryBufferIsEnabled = memoryBufferIsEnabled;
+    this->m_md5ServicePtr = md5ServicePtr;
+    this->m_libFlacMD5CheckingIsEnabled = (md5ServicePtr == nullptr && !pcmPipelineIsRequested);
 
     // Open the FLAC File.
     this->OpenFile(filenamePtr, memoryBufferIsEnabled);
@@ -26,6 +117,15 @@ FlacDecoder::FlacDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled)
 /// </summary>
 FlacDecoder::~FlacDecoder()
 {
+    // Stop the Pipeline Thread before the state it updates is destroyed.
+    this->m_pcmPipelinePtr.reset();
+
+    if (this->m_md5StreamId != 0UL)
+    {
+        // The File was NOT fully decoded.
+        this->m_md5ServicePtr->Cancel(this->m_md5StreamId);
+    }
+
     if (this->DecoderIsOpen())
     {
         // Calling the finish() function flushes the decoding buffer, releases resources, resets the decoder settings to their defaults, 
@@ -40,6 +140,11 @@ FlacDecoder::~FlacDecoder()
 
 long long FlacDecoder::Read()
 {
+    if (this->m_sampledVerificationPlan.IsEnabled())
+    {
+        return this->ReadSampled();
+    }
+
     this->m_lastDecodedFrameSampleSize = 0LL;
 
     // FLAC::Decoder::Stream::process_single() - Tells the decoder to process at
@@ -55,38 +160,7 @@ long long FlacDecoder::Read()
         // Decoding error occurred.
 
         this->m_lastDecodedFrameSampleSize = -1LL; // Flag that an error occurred.
-
-        if (!this->m_errorCallbackFlagEnabled)
-        {
-            switch (this->FLAC::Decoder::Stream::get_state())
-            {
-                case FLAC__STREAM_DECODER_END_OF_STREAM:
-                    this->Truncated(this->m_errorMessage);
-                    break;
-                case FLAC__STREAM_DECODER_SEEK_ERROR:
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"SEEK_ERROR");
-                    break;
-                case FLAC__STREAM_DECODER_ABORTED:
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"DECODER_ABORTED");
-                    break;
-                case FLAC__STREAM_DECODER_MEMORY_ALLOCATION_ERROR:
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"MEMORY_ALLOCATION_ERROR");
-                    break;
-                case FLAC__STREAM_DECODER_OGG_ERROR:
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"OGG_LAYER_ERROR");
-                    break;
-                default:
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"DECODER_ERROR");
-            }
-        }
-        else
-        {
-            // Decoder has Lost Sync. The Error Callback Function has already been called.
-            if (this->m_errorMessage == L"" || this->m_errorMessage == nullptr)
-            {
-                wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"DECODER_LOST_SYNC");
-            }
-        }
+        this->RecordProcessError();
     }
     else
     {
@@ -94,18 +168,41 @@ long long FlacDecoder::Read()
 
         if (this->FLAC::Decoder::Stream::get_state() == FLAC__STREAM_DECODER_END_OF_STREAM)
         {
+            if (this->m_pcmPipelinePtr != nullptr)
+            {
+                // The MD5 signature, the PCM analysis, and the checksums need every decoded sample.
+                this->m_pcmPipelinePtr->Flush();
+            }
+
             if (!this->FLAC::Decoder::Stream::finish())
             {
-                // If MD5 Checking is enabled, the FLAC::Decoder::Stream::finish() function will report when the decoded MD5 signature 
-                // does not match the one stored in the STREAMINFO block.
-                // 
                 // The FLAC::Decoder::Stream::finish() function returns FALSE when ALL of the following conditions are met: 
-                // 1. The MD5 checking is on.
+                // 1. The MD5 checking of the libFLAC Decoder is on.
                 // 2. A STREAMINFO block was available AND The MD5 signature in the STREAMINFO block was non-zero.
                 // 3. The MD5 signature does not match the one computed by the Decoder.
-                
                 this->m_lastDecodedFrameSampleSize = -1LL; // Flag that an error occurred.
-                wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"MD5_MISMATCH");
+                this->RecordError(DecoderErrorCode::MD5_MISMATCH);
+            }
+            else if (this->m_md5SignatureIsKnown)
+            {
+                // Compare the MD5 signature of the decoded samples with the one stored in the STREAMINFO block.
+                unsigned char computedMD5Signature[MD5_DIGEST_SIZE]{};
+                if (this->m_md5StreamId != 0UL)
+                {
+                    this->m_md5ServicePtr->Finish(this->m_md5StreamId, computedMD5Signature);
+                    this->m_md5StreamId = 0UL;
+                }
+                else
+                {
+                    md5_finish(&this->m_stateStructMD5Algorithm, computedMD5Signature);
+                }
+                this->m_md5SignatureIsKnown = false;
+
+                if (memcmp(computedMD5Signature, this->m_streamMD5Signature, MD5_DIGEST_SIZE) != 0)
+                {
+                    this->m_lastDecodedFrameSampleSize = -1LL; // Flag that an error occurred.
+                    this->RecordError(DecoderErrorCode::MD5_MISMATCH);
+                }
             }
 
             // Check that the Decoded data matches the expected size.
@@ -115,12 +212,12 @@ long long FlacDecoder::Read()
                 if (this->m_totalDecodedFrameSampleCount < this->m_streamTotalSampleCount)
                 {
                     // Less Decoded data than expected was encountered.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"MISSING_SAMPLES");
+                    this->RecordCountError(DecoderErrorCode::MISSING_SAMPLES, static_cast<long long>(this->m_streamTotalSampleCount - this->m_totalDecodedFrameSampleCount));
                 }
                 else
                 {
                     // More Decoded data than expected was encountered.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"EXTRA_SAMPLES");
+                    this->RecordCountError(DecoderErrorCode::EXTRA_SAMPLES, static_cast<long long>(this->m_totalDecodedFrameSampleCount - this->m_streamTotalSampleCount));
                 }
             }
         }
@@ -128,14 +225,14 @@ long long FlacDecoder::Read()
     return this->m_lastDecodedFrameSampleSize;
 }
 
-unsigned long long FlacDecoder::GetDecodedAudioDataTotal()
+long long FlacDecoder::Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds)
 {
-    return this->m_streamTotalSampleCount;
+    return this->DecodeBatch<FlacDecoder>(audioUnitBudget, timeBudgetMilliseconds);
 }
 
-const wchar_t* FlacDecoder::GetLastErrorMessage()
+unsigned long long FlacDecoder::GetDecodedAudioDataTotal()
 {
-    return this->m_errorMessage;
+    return this->m_streamTotalSampleCount;
 }
 
 const wchar_t* FlacDecoder::GetSupportedTypes()
@@ -143,6 +240,153 @@ const wchar_t* FlacDecoder::GetSupportedTypes()
     return FlacDecoder::FILE_EXTENSION_TYPES;
 }
 
+bool FlacDecoder::CheckForTruncation()
+{
+    if (this->m_streamTotalSampleCount == 0ULL || this->m_streamMaximumFrameSize == 0UL)
+    {
+        // The total samples are unknown.
+        return false;
+    }
+
+    // Read enough of the tail to hold the last two Frames, and a non-standard ID3v1 Tag.
+    const size_t frameTailSize = 2UL * static_cast<size_t>(this->m_streamMaximumFrameSize);
+    std::vector<unsigned char> tailBuffer(frameTailSize + FlacDecoderSupport::ID3V1_TAG_SIZE);
+    size_t tailSize = this->m_stream.ReadTail(tailBuffer.data(), tailBuffer.size());
+
+    size_t id3v1TagSize = 0;
+    if (tailSize >= FlacDecoderSupport::ID3V1_TAG_SIZE && memcmp(tailBuffer.data() + tailSize - FlacDecoderSupport::ID3V1_TAG_SIZE, "TAG", 3) == 0)
+    {
+        id3v1TagSize = FlacDecoderSupport::ID3V1_TAG_SIZE;
+    }
+
+    // A non-standard APEv2 Tag (e.g. written by foobar2000) is also valid after the last Frame, before any ID3v1 Tag.
+    unsigned long long apeTagSize = FlacDecoderSupport::GetTrailingApeTagSize(tailBuffer.data(), tailSize - id3v1TagSize);
+    if (apeTagSize > FlacDecoderSupport::MAXIMUM_TRAILING_APE_TAG_SIZE)
+    {
+        return false; // The Frames before the Tag are too far from the end of the File. The full decode checks them.
+    }
+
+    if (apeTagSize > 0ULL && frameTailSize + id3v1TagSize + apeTagSize > tailBuffer.size())
+    {
+        // Read the Frames before the Tag as well.
+        tailBuffer.resize(frameTailSize + id3v1TagSize + static_cast<size_t>(apeTagSize));
+        tailSize = this->m_stream.ReadTail(tailBuffer.data(), tailBuffer.size());
+    }
+
+    const size_t trailingTagSize = id3v1TagSize + static_cast<size_t>(apeTagSize);
+    if (tailSize < trailingTagSize)
+    {
+        return false; // The Tag claims more bytes than the File holds. The full decode checks the File.
+    }
+
+    // Exclude the Tags.
+    tailSize -= trailingTagSize;
+    const unsigned char* tailPtr = tailBuffer.data();
+
+    // Scan backwards for Frame Headers. The last Frame must end exactly at the end of the File, which is confirmed by the CRC-16 in its Footer.
+    // A Frame Sync pattern inside the Audio Data can pass the Frame Header CRC-8 by chance, so the scan continues until a complete Frame is found.
+    bool partialFrameWasFound = false;
+    unsigned long long partialFrameFirstSampleNumber = 0ULL;
+
+    for (size_t index = tailSize; index-- > 0; )
+    {
+        unsigned long long firstSampleNumber = 0ULL;
+        unsigned long blockSize = 0UL;
+        if (tailPtr[index] != 0xFF || !this->ParseFrameHeader(tailPtr + index, tailSize - index, firstSampleNumber, blockSize) || firstSampleNumber >= this->m_streamTotalSampleCount)
+        {
+            continue;
+        }
+
+        if (CRC16::Update(0, tailPtr + index, tailSize - index) == 0)
+        {
+            // The CRC-16 over a complete Frame (including the CRC-16 in its Footer) is zero.
+            unsigned long long lastSampleNumber = firstSampleNumber + blockSize;
+            if (lastSampleNumber < this->m_streamTotalSampleCount)
+            {
+                // The File ends at a Frame boundary, before the last Frame.
+                this->Truncated(lastSampleNumber);
+                return true;
+            }
+
+            return false;
+        }
+
+        // Only a Frame Header closer to the end of the File than the largest Frame can start a Frame that was cut short by the end of the File.
+        if (!partialFrameWasFound && tailSize - index < this->m_streamMaximumFrameSize)
+        {
+            partialFrameWasFound = true;
+            partialFrameFirstSampleNumber = firstSampleNumber;
+        }
+    }
+
+    if (partialFrameWasFound)
+    {
+        // The File ends part way through the last Frame Header that was found.
+        this->Truncated(partialFrameFirstSampleNumber);
+        return true;
+    }
+
+    return false;
+}
+
+bool FlacDecoder::EnableSampledVerification(unsigned long windowCount)
+{
+    if (this->m_streamTotalSampleCount == 0ULL)
+    {
+        // The total samples are unknown, so the Windows can NOT be chosen.
+        return false;
+    }
+
+    if (!this->m_sampledVerificationPlan.Configure(windowCount, 0ULL, this->m_streamTotalSampleCount))
+    {
+        return false;
+    }
+
+    // Most of the Frames are skipped, so the MD5 signature can NOT be checked.
+    this->m_md5SignatureIsKnown = false;
+    if (this->m_md5StreamId != 0UL)
+    {
+        this->m_md5ServicePtr->Cancel(this->m_md5StreamId);
+        this->m_md5StreamId = 0UL;
+    }
+
+    return true;
+}
+
+bool FlacDecoder::EnablePcmAnalysis()
+{
+    this->m_pcmAnalyzerPtr = std::make_unique<PcmAnalyzer>(this->m_streamSampleRate);
+    return true;
+}
+
+bool FlacDecoder::EnableAccurateRipChecksum()
+{
+    if (!AccurateRipChecksum::IsSupportedFormat(this->m_streamSampleRate, this->m_streamChannelCount, this->m_streamBitsPerSample))
+    {
+        return false;
+    }
+
+    this->m_accurateRipChecksumPtr = std::make_unique<AccurateRipChecksum>();
+    return true;
+}
+
+bool FlacDecoder::EnablePcmPipeline()
+{
+    if (this->m_streamChannelCount == 0UL || this->m_streamChannelCount > FLAC__MAX_CHANNELS)
+    {
+        return false;
+    }
+
+    if (!this->m_md5SignatureIsKnown && this->m_pcmAnalyzerPtr == nullptr && this->m_accurateRipChecksumPtr == nullptr)
+    {
+        // There is NO per-sample work to move to the Pipeline Thread.
+        return false;
+    }
+
+    this->m_pcmPipelinePtr = std::make_unique<PcmPipeline>([this](int32_t* samplePtr, size_t sampleCount) { this->ConsumePipelineBlock(samplePtr, sampleCount); });
+    return true;
+}
+
 #pragma endregion Overridden_Base_Class_Functions_Region
 
 #pragma region Overridden_Protected_FLAC_Decoder_Stream_Functions_Region
@@ -204,6 +448,29 @@ FLAC__StreamDecoderWriteStatus FlacDecoder::write_callback(const FLAC__Frame* fr
     // Add the number of decoded Subframe Samples to the total Decoded Frame Samples.
     this->m_totalDecodedFrameSampleCount += this->m_lastDecodedFrameSampleSize;
 
+    if (this->m_pcmPipelinePtr != nullptr)
+    {
+        // The decoded Subframes are interleaved into the Pipeline, and consumed by the Pipeline Thread.
+        this->m_pcmPipelinePtr->WritePlanar(buffer, frameHeader.channels, frameHeader.blocksize);
+        return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+    }
+
+    if (this->m_pcmAnalyzerPtr != nullptr)
+    {
+        // The decoded Subframes are already planar, so they are analyzed in place.
+        this->m_pcmAnalyzerPtr->AddPlanar(buffer, frameHeader.channels, frameHeader.blocksize, frameHeader.bits_per_sample);
+    }
+
+    if (this->m_accurateRipChecksumPtr != nullptr && frameHeader.channels == ACCURATERIP_CHANNEL_COUNT)
+    {
+        this->m_accurateRipChecksumPtr->AddPlanar(buffer, frameHeader.blocksize);
+    }
+
+    if (this->m_md5SignatureIsKnown)
+    {
+        this->UpdateMD5(buffer, 1UL, frameHeader.channels, frameHeader.blocksize, frameHeader.bits_per_sample);
+    }
+
     // The write was OK and Decoding can continue.
     return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
 }
@@ -212,79 +479,61 @@ void FlacDecoder::error_callback(FLAC__StreamDecoderErrorStatus status)
 {
     this->m_errorCallbackFlagEnabled = true; // Set the flag indicating that the Error Callback Function has been called.
 
-    std::wostringstream woss;
-
+    // The callback can be called many times for a damaged File, so only a compact Error Record is kept. The text is rendered when reported.
     unsigned long long totalDecodedStreamTimeSeconds = (this->m_streamSampleRate > 0) ? this->m_totalDecodedFrameSampleCount / this->m_streamSampleRate : 0;
-    unsigned long long minutes = totalDecodedStreamTimeSeconds / 60;
-    unsigned long long seconds = totalDecodedStreamTimeSeconds % 60;
 
     switch (status)
     {
         case FLAC__STREAM_DECODER_ERROR_STATUS_LOST_SYNC:
         {
             // An error in the stream caused the decoder to lose synchronization.
+            DecoderErrorCode errorCode = DecoderErrorCode::LOST_SYNC;
             if (this->m_streamTotalSampleCount > 0ULL && this->m_streamSampleRate > 0UL)
             {
                 // Get the total time in seconds for the entire duration of Stream.
                 unsigned long long totalStreamTimeSeconds = this->m_streamTotalSampleCount / this->m_streamSampleRate;
 
                 // Check if the reported Decoded Stream Time matches the Total Stream Time.
-                if (totalStreamTimeSeconds == totalDecodedStreamTimeSeconds)
+                // If so, an error caused the decoder to lose synchronization at the end of the Stream.
+                // Check the FLAC file for the existence of a non-standard ID3v1 Tag embedded at the end of the File.
+                if (totalStreamTimeSeconds == totalDecodedStreamTimeSeconds && this->hasID3v1Tag())
                 {
-                    // An error caused the decoder to lose synchronization at the end of the Stream.
-
-                    // Check the FLAC file for the existence of a non-standard ID3v1 Tag embedded at the end of the File.
-                    if (this->hasID3v1Tag())
-                    {
-                        // An ID3v1 Tag was found at the end of the Stream.
-                        woss << L"<LOST_SYNC @ " << minutes << L"m " << seconds << L"s>" << L" <ID3v1_TAG_FOUND>";
-                    }
-                    else
-                    {
-                        // An IDv3Tag was NOT found at the end of the Stream.
-                        // A different error caused the decoder to lose synchronization.
-                        woss << L"LOST_SYNC @ " << minutes << L"m " << seconds << L"s";
-                    }
-                }
-                else
-                {
-                    // An error caused the decoder to lose synchronization before the end of the Stream.
-                    woss << L"LOST_SYNC @ " << minutes << L"m " << seconds << L"s";
+                    // An ID3v1 Tag was found at the end of the Stream.
+                    errorCode = DecoderErrorCode::LOST_SYNC_ID3v1_TAG_FOUND;
                 }
             }
-            else
-            {
-                // An unknown error caused the decoder to lose synchronization.
-                woss << L"LOST_SYNC @ " << minutes << L"m " << seconds << L"s";
-            }
 
-            wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, woss.str().c_str());
+            this->RecordTimeError(errorCode, this->m_totalDecodedFrameSampleCount, this->m_streamSampleRate);
             break;
         }
         case FLAC__STREAM_DECODER_ERROR_STATUS_BAD_HEADER:
         {
             // The decoder encountered a corrupted frame header.
-            woss << L"BAD_HEADER @ " << minutes << L"m " << seconds << L"s";
-            wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, woss.str().c_str());
+            this->RecordTimeError(DecoderErrorCode::BAD_HEADER, this->m_totalDecodedFrameSampleCount, this->m_streamSampleRate);
             break;
         }
         case FLAC__STREAM_DECODER_ERROR_STATUS_FRAME_CRC_MISMATCH:
         {
             // The frame's data did not match the CRC in the footer.
-            woss << L"FRAME_CRC_MISMATCH @ " << minutes << L"m " << seconds << L"s";
-            wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, woss.str().c_str());
+            this->RecordTimeError(DecoderErrorCode::FRAME_CRC_MISMATCH, this->m_totalDecodedFrameSampleCount, this->m_streamSampleRate);
             break;
         }
         case FLAC__STREAM_DECODER_ERROR_STATUS_UNPARSEABLE_STREAM:
         {
             // The decoder encountered reserved fields in use in the stream.
-            wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"UNPARSEABLE_STREAM");
+            this->RecordError(DecoderErrorCode::UNPARSEABLE_STREAM);
             break;
         }
         case FLAC__STREAM_DECODER_ERROR_STATUS_BAD_METADATA:
         {
             // The decoder encountered a corrupted metadata block.
-            wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"BAD_METADATA");
+            this->RecordError(DecoderErrorCode::BAD_METADATA);
+            break;
+        }
+        default:
+        {
+            // An error status added by a later version of the FLAC library.
+            this->RecordError(DecoderErrorCode::DECODER_LOST_SYNC);
             break;
         }
     }
@@ -333,6 +582,22 @@ void FlacDecoder::metadata_callback(const FLAC__StreamMetadata* metadata)
         // For example, one second of 44.1Khz audio will have 44100 samples regardless of the number of channels.
         // A returned value of zero means the number of total samples is unknown.
         this->m_streamTotalSampleCount = metadata->data.stream_info.total_samples;
+
+        this->m_streamChannelCount = metadata->data.stream_info.channels;
+        this->m_streamBitsPerSample = metadata->data.stream_info.bits_per_sample;
+
+        // An MD5 signature of all zeros means the signature is unknown.
+        memcpy(this->m_streamMD5Signature, metadata->data.stream_info.md5sum, MD5_DIGEST_SIZE);
+
+        // The Block Sizes and the maximum Frame size are used for checking the tail of the File for truncation.
+        // A maximum Frame size of zero means the value is unknown, so it is bounded by the uncompressed Block size.
+        this->m_streamMinimumBlockSize = metadata->data.stream_info.min_blocksize;
+        this->m_streamMaximumBlockSize = metadata->data.stream_info.max_blocksize;
+        this->m_streamMaximumFrameSize = metadata->data.stream_info.max_framesize;
+        if (this->m_streamMaximumFrameSize == 0UL)
+        {
+            this->m_streamMaximumFrameSize = (this->m_streamMaximumBlockSize * metadata->data.stream_info.channels * metadata->data.stream_info.bits_per_sample) / 8UL + FLAC_FRAME_OVERHEAD_BYTES;
+        }
     }
 }
 
@@ -340,23 +605,93 @@ void FlacDecoder::metadata_callback(const FLAC__StreamMetadata* metadata)
 
 #pragma region Private_Member_Functions_Region
 
+void FlacDecoder::RecordProcessError()
+{
+    if (!this->m_errorCallbackFlagEnabled)
+    {
+        switch (this->FLAC::Decoder::Stream::get_state())
+        {
+            case FLAC__STREAM_DECODER_END_OF_STREAM:
+                this->Truncated(this->m_totalDecodedFrameSampleCount);
+                break;
+            case FLAC__STREAM_DECODER_SEEK_ERROR:
+                this->RecordError(DecoderErrorCode::SEEK_ERROR);
+                break;
+            case FLAC__STREAM_DECODER_ABORTED:
+                this->RecordError(DecoderErrorCode::DECODER_ABORTED);
+                break;
+            case FLAC__STREAM_DECODER_MEMORY_ALLOCATION_ERROR:
+                this->RecordError(DecoderErrorCode::MEMORY_ALLOCATION_ERROR);
+                break;
+            case FLAC__STREAM_DECODER_OGG_ERROR:
+                this->RecordError(DecoderErrorCode::OGG_LAYER_ERROR);
+                break;
+            default:
+                this->RecordError(DecoderErrorCode::DECODER_ERROR);
+        }
+    }
+
+    // Otherwise, the Decoder has Lost Sync. The Error Callback Function has already recorded the error.
+}
+
+long long FlacDecoder::ReadSampled()
+{
+    unsigned long long windowPosition = 0ULL;
+    if (this->FLAC::Decoder::Stream::get_state() == FLAC__STREAM_DECODER_END_OF_STREAM || !this->m_sampledVerificationPlan.NextWindow(windowPosition))
+    {
+        return 0LL; // Every Window has been verified.
+    }
+
+    // The time of an error is reported from the start of the Window.
+    this->m_totalDecodedFrameSampleCount = windowPosition;
+
+    if (windowPosition > 0ULL)
+    {
+        // Seeking uses the SEEKTABLE (when present) to narrow the search for the Frame that holds the target sample, and then decodes that Frame.
+        // MD5 checking is turned off by the seek.
+        if (!this->FLAC::Decoder::Stream::seek_absolute(windowPosition))
+        {
+            // The Frames around the target sample could NOT be parsed.
+            this->RecordTimeError(DecoderErrorCode::SEEK_ERROR, windowPosition, this->m_streamSampleRate);
+            return -1LL; // An error occurred.
+        }
+    }
+
+    for (unsigned long frameIndex = 0UL; frameIndex < FLAC_SAMPLED_WINDOW_FRAME_COUNT; ++frameIndex)
+    {
+        if (!this->FLAC::Decoder::Stream::process_single() || this->m_errorCallbackFlagEnabled)
+        {
+            this->RecordProcessError();
+            return -1LL; // An error occurred.
+        }
+
+        if (this->FLAC::Decoder::Stream::get_state() == FLAC__STREAM_DECODER_END_OF_STREAM)
+        {
+            // The last Frame was decoded. The sample count and MD5 signature are NOT checked, since most of the Frames were skipped.
+            break;
+        }
+    }
+
+    return static_cast<long long>(this->m_sampledVerificationPlan.GetWindowProgressUnits(this->m_streamTotalSampleCount));
+}
+
 void FlacDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled)
 {
     if (this->m_stream.Open(filenamePtr, memoryBufferIsEnabled))
     {
-        // The decoder will compute the MD5 signature of the unencoded audio data while decoding and 
-        // compare it to the signature from the STREAMINFO block, if it exists, during FLAC::Decoder::Stream::finish().
-
         //	The stream decoder provides MD5 signature checking. If this is
         //	turned on before initialization, FLAC::Decoder::Stream::finish() will
         //	report when the decoded MD5 signature does not match the one stored
         //	in the STREAMINFO block. 
-        //	
+        //
         //	MD5 checking is automatically turned off
         //	(until the next FLAC__stream_decoder_reset()) if there is no signature
         //	in the STREAMINFO block or when a seek is attempted.
+        //
+        // When the shared MD5 service or the Pipeline Thread is used, the MD5 checking of the libFLAC Decoder is turned off. The MD5 signature of the 
+        // decoded samples is computed from write_callback() instead, and compared to the STREAMINFO block at the end of the Stream.
 
-        this->FLAC::Decoder::Stream::set_md5_checking(true);
+        this->FLAC::Decoder::Stream::set_md5_checking(this->m_libFlacMD5CheckingIsEnabled);
 
         // The FLAC::Decoder::Stream::init() function initializes the Decoder to decode native FLAC streams. 
         // I/O is performed via callbacks to the Client, instead of decoding from a plain native FLAC file via filename or open FILE*.
@@ -380,6 +715,18 @@ void FlacDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnable
             {
                 this->m_totalDecodedFrameSampleCount = 0ULL;
                 this->SetDecoderIsOpenStatus(true);
+
+                // The MD5 signature is NOT checked when the STREAMINFO block has NO signature. Otherwise, it is computed here unless the libFLAC Decoder checks it.
+                static const unsigned char unknownMD5Signature[MD5_DIGEST_SIZE]{};
+                this->m_md5SignatureIsKnown = !this->m_libFlacMD5CheckingIsEnabled && (memcmp(this->m_streamMD5Signature, unknownMD5Signature, MD5_DIGEST_SIZE) != 0);
+                if (this->m_md5SignatureIsKnown && this->m_md5ServicePtr != nullptr)
+                {
+                    this->m_md5StreamId = this->m_md5ServicePtr->Join();
+                }
+                else if (this->m_md5SignatureIsKnown)
+                {
+                    md5_init(&this->m_stateStructMD5Algorithm);
+                }
             }
             else
             {
@@ -398,16 +745,67 @@ void FlacDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnable
     }
 }
 
-void FlacDecoder::Truncated(wchar_t errorMessage[]) const
+void FlacDecoder::UpdateMD5(const FLAC__int32* const channelPtrs[], unsigned long channelStride, unsigned long channelCount, unsigned long frameCount, unsigned long bitsPerSample)
 {
-    std::wostringstream woss;
+    // The MD5 Input Message is the same as the one used by the libFLAC Decoder: the interleaved samples, each stored in the 
+    // fewest whole bytes that hold the bits per sample, as signed Little Endian Integers.
+    unsigned long bytesPerSample = (bitsPerSample + 7UL) / 8UL;
+    size_t packedSize = static_cast<size_t>(frameCount) * channelCount * bytesPerSample;
+    this->m_md5PackedSampleBuffer.resize(packedSize);
+
+    unsigned char* packedPtr = this->m_md5PackedSampleBuffer.data();
+    for (unsigned long frameIndex = 0UL; frameIndex < frameCount; ++frameIndex)
+    {
+        for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+        {
+            uint32_t sample = static_cast<uint32_t>(channelPtrs[channelIndex][static_cast<size_t>(frameIndex) * channelStride]);
+            for (unsigned long byteIndex = 0UL; byteIndex < bytesPerSample; ++byteIndex)
+            {
+                *packedPtr++ = static_cast<unsigned char>(sample >> (8UL * byteIndex));
+            }
+        }
+    }
 
-    unsigned long long totalDecodedStreamTimeSeconds = (this->m_streamSampleRate > 0) ? this->m_totalDecodedFrameSampleCount / this->m_streamSampleRate : 0;
-    unsigned long long minutes = totalDecodedStreamTimeSeconds / 60;
-    unsigned long long seconds = totalDecodedStreamTimeSeconds % 60;
+    if (this->m_md5StreamId != 0UL)
+    {
+        this->m_md5ServicePtr->Submit(this->m_md5StreamId, this->m_md5PackedSampleBuffer.data(), packedSize);
+    }
+    else
+    {
+        md5_append(&this->m_stateStructMD5Algorithm, this->m_md5PackedSampleBuffer.data(), static_cast<int>(packedSize));
+    }
+}
+
+void FlacDecoder::ConsumePipelineBlock(int32_t* samplePtr, size_t sampleCount)
+{
+    // Called on the Pipeline Thread. The Block holds whole interleaved Frames.
+    unsigned long frameCount = static_cast<unsigned long>(sampleCount / this->m_streamChannelCount);
+
+    if (this->m_pcmAnalyzerPtr != nullptr)
+    {
+        this->m_pcmAnalyzerPtr->AddInterleaved(samplePtr, this->m_streamChannelCount, frameCount, this->m_streamBitsPerSample);
+    }
+
+    if (this->m_accurateRipChecksumPtr != nullptr)
+    {
+        this->m_accurateRipChecksumPtr->AddInterleaved(samplePtr, frameCount);
+    }
 
-    woss << L"TRUNCATED @" << minutes << L"m " << seconds << L"s";
-    wcscpy_s(errorMessage, MAX_ERROR_SIZE, woss.str().c_str());
+    if (this->m_md5SignatureIsKnown)
+    {
+        // Each channel starts at its offset in the first Frame, and steps over whole Frames.
+        const FLAC__int32* channelPtrs[FLAC__MAX_CHANNELS]{};
+        for (unsigned long channelIndex = 0UL; channelIndex < this->m_streamChannelCount; ++channelIndex)
+        {
+            channelPtrs[channelIndex] = samplePtr + channelIndex;
+        }
+        this->UpdateMD5(channelPtrs, this->m_streamChannelCount, this->m_streamChannelCount, frameCount, this->m_streamBitsPerSample);
+    }
+}
+
+void FlacDecoder::Truncated(unsigned long long sampleCount)
+{
+    this->RecordTimeError(DecoderErrorCode::TRUNCATED, sampleCount, this->m_streamSampleRate);
 }
 
 bool FlacDecoder::hasID3v1Tag()
@@ -434,4 +832,104 @@ bool FlacDecoder::hasID3v1Tag()
     return false;
 }
 
+bool FlacDecoder::ParseFrameHeader(const unsigned char* dataPtr, size_t size, unsigned long long& firstSampleNumberRef, unsigned long& blockSizeRef) const
+{
+    // The fixed portion: Sync Code (14 bits), Reserved (1 bit), Blocking Strategy (1 bit), Block Size (4 bits), Sample Rate (4 bits), 
+    // Channel Assignment (4 bits), Sample Size (3 bits), Reserved (1 bit).
+    if (size < 6 || dataPtr[0] != 0xFF || (dataPtr[1] & 0xFE) != 0xF8)
+    {
+        return false;
+    }
+
+    bool variableBlockSize = (dataPtr[1] & 0x01) != 0;
+    unsigned long blockSizeCode = dataPtr[2] >> 4;
+    unsigned long sampleRateCode = dataPtr[2] & 0x0F;
+    unsigned long channelAssignment = dataPtr[3] >> 4;
+    unsigned long sampleSizeCode = (dataPtr[3] >> 1) & 0x07;
+
+    if (blockSizeCode == 0UL || sampleRateCode == 0x0FUL || channelAssignment > 10UL || sampleSizeCode == 3UL || (dataPtr[3] & 0x01) != 0)
+    {
+        return false;
+    }
+
+    // The Frame number (Fixed Block Size) or the Sample number (Variable Block Size), coded using UTF-8 style variable length coding.
+    // The number of leading 1 bits in the first byte gives the number of continuation bytes (none, when there are no leading 1 bits).
+    // A 36-bit Sample number (7 leading 1 bits) is only used with a Variable Block Size.
+    size_t index = 4;
+    unsigned long leadingBitCount = 0UL;
+    while (leadingBitCount < 8UL && (dataPtr[index] & (0x80UL >> leadingBitCount)) != 0UL)
+    {
+        leadingBitCount++;
+    }
+
+    if (leadingBitCount == 1UL || leadingBitCount == 8UL || (leadingBitCount == 7UL && !variableBlockSize))
+    {
+        return false;
+    }
+
+    size_t continuationByteCount = (leadingBitCount == 0UL) ? 0 : static_cast<size_t>(leadingBitCount - 1UL);
+    unsigned long long codedNumber = dataPtr[index++] & (0x7FUL >> leadingBitCount);
+
+    // The optional Block Size and Sample Rate fields, and the CRC-8.
+    size_t headerSize = index + continuationByteCount + ((blockSizeCode == 6UL) ? 1 : (blockSizeCode == 7UL) ? 2 : 0)
+        + ((sampleRateCode == 12UL) ? 1 : (sampleRateCode >= 13UL) ? 2 : 0);
+    if (size < headerSize + 1)
+    {
+        return false;
+    }
+
+    for (size_t byteIndex = 0; byteIndex < continuationByteCount; byteIndex++)
+    {
+        unsigned char continuationByte = dataPtr[index++];
+        if ((continuationByte & 0xC0) != 0x80)
+        {
+            return false;
+        }
+        codedNumber = (codedNumber << 6) | (continuationByte & 0x3F);
+    }
+
+    if (blockSizeCode == 1UL)
+    {
+        blockSizeRef = 192UL;
+    }
+    else if (blockSizeCode <= 5UL)
+    {
+        blockSizeRef = 576UL << (blockSizeCode - 2UL);
+    }
+    else if (blockSizeCode == 6UL)
+    {
+        blockSizeRef = dataPtr[index++] + 1UL;
+    }
+    else if (blockSizeCode == 7UL)
+    {
+        blockSizeRef = ((static_cast<unsigned long>(dataPtr[index]) << 8) | dataPtr[index + 1]) + 1UL;
+        index += 2;
+    }
+    else
+    {
+        blockSizeRef = 256UL << (blockSizeCode - 8UL);
+    }
+
+    if (FlacDecoderSupport::CalculateCRC8(dataPtr, headerSize) != dataPtr[headerSize])
+    {
+        return false;
+    }
+
+    if (variableBlockSize)
+    {
+        firstSampleNumberRef = codedNumber;
+    }
+    else if (this->m_streamMinimumBlockSize == this->m_streamMaximumBlockSize)
+    {
+        // Every Frame except the last one holds the same number of samples.
+        firstSampleNumberRef = codedNumber * this->m_streamMaximumBlockSize;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
 #pragma endregion Private_Member_Functions_Region
\ No newline at end of file
@@ -1,4 +1,17 @@
 #include "MP3Decoder.h"
+#include "CRC16.h"
+#include <algorithm>
+#include <cstring>
+
+#pragma region SIMD_ADJUSTMENT_FOR_COMPILATION_TARGET
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#include <emmintrin.h>
+#define MP3_DECODER_SSE2_IS_AVAILABLE
+#endif
+
+#pragma endregion SIMD_ADJUSTMENT_FOR_COMPILATION_TARGET
 
 /// <summary>
 /// Purpose: A namespace containing supporting Data for the MP3 Decoder.
@@ -9,7 +22,7 @@ namespace MP3DecoderSupport
     /// Purpose: Contains all of the commonly supported MP3 Bitrates (Excludes the Free and Bad Rows).
     /// Columns: [0] {MPEG-1 Layer-I}, [1] {MPEG-1 Layer-II}, [2] {MPEG-1 Layer-III}, [3] {MPEG-2 Layer-I}, [4] {MPEG-2 Layer-II & Layer-III}
     /// </summary>
-    static const unsigned long MP3_BITRATES[16][5] =
+    static constexpr unsigned long MP3_BITRATES[16][5] =
     {
         {0UL, 0UL, 0UL, 0UL, 0UL},	// Free (Free Format)
         {32UL, 32UL, 32UL, 32UL, 8UL},
@@ -33,13 +46,32 @@ namespace MP3DecoderSupport
     /// Purpose: Contains all of the commonly supported MP3 Sample Rates (values are in Hz).
     /// Columns: [0] {MPEG-1}, [1] {MPEG-2}, [2] {MPEG-2.5}
     /// </summary>
-    static const unsigned long MP3_SAMPLE_RATES[4][3] =
+    static constexpr unsigned long MP3_SAMPLE_RATES[4][3] =
     {
         {44100UL, 22050UL, 11025UL},
         {48000UL, 24000UL, 12000UL},
         {32000UL, 16000UL, 8000UL},
         {0UL, 0UL, 0UL}	// Reserved
     };
+
+    /// <summary>
+    /// Purpose: Maps the MPEG Audio Encoding Version bits to the Column Index used in the MP3 Sample Rates Array.
+    /// Index: [0] {MPEG-2.5}, [1] {Reserved}, [2] {MPEG-2}, [3] {MPEG-1}
+    /// </summary>
+    static constexpr unsigned long MP3_SAMPLE_RATE_COLUMN_INDEX[4] = { 2UL, 0UL, 1UL, 0UL };
+
+    /// <summary>
+    /// Purpose: Contains the Frame Size (the number of Samples in a Frame).
+    /// Rows: MPEG Audio Encoding Version bits {MPEG-2.5, Reserved, MPEG-2, MPEG-1}
+    /// Columns: Layer Description bits {Reserved, Layer III, Layer II, Layer I}
+    /// </summary>
+    static constexpr unsigned long MP3_SAMPLES_PER_FRAME[4][4] =
+    {
+        {0UL, 576UL, 1152UL, 384UL},
+        {0UL, 0UL, 0UL, 0UL},
+        {0UL, 576UL, 1152UL, 384UL},
+        {0UL, 1152UL, 1152UL, 384UL}
+    };
     
     /// <summary>
     /// Purpose: Used for verifying CRC Data in Audio Frames that have the CRC Protection Bit enabled. 
@@ -53,7 +85,7 @@ namespace MP3DecoderSupport
     /// 
     /// URI: http://www.codeproject.com/audio/MPEGAudioInfo.asp#CRC
     /// </summary>
-    static const unsigned long MP3_CRC_BYTE_SIZE[2][2] =
+    static constexpr unsigned long MP3_CRC_BYTE_SIZE[2][2] =
     {
         {32UL, 17UL}, 
         {17UL, 9UL}
@@ -68,6 +100,192 @@ namespace MP3DecoderSupport
         unsigned long Flags;     // The APE Tag flags.
         char Reserved[8];        // Reserved for later use (must be zero).
     } APE_TAG_FOOTER;
+
+    /// <summary>
+    /// Purpose: A Bitmask used to extract the Frame Sync, MPEG Audio Encoding Version, Layer Description, and Sampling Rate from a Frame Header.
+    /// These fields are constant across all of the Frames within an MP3 File.
+    /// </summary>
+    static constexpr unsigned long FRAME_HEADER_CONSTANT_FIELDS_MASK = 0xFFFE0C00UL;
+
+    /// <summary>
+    /// Purpose: A Bitmask used to extract the 11 Frame Sync bits from a Frame Header.
+    /// </summary>
+    static constexpr unsigned long FRAME_HEADER_SYNC_MASK = 0xFFE00000UL;
+
+    /// <summary>
+    /// Purpose: Calculates the Frame Length from the individual Frame Header fields.
+    /// 
+    /// Frame Length Formula (Layer I): FrameLengthInBytes = (12 * BitRate / SampleRate + Padding) * 4
+    /// Frame Length Formula (Layer II, and MPEG-1 Layer III): FrameLengthInBytes = 144 * BitRate / SampleRate + Padding
+    /// Frame Length Formula (MPEG-2 or MPEG-2.5 Layer III): FrameLengthInBytes = 72 * BitRate / SampleRate + Padding
+    /// </summary>
+    /// <returns>The Frame Length in bytes. Otherwise, 0 for a Reserved MPEG Audio Encoding Version, Layer Description, or Sample Rate.</returns>
+    static constexpr unsigned long CalculateFrameLength(unsigned long encodingVersion, unsigned long layerDescription, unsigned long bitrateIndex, unsigned long sampleRateIndex, unsigned long framePadding)
+    {
+        if (encodingVersion == 0x01 || layerDescription == 0x00)
+        {
+            // Reserved MPEG Audio Encoding Version or Reserved Layer Description.
+            return 0UL;
+        }
+
+        unsigned long sampleRate = MP3_SAMPLE_RATES[sampleRateIndex][MP3_SAMPLE_RATE_COLUMN_INDEX[encodingVersion]];
+        if (sampleRate == 0UL)
+        {
+            // Reserved Sample Rate encountered.
+            return 0UL;
+        }
+
+        unsigned long bitrateColumnIndex = (encodingVersion == MPEG1) ? (3UL - layerDescription) : ((layerDescription == LAYER_1) ? 3UL : 4UL);
+        unsigned long bitrate = 1000UL * MP3_BITRATES[bitrateIndex][bitrateColumnIndex];
+
+        switch (layerDescription)
+        {
+            case LAYER_1:
+                return (12UL * bitrate / sampleRate + framePadding) * 4UL;
+            case LAYER_II:
+                return 144UL * bitrate / sampleRate + framePadding;
+            default:
+                return ((encodingVersion == MPEG1) ? 144UL : 72UL) * bitrate / sampleRate + framePadding;
+        }
+    }
+
+    /// <summary>
+    /// Purpose: A Lookup Table of every Frame Length, built at compile time.
+    /// 
+    /// Indexed by 11 Frame Header bits: the MPEG Audio Encoding Version (bits 20-19), the Layer Description (bits 18-17), the Bitrate (bits 15-12), 
+    /// the Sampling Rate (bits 11-10), and the Padding Bit (bit 9). The CRC Protection Bit (bit 16) is skipped.
+    /// </summary>
+    struct FrameLengthTable
+    {
+        unsigned short values[2048]{};
+
+        constexpr FrameLengthTable()
+        {
+            for (unsigned long index = 0UL; index < 2048UL; ++index)
+            {
+                this->values[index] = static_cast<unsigned short>(CalculateFrameLength((index >> 9UL) & 0x03, (index >> 7UL) & 0x03, (index >> 3UL) & 0x0F, (index >> 1UL) & 0x03, index & 0x01));
+            }
+        }
+    };
+
+    static constexpr FrameLengthTable FRAME_LENGTH_TABLE{};
+
+    static_assert(FRAME_LENGTH_TABLE.values[(3UL << 9UL) | (1UL << 7UL) | (9UL << 3UL)] == 417, "MPEG-1 Layer III, 128 kbps, 44100 Hz Frame Length.");
+
+    /// <summary>
+    /// Purpose: Gets the Frame Length of a Frame Header using the Frame Length Lookup Table.
+    /// </summary>
+    /// <returns>The Frame Length in bytes. Otherwise, 0 if the Frame Header is NOT valid.</returns>
+    static inline unsigned long GetFrameLength(unsigned long frameHeader)
+    {
+        unsigned long index = ((frameHeader >> 10UL) & 0x780UL) | ((frameHeader >> 9UL) & 0x7FUL);
+        return ((frameHeader & FRAME_HEADER_SYNC_MASK) == FRAME_HEADER_SYNC_MASK) ? FRAME_LENGTH_TABLE.values[index] : 0UL;
+    }
+
+    /// <summary>
+    /// Purpose: Gets the Frame Size (the number of Samples in a Frame) of a valid Frame Header.
+    /// </summary>
+    static inline unsigned long GetSamplesPerFrame(unsigned long frameHeader)
+    {
+        return MP3_SAMPLES_PER_FRAME[(frameHeader >> 19UL) & 0x03][(frameHeader >> 17UL) & 0x03];
+    }
+
+    /// <summary>
+    /// Purpose: Gets the Sample Rate in Hz of a valid Frame Header.
+    /// </summary>
+    static inline unsigned long GetSampleRate(unsigned long frameHeader)
+    {
+        return MP3_SAMPLE_RATES[(frameHeader >> 10UL) & 0x03][MP3_SAMPLE_RATE_COLUMN_INDEX[(frameHeader >> 19UL) & 0x03]];
+    }
+
+    /// <summary>
+    /// Purpose: Assembles the 4-byte (big-endian) value stored at the pointer.
+    /// </summary>
+    static inline unsigned long ReadUInt32BigEndian(const unsigned char* dataPtr)
+    {
+        return (static_cast<unsigned long>(dataPtr[0]) << 24UL) | (static_cast<unsigned long>(dataPtr[1]) << 16UL) |
+            (static_cast<unsigned long>(dataPtr[2]) << 8UL) | static_cast<unsigned long>(dataPtr[3]);
+    }
+
+    /// <summary>
+    /// Purpose: Reads a field of the Side Information (most significant bit first), and advances the bit offset past it.
+    /// </summary>
+    static inline unsigned long ReadBits(const unsigned char* dataPtr, unsigned long& bitOffsetRef, unsigned long bitCount)
+    {
+        unsigned long value = 0UL;
+        for (unsigned long bitIndex = 0UL; bitIndex < bitCount; ++bitIndex, ++bitOffsetRef)
+        {
+            value = (value << 1UL) | ((dataPtr[bitOffsetRef >> 3UL] >> (7UL - (bitOffsetRef & 0x07UL))) & 0x01UL);
+        }
+        return value;
+    }
+
+    /// <summary>
+    /// Purpose: Assembles the 4-byte (big-endian) Frame Header stored at the pointer.
+    /// </summary>
+    static inline unsigned long ReadFrameHeader(const unsigned char* dataPtr)
+    {
+        return ReadUInt32BigEndian(dataPtr);
+    }
+
+    /// <summary>
+    /// Purpose: The Xing/Info Tag flags indicating which optional fields are present.
+    /// </summary>
+    static constexpr unsigned long INFO_TAG_FRAMES_FLAG = 0x0001UL;
+    static constexpr unsigned long INFO_TAG_BYTES_FLAG = 0x0002UL;
+    static constexpr unsigned long INFO_TAG_TOC_FLAG = 0x0004UL;
+    static constexpr unsigned long INFO_TAG_QUALITY_FLAG = 0x0008UL;
+
+    /// <summary>
+    /// Purpose: The size in bytes of the LAME Tag extension, that follows the Xing/Info Tag fields. The last 2-bytes hold the CRC-16 of every preceding byte in the Frame.
+    /// </summary>
+    static constexpr size_t LAME_TAG_SIZE = 36;
+
+    /// <summary>
+    /// Purpose: Finds the next Frame Sync candidate (11 set bits, i.e. a 0xFF byte followed by a byte with its top 3 bits set).
+    /// On x86/x64, 16 candidate positions are compared at a time using SSE2. The remaining positions are compared one at a time.
+    /// </summary>
+    /// <param name="dataPtr">A pointer to the resident data.</param>
+    /// <param name="startIndex">The index of the first position to check.</param>
+    /// <param name="endIndex">The index one past the last byte that may be read.</param>
+    /// <returns>The index of the candidate. Otherwise, endIndex if no candidate was found.</returns>
+    static size_t FindFrameSyncCandidate(const unsigned char* dataPtr, size_t startIndex, size_t endIndex)
+    {
+        size_t index = startIndex;
+
+#ifdef MP3_DECODER_SSE2_IS_AVAILABLE
+        const __m128i allBitsSet = _mm_set1_epi8(static_cast<char>(0xFF));
+        const __m128i syncBitsMask = _mm_set1_epi8(static_cast<char>(0xE0));
+
+        // Each iteration reads 17 bytes: the 16 candidate first bytes, and the byte that follows each of them.
+        while (index + 17 <= endIndex)
+        {
+            __m128i firstBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + index));
+            __m128i secondBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dataPtr + index + 1));
+            __m128i candidates = _mm_and_si128(_mm_cmpeq_epi8(firstBytes, allBitsSet), _mm_cmpeq_epi8(_mm_and_si128(secondBytes, syncBitsMask), syncBitsMask));
+
+            int candidateMask = _mm_movemask_epi8(candidates);
+            if (candidateMask != 0)
+            {
+                unsigned long bitIndex = 0UL;
+                _BitScanForward(&bitIndex, static_cast<unsigned long>(candidateMask));
+                return index + bitIndex;
+            }
+
+            index += 16;
+        }
+#endif
+
+        for (; index + 1 < endIndex; ++index)
+        {
+            if (dataPtr[index] == 0xFF && (dataPtr[index + 1] & 0xE0) == 0xE0)
+            {
+                return index;
+            }
+        }
+
+        return endIndex;
+    }
 }
 
 MP3Decoder::MP3Decoder() : AbstractBaseDecoder(DECODER_NAME)
@@ -100,38 +318,55 @@ MP3Decoder::~MP3Decoder()
 
 long long MP3Decoder::Read()
 {
-
-    // Read() 1-byte of data from the Stream at a time into the Buffer, starting from the 4th byte, in reverse order. (4-bytes total)
-    // Check for the 'unsigned long' wrap-around condition with the std::numeric_limits<T>::max() function.
-    // NOTE: The Loop stops when the loop variable wraps around to the maximum value of an 'unsigned long' due to underflow (which happens when you subtract 1 from 0 for an 'unsigned long').
-    // For clarity, this for-loop is logically equivalent to the more traditional decrement-style for-loop: 'for (int loopVar = 3; loopVar >=0; --loopVar)'.
-    for (this->m_currentFrameLength = 3UL; this->m_currentFrameLength != std::numeric_limits<unsigned long>::max(); --this->m_currentFrameLength)
+    if (this->m_sampledVerificationPlan.IsEnabled())
     {
-        void* readBufferPtr = reinterpret_cast<unsigned char*>(&this->m_currentFrameHeader) + this->m_currentFrameLength;
-        size_t numberOfBytesRead = this->m_stream.Read(readBufferPtr, 1);
-        if (numberOfBytesRead == 0)
-        {
-            // If the Read() operation fails before reading 4-bytes, set an error message and return.
-            wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"LOST_SYNC @ END_OF_FILE");
-            return -1L; // An error occurred.
-        }
+        return this->ReadSampled();
     }
 
-    // After reading 4-bytes (32-bits) in reverse order within the Stream, the beginning of the current Frame Header is set and ready for processing.
+    return this->ReadFrame();
+}
 
-    // Get the current Frame Length.
-    this->m_currentFrameLength = this->GetFrameLength();
+long long MP3Decoder::ReadFrame()
+{
+    // Get the resident bytes at the start of the current Frame, from the Window.
+    const unsigned char* framePtr = nullptr;
+    size_t frameDataSize = 0;
+    if (!this->GetFrameData(this->m_offset, MP3_MAXIMUM_FRAME_LENGTH, framePtr, frameDataSize) || frameDataSize < 4)
+    {
+        // If fewer than 4-bytes remain in the Stream, set an error message and return.
+        this->RecordError(DecoderErrorCode::LOST_SYNC_AT_END_OF_FILE);
+        return -1LL; // An error occurred.
+    }
+
+    // Assemble the 4-byte (32-bit) Frame Header, and look up the current Frame Length.
+    this->m_currentFrameHeader = MP3DecoderSupport::ReadFrameHeader(framePtr);
+    this->m_currentFrameLength = MP3DecoderSupport::GetFrameLength(this->m_currentFrameHeader);
     
     if (this->m_currentFrameLength != 0UL)
     {
-        // Use the Bitmask to extract the Bitrate, Sampling Rate, and Channel Mode, from both of the Frame Headers.
+        // Use the Bitmask to extract the MPEG Audio Encoding Version, Layer Description, and Sampling Rate, from both of the Frame Headers.
         // Compare if those fields are identical OR the last Frame Header read is zero.
-        if ( ((this->m_currentFrameHeader & 0xFFFE0C00) == (this->m_previousFrameHeader & 0xFFFE0C00)) || (this->m_previousFrameHeader == 0UL) )
+        if ( ((this->m_currentFrameHeader & MP3DecoderSupport::FRAME_HEADER_CONSTANT_FIELDS_MASK) == (this->m_previousFrameHeader & MP3DecoderSupport::FRAME_HEADER_CONSTANT_FIELDS_MASK)) || (this->m_previousFrameHeader == 0UL) )
         {
             if (this->m_previousFrameHeader == 0UL)
             {
                 this->m_previousFrameHeader = this->m_currentFrameHeader; // Update the previous Frame Header that is stored.
-                this->m_streamSampleRate = this->m_sampleRate; // Update the reported Sample Rate for entire the Stream.
+                this->m_streamSampleRate = MP3DecoderSupport::GetSampleRate(this->m_currentFrameHeader); // Update the reported Sample Rate for entire the Stream.
+            }
+
+            // Increment Frame Sample Position by the Frame Size Constant.
+            unsigned long samplesPerFrame = MP3DecoderSupport::GetSamplesPerFrame(this->m_currentFrameHeader);
+            this->m_frameSamplePosition += samplesPerFrame;
+
+            if (!this->m_infoTag.isPresent || this->m_offset != this->m_infoTag.frameOffset)
+            {
+                // Count the Audio Frame, and add it to the Music CRC (the Info Tag Frame is excluded from both).
+                this->m_frameCount++;
+                if (this->m_infoTag.lameTagIsValid)
+                {
+                    size_t musicByteCount = (std::min)(static_cast<size_t>(this->m_currentFrameLength), frameDataSize);
+                    this->m_musicCRC = CRC16::UpdateReflected(this->m_musicCRC, framePtr, musicByteCount);
+                }
             }
 
             // Update the offset position within the Stream.
@@ -140,16 +375,11 @@ long long MP3Decoder::Read()
             if (this->m_offset < this->m_fileSizeInBytes)
             {
                 // The offset is within the File Size.
-                if (this->CheckCRCProtection())
+                if (this->CheckCRCProtection(framePtr, frameDataSize) && this->VerifyFrame(framePtr, this->m_currentFrameLength))
                 {
-                    // CRC Check passed, seek to the offset position within the Stream.
-                    if (this->m_stream.Seek(this->m_offset, SEEK_SET) != 0)
-                    {
-                        return -1LL; // A seek error occurred.
-                    }
-
                     // Return the number of Decoded Audio Units read.
-                    return this->m_currentFrameLength;
+                    // When the Info Tag holds the Frame count, progress is tracked in Samples. Otherwise, progress is tracked in bytes.
+                    return this->m_infoTag.frameCountIsPresent ? samplesPerFrame : this->m_currentFrameLength;
                 }
                 else
                 {
@@ -159,7 +389,8 @@ long long MP3Decoder::Read()
             else if (this->m_offset == this->m_fileSizeInBytes)
             {
                 // The offset is equal to the File Size.
-                if (this->CheckCRCProtection())
+                // The Info Tag is NOT verified when the File is sampled, since most of the Frames were skipped.
+                if (this->CheckCRCProtection(framePtr, frameDataSize) && this->VerifyFrame(framePtr, this->m_currentFrameLength) && (this->m_sampledVerificationPlan.IsEnabled() || this->VerifyInfoTag()))
                 {
                     return 0LL; // EOF
                 }
@@ -171,14 +402,13 @@ long long MP3Decoder::Read()
             else if (this->m_offset > this->m_fileSizeInBytes)
             {
                 // The offset exceeds the File Size.
-                wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"TRUNCATED");
+                this->RecordError(DecoderErrorCode::TRUNCATED);
             }
         }
     }
 
     // Check if an error previously occurred.
-    size_t errorMessageSize = wcslen(this->m_errorMessage);
-    if (errorMessageSize == 0)
+    if (this->m_errorLog.GetCount() == 0)
     {
         // Check the current Frame Sample Position within the Stream.
         if (this->m_frameSamplePosition > 0UL)
@@ -188,13 +418,12 @@ long long MP3Decoder::Read()
             if (this->ResynchronizeBitstream())
             {
                 // Resynchronization of the bitstream was successful.
-                float timeDuration = static_cast<float>(this->m_frameSamplePosition) / this->m_streamSampleRate;
-                swprintf_s(this->m_errorMessage, MAX_ERROR_SIZE, L"LOST_SYNC @ %dm %02ds", ((int)timeDuration) / 60, ((int)timeDuration) % 60);
+                this->RecordFrameTimeError(DecoderErrorCode::LOST_SYNC);
             }
             else
             {
                 // Resynchronization of the bitstream failed.
-                wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"LOST_SYNC @ END_OF_FILE");
+                this->RecordError(DecoderErrorCode::LOST_SYNC_AT_END_OF_FILE);
             }
         }
         else
@@ -204,7 +433,7 @@ long long MP3Decoder::Read()
             if (!this->ResynchronizeBitstream())
             {
                 // Resynchronization of the bitstream failed.
-                wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"UNRECOGNIZED_FORMAT");
+                this->RecordError(DecoderErrorCode::UNRECOGNIZED_FORMAT);
             }
             else
             {
@@ -214,12 +443,12 @@ long long MP3Decoder::Read()
                 if (this->m_tagHeaderLengthBytes > 0UL)
                 {
                     // Tag Header bytes exist at the start of the Stream.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"BAD_ID3v2_TAG");
+                    this->RecordError(DecoderErrorCode::BAD_ID3v2_TAG);
                 }
                 else
                 {
                     // Tag Header bytes do NOT exist at the start of the Stream.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"BAD_STARTING_SYNC");
+                    this->RecordError(DecoderErrorCode::BAD_STARTING_SYNC);
                 }
             }
         }
@@ -228,14 +457,21 @@ long long MP3Decoder::Read()
     return -1LL; // An error occurred.
 }
 
-unsigned long long MP3Decoder::GetDecodedAudioDataTotal()
+long long MP3Decoder::Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds)
 {
-    return static_cast<unsigned long long>(this->m_fileSizeInBytes);
+    // MP3DeepDecoder does NOT override Read(), so the loop instantiated for MP3Decoder also serves it.
+    return this->DecodeBatch<MP3Decoder>(audioUnitBudget, timeBudgetMilliseconds);
 }
 
-const wchar_t* MP3Decoder::GetLastErrorMessage()
+unsigned long long MP3Decoder::GetDecodedAudioDataTotal()
 {
-    return this->m_errorMessage;
+    if (this->m_infoTag.frameCountIsPresent)
+    {
+        // The total number of Samples, including the Info Tag Frame.
+        return (static_cast<unsigned long long>(this->m_infoTag.frameCount) + 1ULL) * this->m_infoTag.samplesPerFrame;
+    }
+
+    return static_cast<unsigned long long>(this->m_fileSizeInBytes);
 }
 
 const wchar_t* MP3Decoder::GetSupportedTypes()
@@ -243,8 +479,152 @@ const wchar_t* MP3Decoder::GetSupportedTypes()
     return MP3Decoder::FILE_EXTENSION_TYPES;
 }
 
+bool MP3Decoder::CheckForTruncation()
+{
+    // The Footer Tags were already read from the tail of the File when it was opened, so only the Info Tag needs to be compared against the Audio Data size.
+    if (!this->m_infoTag.isPresent)
+    {
+        return false;
+    }
+
+    long long audioByteCount = this->m_fileSizeInBytes - this->m_infoTag.frameOffset;
+
+    if (this->m_infoTag.lameTagIsValid)
+    {
+        // The byte counts written by LAME include the Info Tag Frame, and exclude any Tags.
+        long long expectedByteCounts[] = { this->m_infoTag.byteCountIsPresent ? static_cast<long long>(this->m_infoTag.byteCount) : 0LL,
+            static_cast<long long>(this->m_infoTag.musicLength) };
+
+        for (long long expectedByteCount : expectedByteCounts)
+        {
+            if (audioByteCount < expectedByteCount)
+            {
+                this->RecordCountError(DecoderErrorCode::MISSING_BYTES, expectedByteCount - audioByteCount);
+                return true;
+            }
+        }
+    }
+
+    if (this->m_infoTag.frameCountIsPresent && this->m_infoTag.minimumFrameLength > 0UL)
+    {
+        // Every Audio Frame is at least as long as a Frame at the lowest Bitrate.
+        // LAME excludes the Info Tag Frame from the Frame count. Some other encoders include it.
+        long long minimumFrameCount = static_cast<long long>(this->m_infoTag.frameCount) - (this->m_infoTag.lameTagIsValid ? 0LL : 1LL);
+        if (audioByteCount - static_cast<long long>(this->m_infoTag.frameLength) < minimumFrameCount * static_cast<long long>(this->m_infoTag.minimumFrameLength))
+        {
+            this->RecordError(DecoderErrorCode::TRUNCATED);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool MP3Decoder::EnableSampledVerification(unsigned long windowCount)
+{
+    // The Windows start within the Audio Data, leaving room for a whole Frame before the Footer Tags.
+    this->m_audioDataOffset = this->m_offset;
+    long long rangeEnd = this->m_fileSizeInBytes - static_cast<long long>(MP3_MAXIMUM_FRAME_LENGTH);
+    if (rangeEnd <= this->m_audioDataOffset)
+    {
+        return false;
+    }
+
+    return this->m_sampledVerificationPlan.Configure(windowCount, static_cast<unsigned long long>(this->m_audioDataOffset), static_cast<unsigned long long>(rangeEnd));
+}
+
+bool MP3Decoder::EnablePcmAnalysis()
+{
+    return false;
+}
+
+bool MP3Decoder::EnableAccurateRipChecksum()
+{
+    return false;
+}
+
+bool MP3Decoder::EnablePcmPipeline()
+{
+    return false;
+}
+
 #pragma endregion Overridden_Base_Class_Functions_Region
 
+#pragma region Protected_Member_Functions_Region
+
+bool MP3Decoder::VerifyFrame(const unsigned char* framePtr, unsigned long frameLength)
+{
+    // Layer I/II Frames are independent of each other. Only Layer III Frames share the Bit Reservoir.
+    if (((this->m_currentFrameHeader >> 17UL) & 0x03) != LAYER_III)
+    {
+        return true;
+    }
+
+    // The Side Information follows the Frame Header, and the optional CRC Checksum.
+    bool singleChannelMono = ((this->m_currentFrameHeader >> 6UL) & 0x03) == 0x03;
+    bool encodingVersionIsMPEG1 = ((this->m_currentFrameHeader >> 19UL) & 0x03) == MPEG1;
+    unsigned long sideInformationOffset = 4UL + ((((this->m_currentFrameHeader >> 16UL) & 0x01) == 0UL) ? 2UL : 0UL);
+    unsigned long sideInformationSize = MP3DecoderSupport::MP3_CRC_BYTE_SIZE[singleChannelMono ? 1 : 0][encodingVersionIsMPEG1 ? 0 : 1];
+    if (frameLength < sideInformationOffset + sideInformationSize)
+    {
+        this->RecordFrameTimeError(DecoderErrorCode::BIT_RESERVOIR_ERROR);
+        return false;
+    }
+
+    // Add up the Audio Data bits of every Granule and Channel (the 12-bit 'part2_3_length' fields).
+    // MPEG-1: 'main_data_begin' (9 bits), 'private_bits' (5 bits Mono, 3 bits Stereo), 'scfsi' (4 bits per Channel), then 2 Granules of 59 bits per Channel.
+    // MPEG-2/MPEG-2.5: 'main_data_begin' (8 bits), 'private_bits' (1 bit Mono, 2 bits Stereo), then 1 Granule of 63 bits per Channel.
+    // URI: http://www.mp3-tech.org/programmer/sources/mp3_side_info.html
+    const unsigned char* sideInformationPtr = framePtr + sideInformationOffset;
+    unsigned long channelCount = singleChannelMono ? 1UL : 2UL;
+    unsigned long bitOffset = 0UL;
+    unsigned long mainDataBegin = MP3DecoderSupport::ReadBits(sideInformationPtr, bitOffset, encodingVersionIsMPEG1 ? 9UL : 8UL);
+    bitOffset += encodingVersionIsMPEG1 ? (singleChannelMono ? 5UL : 3UL) + 4UL * channelCount : (singleChannelMono ? 1UL : 2UL);
+
+    unsigned long granuleCount = encodingVersionIsMPEG1 ? 2UL : 1UL;
+    unsigned long granuleChannelBitCount = encodingVersionIsMPEG1 ? 59UL : 63UL;
+    unsigned long mainDataBitCount = 0UL;
+    for (unsigned long granuleChannelIndex = 0UL; granuleChannelIndex < granuleCount * channelCount; ++granuleChannelIndex)
+    {
+        unsigned long fieldOffset = bitOffset + granuleChannelIndex * granuleChannelBitCount;
+        mainDataBitCount += MP3DecoderSupport::ReadBits(sideInformationPtr, fieldOffset, 12UL);
+    }
+
+    // The Audio Data starts 'main_data_begin' bytes before the Frame's own Audio Data, within the bytes left by the previous Frames.
+    if (mainDataBegin > this->m_bitReservoirSize)
+    {
+        this->RecordFrameTimeError(DecoderErrorCode::BIT_RESERVOIR_ERROR);
+        return false;
+    }
+
+    // The Audio Data must end within the Frame.
+    unsigned long frameMainDataSize = frameLength - sideInformationOffset - sideInformationSize;
+    unsigned long mainDataByteCount = mainDataBitCount / 8UL;
+    if (mainDataByteCount > mainDataBegin + frameMainDataSize)
+    {
+        this->RecordFrameTimeError(DecoderErrorCode::BIT_RESERVOIR_ERROR);
+        return false;
+    }
+
+    // The bytes after the end of the Audio Data are left in the Bit Reservoir for the next Frame.
+    unsigned long bitReservoirSize = mainDataBegin + frameMainDataSize - mainDataByteCount;
+    this->m_bitReservoirSize = (bitReservoirSize < MP3_BIT_RESERVOIR_MAXIMUM_SIZE) ? bitReservoirSize : MP3_BIT_RESERVOIR_MAXIMUM_SIZE;
+    return true;
+}
+
+void MP3Decoder::RecordFrameTimeError(DecoderErrorCode code)
+{
+    this->RecordTimeError(code, this->m_frameSamplePosition, this->m_streamSampleRate);
+}
+
+void MP3Decoder::ResetFrameVerification()
+{
+    // The bytes left by the Frames before the jump are unknown, so the largest Bit Reservoir is allowed.
+    this->m_bitReservoirSize = MP3_BIT_RESERVOIR_MAXIMUM_SIZE;
+}
+
+#pragma endregion Protected_Member_Functions_Region
+
 #pragma region Private_Member_Functions_Region
 
 unsigned long MP3Decoder::GetID3v2TagHeaderLength()
@@ -283,7 +663,7 @@ unsigned long MP3Decoder::GetID3v2TagHeaderLength()
             if (headerLength == 0UL)
             {
                 // If 'ID3v2 Tag Header' Length remains 0 after the checks, create an Error message.
-                wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"BAD_ID3v2_TAG");
+                this->RecordError(DecoderErrorCode::BAD_ID3v2_TAG);
             }
         }
     }
@@ -346,7 +726,7 @@ unsigned long MP3Decoder::GetTagFooterLength()
             if (tagFooterStruct.Size < APE_TAG_FOOTER_BYTES || tagFooterStruct.Size > this->m_fileSizeInBytes)
             {
                 // The 'APE Tag Footer' is NOT the expected size. Therefore, a bad APE Tag was encountered.
-                wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"BAD_APE_TAG");
+                this->RecordError(DecoderErrorCode::BAD_APE_TAG);
             }
             else
             {
@@ -417,7 +797,7 @@ unsigned long MP3Decoder::GetLyricsTagLength()
                     else
                     {
                         // A match was NOT found.
-                        wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"BAD_LYRICS3v1_TAG");
+                        this->RecordError(DecoderErrorCode::BAD_LYRICS3v1_TAG);
                     }
                 }
             }
@@ -442,7 +822,7 @@ unsigned long MP3Decoder::GetLyricsTagLength()
                 }
                 else
                 {
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"BAD_LYRICS3v2_TAG");
+                    this->RecordError(DecoderErrorCode::BAD_LYRICS3v2_TAG);
                 }
             }
         }
@@ -450,317 +830,375 @@ unsigned long MP3Decoder::GetLyricsTagLength()
     return 0UL;
 }
 
-unsigned long MP3Decoder::GetFrameLength()
+bool MP3Decoder::ResynchronizeBitstream()
 {
-    if (this->m_currentFrameHeader > 0xFFE00000)
+    // Reset the Frame Header and Frame Length.
+    this->m_currentFrameHeader = 0UL;
+    this->m_currentFrameLength = 0UL;
+
+    // The scan starts at the byte after the start of the Frame Header that failed, and ends at the end of the Audio Data.
+    long long scanOffset = this->m_offset + 1LL;
+    long long remainingAudioBytes = this->m_fileSizeInBytes - scanOffset;
+    if (remainingAudioBytes < 4LL || this->m_maxResynchronizationCount == 0UL)
     {
-        // Read the Frame Header contents:
+        // Resynchronization was NOT successful.
+        return false;
+    }
 
-        // Bit-shift 19-bits to the right and set the value for the MPEG Audio Encoding Version. (BitMask 0x03 = 0000 0011)
-        // 0x00 = 0000 0000 = MPEG Version 2.5
-        // 0x01 = 0000 0001 = Reserved
-        // 0x02 = 0000 0010 = MPEG Version 2 (ISO/IEC 13818-3)
-        // 0x03 = 0000 0011 = MPEG Version 1 (ISO/IEC 11172-3)
-        this->m_encodingVersion = (this->m_currentFrameHeader >> 19UL) & 0x03;
-        
-        // Bit-shift 19-bits to the right and set the value for the Layer Description. (BitMask 0x03 = 0000 0011)
-        // 0x00 = 0000 0000 = Reserved
-        // 0x01 = 0000 0001 = Layer III
-        // 0x02 = 0000 0010 = Layer II
-        // 0x03 = 0000 0011 = Layer I
-        this->m_layerDescription = (this->m_currentFrameHeader >> 17UL) & 0x03;
-        
-        // Bit-shift 12-bits to the right and set the value for the Bitrate. (BitMask 0x0F = 0000 1111)
-        this->m_bitrate = (this->m_currentFrameHeader >> 12UL) & 0x0F;
+    // The scan is limited by the remaining budget. Extra look-ahead bytes are needed to validate a candidate near the end of the scan.
+    size_t scanSize = static_cast<size_t>((std::min)(remainingAudioBytes, static_cast<long long>(this->m_maxResynchronizationCount)));
+    size_t requestedSize = static_cast<size_t>((std::min)(remainingAudioBytes, static_cast<long long>(scanSize + MP3_MAXIMUM_FRAME_LENGTH + 4UL)));
 
-        // Bit-shift 10-bits to the right and set the value for the Sampling Rate Frequency. (BitMask 0x03 = 0000 0011)
-        this->m_sampleRate = (this->m_currentFrameHeader >> 10UL) & 0x03;
-        
-        // Bit-shift 9-bits to the right, and sets the value for the Padding Bit. (BitMask 0x01 = 0000 0001)
-        // 0x00 = 0000 0000 = Frame is NOT Padded.
-        // 0x01 = 0000 0001 = Frame is Padded with one extra slot. For Layer I a slot is 32-bits long, for Layer II and Layer III a slot is 8-bits long.
-        this->m_framePadding = (this->m_currentFrameHeader >> 9UL) & 0x01;
-        
-        // Bit-shift 6-bits to the right, and set the value for the Channel Mode (Explicitly checks for Single Channel Mono Mode with the Bitmask). (BitMask 0x03 = 0000 0011)
-        // 0x00 = 0000 0000 = Stereo
-        // 0x01 = 0000 0001 = Joint Stereo (Stereo)
-        // 0x02 = 0000 0010 = Dual Channel (Stereo)
-        // 0x03 = 0000 0011 = Single Channel (Mono)
-        this->m_singleChannelMono = ((this->m_currentFrameHeader >> 6UL) & 0x03) == 0x03;
-        
-        // Bit-shift 16-bits to the right, and sets the value for the CRC Protection Bit. (BitMask 0x01 = 0000 0001)
-        // 0x00 = 0000 0000 = Protected by CRC (16bit CRC Checksum value follows Frame Header).
-        // 0x01 = 0000 0001 = Not Protected
-        this->m_embeddedFrameCRC = ((this->m_currentFrameHeader >> 16UL) & 0x01);
+    // The scan reuses the Window Buffer, so the Window must be refilled afterwards.
+    this->m_windowPtr = nullptr;
+
+    const unsigned char* dataPtr = nullptr;
+    size_t dataSize = 0;
+    if (!this->GetResidentData(scanOffset, requestedSize, dataPtr, dataSize))
+    {
+        // Resynchronization was NOT successful.
+        return false;
+    }
 
-        this->m_columnIndex = 5UL;
+    scanSize = (std::min)(scanSize, dataSize);
 
-        // Adjust the Column Index used based upon the encoding version.
-        switch (this->m_encodingVersion)
+    // Enter the Resynchronization Loop Algorithm.
+    // 1. Finds the next Frame Sync candidate within the resident data.
+    // 2. Checks that the candidate forms a valid Frame Header, that matches the previous Frame Header (if any).
+    // 3. Checks that the candidate is followed by another matching Frame Header, OR ends exactly at the end of the Audio Data.
+    // 4. Either Exits the loop when the conditions are satisfied OR determines that Resychronization failed when the scan is exhausted.
+    size_t candidateIndex = 0;
+    while ((candidateIndex = MP3DecoderSupport::FindFrameSyncCandidate(dataPtr, candidateIndex, (std::min)(scanSize + 1, dataSize))) < scanSize)
+    {
+        if (candidateIndex + 4 <= dataSize)
         {
-            case MPEG1:
-                switch (this->m_layerDescription)
+            unsigned long frameHeader = MP3DecoderSupport::ReadFrameHeader(dataPtr + candidateIndex);
+            unsigned long frameLength = MP3DecoderSupport::GetFrameLength(frameHeader);
+            unsigned long bitrateIndex = (frameHeader >> 12UL) & 0x0F;
+
+            // Free Format and Bad Bitrates do NOT have a usable Frame Length.
+            if (frameLength > 0UL && bitrateIndex != 0x00 && bitrateIndex != 0x0F
+                && (this->m_previousFrameHeader == 0UL || (frameHeader & MP3DecoderSupport::FRAME_HEADER_CONSTANT_FIELDS_MASK) == (this->m_previousFrameHeader & MP3DecoderSupport::FRAME_HEADER_CONSTANT_FIELDS_MASK)))
+            {
+                size_t nextFrameIndex = candidateIndex + frameLength;
+                bool candidateIsValid = false;
+
+                if (scanOffset + static_cast<long long>(nextFrameIndex) == this->m_fileSizeInBytes)
                 {
-                    case LAYER_1:
-                        this->m_columnIndex = 0UL;
-                        break;
-                    case LAYER_II:
-                        this->m_columnIndex = 1UL;
-                        break;
-                    case LAYER_III:
-                        this->m_columnIndex = 2UL;
-                        break;
+                    // The candidate Frame ends exactly at the end of the Audio Data.
+                    candidateIsValid = true;
                 }
-                break;
-            case MPEG2:
-                // Fall through.
-            case MPEG2_5:
-                switch (this->m_layerDescription)
+                else if (nextFrameIndex + 4 <= dataSize)
                 {
-                    case LAYER_1:
-                        this->m_columnIndex = 3UL;
-                        break;
-                    case LAYER_II:
-                        // Fall-through.
-                    case LAYER_III:
-                        this->m_columnIndex = 4UL;
-                        break;
+                    // Compare the candidate Frame Header with the Frame Header that follows it.
+                    unsigned long nextFrameHeader = MP3DecoderSupport::ReadFrameHeader(dataPtr + nextFrameIndex);
+                    candidateIsValid = MP3DecoderSupport::GetFrameLength(nextFrameHeader) > 0UL
+                        && (nextFrameHeader & MP3DecoderSupport::FRAME_HEADER_CONSTANT_FIELDS_MASK) == (frameHeader & MP3DecoderSupport::FRAME_HEADER_CONSTANT_FIELDS_MASK);
                 }
-                break;
-        }
 
-        if (this->m_columnIndex < 5UL)
-        {
-            // Calculate the Bitrate in kilobits per second. (Bitrate Formula: Bits-per-second * Bit Rate)
-            unsigned long bitsPerSecond = 1000UL;
-            this->m_bitrate = bitsPerSecond * MP3DecoderSupport::MP3_BITRATES[this->m_bitrate][this->m_columnIndex];
-        }
-        else
-        {
-            return 0UL;
+                if (candidateIsValid)
+                {
+                    // A valid new Frame Header was found in the data.
+                    this->m_maxResynchronizationCount -= static_cast<unsigned long>(candidateIndex + 1);
+                    this->m_currentFrameHeader = frameHeader;
+                    this->m_currentFrameLength = frameLength;
+                    this->m_offset = scanOffset + static_cast<long long>(candidateIndex);
+
+                    // Resynchronization was successful.
+                    return true;
+                }
+            }
         }
 
-        // Adjust the Column Index used based upon the encoding version.
-        switch (this->m_encodingVersion)
+        ++candidateIndex;
+    }
+
+    // The scan was exhausted.
+    this->m_maxResynchronizationCount -= static_cast<unsigned long>(scanSize);
+
+    // Resynchronization was NOT successful.
+    return false;
+}
+
+long long MP3Decoder::ReadSampled()
+{
+    unsigned long long windowPosition = 0ULL;
+    if (this->m_offset >= this->m_fileSizeInBytes || !this->m_sampledVerificationPlan.NextWindow(windowPosition))
+    {
+        return 0LL; // Every Window has been verified, or the end of the Audio Data was reached.
+    }
+
+    if (static_cast<long long>(windowPosition) > this->m_offset && this->m_previousFrameHeader != 0UL)
+    {
+        // Estimate the Frame Sample Position at the Window, so errors are reported with an approximate time.
+        // With the Info Tag Frame count the total is exact. Otherwise, the total is estimated from the first Frame (exact for CBR).
+        long long audioByteCount = this->m_fileSizeInBytes - this->m_audioDataOffset;
+        unsigned long firstFrameLength = MP3DecoderSupport::GetFrameLength(this->m_previousFrameHeader);
+        double totalSampleCount = this->m_infoTag.frameCountIsPresent ? static_cast<double>(this->GetDecodedAudioDataTotal())
+            : (firstFrameLength > 0UL) ? static_cast<double>(audioByteCount) / firstFrameLength * MP3DecoderSupport::GetSamplesPerFrame(this->m_previousFrameHeader) : 0.0;
+        this->m_frameSamplePosition = static_cast<unsigned long>(totalSampleCount * (static_cast<long long>(windowPosition) - this->m_audioDataOffset) / audioByteCount);
+
+        // Resynchronize on the first Frame at or after the Window position. Each Window has its own scan budget.
+        this->m_offset = static_cast<long long>(windowPosition) - 1LL;
+        this->m_maxResynchronizationCount = MAX_RESYNCHRONIZATION_ATTEMPTS;
+        if (!this->ResynchronizeBitstream())
         {
-            case MPEG1:
-                this->m_columnIndex = 0UL;
-                break;
-            case MPEG2:
-                this->m_columnIndex = 1UL;
-                break;
-            case MPEG2_5:
-                this->m_columnIndex = 2UL;
-                break;
-            default:
-                return 0UL;
+            this->RecordFrameTimeError(DecoderErrorCode::LOST_SYNC);
+            return -1LL; // An error occurred.
         }
-        
-        // Retrieve the Sampling Rate.
-        this->m_sampleRate = MP3DecoderSupport::MP3_SAMPLE_RATES[this->m_sampleRate][this->m_columnIndex];
 
-        if (this->m_sampleRate == 0UL)
+        this->ResetFrameVerification();
+    }
+
+    for (unsigned long frameIndex = 0UL; frameIndex < MP3_SAMPLED_WINDOW_FRAME_COUNT; ++frameIndex)
+    {
+        long long audioUnitsRead = this->ReadFrame();
+        if (audioUnitsRead < 0LL)
         {
-            // Reserved Sample Rate encountered.
-            return 0UL;
+            return -1LL; // An error occurred.
         }
-
-        // Use the Layer Description and the MPEG Audio Encoding Version to determine the Frame Length Formula used for calculating the Frame Length.
-        switch (this->m_layerDescription)
+        else if (audioUnitsRead == 0LL)
         {
-            case LAYER_1:
-            {
-                // Frame Length Formula (Layer I): FrameLengthInBytes = (12 * BitRate / SampleRate + Padding) * 4
-                this->m_frameSamplePosition += 384UL;// Increment Frame Sample Position by the Frame Size Constant.
-                unsigned long frameLength = (12UL * this->m_bitrate / this->m_sampleRate + this->m_framePadding) * 4UL;
-                return frameLength;
-            }
-            case LAYER_II:
-            {
-                // Frame Length Formula (Layer II): FrameLengthInBytes = 144 * BitRate / SampleRate + Padding
-                this->m_frameSamplePosition += 1152UL; // Increment Frame Sample Position by the Frame Size Constant.
-                unsigned long frameLength = 144UL * this->m_bitrate / this->m_sampleRate + this->m_framePadding;
-                return frameLength;
-            }
-            case LAYER_III:
-                if (this->m_encodingVersion == MPEG1)
-                {
-                    // MPEG-1
-                    // Frame Length Formula (Layer III): FrameLengthInBytes = 144 * BitRate / SampleRate + Padding
-                    this->m_frameSamplePosition += 1152UL; // Increment Frame Sample Position by the Frame Size Constant.
-                    unsigned long frameLength = 144UL * this->m_bitrate / this->m_sampleRate + this->m_framePadding;
-                    return frameLength;
-                }
-                else
-                {
-                    // MPEG-2 or MPEG-2.5
-                    // Frame Length Formula (Layer III): FrameLengthInBytes = 72 * BitRate / SampleRate + Padding
-                    this->m_frameSamplePosition += 576UL; // Increment Frame Sample Position by the Frame Size Constant.
-                    unsigned long frameLength = 72UL * this->m_bitrate / this->m_sampleRate + this->m_framePadding;
-                    return frameLength;
-                }
-            default:
-                return 0UL;
+            // The end of the Audio Data was reached.
+            break;
         }
     }
-    else 
+
+    return static_cast<long long>(this->m_sampledVerificationPlan.GetWindowProgressUnits(this->GetDecodedAudioDataTotal()));
+}
+
+bool MP3Decoder::GetResidentData(long long offset, size_t requestedSize, const unsigned char*& dataPtrRef, size_t& dataSizeRef)
+{
+    if (offset < 0LL)
+    {
+        return false;
+    }
+
+    size_t residentSize = 0;
+    const unsigned char* residentDataPtr = this->m_stream.GetResidentDataPtr(offset, residentSize);
+    if (residentDataPtr != nullptr)
+    {
+        // The Memory Buffer is enabled, and the bytes at the offset are resident (i.e. NOT skipped by sparse loading), so NO bytes are copied.
+        dataPtrRef = residentDataPtr;
+        dataSizeRef = (std::min)(requestedSize, residentSize);
+        return true;
+    }
+
+    // Read the data into the Window Buffer with a single Read().
+    this->m_windowBuffer.resize(requestedSize);
+    if (this->m_stream.Seek(offset, SEEK_SET) != 0)
     {
-        return 0UL;
+        return false;
     }
+
+    dataPtrRef = this->m_windowBuffer.data();
+    dataSizeRef = this->m_stream.Read(this->m_windowBuffer.data(), requestedSize);
+    return true;
 }
 
-bool MP3Decoder::ResynchronizeBitstream()
+bool MP3Decoder::GetFrameData(long long offset, size_t minimumSize, const unsigned char*& dataPtrRef, size_t& dataSizeRef)
 {
-    // Reset the Frame Header and Frame Length.
-    this->m_currentFrameHeader = 0UL;
-    this->m_currentFrameLength = 0UL;
-    
-    // Enter the Resynchronization Loop Algorithm. 
-    // 1. Searches by reading in a fresh new byte from the Stream.
-    // 2. Inserts the new byte into the Frame Header.
-    // 3. Recalculates the new Frame Length for the Frame Header.
-    // 4. Either Exits the loop when the conditions are satisfied OR determines that Resychronization when the Stream bytes are exhausted or there is Stream error.
-    // NOTE: MAX_RESYNCHRONIZATION_ATTEMPTS is used to limit the maximum total number of resynchronization iterations.
-    bool validFrameLengthWasFound = false;
-    while (!validFrameLengthWasFound && --this->m_maxResynchronizationCount > 0UL)
-    {
-        // Bit-shifts the Frame Header 8-bits to the left. 
-        // This effectively discards the oldest byte (on the left-side) and makes room for a new byte to be read in (on the right-side).
-        this->m_currentFrameHeader <<= 8UL;
-
-        // Read the next single byte into the Frame Header (on the right-side).
-        if (this->m_stream.Read(reinterpret_cast<unsigned char*>(&this->m_currentFrameHeader), 1) != 0)
-        {
-            // Recalculate the Frame Length for the Frame Header using the newly inserted byte.
-            this->m_currentFrameLength = this->GetFrameLength();
+    long long windowEndOffset = this->m_windowOffset + static_cast<long long>(this->m_windowSize);
 
-            if (this->m_currentFrameLength > 0UL)
-            {
-                validFrameLengthWasFound = true;
-            }
-        }
-        else
+    // Check if the Window already holds the requested bytes (OR all of the remaining bytes in the Stream).
+    bool windowHoldsData = (this->m_windowPtr != nullptr) && (offset >= this->m_windowOffset) && (offset <= windowEndOffset)
+        && ((offset + static_cast<long long>(minimumSize) <= windowEndOffset) || this->m_windowReachesEndOfStream);
+
+    if (!windowHoldsData)
+    {
+        // Refill the Window, starting at the offset.
+        // When the Memory Buffer is enabled, the Window covers the rest of the File and no bytes are copied.
+        bool memoryBufferIsEnabled = this->m_stream.GetMemoryBufferPtr() != nullptr;
+        size_t requestedSize = memoryBufferIsEnabled ? this->m_stream.GetMemoryBufferSize() : (std::max)(static_cast<size_t>(MP3_WINDOW_SIZE), minimumSize);
+
+        if (!this->GetResidentData(offset, requestedSize, this->m_windowPtr, this->m_windowSize))
         {
-            // Resynchronization was NOT successful.
-            return false; // (Base Case)
+            this->m_windowPtr = nullptr;
+            return false;
         }
+
+        this->m_windowOffset = offset;
+        this->m_windowReachesEndOfStream = memoryBufferIsEnabled || (this->m_windowSize < requestedSize);
+        windowEndOffset = this->m_windowOffset + static_cast<long long>(this->m_windowSize);
     }
 
-    // Check the Frame Length.
-    if (this->m_currentFrameLength > 0UL)
+    dataPtrRef = this->m_windowPtr + (offset - this->m_windowOffset);
+    dataSizeRef = static_cast<size_t>(windowEndOffset - offset);
+    return true;
+}
+
+bool MP3Decoder::CheckCRCProtection(const unsigned char* framePtr, size_t frameDataSize)
+{
+    // Check if CRC Protection is enabled for the Frame (Protection Bit == 0) and that the layer is Layer III Encoding.
+    if (((this->m_currentFrameHeader >> 16UL) & 0x01) == 0UL && ((this->m_currentFrameHeader >> 17UL) & 0x03) == LAYER_III)
     {
-        // Check that a previous Frame Header exists.
-        if (this->m_previousFrameHeader > 0UL)
+        // Determine the number of CRC bytes for the combination of Channel Mode and Layer III Encoding Version.
+        bool singleChannelMono = ((this->m_currentFrameHeader >> 6UL) & 0x03) == 0x03;
+        bool encodingVersionIsMPEG1 = ((this->m_currentFrameHeader >> 19UL) & 0x03) == MPEG1;
+        size_t crcByteSize = MP3DecoderSupport::MP3_CRC_BYTE_SIZE[singleChannelMono ? 1 : 0][encodingVersionIsMPEG1 ? 0 : 1];
+
+        // The CRC bytes must all be resident (i.e. the Frame is NOT cut short by the end of the Stream).
+        if (frameDataSize >= 6 + crcByteSize)
         {
-            // Compare the Previous Frame Header with the Frame Header (that has the new byte inserted).
-            // Use the Bitmask to extract the Bitrate, Sampling Rate, and Channel Mode, from both of the Headers.
-            // Compare if those fields are identical.
-            if ( (this->m_currentFrameHeader & 0xFFFE0C00) == (this->m_previousFrameHeader & 0xFFFE0C00) )
-            {
-                // The Frame Headers match, therefore a valid new Frame Header was constructed from the data.
-                // Resynchronization was successful.
-                return true; // (Base Case)
-            }
-            else
+            // The embedded 16-bit CRC Checksum value follows the Frame Header. (High Byte first)
+            unsigned short embeddedFrameCRC = static_cast<unsigned short>((framePtr[4] << 8) | framePtr[5]);
+
+            // The CRC covers the last 2-bytes of the Frame Header, followed by the Side Information (skipping over the embedded CRC Checksum value).
+            unsigned short calculatedCRC = CRC16::Update(0xFFFF, framePtr + 2, 2);
+            calculatedCRC = CRC16::Update(calculatedCRC, framePtr + 6, crcByteSize);
+
+            if (calculatedCRC != embeddedFrameCRC)
             {
-                // The Frame Headers do NOT match, therefore a valid new Frame Header was NOT constructed from the data.
-                // Resynchronization was NOT successful.
-                // Try another resychronization attempt.
-                return this->ResynchronizeBitstream(); // Recursive Call. (Problem Reduction Step)
+                this->RecordFrameTimeError(DecoderErrorCode::CRC_ERROR);
+                return false;
             }
         }
-        else
-        {
-            // A previous Frame Header did NOT exist.
-            // Update the previous Frame Header that is stored.
-            this->m_previousFrameHeader = this->m_currentFrameHeader;
+    }
 
-            // Resynchronization was NOT successful.
-            // Try another resychronization attempt.
-            return this->ResynchronizeBitstream(); // Recursive Call. (Problem Reduction Step)
-        }
+    return true;
+}
+
+void MP3Decoder::ParseInfoTag()
+{
+    this->m_infoTag = MP3InfoTag{};
+
+    const unsigned char* framePtr = nullptr;
+    size_t frameDataSize = 0;
+    if (!this->GetFrameData(this->m_offset, MP3_MAXIMUM_FRAME_LENGTH, framePtr, frameDataSize) || frameDataSize < 4)
+    {
+        return;
     }
-    else
+
+    // The Info Tag is stored in a complete Layer III Frame.
+    unsigned long frameHeader = MP3DecoderSupport::ReadFrameHeader(framePtr);
+    unsigned long frameLength = MP3DecoderSupport::GetFrameLength(frameHeader);
+    if (frameLength == 0UL || ((frameHeader >> 17UL) & 0x03) != LAYER_III || frameDataSize < frameLength)
     {
-        // Resynchronization was NOT successful.
-        return false;  // (Base Case)
+        return;
     }
-}
 
-bool MP3Decoder::CheckCRCProtection()
-{
-    // Check if CRC Protection is enabled for the Frame and that the layer is Layer III Encoding.
-    if (this->m_embeddedFrameCRC == 0 && this->m_layerDescription == LAYER_III)
+    // The Info Tag follows the Frame Header, the optional CRC Checksum, and the Side Information.
+    bool singleChannelMono = ((frameHeader >> 6UL) & 0x03) == 0x03;
+    bool encodingVersionIsMPEG1 = ((frameHeader >> 19UL) & 0x03) == MPEG1;
+    size_t fieldOffset = 4 + ((((frameHeader >> 16UL) & 0x01) == 0UL) ? 2 : 0) + MP3DecoderSupport::MP3_CRC_BYTE_SIZE[singleChannelMono ? 1 : 0][encodingVersionIsMPEG1 ? 0 : 1];
+
+    // The Info Tag starts with the "Xing" (VBR) or "Info" (CBR) ID, followed by the 4-byte flags.
+    if (fieldOffset + 8 > frameLength || (memcmp(framePtr + fieldOffset, "Xing", 4) != 0 && memcmp(framePtr + fieldOffset, "Info", 4) != 0))
     {
-        // Determine the number of CRC bytes for the combination of Channel Mode and Layer III Encoding Version.
-        this->m_CRCByteSize = MP3DecoderSupport::MP3_CRC_BYTE_SIZE[this->m_singleChannelMono == 1 ? 1 : 0][this->m_encodingVersion == MPEG1 ? 0 : 1];
-        
-        // Seek backwards 2-bytes from the current position in the Stream.
-        int seekSuccessful = this->m_stream.Seek(-2, SEEK_CUR);
+        return;
+    }
+
+    unsigned long flags = MP3DecoderSupport::ReadUInt32BigEndian(framePtr + fieldOffset + 4);
+    fieldOffset += 8;
+
+    // The optional fields: Frames (4 bytes), Bytes (4 bytes), TOC (100 bytes), and Quality (4 bytes).
+    size_t fieldsSize = ((flags & MP3DecoderSupport::INFO_TAG_FRAMES_FLAG) ? 4 : 0) + ((flags & MP3DecoderSupport::INFO_TAG_BYTES_FLAG) ? 4 : 0) +
+        ((flags & MP3DecoderSupport::INFO_TAG_TOC_FLAG) ? 100 : 0) + ((flags & MP3DecoderSupport::INFO_TAG_QUALITY_FLAG) ? 4 : 0);
+    if (fieldOffset + fieldsSize > frameLength)
+    {
+        return;
+    }
 
-        // Read 2-bytes from the Buffer.
-        size_t initialbufferReadSize = this->m_stream.Read(this->m_bufferCRCBytes, 2);
+    MP3InfoTag infoTag{};
+    infoTag.isPresent = true;
+    infoTag.frameOffset = this->m_offset;
+    infoTag.frameLength = frameLength;
+    infoTag.samplesPerFrame = MP3DecoderSupport::GetSamplesPerFrame(frameHeader);
 
-        // Read 2-bytes (High + Low) to obtain the embedded CRC Checksum value for the Audio Frame.
-        // Read 1-byte into the High Byte. (The High Byte must be read 1st)
-        unsigned char* highBytePtr = reinterpret_cast<unsigned char*>(&this->m_embeddedFrameCRC) + 1; // Increment by 1-byte.
-        size_t highByteReadSize = this->m_stream.Read(highBytePtr, 1);
+    // Replace the Bitrate Index with the lowest Bitrate (index 1), and clear the Padding Bit.
+    infoTag.minimumFrameLength = MP3DecoderSupport::GetFrameLength((frameHeader & ~0x0000F200UL) | 0x00001000UL);
 
-        // Read 1-byte into the Low Byte. (The Low Byte must be read 2nd)
-        unsigned char* lowBytePtr = reinterpret_cast<unsigned char*>(&this->m_embeddedFrameCRC);
-        size_t lowByteReadSize = this->m_stream.Read(lowBytePtr, 1);
+    if (flags & MP3DecoderSupport::INFO_TAG_FRAMES_FLAG)
+    {
+        infoTag.frameCount = MP3DecoderSupport::ReadUInt32BigEndian(framePtr + fieldOffset);
+        infoTag.frameCountIsPresent = infoTag.frameCount > 0UL;
+        fieldOffset += 4;
+    }
 
-        // Read CRC bytes into the CRC Buffer starting at the third byte (skip over 2-bytes).
-        size_t bufferCRCReadSize = this->m_stream.Read(this->m_bufferCRCBytes + 2, this->m_CRCByteSize);
+    if (flags & MP3DecoderSupport::INFO_TAG_BYTES_FLAG)
+    {
+        infoTag.byteCount = MP3DecoderSupport::ReadUInt32BigEndian(framePtr + fieldOffset);
+        infoTag.byteCountIsPresent = infoTag.byteCount > 0UL;
+        fieldOffset += 4;
+    }
 
-        // Calculates the CRC of the data bytes using the CRC16() function and compares it to the CRC read from the file.
-        unsigned short calculatedCRC = this->CRC16(this->m_bufferCRCBytes, static_cast<size_t>(this->m_CRCByteSize) + 2);
+    // The TOC (used for seeking) and the Quality indicator are NOT needed.
+    fieldOffset += ((flags & MP3DecoderSupport::INFO_TAG_TOC_FLAG) ? 100 : 0) + ((flags & MP3DecoderSupport::INFO_TAG_QUALITY_FLAG) ? 4 : 0);
 
-        if (seekSuccessful == 0 
-            && initialbufferReadSize == 2 
-            && highByteReadSize == 1
-            && lowByteReadSize == 1
-            && bufferCRCReadSize == this->m_CRCByteSize 
-            && calculatedCRC != this->m_embeddedFrameCRC)
+    // Check for the LAME Tag extension. It is only trusted when its own CRC-16 (covering every preceding byte in the Frame) matches.
+    if (fieldOffset + MP3DecoderSupport::LAME_TAG_SIZE <= frameLength)
+    {
+        const unsigned char* lameTagPtr = framePtr + fieldOffset;
+        unsigned short storedTagCRC = static_cast<unsigned short>((lameTagPtr[34] << 8) | lameTagPtr[35]);
+        unsigned short calculatedTagCRC = CRC16::UpdateReflected(0, framePtr, fieldOffset + 34);
+
+        if (storedTagCRC == calculatedTagCRC)
         {
-            float timeDuration = static_cast<float>(this->m_frameSamplePosition) / this->m_streamSampleRate;
-            swprintf(this->m_errorMessage, MAX_ERROR_SIZE, L"CRC_ERROR @ %dm %02ds", (static_cast<int>(timeDuration)) / 60, (static_cast<int>(timeDuration)) % 60);
-            return false;
+            infoTag.lameTagIsValid = true;
+            infoTag.musicLength = MP3DecoderSupport::ReadUInt32BigEndian(lameTagPtr + 28);
+            infoTag.musicCRC = static_cast<unsigned short>((lameTagPtr[32] << 8) | lameTagPtr[33]);
         }
     }
 
-    return true;
+    this->m_infoTag = infoTag;
 }
 
-unsigned short MP3Decoder::CRC16(unsigned char* bufferDataPtr, size_t bufferLength)
+bool MP3Decoder::VerifyInfoTag()
 {
-    unsigned short crc = 0xFFFF; // Initial value.
-    unsigned short polynomial = 0x8005; // A Polynomial commonly used with CRC-16 Algorithms.
-
-    // Process each Byte of Data.
-    for (size_t byteIndex = 0; byteIndex < bufferLength; ++byteIndex) {
+    if (!this->m_infoTag.isPresent)
+    {
+        return true;
+    }
 
-        // For each Byte, XOR the CRC with the byte shifted left by 8-bits.
-        crc ^= static_cast<unsigned short>(bufferDataPtr[byteIndex] << 8);
-        
-        // Process each Bit of data in the Byte. (Iterate 8 times, once for each individual bit).
-        for (size_t bitIndex = 0; bitIndex < 8; ++bitIndex) {
+    if (this->m_infoTag.frameCountIsPresent)
+    {
+        // LAME excludes the Info Tag Frame from the Frame count. Some other encoders include it.
+        bool frameCountMatches = (this->m_frameCount == this->m_infoTag.frameCount)
+            || (!this->m_infoTag.lameTagIsValid && this->m_frameCount + 1UL == this->m_infoTag.frameCount);
 
-            // Check the 15th bit of the CRC.
-            if (crc & 0x8000)
+        if (!frameCountMatches)
+        {
+            if (this->m_frameCount < this->m_infoTag.frameCount)
             {
-                // If the 15th bit is 1, then shift the CRC to the left by 1-bit and XOR it with the Polynomial.
-                crc = (crc << 1) ^ polynomial;
+                this->RecordCountError(DecoderErrorCode::MISSING_FRAMES, static_cast<long long>(this->m_infoTag.frameCount - this->m_frameCount));
             }
             else
             {
-                // If the 15th bit is 0, then shift the CRC to the left by 1-bit.
-                crc = crc << 1;
+                this->RecordCountError(DecoderErrorCode::EXTRA_FRAMES, static_cast<long long>(this->m_frameCount - this->m_infoTag.frameCount));
             }
+            return false;
         }
     }
 
-    return crc;
+    if (this->m_infoTag.lameTagIsValid)
+    {
+        // The byte counts written by LAME include the Info Tag Frame, and exclude any Tags.
+        long long audioByteCount = this->m_fileSizeInBytes - this->m_infoTag.frameOffset;
+        long long expectedByteCounts[] = { this->m_infoTag.byteCountIsPresent ? static_cast<long long>(this->m_infoTag.byteCount) : audioByteCount,
+            (this->m_infoTag.musicLength > 0UL) ? static_cast<long long>(this->m_infoTag.musicLength) : audioByteCount };
+
+        for (long long expectedByteCount : expectedByteCounts)
+        {
+            if (audioByteCount < expectedByteCount)
+            {
+                this->RecordCountError(DecoderErrorCode::MISSING_BYTES, expectedByteCount - audioByteCount);
+                return false;
+            }
+            else if (audioByteCount > expectedByteCount)
+            {
+                this->RecordCountError(DecoderErrorCode::EXTRA_BYTES, audioByteCount - expectedByteCount);
+                return false;
+            }
+        }
+
+        if (this->m_musicCRC != this->m_infoTag.musicCRC)
+        {
+            this->RecordError(DecoderErrorCode::MUSIC_CRC_MISMATCH);
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void MP3Decoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled)
@@ -790,6 +1228,13 @@ void MP3Decoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled
             this->m_frameSamplePosition = 0UL;
             this->m_previousFrameHeader = 0UL;
             this->m_maxResynchronizationCount = MAX_RESYNCHRONIZATION_ATTEMPTS;
+            this->m_windowPtr = nullptr;
+            this->m_frameCount = 0UL;
+            this->m_musicCRC = 0;
+            this->m_bitReservoirSize = 0UL;
+
+            // Check for an Info Tag in the first Frame.
+            this->ParseInfoTag();
 
             this->SetDecoderIsOpenStatus(true);
         }
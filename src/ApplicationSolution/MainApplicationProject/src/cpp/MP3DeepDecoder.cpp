@@ -0,0 +1,90 @@
+#define MINIMP3_IMPLEMENTATION
+#include "MP3DeepDecoder.h"
+
+/// <summary>
+/// Purpose: With-args Constructor that opens the Decoder using the specified File. Uses Constructor Chaining (i.e. Constructor Delegation)
+/// </summary>
+/// <param name="filenamePtr"></param>
+/// <param name="memoryBufferIsEnabled"></param>
+MP3DeepDecoder::MP3DeepDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled) : MP3Decoder(filenamePtr, memoryBufferIsEnabled)
+{
+    mp3dec_init(&this->m_decoder);
+}
+
+MP3DeepDecoder::~MP3DeepDecoder()
+{
+
+}
+
+#pragma region Overridden_Base_Class_Functions_Region
+
+bool MP3DeepDecoder::EnablePcmAnalysis()
+{
+    this->m_pcmAnalysisIsEnabled = true;
+    return true;
+}
+
+#pragma endregion Overridden_Base_Class_Functions_Region
+
+#pragma region Protected_Member_Functions_Region
+
+bool MP3DeepDecoder::VerifyFrame(const unsigned char* framePtr, unsigned long frameLength)
+{
+    // Check the Side Information against the Bit Reservoir first, so the same errors are reported as by the Frame Header walk.
+    if (!MP3Decoder::VerifyFrame(framePtr, frameLength))
+    {
+        return false;
+    }
+
+    // Decode exactly one Frame. The decoder accepts a lone Frame at the start of the input, so the next Frame Header is NOT needed.
+    mp3dec_frame_info_t frameInfo{};
+    int sampleCount = mp3dec_decode_frame(&this->m_decoder, framePtr, static_cast<int>(frameLength), this->m_pcmBuffer, &frameInfo);
+
+    if (frameInfo.frame_offset != 0 || frameInfo.frame_bytes != static_cast<int>(frameLength))
+    {
+        // The decoder did NOT recognise the Frame that the Frame Header walk accepted.
+        this->RecordFrameTimeError(DecoderErrorCode::DECODE_ERROR);
+        return false;
+    }
+
+    if (this->m_reservoirPrimingBytesRemaining > 0UL)
+    {
+        // The Bit Reservoir is still being refilled after a jump, so the Frame may refer to bytes that were NOT decoded.
+        this->m_reservoirPrimingBytesRemaining -= (std::min)(this->m_reservoirPrimingBytesRemaining, frameLength);
+        return true;
+    }
+
+    if (sampleCount == 0)
+    {
+        // The Side Information is invalid, the Bit Reservoir does NOT hold the bytes the Frame refers to, or the Layer I/II allocation is invalid.
+        this->RecordFrameTimeError(DecoderErrorCode::DECODE_ERROR);
+        return false;
+    }
+
+    if (this->m_pcmAnalysisIsEnabled)
+    {
+        if (this->m_pcmAnalyzerPtr == nullptr)
+        {
+            this->m_pcmAnalyzerPtr = std::make_unique<PcmAnalyzer>(static_cast<unsigned long>(frameInfo.hz));
+        }
+
+        // The decoder writes 16-bit interleaved Samples.
+        const size_t pcmSampleCount = static_cast<size_t>(sampleCount) * static_cast<size_t>(frameInfo.channels);
+        for (size_t sampleIndex = 0; sampleIndex < pcmSampleCount; sampleIndex++)
+        {
+            this->m_pcmAnalysisBuffer[sampleIndex] = this->m_pcmBuffer[sampleIndex];
+        }
+        this->m_pcmAnalyzerPtr->AddInterleaved(this->m_pcmAnalysisBuffer, static_cast<unsigned long>(frameInfo.channels), static_cast<unsigned long>(sampleCount), 16UL);
+    }
+
+    return true;
+}
+
+void MP3DeepDecoder::ResetFrameVerification()
+{
+    MP3Decoder::ResetFrameVerification();
+    mp3dec_init(&this->m_decoder);
+    this->m_reservoirPrimingBytesRemaining = MP3_BIT_RESERVOIR_MAXIMUM_SIZE;
+}
+
+#pragma endregion Protected_Member_Functions_Region
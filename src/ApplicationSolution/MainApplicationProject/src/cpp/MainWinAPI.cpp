@@ -37,6 +37,7 @@ processorArchitecture='*' publicKeyToken='6595b64144ccf1df' language='*'\"")
 #include "MainWinAPI.h"
 #include "ApplicationManager.h"
 #include "ExecutionManager.h"
+#include "PcmPipeline.h"
 
 using namespace std;
 
@@ -509,7 +510,19 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
         }
         case MSG_EDIT_WINDOW_UPDATE_TEXT:
             // This Message is sent when a request to update the Edit Window text is made.
-            g_applicationManagerPtr->SetEditWindowText((wchar_t*)wParam, (wchar_t*)lParam);
+            g_applicationManagerPtr->SetEditWindowText((wchar_t*)wParam, (DecoderErrorRecord*)lParam);
+            break;
+        case MSG_FILE_ANALYSIS_UPDATE:
+            // This Message is sent when a Thread has analyzed the decoded PCM of a File.
+            g_applicationManagerPtr->AddFileAnalysisResult((wchar_t*)wParam, (PcmAnalysisResult*)lParam);
+            break;
+        case MSG_FILE_CHECKSUM_UPDATE:
+            // This Message is sent when a Thread has computed the checksums of the decoded PCM of a File.
+            g_applicationManagerPtr->AddFileChecksumResult((wchar_t*)wParam, (AccurateRipChecksumResult*)lParam);
+            break;
+        case MSG_FILE_TRUNCATION_UPDATE:
+            // This Message is sent when the quick tail-only check of a Thread has found a File truncated.
+            g_applicationManagerPtr->AddTruncatedFile((wchar_t*)wParam);
             break;
         case MSG_TITLE_BAR_UPDATE:
             // This Message is sent when a request to update the Window Title Bar Percentage text is made.
@@ -907,7 +920,7 @@ DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)
 
     wstring filename{};
     wchar_t* filenameMessagePtr = nullptr;
-    wchar_t* errorMessagePtr = nullptr;
+    DecoderErrorRecord* errorRecordPtr = nullptr;
 
     // Stores the total number of units from the audio file that have been decoded.
     uint64_t totalAudioUnitsRead = 0ULL;;
@@ -917,6 +930,10 @@ DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)
     
     const int waitTimeOutInterval = 0;
     const int numberOfEventHandleObjects = 2;
+
+    // The Pipeline Thread of this Decoder Thread. It is started when a File is first given a PCM Pipeline, and is reused by every later File.
+    PcmPipelineWorker pcmPipelineWorker{};
+    PcmPipelineWorker::SetCurrentThreadWorker(&pcmPipelineWorker);
     
     // The index value used to determine whether the main Thread Loop is terminated.
     static const DWORD THREAD_TERMINATION_INDEX_VALUE = 0;
@@ -965,18 +982,37 @@ DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)
             const size_t bufferSize = filename.size() + 1;
             filenameMessagePtr = new wchar_t[bufferSize]{}; // Create on the Heap. This will be cleaned up later by the recipient of the MSG_EDIT_WINDOW_UPDATE_TEXT Message. 
             wcscpy_s(filenameMessagePtr, bufferSize, filename.c_str());
+
+            if (DECODER_TUNING_ENABLED)
+            {
+                // Time the candidate read and unpack sizes on the File, when it is sampled by the tuning mode. The File is then verified as usual.
+                g_applicationManagerPtr->TuneDecoder(filename.c_str());
+            }
             
-            // Request ownership of the Critical Section.
-            EnterCriticalSection(&g_criticalSection);
+            unique_ptr<PureAbstractBaseDecoder> decoderSmartPtr{};
 
-            // Serialize Thread access to reading Files from the Disk.
-            // By placing the OpenDecoder() operation within the Critical Section, it ensures that only 1-Thread at a time can read a File from the Disk.
-            // This optimization significantly improves Disk I/O performance and overall program speed when processing Files on the Disk.
-            // Open a new Decoder using the file.
-            unique_ptr<PureAbstractBaseDecoder> decoderSmartPtr = g_applicationManagerPtr->OpenDecoder(filename.c_str());
+            // Reserve the Threads for the File (the Decoder Thread, and any idle CPUs its Decoder can use), outside of the read serialization.
+            unsigned long reservedThreadCount = g_applicationManagerPtr->ReserveDecoderThreads(filename.c_str());
+            if (VOLUME_ADMISSION_ENABLED)
+            {
+                // Each Volume admits as many concurrent reads as suits its storage (e.g. 1-Thread at a time for a rotational Disk),
+                // so the Files on different Volumes are read at the same time.
+                decoderSmartPtr = g_applicationManagerPtr->OpenAdmittedDecoder(filename.c_str(), reservedThreadCount);
+            }
+            else
+            {
+                // Request ownership of the Critical Section.
+                EnterCriticalSection(&g_criticalSection);
 
-            // Release ownership of the Critical Section.
-            LeaveCriticalSection(&g_criticalSection);
+                // Serialize Thread access to reading Files from the Disk.
+                // By placing the OpenDecoder() operation within the Critical Section, it ensures that only 1-Thread at a time can read a File from the Disk.
+                // This optimization significantly improves Disk I/O performance and overall program speed when processing Files on the Disk.
+                // Open a new Decoder using the file.
+                decoderSmartPtr = g_applicationManagerPtr->OpenDecoder(filename.c_str(), reservedThreadCount);
+
+                // Release ownership of the Critical Section.
+                LeaveCriticalSection(&g_criticalSection);
+            }
 
             if (decoderSmartPtr != nullptr)
             {
@@ -996,7 +1032,23 @@ DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)
                 PostMessage(hwndProgressBarWindow, PBM_SETRANGE32, progressBarLowMinimum, progressBarHighMaximum);
 
                 totalAudioUnitsRead = 0ULL;
-                currentAudioUnitSizeRead = decoderSmartPtr->Read(); // Initialize the loop control variable.
+
+                // The File is decoded in batches of many Frames, so the termination check and the progress update below are NOT done per Frame.
+                const uint64_t audioUnitBudget = (decodedAudioDataTotal / DECODE_PROGRESS_STEP_COUNT > 0ULL) ? (decodedAudioDataTotal / DECODE_PROGRESS_STEP_COUNT) : 1ULL;
+
+                // A quick tail-only check for truncation. A truncated File is listed first in the Final Report.
+                // Under the quick policy, a truncated File is reported without being fully decoded.
+                // Otherwise, the full decode decides the result, since the tail-only check is a heuristic (e.g. a trailing Tag it does NOT recognize).
+                const bool fileIsTruncated = decoderSmartPtr->CheckForTruncation();
+                if (fileIsTruncated)
+                {
+                    // The Filename is copied to the Heap. This will be cleaned up later by the recipient of the MSG_FILE_TRUNCATION_UPDATE Message.
+                    wchar_t* truncatedFilenamePtr = new wchar_t[bufferSize]{};
+                    wcscpy_s(truncatedFilenamePtr, bufferSize, filename.c_str());
+                    PostMessage(g_hwndMainApplicationWindow, MSG_FILE_TRUNCATION_UPDATE, reinterpret_cast<WPARAM>(truncatedFilenamePtr), 0);
+                }
+
+                currentAudioUnitSizeRead = (fileIsTruncated && QUICK_TRUNCATION_POLICY_ENABLED) ? -1LL : decoderSmartPtr->Decode(audioUnitBudget, DECODE_TIME_BUDGET_MILLISECONDS); // Initialize the loop control variable.
                 
                 // Purpose: A Thread Loop to Read File Data.
                 // The Thread Loop terminates when the Terminate Event Object is set to the 'signaled state' (Available).
@@ -1029,45 +1081,65 @@ DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)
                     // Caution: Global Shared State is being updated through this Array (Critical Section). 
                     // The Array index being assumed unique per Thread, is the only safety mechanism.
                     // An Explicit Lock is ommitted for maximum performance.
-                    g_decoderProgressTracker[progressTrackerIndex] = totalAudioUnitsRead >> 8ULL;
+                    // The total is only estimated for some Files (e.g. a streamed Ogg Vorbis File, until its last Page), so it can be exceeded.
+                    // Clamp the progress to 100%.
+                    g_decoderProgressTracker[progressTrackerIndex] = ((totalAudioUnitsRead < decodedAudioDataTotal) ? totalAudioUnitsRead : decodedAudioDataTotal) >> 8ULL;
                     
-                    currentAudioUnitSizeRead = decoderSmartPtr->Read(); // Update the loop control variable.
+                    currentAudioUnitSizeRead = decoderSmartPtr->Decode(audioUnitBudget, DECODE_TIME_BUDGET_MILLISECONDS); // Update the loop control variable.
                 }
-                
+
                 if (currentAudioUnitSizeRead < 0LL)
                 {
                     // A decoding read error occurred. (i.e. Audio Unit Size == -1)
                     
-                    // Create an Error Message (on the Heap). 
-                    // This Error Message will be cleaned up later by the recipient of the MSG_EDIT_WINDOW_UPDATE_TEXT Message.
-                    
-                    const wchar_t* lastErrorPtr = decoderSmartPtr->GetLastErrorMessage();
-                    const size_t bufferSize = wcslen(lastErrorPtr) + 1;
-                    errorMessagePtr = new wchar_t[bufferSize]{};
-                    wcscpy_s(errorMessagePtr, bufferSize, lastErrorPtr); // Copy to the Heap.
+                    // Copy the Error Record to the Heap. The text is NOT rendered until the Final Report.
+                    // This Error Record will be cleaned up later by the recipient of the MSG_EDIT_WINDOW_UPDATE_TEXT Message.
+                    errorRecordPtr = new DecoderErrorRecord(decoderSmartPtr->GetLastErrorRecord());
                 }
                 else 
                 {
                     // No error occurred.
-                    errorMessagePtr = nullptr;
+                    errorRecordPtr = nullptr;
+
+                    PcmAnalysisResult analysisResult{};
+                    if (currentAudioUnitSizeRead == 0LL && decoderSmartPtr->GetPcmAnalysisResult(analysisResult))
+                    {
+                        // The whole File was decoded and analyzed. The Filename and the Result are copied to the Heap.
+                        // These will be cleaned up later by the recipient of the MSG_FILE_ANALYSIS_UPDATE Message.
+                        wchar_t* analysisFilenamePtr = new wchar_t[bufferSize]{};
+                        wcscpy_s(analysisFilenamePtr, bufferSize, filename.c_str());
+                        PostMessage(g_hwndMainApplicationWindow, MSG_FILE_ANALYSIS_UPDATE, reinterpret_cast<WPARAM>(analysisFilenamePtr), reinterpret_cast<LPARAM>(new PcmAnalysisResult(analysisResult)));
+                    }
+
+                    AccurateRipChecksumResult checksumResult{};
+                    if (currentAudioUnitSizeRead == 0LL && decoderSmartPtr->GetAccurateRipChecksumResult(checksumResult))
+                    {
+                        // The whole File was decoded. The Filename and the Result are copied to the Heap.
+                        // These will be cleaned up later by the recipient of the MSG_FILE_CHECKSUM_UPDATE Message.
+                        wchar_t* checksumFilenamePtr = new wchar_t[bufferSize]{};
+                        wcscpy_s(checksumFilenamePtr, bufferSize, filename.c_str());
+                        PostMessage(g_hwndMainApplicationWindow, MSG_FILE_CHECKSUM_UPDATE, reinterpret_cast<WPARAM>(checksumFilenamePtr), reinterpret_cast<LPARAM>(new AccurateRipChecksumResult(checksumResult)));
+                    }
                 }
             }
             else
             {
                 // A Decoder was NOT opened for the File. 
-                // Create an Error Message (on the Heap).
-                // This Error Message will be cleaned up later by the recipient of the MSG_EDIT_WINDOW_UPDATE_TEXT Message.
-
-                const size_t bufferSize = wcslen(STR_FILE_ERROR) + 1;
-                errorMessagePtr = new wchar_t[bufferSize]{};
-                wcscpy_s(errorMessagePtr, bufferSize, STR_FILE_ERROR); // Copy to the Heap.
+                // Create an Error Record (on the Heap).
+                // This Error Record will be cleaned up later by the recipient of the MSG_EDIT_WINDOW_UPDATE_TEXT Message.
+                errorRecordPtr = new DecoderErrorRecord{};
+                errorRecordPtr->code = DecoderErrorCode::UNABLE_TO_OPEN_DECODER;
             }
             
+            // The Decoder (and any Segment or Pipeline Threads it started) is finished, so its CPUs can be lent to the next File.
+            decoderSmartPtr.reset();
+            g_applicationManagerPtr->ReleaseDecoderThreads(reservedThreadCount);
+
             // Send a Message to update the Files Processed Count.
             PostMessage(g_hwndMainApplicationWindow, MSG_THREAD_FILE_PROCESSED, 0, 0);
 
             // Send a Message to update the Edit Window text.
-            PostMessage(g_hwndMainApplicationWindow, MSG_EDIT_WINDOW_UPDATE_TEXT, reinterpret_cast<WPARAM>(filenameMessagePtr), reinterpret_cast<LPARAM>(errorMessagePtr));
+            PostMessage(g_hwndMainApplicationWindow, MSG_EDIT_WINDOW_UPDATE_TEXT, reinterpret_cast<WPARAM>(filenameMessagePtr), reinterpret_cast<LPARAM>(errorRecordPtr));
 
             // Send a Message to update the Window Title Bar Percentage text.
             PostMessage(g_hwndMainApplicationWindow, MSG_TITLE_BAR_UPDATE, 0, 0);
@@ -1096,6 +1168,9 @@ DWORD WINAPI DecoderThreadProc(LPVOID lpParameter)
         waitEventMessageHandleIndex = WaitForMultipleObjects(numberOfEventHandleObjects, handleEventObjectsThreadState, false, INFINITE);
     }
 
+    // Every Decoder of this Thread has been destroyed. The Pipeline Thread is stopped when this function returns.
+    PcmPipelineWorker::SetCurrentThreadWorker(nullptr);
+
     // Return Thread Exit Code.
     return 0;
 }
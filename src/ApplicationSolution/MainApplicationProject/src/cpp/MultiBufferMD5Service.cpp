@@ -0,0 +1,625 @@
+#include "MultiBufferMD5Service.h"
+#include "CpuDispatch.h"
+#include <algorithm>
+#include <cstring>
+
+#pragma region SIMD_ADJUSTMENT_FOR_COMPILATION_TARGET
+#ifdef CPU_DISPATCH_X86_ENABLED
+// The SSE2, AVX2, and AVX-512 lanes are all compiled, and the widest lanes supported by the CPU are chosen at runtime.
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+// The Vectors are only passed between functions inlined into a single variant, so the ABI used to pass them does NOT matter.
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+#endif
+#pragma endregion SIMD_ADJUSTMENT_FOR_COMPILATION_TARGET
+
+namespace MultiBufferMD5Support
+{
+    constexpr uint32_t INITIAL_STATE[4] = { 0x67452301UL, 0xEFCDAB89UL, 0x98BADCFEUL, 0x10325476UL };
+
+    inline uint32_t LoadLittleEndian32(const unsigned char* bytePtr)
+    {
+        return static_cast<uint32_t>(bytePtr[0]) | (static_cast<uint32_t>(bytePtr[1]) << 8) |
+            (static_cast<uint32_t>(bytePtr[2]) << 16) | (static_cast<uint32_t>(bytePtr[3]) << 24);
+    }
+
+    /// <summary>
+    /// Purpose: The MD5 Transform of a single Block, written once for every lane width. The Ops type supplies the Vector type and its operations.
+    /// F, G, H, and I are the MD5 auxiliary functions. URI: https://www.rfc-editor.org/rfc/rfc1321#section-3.4
+    /// </summary>
+    template <typename Ops>
+    inline void TransformBlock(typename Ops::Vector state[4], const typename Ops::Vector words[16])
+    {
+        typename Ops::Vector a = state[0];
+        typename Ops::Vector b = state[1];
+        typename Ops::Vector c = state[2];
+        typename Ops::Vector d = state[3];
+
+        #define MULTI_BUFFER_MD5_STEP(function, a, b, c, d, wordIndex, constant, shift) \
+            a = Ops::Add(b, Ops::template RotateLeft<shift>(Ops::Add(Ops::Add(a, Ops::function(b, c, d)), Ops::Add(words[wordIndex], Ops::Set(constant)))))
+
+        MULTI_BUFFER_MD5_STEP(F, a, b, c, d, 0, 0xD76AA478UL, 7);
+        MULTI_BUFFER_MD5_STEP(F, d, a, b, c, 1, 0xE8C7B756UL, 12);
+        MULTI_BUFFER_MD5_STEP(F, c, d, a, b, 2, 0x242070DBUL, 17);
+        MULTI_BUFFER_MD5_STEP(F, b, c, d, a, 3, 0xC1BDCEEEUL, 22);
+        MULTI_BUFFER_MD5_STEP(F, a, b, c, d, 4, 0xF57C0FAFUL, 7);
+        MULTI_BUFFER_MD5_STEP(F, d, a, b, c, 5, 0x4787C62AUL, 12);
+        MULTI_BUFFER_MD5_STEP(F, c, d, a, b, 6, 0xA8304613UL, 17);
+        MULTI_BUFFER_MD5_STEP(F, b, c, d, a, 7, 0xFD469501UL, 22);
+        MULTI_BUFFER_MD5_STEP(F, a, b, c, d, 8, 0x698098D8UL, 7);
+        MULTI_BUFFER_MD5_STEP(F, d, a, b, c, 9, 0x8B44F7AFUL, 12);
+        MULTI_BUFFER_MD5_STEP(F, c, d, a, b, 10, 0xFFFF5BB1UL, 17);
+        MULTI_BUFFER_MD5_STEP(F, b, c, d, a, 11, 0x895CD7BEUL, 22);
+        MULTI_BUFFER_MD5_STEP(F, a, b, c, d, 12, 0x6B901122UL, 7);
+        MULTI_BUFFER_MD5_STEP(F, d, a, b, c, 13, 0xFD987193UL, 12);
+        MULTI_BUFFER_MD5_STEP(F, c, d, a, b, 14, 0xA679438EUL, 17);
+        MULTI_BUFFER_MD5_STEP(F, b, c, d, a, 15, 0x49B40821UL, 22);
+
+        MULTI_BUFFER_MD5_STEP(G, a, b, c, d, 1, 0xF61E2562UL, 5);
+        MULTI_BUFFER_MD5_STEP(G, d, a, b, c, 6, 0xC040B340UL, 9);
+        MULTI_BUFFER_MD5_STEP(G, c, d, a, b, 11, 0x265E5A51UL, 14);
+        MULTI_BUFFER_MD5_STEP(G, b, c, d, a, 0, 0xE9B6C7AAUL, 20);
+        MULTI_BUFFER_MD5_STEP(G, a, b, c, d, 5, 0xD62F105DUL, 5);
+        MULTI_BUFFER_MD5_STEP(G, d, a, b, c, 10, 0x02441453UL, 9);
+        MULTI_BUFFER_MD5_STEP(G, c, d, a, b, 15, 0xD8A1E681UL, 14);
+        MULTI_BUFFER_MD5_STEP(G, b, c, d, a, 4, 0xE7D3FBC8UL, 20);
+        MULTI_BUFFER_MD5_STEP(G, a, b, c, d, 9, 0x21E1CDE6UL, 5);
+        MULTI_BUFFER_MD5_STEP(G, d, a, b, c, 14, 0xC33707D6UL, 9);
+        MULTI_BUFFER_MD5_STEP(G, c, d, a, b, 3, 0xF4D50D87UL, 14);
+        MULTI_BUFFER_MD5_STEP(G, b, c, d, a, 8, 0x455A14EDUL, 20);
+        MULTI_BUFFER_MD5_STEP(G, a, b, c, d, 13, 0xA9E3E905UL, 5);
+        MULTI_BUFFER_MD5_STEP(G, d, a, b, c, 2, 0xFCEFA3F8UL, 9);
+        MULTI_BUFFER_MD5_STEP(G, c, d, a, b, 7, 0x676F02D9UL, 14);
+        MULTI_BUFFER_MD5_STEP(G, b, c, d, a, 12, 0x8D2A4C8AUL, 20);
+
+        MULTI_BUFFER_MD5_STEP(H, a, b, c, d, 5, 0xFFFA3942UL, 4);
+        MULTI_BUFFER_MD5_STEP(H, d, a, b, c, 8, 0x8771F681UL, 11);
+        MULTI_BUFFER_MD5_STEP(H, c, d, a, b, 11, 0x6D9D6122UL, 16);
+        MULTI_BUFFER_MD5_STEP(H, b, c, d, a, 14, 0xFDE5380CUL, 23);
+        MULTI_BUFFER_MD5_STEP(H, a, b, c, d, 1, 0xA4BEEA44UL, 4);
+        MULTI_BUFFER_MD5_STEP(H, d, a, b, c, 4, 0x4BDECFA9UL, 11);
+        MULTI_BUFFER_MD5_STEP(H, c, d, a, b, 7, 0xF6BB4B60UL, 16);
+        MULTI_BUFFER_MD5_STEP(H, b, c, d, a, 10, 0xBEBFBC70UL, 23);
+        MULTI_BUFFER_MD5_STEP(H, a, b, c, d, 13, 0x289B7EC6UL, 4);
+        MULTI_BUFFER_MD5_STEP(H, d, a, b, c, 0, 0xEAA127FAUL, 11);
+        MULTI_BUFFER_MD5_STEP(H, c, d, a, b, 3, 0xD4EF3085UL, 16);
+        MULTI_BUFFER_MD5_STEP(H, b, c, d, a, 6, 0x04881D05UL, 23);
+        MULTI_BUFFER_MD5_STEP(H, a, b, c, d, 9, 0xD9D4D039UL, 4);
+        MULTI_BUFFER_MD5_STEP(H, d, a, b, c, 12, 0xE6DB99E5UL, 11);
+        MULTI_BUFFER_MD5_STEP(H, c, d, a, b, 15, 0x1FA27CF8UL, 16);
+        MULTI_BUFFER_MD5_STEP(H, b, c, d, a, 2, 0xC4AC5665UL, 23);
+
+        MULTI_BUFFER_MD5_STEP(I, a, b, c, d, 0, 0xF4292244UL, 6);
+        MULTI_BUFFER_MD5_STEP(I, d, a, b, c, 7, 0x432AFF97UL, 10);
+        MULTI_BUFFER_MD5_STEP(I, c, d, a, b, 14, 0xAB9423A7UL, 15);
+        MULTI_BUFFER_MD5_STEP(I, b, c, d, a, 5, 0xFC93A039UL, 21);
+        MULTI_BUFFER_MD5_STEP(I, a, b, c, d, 12, 0x655B59C3UL, 6);
+        MULTI_BUFFER_MD5_STEP(I, d, a, b, c, 3, 0x8F0CCC92UL, 10);
+        MULTI_BUFFER_MD5_STEP(I, c, d, a, b, 10, 0xFFEFF47DUL, 15);
+        MULTI_BUFFER_MD5_STEP(I, b, c, d, a, 1, 0x85845DD1UL, 21);
+        MULTI_BUFFER_MD5_STEP(I, a, b, c, d, 8, 0x6FA87E4FUL, 6);
+        MULTI_BUFFER_MD5_STEP(I, d, a, b, c, 15, 0xFE2CE6E0UL, 10);
+        MULTI_BUFFER_MD5_STEP(I, c, d, a, b, 6, 0xA3014314UL, 15);
+        MULTI_BUFFER_MD5_STEP(I, b, c, d, a, 13, 0x4E0811A1UL, 21);
+        MULTI_BUFFER_MD5_STEP(I, a, b, c, d, 4, 0xF7537E82UL, 6);
+        MULTI_BUFFER_MD5_STEP(I, d, a, b, c, 11, 0xBD3AF235UL, 10);
+        MULTI_BUFFER_MD5_STEP(I, c, d, a, b, 2, 0x2AD7D2BBUL, 15);
+        MULTI_BUFFER_MD5_STEP(I, b, c, d, a, 9, 0xEB86D391UL, 21);
+
+        #undef MULTI_BUFFER_MD5_STEP
+
+        state[0] = Ops::Add(state[0], a);
+        state[1] = Ops::Add(state[1], b);
+        state[2] = Ops::Add(state[2], c);
+        state[3] = Ops::Add(state[3], d);
+    }
+
+    /// <summary>
+    /// Purpose: A single Stream, using 32-bit Integers.
+    /// </summary>
+    struct ScalarOps
+    {
+        typedef uint32_t Vector;
+
+        static Vector Set(uint32_t value) { return value; }
+        static Vector Add(Vector x, Vector y) { return x + y; }
+        static Vector F(Vector x, Vector y, Vector z) { return z ^ (x & (y ^ z)); }
+        static Vector G(Vector x, Vector y, Vector z) { return y ^ (z & (x ^ y)); }
+        static Vector H(Vector x, Vector y, Vector z) { return x ^ y ^ z; }
+        static Vector I(Vector x, Vector y, Vector z) { return y ^ (x | ~z); }
+        template <int Shift> static Vector RotateLeft(Vector x) { return (x << Shift) | (x >> (32 - Shift)); }
+    };
+
+#ifdef CPU_DISPATCH_X86_ENABLED
+    /// <summary>
+    /// Purpose: 16 Streams. The auxiliary functions are single ternary logic instructions, and the rotate is a single instruction.
+    /// </summary>
+    struct Avx512LaneOps
+    {
+        typedef __m512i Vector;
+        static constexpr size_t LANE_COUNT = 16;
+
+        CPU_DISPATCH_INLINE_TARGET("avx512f") static Vector Load(const uint32_t* valuePtr) { return _mm512_load_si512(valuePtr); }
+        CPU_DISPATCH_INLINE_TARGET("avx512f") static void Store(uint32_t* valuePtr, Vector x) { _mm512_store_si512(valuePtr, x); }
+        CPU_DISPATCH_INLINE_TARGET("avx512f") static Vector Set(uint32_t value) { return _mm512_set1_epi32(static_cast<int>(value)); }
+        CPU_DISPATCH_INLINE_TARGET("avx512f") static Vector Add(Vector x, Vector y) { return _mm512_add_epi32(x, y); }
+        CPU_DISPATCH_INLINE_TARGET("avx512f") static Vector F(Vector x, Vector y, Vector z) { return _mm512_ternarylogic_epi32(x, y, z, 0xCA); }
+        CPU_DISPATCH_INLINE_TARGET("avx512f") static Vector G(Vector x, Vector y, Vector z) { return _mm512_ternarylogic_epi32(z, x, y, 0xCA); }
+        CPU_DISPATCH_INLINE_TARGET("avx512f") static Vector H(Vector x, Vector y, Vector z) { return _mm512_ternarylogic_epi32(x, y, z, 0x96); }
+        CPU_DISPATCH_INLINE_TARGET("avx512f") static Vector I(Vector x, Vector y, Vector z) { return _mm512_ternarylogic_epi32(x, y, z, 0x39); }
+        template <int Shift> CPU_DISPATCH_INLINE_TARGET("avx512f") static Vector RotateLeft(Vector x) { return _mm512_rol_epi32(x, Shift); }
+    };
+
+    /// <summary>
+    /// Purpose: 8 Streams.
+    /// </summary>
+    struct Avx2LaneOps
+    {
+        typedef __m256i Vector;
+        static constexpr size_t LANE_COUNT = 8;
+
+        CPU_DISPATCH_INLINE_TARGET("avx2") static Vector Load(const uint32_t* valuePtr) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(valuePtr)); }
+        CPU_DISPATCH_INLINE_TARGET("avx2") static void Store(uint32_t* valuePtr, Vector x) { _mm256_store_si256(reinterpret_cast<__m256i*>(valuePtr), x); }
+        CPU_DISPATCH_INLINE_TARGET("avx2") static Vector Set(uint32_t value) { return _mm256_set1_epi32(static_cast<int>(value)); }
+        CPU_DISPATCH_INLINE_TARGET("avx2") static Vector Add(Vector x, Vector y) { return _mm256_add_epi32(x, y); }
+        CPU_DISPATCH_INLINE_TARGET("avx2") static Vector F(Vector x, Vector y, Vector z) { return _mm256_xor_si256(z, _mm256_and_si256(x, _mm256_xor_si256(y, z))); }
+        CPU_DISPATCH_INLINE_TARGET("avx2") static Vector G(Vector x, Vector y, Vector z) { return _mm256_xor_si256(y, _mm256_and_si256(z, _mm256_xor_si256(x, y))); }
+        CPU_DISPATCH_INLINE_TARGET("avx2") static Vector H(Vector x, Vector y, Vector z) { return _mm256_xor_si256(_mm256_xor_si256(x, y), z); }
+        CPU_DISPATCH_INLINE_TARGET("avx2") static Vector I(Vector x, Vector y, Vector z) { return _mm256_xor_si256(y, _mm256_or_si256(x, _mm256_xor_si256(z, _mm256_set1_epi32(-1)))); }
+        template <int Shift> CPU_DISPATCH_INLINE_TARGET("avx2") static Vector RotateLeft(Vector x) { return _mm256_or_si256(_mm256_slli_epi32(x, Shift), _mm256_srli_epi32(x, 32 - Shift)); }
+    };
+
+    /// <summary>
+    /// Purpose: 4 Streams.
+    /// </summary>
+    struct Sse2LaneOps
+    {
+        typedef __m128i Vector;
+        static constexpr size_t LANE_COUNT = 4;
+
+        CPU_DISPATCH_INLINE_TARGET("sse2") static Vector Load(const uint32_t* valuePtr) { return _mm_load_si128(reinterpret_cast<const __m128i*>(valuePtr)); }
+        CPU_DISPATCH_INLINE_TARGET("sse2") static void Store(uint32_t* valuePtr, Vector x) { _mm_store_si128(reinterpret_cast<__m128i*>(valuePtr), x); }
+        CPU_DISPATCH_INLINE_TARGET("sse2") static Vector Set(uint32_t value) { return _mm_set1_epi32(static_cast<int>(value)); }
+        CPU_DISPATCH_INLINE_TARGET("sse2") static Vector Add(Vector x, Vector y) { return _mm_add_epi32(x, y); }
+        CPU_DISPATCH_INLINE_TARGET("sse2") static Vector F(Vector x, Vector y, Vector z) { return _mm_xor_si128(z, _mm_and_si128(x, _mm_xor_si128(y, z))); }
+        CPU_DISPATCH_INLINE_TARGET("sse2") static Vector G(Vector x, Vector y, Vector z) { return _mm_xor_si128(y, _mm_and_si128(z, _mm_xor_si128(x, y))); }
+        CPU_DISPATCH_INLINE_TARGET("sse2") static Vector H(Vector x, Vector y, Vector z) { return _mm_xor_si128(_mm_xor_si128(x, y), z); }
+        CPU_DISPATCH_INLINE_TARGET("sse2") static Vector I(Vector x, Vector y, Vector z) { return _mm_xor_si128(y, _mm_or_si128(x, _mm_xor_si128(z, _mm_set1_epi32(-1)))); }
+        template <int Shift> CPU_DISPATCH_INLINE_TARGET("sse2") static Vector RotateLeft(Vector x) { return _mm_or_si128(_mm_slli_epi32(x, Shift), _mm_srli_epi32(x, 32 - Shift)); }
+    };
+#endif
+
+    /// <summary>
+    /// Purpose: The largest number of Streams hashed together (i.e. AVX-512).
+    /// </summary>
+    constexpr size_t MAXIMUM_LANE_COUNT = 16;
+
+    void TransformScalar(uint32_t state[4], const unsigned char* blockPtr, size_t blockCount)
+    {
+        uint32_t words[16];
+        for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex, blockPtr += MD5_BLOCK_SIZE)
+        {
+            for (size_t wordIndex = 0; wordIndex < 16; ++wordIndex)
+            {
+                words[wordIndex] = LoadLittleEndian32(blockPtr + 4 * wordIndex);
+            }
+
+            TransformBlock<ScalarOps>(state, words);
+        }
+    }
+
+    /// <summary>
+    /// Purpose: Hashes blockCount Blocks of every lane. The lane states are stored by word (i.e. laneStates[word][lane]).
+    /// An idle lane has a Block stride of 0, so it hashes the same Block over and over, and its state is overwritten.
+    /// </summary>
+    typedef void (*TransformLanesFunction)(uint32_t (&laneStates)[4][MAXIMUM_LANE_COUNT], const unsigned char* blockPtrs[MAXIMUM_LANE_COUNT], const size_t blockStrides[MAXIMUM_LANE_COUNT], size_t blockCount);
+
+    template <typename LaneOps>
+    inline void TransformLanes(uint32_t (&laneStates)[4][MAXIMUM_LANE_COUNT], const unsigned char* blockPtrs[MAXIMUM_LANE_COUNT], const size_t blockStrides[MAXIMUM_LANE_COUNT], size_t blockCount)
+    {
+        typename LaneOps::Vector state[4];
+        for (size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+        {
+            state[wordIndex] = LaneOps::Load(laneStates[wordIndex]);
+        }
+
+        // The Message words are transposed, so each Vector holds the same word of every lane.
+        alignas(64) uint32_t transposedWords[16][MAXIMUM_LANE_COUNT];
+        typename LaneOps::Vector words[16];
+        for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+        {
+            for (size_t lane = 0; lane < LaneOps::LANE_COUNT; ++lane)
+            {
+                for (size_t wordIndex = 0; wordIndex < 16; ++wordIndex)
+                {
+                    transposedWords[wordIndex][lane] = LoadLittleEndian32(blockPtrs[lane] + 4 * wordIndex);
+                }
+                blockPtrs[lane] += blockStrides[lane];
+            }
+
+            for (size_t wordIndex = 0; wordIndex < 16; ++wordIndex)
+            {
+                words[wordIndex] = LaneOps::Load(transposedWords[wordIndex]);
+            }
+
+            TransformBlock<LaneOps>(state, words);
+        }
+
+        for (size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+        {
+            LaneOps::Store(laneStates[wordIndex], state[wordIndex]);
+        }
+    }
+
+#ifdef CPU_DISPATCH_X86_ENABLED
+    CPU_DISPATCH_TARGET("avx512f") void TransformLanesAvx512(uint32_t (&laneStates)[4][MAXIMUM_LANE_COUNT], const unsigned char* blockPtrs[MAXIMUM_LANE_COUNT], const size_t blockStrides[MAXIMUM_LANE_COUNT], size_t blockCount)
+    {
+        TransformLanes<Avx512LaneOps>(laneStates, blockPtrs, blockStrides, blockCount);
+    }
+
+    CPU_DISPATCH_TARGET("avx2") void TransformLanesAvx2(uint32_t (&laneStates)[4][MAXIMUM_LANE_COUNT], const unsigned char* blockPtrs[MAXIMUM_LANE_COUNT], const size_t blockStrides[MAXIMUM_LANE_COUNT], size_t blockCount)
+    {
+        TransformLanes<Avx2LaneOps>(laneStates, blockPtrs, blockStrides, blockCount);
+    }
+
+    CPU_DISPATCH_TARGET("sse2") void TransformLanesSse2(uint32_t (&laneStates)[4][MAXIMUM_LANE_COUNT], const unsigned char* blockPtrs[MAXIMUM_LANE_COUNT], const size_t blockStrides[MAXIMUM_LANE_COUNT], size_t blockCount)
+    {
+        TransformLanes<Sse2LaneOps>(laneStates, blockPtrs, blockStrides, blockCount);
+    }
+#endif
+
+    /// <summary>
+    /// Purpose: The lanes chosen for the CPU. When transformLanesFunctionPtr is nullptr, every Stream uses the scalar Transform.
+    /// </summary>
+    struct LaneKernel
+    {
+        TransformLanesFunction transformLanesFunctionPtr{ nullptr };
+        size_t laneCount{ 1 };
+    };
+
+    LaneKernel BindLaneKernel()
+    {
+        LaneKernel kernel{};
+
+        #ifdef CPU_DISPATCH_X86_ENABLED
+        const CpuFeatures& featuresRef = CpuDispatch::GetFeatures();
+        if (featuresRef.avx512f)
+        {
+            kernel.transformLanesFunctionPtr = TransformLanesAvx512;
+            kernel.laneCount = Avx512LaneOps::LANE_COUNT;
+            CpuDispatch::RecordVariant("MD5 lanes", "AVX-512 (16 lanes)");
+            return kernel;
+        }
+
+        if (featuresRef.avx2)
+        {
+            kernel.transformLanesFunctionPtr = TransformLanesAvx2;
+            kernel.laneCount = Avx2LaneOps::LANE_COUNT;
+            CpuDispatch::RecordVariant("MD5 lanes", "AVX2 (8 lanes)");
+            return kernel;
+        }
+
+        if (featuresRef.sse2)
+        {
+            kernel.transformLanesFunctionPtr = TransformLanesSse2;
+            kernel.laneCount = Sse2LaneOps::LANE_COUNT;
+            CpuDispatch::RecordVariant("MD5 lanes", "SSE2 (4 lanes)");
+            return kernel;
+        }
+        #endif
+
+        CpuDispatch::RecordVariant("MD5 lanes", "SCALAR (1 lane)");
+        return kernel;
+    }
+
+    const LaneKernel& GetLaneKernel()
+    {
+        static const LaneKernel kernel = BindLaneKernel(); // Bound once, on first use.
+        return kernel;
+    }
+
+    /// <summary>
+    /// Purpose: The whole Blocks of a single Stream in a batch.
+    /// </summary>
+    struct LaneWork
+    {
+        uint32_t state[4]{};
+        std::vector<unsigned char> blocks{};
+    };
+
+    /// <summary>
+    /// Purpose: Hashes the Blocks of up to lane count Streams. While at least two Streams have Blocks left, they are hashed together,
+    /// up to the end of the shortest Stream. The Blocks left in the last Stream are hashed using the scalar Transform.
+    /// </summary>
+    void HashLanes(LaneWork* workPtr, size_t workCount)
+    {
+        size_t remainingBlockCounts[MAXIMUM_LANE_COUNT]{};
+        size_t offsets[MAXIMUM_LANE_COUNT]{};
+        for (size_t lane = 0; lane < workCount; ++lane)
+        {
+            remainingBlockCounts[lane] = workPtr[lane].blocks.size() / MD5_BLOCK_SIZE;
+        }
+
+        const LaneKernel& kernelRef = GetLaneKernel();
+        if (kernelRef.transformLanesFunctionPtr != nullptr)
+        {
+            static const unsigned char idleBlock[MD5_BLOCK_SIZE]{};
+            alignas(64) uint32_t laneStates[4][MAXIMUM_LANE_COUNT]{};
+            for (size_t lane = 0; lane < workCount; ++lane)
+            {
+                for (size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+                {
+                    laneStates[wordIndex][lane] = workPtr[lane].state[wordIndex];
+                }
+            }
+
+            while (true)
+            {
+                size_t activeLaneCount = 0;
+                size_t blockCount = 0;
+                for (size_t lane = 0; lane < workCount; ++lane)
+                {
+                    if (remainingBlockCounts[lane] > 0)
+                    {
+                        blockCount = (activeLaneCount == 0) ? remainingBlockCounts[lane] : std::min(blockCount, remainingBlockCounts[lane]);
+                        ++activeLaneCount;
+                    }
+                }
+
+                if (activeLaneCount < 2)
+                {
+                    break;
+                }
+
+                const unsigned char* blockPtrs[MAXIMUM_LANE_COUNT];
+                size_t blockStrides[MAXIMUM_LANE_COUNT];
+                for (size_t lane = 0; lane < kernelRef.laneCount; ++lane)
+                {
+                    bool laneIsActive = (lane < workCount && remainingBlockCounts[lane] > 0);
+                    blockPtrs[lane] = laneIsActive ? workPtr[lane].blocks.data() + offsets[lane] : idleBlock;
+                    blockStrides[lane] = laneIsActive ? MD5_BLOCK_SIZE : 0;
+                }
+
+                kernelRef.transformLanesFunctionPtr(laneStates, blockPtrs, blockStrides, blockCount);
+
+                for (size_t lane = 0; lane < workCount; ++lane)
+                {
+                    if (remainingBlockCounts[lane] > 0)
+                    {
+                        remainingBlockCounts[lane] -= blockCount;
+                        offsets[lane] += blockCount * MD5_BLOCK_SIZE;
+                        if (remainingBlockCounts[lane] == 0)
+                        {
+                            // The lane is idle from now on, so its state must be saved before the next Transform overwrites it.
+                            for (size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+                            {
+                                workPtr[lane].state[wordIndex] = laneStates[wordIndex][lane];
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (size_t lane = 0; lane < workCount; ++lane)
+            {
+                if (remainingBlockCounts[lane] > 0)
+                {
+                    for (size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+                    {
+                        workPtr[lane].state[wordIndex] = laneStates[wordIndex][lane];
+                    }
+                }
+            }
+        }
+
+        for (size_t lane = 0; lane < workCount; ++lane)
+        {
+            TransformScalar(workPtr[lane].state, workPtr[lane].blocks.data() + offsets[lane], remainingBlockCounts[lane]);
+        }
+    }
+}
+
+MultiBufferMD5Service::MultiBufferMD5Service()
+{
+
+}
+
+MultiBufferMD5Service::~MultiBufferMD5Service()
+{
+
+}
+
+#pragma region Public_Member_Functions_Region
+
+MD5StreamId MultiBufferMD5Service::Join()
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    MD5StreamId streamId = this->m_nextStreamId++;
+    StreamState& streamRef = this->m_streams[streamId];
+    memcpy(streamRef.state, MultiBufferMD5Support::INITIAL_STATE, sizeof(streamRef.state));
+    return streamId;
+}
+
+void MultiBufferMD5Service::Submit(MD5StreamId streamId, const unsigned char* dataPtr, size_t size)
+{
+    StreamState* streamPtr = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        auto streamIterator = this->m_streams.find(streamId);
+        if (streamIterator == this->m_streams.end())
+        {
+            return;
+        }
+
+        // The Stream is NOT moved or erased until its own Thread ends it, so it is used below without holding the shared Mutex.
+        streamPtr = &streamIterator->second;
+        if (streamPtr->isHashing && GetPendingSize(*streamPtr) + size > MULTI_BUFFER_MD5_MAXIMUM_PENDING_SIZE)
+        {
+            // Another Thread is hashing this Stream, and is falling behind the Decoder.
+            this->WaitWhileHashing(lock, *streamPtr);
+        }
+    }
+
+    // Copy the bytes to the pending Buffer of the Stream. A batch on another Thread only holds its Mutex while swapping out the whole Blocks.
+    size_t pendingSize = 0;
+    {
+        std::lock_guard<std::mutex> pendingLock(streamPtr->pendingMutex);
+        streamPtr->pendingBytes.insert(streamPtr->pendingBytes.end(), dataPtr, dataPtr + size);
+        pendingSize = streamPtr->pendingBytes.size();
+    }
+    streamPtr->messageSize += size;
+
+    if (pendingSize >= MULTI_BUFFER_MD5_BATCH_SIZE)
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        if (!streamPtr->isHashing)
+        {
+            this->HashBatch(lock, *streamPtr);
+        }
+    }
+}
+
+void MultiBufferMD5Service::Finish(MD5StreamId streamId, unsigned char digest[MD5_DIGEST_SIZE])
+{
+    uint32_t state[4]{};
+    unsigned long long messageSize = 0ULL;
+    std::vector<unsigned char> pendingBytes{};
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        auto streamIterator = this->m_streams.find(streamId);
+        if (streamIterator == this->m_streams.end())
+        {
+            memset(digest, 0, MD5_DIGEST_SIZE);
+            return;
+        }
+
+        this->WaitWhileHashing(lock, streamIterator->second);
+        memcpy(state, streamIterator->second.state, sizeof(state));
+        messageSize = streamIterator->second.messageSize;
+        {
+            std::lock_guard<std::mutex> pendingLock(streamIterator->second.pendingMutex);
+            pendingBytes.swap(streamIterator->second.pendingBytes);
+        }
+        this->m_streams.erase(streamIterator);
+    }
+
+    // The last Stream bytes are hashed on the calling Thread.
+    size_t wholeBlockCount = pendingBytes.size() / MD5_BLOCK_SIZE;
+    MultiBufferMD5Support::TransformScalar(state, pendingBytes.data(), wholeBlockCount);
+
+    // Padding: a single 1 bit, then 0 bits up to 56 bytes (mod 64), then the Message length in bits (64-bit Little Endian).
+    unsigned char finalBlocks[2 * MD5_BLOCK_SIZE]{};
+    size_t tailSize = pendingBytes.size() - wholeBlockCount * MD5_BLOCK_SIZE;
+    if (tailSize > 0)
+    {
+        memcpy(finalBlocks, pendingBytes.data() + wholeBlockCount * MD5_BLOCK_SIZE, tailSize);
+    }
+    finalBlocks[tailSize] = 0x80;
+
+    size_t finalBlockCount = (tailSize < MD5_BLOCK_SIZE - 8) ? 1 : 2;
+    unsigned long long messageBitCount = messageSize * 8ULL;
+    for (size_t byteIndex = 0; byteIndex < 8; ++byteIndex)
+    {
+        finalBlocks[finalBlockCount * MD5_BLOCK_SIZE - 8 + byteIndex] = static_cast<unsigned char>(messageBitCount >> (8 * byteIndex));
+    }
+    MultiBufferMD5Support::TransformScalar(state, finalBlocks, finalBlockCount);
+
+    for (size_t wordIndex = 0; wordIndex < 4; ++wordIndex)
+    {
+        for (size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+        {
+            digest[4 * wordIndex + byteIndex] = static_cast<unsigned char>(state[wordIndex] >> (8 * byteIndex));
+        }
+    }
+}
+
+void MultiBufferMD5Service::Cancel(MD5StreamId streamId)
+{
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    auto streamIterator = this->m_streams.find(streamId);
+    if (streamIterator != this->m_streams.end())
+    {
+        this->WaitWhileHashing(lock, streamIterator->second);
+        this->m_streams.erase(streamIterator);
+    }
+}
+
+unsigned long MultiBufferMD5Service::GetLaneCount()
+{
+    return static_cast<unsigned long>(MultiBufferMD5Support::GetLaneKernel().laneCount);
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+void MultiBufferMD5Service::HashBatch(std::unique_lock<std::mutex>& lockRef, StreamState& streamRef)
+{
+    StreamState* streamPtrs[MultiBufferMD5Support::MAXIMUM_LANE_COUNT]{};
+    MultiBufferMD5Support::LaneWork work[MultiBufferMD5Support::MAXIMUM_LANE_COUNT]{};
+    size_t laneCount = MultiBufferMD5Support::GetLaneKernel().laneCount;
+    size_t workCount = 0;
+
+    // The Stream that started the batch takes the first lane. The other lanes are filled by the idle Streams with at least one whole Block pending.
+    streamPtrs[workCount++] = &streamRef;
+    for (auto& streamPair : this->m_streams)
+    {
+        if (workCount == laneCount)
+        {
+            break;
+        }
+
+        StreamState& otherStreamRef = streamPair.second;
+        if (&otherStreamRef != &streamRef && !otherStreamRef.isHashing && GetPendingSize(otherStreamRef) >= MD5_BLOCK_SIZE)
+        {
+            streamPtrs[workCount++] = &otherStreamRef;
+        }
+    }
+
+    // Take the whole Blocks. The partial Block at the end stays pending. The Decoder of the Stream may keep submitting bytes while they are hashed.
+    for (size_t lane = 0; lane < workCount; ++lane)
+    {
+        StreamState& laneStreamRef = *streamPtrs[lane];
+        std::vector<unsigned char>& blocksRef = work[lane].blocks;
+        {
+            std::lock_guard<std::mutex> pendingLock(laneStreamRef.pendingMutex);
+            size_t wholeSize = laneStreamRef.pendingBytes.size() - (laneStreamRef.pendingBytes.size() % MD5_BLOCK_SIZE);
+
+            blocksRef.swap(laneStreamRef.pendingBytes);
+            laneStreamRef.pendingBytes.assign(blocksRef.begin() + wholeSize, blocksRef.end());
+            blocksRef.resize(wholeSize);
+        }
+
+        memcpy(work[lane].state, laneStreamRef.state, sizeof(work[lane].state));
+        laneStreamRef.isHashing = true;
+    }
+
+    lockRef.unlock();
+    MultiBufferMD5Support::HashLanes(work, workCount);
+    lockRef.lock();
+
+    for (size_t lane = 0; lane < workCount; ++lane)
+    {
+        memcpy(streamPtrs[lane]->state, work[lane].state, sizeof(work[lane].state));
+        streamPtrs[lane]->isHashing = false;
+    }
+
+    this->m_hashingCompleteCondition.notify_all();
+}
+
+size_t MultiBufferMD5Service::GetPendingSize(StreamState& streamRef)
+{
+    std::lock_guard<std::mutex> pendingLock(streamRef.pendingMutex);
+    return streamRef.pendingBytes.size();
+}
+
+void MultiBufferMD5Service::WaitWhileHashing(std::unique_lock<std::mutex>& lockRef, const StreamState& streamRef)
+{
+    this->m_hashingCompleteCondition.wait(lockRef, [&streamRef]() { return !streamRef.isHashing; });
+}
+
+#pragma endregion Private_Member_Functions_Region
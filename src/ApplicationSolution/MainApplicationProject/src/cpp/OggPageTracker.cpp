@@ -0,0 +1,194 @@
+#include "OggPageTracker.h"
+#include <cstring>
+
+/// <summary>
+/// Purpose: The Capture Pattern that starts every Ogg Page.
+/// </summary>
+static constexpr unsigned char OGG_CAPTURE_PATTERN[] = { 'O', 'g', 'g', 'S' };
+
+/// <summary>
+/// Purpose: The Header Type flag indicating the last Page of a logical bitstream.
+/// </summary>
+constexpr auto OGG_HEADER_TYPE_END_OF_STREAM = 0x04;
+
+OggPageTracker::OggPageTracker()
+{
+
+}
+
+OggPageTracker::~OggPageTracker()
+{
+
+}
+
+void OggPageTracker::Consume(const unsigned char* dataPtr, size_t size)
+{
+    while (size > 0)
+    {
+        if (this->m_pageBodyBytesRemaining > 0)
+        {
+            // Skip over the Page body in bulk. Only the Page Headers are of interest.
+            size_t skipSize = (this->m_pageBodyBytesRemaining < size) ? static_cast<size_t>(this->m_pageBodyBytesRemaining) : size;
+            this->m_pageBodyBytesRemaining -= skipSize;
+            dataPtr += skipSize;
+            size -= skipSize;
+            continue;
+        }
+
+        unsigned char currentByte = *dataPtr++;
+        size--;
+
+        if (this->m_pageHeaderBytesFilled < sizeof(OGG_CAPTURE_PATTERN))
+        {
+            // Match the Capture Pattern. Garbage between Pages is skipped until the Capture Pattern is found again.
+            if (currentByte == OGG_CAPTURE_PATTERN[this->m_pageHeaderBytesFilled])
+            {
+                this->m_pageHeaderBuffer[this->m_pageHeaderBytesFilled++] = currentByte;
+            }
+            else
+            {
+                this->m_pageHeaderBytesFilled = (currentByte == OGG_CAPTURE_PATTERN[0]) ? 1 : 0;
+            }
+            continue;
+        }
+
+        this->m_pageHeaderBuffer[this->m_pageHeaderBytesFilled++] = currentByte;
+
+        if (this->m_pageHeaderBytesFilled == OGG_PAGE_HEADER_FIXED_SIZE)
+        {
+            // The last byte of the fixed portion holds the number of entries in the Segment Table.
+            this->m_pageHeaderBytesRequired = OGG_PAGE_HEADER_FIXED_SIZE + this->m_pageHeaderBuffer[OGG_PAGE_HEADER_FIXED_SIZE - 1];
+        }
+
+        if (this->m_pageHeaderBytesFilled >= OGG_PAGE_HEADER_FIXED_SIZE && this->m_pageHeaderBytesFilled == this->m_pageHeaderBytesRequired)
+        {
+            this->ProcessPageHeader();
+            this->m_pageHeaderBytesFilled = 0;
+            this->m_pageHeaderBytesRequired = OGG_PAGE_HEADER_FIXED_SIZE;
+        }
+    }
+}
+
+long long OggPageTracker::GetLastGranulePosition(long serialNumber) const
+{
+    auto it = this->m_serialNumberToStateMap.find(serialNumber);
+    return (it != this->m_serialNumberToStateMap.end()) ? it->second.lastGranulePosition : -1LL;
+}
+
+unsigned long OggPageTracker::GetAnchorPageCount(long serialNumber) const
+{
+    auto it = this->m_serialNumberToStateMap.find(serialNumber);
+    return (it != this->m_serialNumberToStateMap.end()) ? it->second.anchorPageCount : 0UL;
+}
+
+bool OggPageTracker::IsEndOfStreamSeen(long serialNumber) const
+{
+    auto it = this->m_serialNumberToStateMap.find(serialNumber);
+    return (it != this->m_serialNumberToStateMap.end()) ? it->second.endOfStreamSeen : false;
+}
+
+void OggPageTracker::Reset()
+{
+    this->m_serialNumberToStateMap.clear();
+    this->m_pageHeaderBytesFilled = 0;
+    this->m_pageHeaderBytesRequired = OGG_PAGE_HEADER_FIXED_SIZE;
+    this->m_pageBodyBytesRemaining = 0;
+}
+
+bool OggPageTracker::ParsePageHeader(const unsigned char* dataPtr, size_t size, OggPageHeaderInfo& pageHeaderInfoRef)
+{
+    if (size < OGG_PAGE_HEADER_FIXED_SIZE || memcmp(dataPtr, OGG_CAPTURE_PATTERN, sizeof(OGG_CAPTURE_PATTERN)) != 0 || dataPtr[4] != 0)
+    {
+        return false;
+    }
+
+    size_t headerSize = OGG_PAGE_HEADER_FIXED_SIZE + dataPtr[OGG_PAGE_HEADER_FIXED_SIZE - 1];
+    if (size < headerSize)
+    {
+        return false;
+    }
+
+    size_t bodySize = 0;
+    for (size_t i = OGG_PAGE_HEADER_FIXED_SIZE; i < headerSize; i++)
+    {
+        bodySize += dataPtr[i];
+    }
+
+    if (size - headerSize < bodySize)
+    {
+        return false;
+    }
+
+    unsigned long long granulePosition = 0;
+    for (int i = 7; i >= 0; i--)
+    {
+        granulePosition = (granulePosition << 8) | dataPtr[6 + i];
+    }
+
+    unsigned int serialNumber = static_cast<unsigned int>(dataPtr[14]) | (static_cast<unsigned int>(dataPtr[15]) << 8) |
+        (static_cast<unsigned int>(dataPtr[16]) << 16) | (static_cast<unsigned int>(dataPtr[17]) << 24);
+
+    unsigned int sequenceNumber = static_cast<unsigned int>(dataPtr[18]) | (static_cast<unsigned int>(dataPtr[19]) << 8) |
+        (static_cast<unsigned int>(dataPtr[20]) << 16) | (static_cast<unsigned int>(dataPtr[21]) << 24);
+
+    pageHeaderInfoRef.granulePosition = static_cast<long long>(granulePosition);
+    pageHeaderInfoRef.serialNumber = static_cast<long>(static_cast<int>(serialNumber));
+    pageHeaderInfoRef.sequenceNumber = sequenceNumber;
+    pageHeaderInfoRef.headerType = dataPtr[5];
+    pageHeaderInfoRef.headerSize = headerSize;
+    pageHeaderInfoRef.bodySize = bodySize;
+
+    return true;
+}
+
+void OggPageTracker::ProcessPageHeader()
+{
+    // Page Header layout (all multi-byte fields are little-endian):
+    // [0-3] Capture Pattern, [4] Version, [5] Header Type, [6-13] Granule Position, [14-17] Serial Number,
+    // [18-21] Page Sequence Number, [22-25] CRC Checksum, [26] Number of Segments, [27-...] Segment Table.
+    const unsigned char* headerPtr = this->m_pageHeaderBuffer;
+
+    // The Body size is the sum of the Segment Table (Lacing Values).
+    unsigned long long pageBodySize = 0;
+    for (size_t i = OGG_PAGE_HEADER_FIXED_SIZE; i < this->m_pageHeaderBytesRequired; i++)
+    {
+        pageBodySize += headerPtr[i];
+    }
+
+    if (headerPtr[4] != 0)
+    {
+        // Unsupported Stream Structure Version. Treat it as garbage and resume scanning for the next Capture Pattern.
+        return;
+    }
+
+    this->m_pageBodyBytesRemaining = pageBodySize;
+
+    unsigned long long granulePosition = 0;
+    for (int i = 7; i >= 0; i--)
+    {
+        granulePosition = (granulePosition << 8) | headerPtr[6 + i];
+    }
+
+    unsigned int serialNumber = static_cast<unsigned int>(headerPtr[14]) | (static_cast<unsigned int>(headerPtr[15]) << 8) |
+        (static_cast<unsigned int>(headerPtr[16]) << 16) | (static_cast<unsigned int>(headerPtr[17]) << 24);
+
+    // Use the same sign-extended Serial Number as 'libogg' and 'libvorbisfile' (i.e. ogg_page_serialno() returns an int).
+    LogicalBitstreamState& state = this->m_serialNumberToStateMap[static_cast<long>(static_cast<int>(serialNumber))];
+
+    bool endOfStream = (headerPtr[5] & OGG_HEADER_TYPE_END_OF_STREAM) != 0;
+    long long signedGranulePosition = static_cast<long long>(granulePosition);
+    if (signedGranulePosition != -1LL)
+    {
+        // A Granule Position of -1 indicates that no Packet finishes on the Page.
+        state.lastGranulePosition = signedGranulePosition;
+        if (signedGranulePosition > 0 && !endOfStream)
+        {
+            state.anchorPageCount++;
+        }
+    }
+
+    if (endOfStream)
+    {
+        state.endOfStreamSeen = true;
+    }
+}
@@ -1,10 +1,5 @@
 #include "OggVorbisDecoder.h"
 
-/// <summary>
-/// Purpose: The maximum number of decoded Samples to produce.
-/// </summary>
-constexpr auto CHUNK_SIZE = 4096;
-
 #pragma region OGG_VORBIS_CALLBACK_FUNCTIONS
 
 /// <summary>
@@ -37,6 +32,28 @@ namespace OggVorbisCallbackFunction
         StreamWrapper* streamWrapperPtr = static_cast<StreamWrapper*>(datasource);
         return static_cast<long>(streamWrapperPtr->Tell());
     }
+
+    /// <summary>
+    /// Purpose: The read Callback Function used in Streaming Mode. The bytes are also passed through the Page Tracker.
+    /// </summary>
+    static size_t streaming_read_func(void* ptr, size_t size, size_t nmemb, void* datasource)
+    {
+        OggVorbisStreamingDataSource* dataSourcePtr = static_cast<OggVorbisStreamingDataSource*>(datasource);
+        size_t bytesRead = dataSourcePtr->streamWrapperPtr->Read(ptr, size * nmemb);
+        dataSourcePtr->pageTrackerPtr->Consume(static_cast<const unsigned char*>(ptr), bytesRead);
+        return bytesRead;
+    }
+
+    /// <summary>
+    /// Purpose: The close Callback Function used in Streaming Mode.
+    /// </summary>
+    static int streaming_close_func(void* datasource)
+    {
+        // Called after the ov_clear() function is called.
+        OggVorbisStreamingDataSource* dataSourcePtr = static_cast<OggVorbisStreamingDataSource*>(datasource);
+        dataSourcePtr->streamWrapperPtr->Close();
+        return 1;
+    }
 }
 
 #pragma endregion OGG_VORBIS_CALLBACK_FUNCTIONS
@@ -51,9 +68,26 @@ OggVorbisDecoder::OggVorbisDecoder() : AbstractBaseDecoder(DECODER_NAME)
 /// </summary>
 /// <param name="filenamePtr"></param>
 /// <param name="memoryBufferIsEnabled"></param>
-OggVorbisDecoder::OggVorbisDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled) : OggVorbisDecoder()
+OggVorbisDecoder::OggVorbisDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled) : OggVorbisDecoder(filenamePtr, memoryBufferIsEnabled, false, 1UL)
+{
+
+}
+
+/// <summary>
+/// Purpose: With-args Constructor that opens the Decoder using the specified File. Uses Constructor Chaining (i.e. Constructor Delegation)
+/// </summary>
+/// <param name="filenamePtr"></param>
+/// <param name="memoryBufferIsEnabled"></param>
+/// <param name="streamingModeIsEnabled">
+/// Set to TRUE to present the Stream as non-seekable and decode it in a single forward pass. 
+/// Set to FALSE to let 'libvorbisfile' seek through the File at open time.
+/// </param>
+/// <param name="segmentThreadCount">The maximum number of Threads that can be used to verify Segments of a large File concurrently.</param>
+OggVorbisDecoder::OggVorbisDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled, bool streamingModeIsEnabled, unsigned long segmentThreadCount) : OggVorbisDecoder()
 {
     this->m_decoderMemoryBufferIsEnabled = memoryBufferIsEnabled;
+    this->m_streamingModeIsEnabled = streamingModeIsEnabled;
+    this->m_segmentThreadCount = segmentThreadCount;
     
     // Open the Ogg-Vorbis File.
     this->OpenFile(filenamePtr, memoryBufferIsEnabled);
@@ -61,6 +95,9 @@ OggVorbisDecoder::OggVorbisDecoder(const wchar_t* filenamePtr, bool memoryBuffer
 
 OggVorbisDecoder::~OggVorbisDecoder()
 {
+    // Stop any Segment Threads before the Memory Buffer they read from is released.
+    this->m_segmentVerifierPtr.reset();
+
     if (this->DecoderIsOpen())
     {
         // After a bitstream has been opened using ov_open_callbacks() and decoding is complete, the Application must call ov_clear() 
@@ -74,11 +111,21 @@ OggVorbisDecoder::~OggVorbisDecoder()
 
 long long OggVorbisDecoder::Read()
 {
+    if (this->m_segmentVerifierPtr != nullptr)
+    {
+        return this->ReadSegments();
+    }
+
+    if (this->m_sampledVerificationPlan.IsEnabled())
+    {
+        return this->ReadSampled();
+    }
+
     // URI: https://xiph.org/vorbis/doc/vorbisfile/decoding.html
 
     // Get the Samples in the Native Float Format instead of in Integer Formats.
     // URI: https://www.xiph.org/vorbis/doc/vorbisfile/ov_read_float.html
-    long long numberOfSampleBytesRead = ov_read_float(&this->m_oggVorbisFileStruct, &this->m_decodedOutputBuffer, CHUNK_SIZE, &this->m_bitstream);
+    long long numberOfSampleBytesRead = ov_read_float(&this->m_oggVorbisFileStruct, &this->m_decodedOutputBuffer, this->m_readChunkSize, &this->m_bitstream);
     switch (numberOfSampleBytesRead)
     {
         case 0LL:
@@ -86,21 +133,27 @@ long long OggVorbisDecoder::Read()
             // Indicates EOF has been reached.
             if (!this->m_oggVorbisFileStruct.os.e_o_s)
             {
-                wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"TRUNCATED");
+                this->RecordError(DecoderErrorCode::TRUNCATED);
                 return -1LL; // An error occured.
             }
+
+            if (this->m_streamingModeIsEnabled)
+            {
+                // The total is now known exactly.
+                this->m_streamTotalSampleCount = this->m_streamingDecodedSampleCount;
+
+                if (!this->VerifyStreamingLinkEnd())
+                {
+                    return -1LL; // An error occured.
+                }
+            }
             break;
         }
         case OV_HOLE:
         {
             // Indicates that there was an interruption in the Data.
             // Possibilities include one of the following: garbage between pages, loss of sync followed by recapture, or a corrupt page.
-            
-            // Get the current Decoding offset in seconds.
-            // URI: https://www.xiph.org/vorbis/doc/vorbisfile/ov_time_tell.html
-            float decodingTimeOffset = (float)ov_time_tell(&this->m_oggVorbisFileStruct);
-
-            swprintf(this->m_errorMessage, MAX_ERROR_SIZE, L"OGG-VORBIS_HOLE @ %dm %02ds", ((int)decodingTimeOffset) / 60, ((int)decodingTimeOffset) % 60);
+            this->RecordDecodingTimeError(DecoderErrorCode::OGG_VORBIS_HOLE);
             return -1LL; // An error occured.
         }
         case OV_EBADLINK:
@@ -110,52 +163,165 @@ long long OggVorbisDecoder::Read()
             // NOTE: A Vorbis stream may consist of multiple sections (called Links) that encode differing numbers of channels or sample rates.
             // It is important to pay attention to the Link numbers returned by ov_read() and handle audio changes that may occur at Link boundaries.
             // Multi-section files do exist in the wild and are not merely a specification curiosity.
-
-            // Get the current Decoding offset in seconds.
-            // URI: https://www.xiph.org/vorbis/doc/vorbisfile/ov_time_tell.html
-            float decodingTimeOffset = (float)ov_time_tell(&this->m_oggVorbisFileStruct);
-
-            swprintf(this->m_errorMessage, MAX_ERROR_SIZE, L"OGG-VORBIS_EBADLINK @ %dm %02ds", ((int)decodingTimeOffset) / 60, ((int)decodingTimeOffset) % 60);
+            this->RecordDecodingTimeError(DecoderErrorCode::OGG_VORBIS_EBADLINK);
             return -1LL;  // An error occured.
         }
         case OV_EINVAL:
             // Indicates the initial File Headers couldn't be read or are corrupt, OR that the initial open() call for the Vorbis File failed.
-            wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"UNREADABLE_OR_CORRUPT_HEADER");
+            this->RecordError(DecoderErrorCode::UNREADABLE_OR_CORRUPT_HEADER);
             return -1LL; // An error occured.
     }
 
+    if (this->m_pcmAnalyzerPtr != nullptr && numberOfSampleBytesRead > 0LL)
+    {
+        // The number of channels can change at a Link boundary, so it is read for the current Link.
+        // URI: https://xiph.org/vorbis/doc/vorbisfile/ov_info.html
+        vorbis_info* vorbisInfoStructPtr = ov_info(&this->m_oggVorbisFileStruct, -1);
+        if (vorbisInfoStructPtr != nullptr)
+        {
+            this->m_pcmAnalyzerPtr->AddPlanar(this->m_decodedOutputBuffer, static_cast<unsigned long>(vorbisInfoStructPtr->channels), static_cast<unsigned long>(numberOfSampleBytesRead));
+        }
+    }
+
+    if (this->m_streamingModeIsEnabled && numberOfSampleBytesRead > 0LL)
+    {
+        this->m_streamingDecodedSampleCount += numberOfSampleBytesRead;
+        if (!this->UpdateStreamingLinkState())
+        {
+            return -1LL; // An error occured.
+        }
+    }
+
     // The number of Sample bytes that were successfully read.
     return numberOfSampleBytesRead;
 }
 
-unsigned long long OggVorbisDecoder::GetDecodedAudioDataTotal()
+long long OggVorbisDecoder::Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds)
 {
-    return this->m_streamTotalSampleCount;
+    return this->DecodeBatch<OggVorbisDecoder>(audioUnitBudget, timeBudgetMilliseconds);
 }
 
-const wchar_t* OggVorbisDecoder::GetLastErrorMessage()
+unsigned long long OggVorbisDecoder::GetDecodedAudioDataTotal()
 {
-    return this->m_errorMessage;
+    return this->m_streamTotalSampleCount;
 }
 
+
 const wchar_t* OggVorbisDecoder::GetSupportedTypes()
 {
     return OggVorbisDecoder::FILE_EXTENSION_TYPES;
 }
 
+bool OggVorbisDecoder::CheckForTruncation()
+{
+    std::vector<unsigned char> tailBuffer(OGG_VORBIS_TAIL_CHECK_SIZE);
+    size_t tailSize = this->m_stream.ReadTail(tailBuffer.data(), tailBuffer.size());
+    unsigned char* tailPtr = tailBuffer.data();
+    unsigned char headerCopy[OGG_PAGE_HEADER_MAXIMUM_SIZE]{};
+
+    // Scan backwards for the last complete Page. ParsePageHeader() rejects a Page whose Body extends beyond the tail.
+    for (size_t index = (tailSize >= OGG_PAGE_HEADER_FIXED_SIZE) ? tailSize - OGG_PAGE_HEADER_FIXED_SIZE + 1 : 0; index-- > 0; )
+    {
+        OggPageHeaderInfo pageHeaderInfo{};
+        if (tailPtr[index] != 'O' || !OggPageTracker::ParsePageHeader(tailPtr + index, tailSize - index, pageHeaderInfo))
+        {
+            continue;
+        }
+
+        // URI: https://xiph.org/ogg/doc/libogg/ogg_page_checksum_set.html
+        ogg_page oggPage{};
+        memcpy(headerCopy, tailPtr + index, pageHeaderInfo.headerSize);
+        oggPage.header = headerCopy;
+        oggPage.header_len = static_cast<long>(pageHeaderInfo.headerSize);
+        oggPage.body = tailPtr + index + pageHeaderInfo.headerSize;
+        oggPage.body_len = static_cast<long>(pageHeaderInfo.bodySize);
+        ogg_page_checksum_set(&oggPage);
+        if (memcmp(headerCopy + 22, tailPtr + index + 22, 4) != 0)
+        {
+            // A false Capture Pattern within a Page Body, or a damaged Page. The full decode reports damaged Pages.
+            continue;
+        }
+
+        size_t pageEnd = index + pageHeaderInfo.headerSize + pageHeaderInfo.bodySize;
+        bool partialPageFollows = (tailSize - pageEnd >= 4) && memcmp(tailPtr + pageEnd, "OggS", 4) == 0;
+        if ((pageHeaderInfo.headerType & 0x04) == 0 || partialPageFollows)
+        {
+            this->RecordError(DecoderErrorCode::TRUNCATED);
+            return true;
+        }
+
+        return false;
+    }
+
+    return false;
+}
+
+bool OggVorbisDecoder::EnableSampledVerification(unsigned long windowCount)
+{
+    // URI: https://xiph.org/vorbis/doc/vorbisfile/ov_seekable.html
+    if (this->m_streamingModeIsEnabled || !ov_seekable(&this->m_oggVorbisFileStruct) || this->m_streamTotalSampleCount <= 0LL)
+    {
+        return false;
+    }
+
+    if (!this->m_sampledVerificationPlan.Configure(windowCount, 0ULL, static_cast<unsigned long long>(this->m_streamTotalSampleCount)))
+    {
+        return false;
+    }
+
+    // The Segments would decode every Page, so they are NOT used.
+    this->m_segmentVerifierPtr.reset();
+    return true;
+}
+
+bool OggVorbisDecoder::EnablePcmAnalysis()
+{
+    this->m_segmentVerifierPtr.reset();
+    this->m_pcmAnalyzerPtr = std::make_unique<PcmAnalyzer>(static_cast<unsigned long>(this->m_streamSampleRate));
+    return true;
+}
+
+bool OggVorbisDecoder::EnableAccurateRipChecksum()
+{
+    return false;
+}
+
+bool OggVorbisDecoder::EnablePcmPipeline()
+{
+    return false;
+}
+
 void OggVorbisDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled)
 {
+    this->m_readChunkSize = static_cast<int>(DecoderTuning::GetProfile().oggVorbisReadChunkSize);
+
     // Configure all of the Ogg-Vorbis Callback Functions.
     this->m_oggVorbisCallback.close_func = OggVorbisCallbackFunction::close_func;
     this->m_oggVorbisCallback.read_func = OggVorbisCallbackFunction::read_func;
     this->m_oggVorbisCallback.seek_func = OggVorbisCallbackFunction::seek_func;
     this->m_oggVorbisCallback.tell_func = OggVorbisCallbackFunction::tell_func;
 
+    void* dataSourcePtr = &this->m_stream;
+    if (this->m_streamingModeIsEnabled)
+    {
+        // Without a seek Callback Function, 'libvorbisfile' treats the Stream as non-seekable and skips the open-time bisection 
+        // of the File (used to find every Link and compute the PCM total). The Links are instead discovered as they are decoded.
+        // URI: https://xiph.org/vorbis/doc/vorbisfile/callbacks.html
+        this->m_oggVorbisCallback.read_func = OggVorbisCallbackFunction::streaming_read_func;
+        this->m_oggVorbisCallback.close_func = OggVorbisCallbackFunction::streaming_close_func;
+        this->m_oggVorbisCallback.seek_func = nullptr;
+        this->m_oggVorbisCallback.tell_func = nullptr;
+
+        this->m_streamingDataSource.streamWrapperPtr = &this->m_stream;
+        this->m_streamingDataSource.pageTrackerPtr = &this->m_pageTracker;
+        dataSourcePtr = &this->m_streamingDataSource;
+    }
+
     if (this->m_stream.Open(filenamePtr, memoryBufferIsEnabled))
     {
         // In Windows, the ov_open_callbacks() function should always be used instead of the ov_open() function.
         // URI: https://www.xiph.org/vorbis/doc/vorbisfile/ov_open_callbacks.html
-        int openResult = ov_open_callbacks(&this->m_stream, &this->m_oggVorbisFileStruct, 0, 0, this->m_oggVorbisCallback);
+        int openResult = ov_open_callbacks(dataSourcePtr, &this->m_oggVorbisFileStruct, 0, 0, this->m_oggVorbisCallback);
         if (openResult == 0)
         {
             // Get ths Vorbis Info Struct which contains basic information about the audio in a Vorbis bitstream.
@@ -166,9 +332,24 @@ void OggVorbisDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsE
             // Set the Sampling rate of the bitstream.
             this->m_streamSampleRate = vorbisInfoStructPtr->rate;
 
-            // Get the total PCM samples for the entire physical bitstream.
-            // URI: https://www.xiph.org/vorbis/doc/vorbisfile/ov_pcm_total.html
-            this->m_streamTotalSampleCount = ov_pcm_total(&this->m_oggVorbisFileStruct, -1);
+            if (this->m_streamingModeIsEnabled)
+            {
+                // ov_pcm_total() is NOT available for a non-seekable Stream. Estimate the total using the nominal bitrate of the first Link,
+                // which is only used for progress reporting, until the exact total is known at the end of the Stream.
+                long long streamLength = this->m_stream.Length();
+                if (vorbisInfoStructPtr->bitrate_nominal > 0 && streamLength > 0)
+                {
+                    this->m_streamTotalSampleCount = (streamLength * 8LL * this->m_streamSampleRate) / vorbisInfoStructPtr->bitrate_nominal;
+                }
+            }
+            else
+            {
+                // Get the total PCM samples for the entire physical bitstream.
+                // URI: https://www.xiph.org/vorbis/doc/vorbisfile/ov_pcm_total.html
+                this->m_streamTotalSampleCount = ov_pcm_total(&this->m_oggVorbisFileStruct, -1);
+
+                this->ConfigureSegmentVerifier();
+            }
 
             this->SetDecoderIsOpenStatus(true);
         }
@@ -180,23 +361,23 @@ void OggVorbisDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsE
             {
                 case OV_EREAD:
                     // A read from media returned an error.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"READ_ERROR");
+                    this->RecordError(DecoderErrorCode::READ_ERROR);
                     break;
                 case OV_ENOTVORBIS:
                     // Bitstream does not contain any Vorbis data.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"NON_VORBIS_DATA_IN_BITSTREAM");
+                    this->RecordError(DecoderErrorCode::NON_VORBIS_DATA_IN_BITSTREAM);
                     break;
                 case OV_EVERSION:
                     // Vorbis version mismatch.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"VORBIS_VERSION_MISMATCH");
+                    this->RecordError(DecoderErrorCode::VORBIS_VERSION_MISMATCH);
                     break;
                 case OV_EBADHEADER:
                     // Invalid Vorbis bitstream header.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"INVALID_VORBIS_HEADER");
+                    this->RecordError(DecoderErrorCode::INVALID_VORBIS_HEADER);
                     break;
                 case OV_EFAULT:
                     // Internal logic fault; indicates a bug or heap/stack corruption.
-                    wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"DECODER_FAULT_OCCURRED");
+                    this->RecordError(DecoderErrorCode::DECODER_FAULT_OCCURRED);
                     break;
             }
 
@@ -210,4 +391,167 @@ void OggVorbisDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsE
 
 #pragma region Private_Member_Functions_Region
 
+bool OggVorbisDecoder::UpdateStreamingLinkState()
+{
+    long serialNumber = this->m_oggVorbisFileStruct.current_serialno;
+    if (this->m_streamingLinkCount == 0 || serialNumber != this->m_streamingLinkSerialNumber)
+    {
+        // A Link boundary was crossed. 'libvorbisfile' returns all of the Samples of the previous Link before switching, 
+        // so the last recorded PCM position is the final position of the previous Link.
+        if (this->m_streamingLinkCount > 0 && !this->VerifyStreamingLinkEnd())
+        {
+            return false;
+        }
+
+        this->m_streamingLinkCount++;
+        this->m_streamingLinkSerialNumber = serialNumber;
+
+        // The Sampling rate may differ between Links.
+        vorbis_info* vorbisInfoStructPtr = ov_info(&this->m_oggVorbisFileStruct, -1);
+        if (vorbisInfoStructPtr != nullptr)
+        {
+            this->m_streamSampleRate = vorbisInfoStructPtr->rate;
+        }
+    }
+
+    // URI: https://xiph.org/vorbis/doc/vorbisfile/ov_pcm_tell.html
+    this->m_streamingLinkPcmPosition = ov_pcm_tell(&this->m_oggVorbisFileStruct);
+    return true;
+}
+
+bool OggVorbisDecoder::VerifyStreamingLinkEnd()
+{
+    long serialNumber = this->m_streamingLinkSerialNumber;
+    long long lastGranulePosition = this->m_pageTracker.GetLastGranulePosition(serialNumber);
+    if (this->m_streamingLinkCount == 0 || lastGranulePosition < 0 || !this->m_pageTracker.IsEndOfStreamSeen(serialNumber))
+    {
+        // Nothing was decoded, or the Link has no final Page to validate against.
+        return true;
+    }
+
+    // For a non-seekable Stream, 'libvorbisfile' re-anchors the PCM position to the Granule Position of each Audio Page, 
+    // but it does NOT reset the PCM position at a Link boundary. A Link after the first one can only be validated once it has been anchored.
+    if (this->m_streamingLinkCount > 1 && this->m_pageTracker.GetAnchorPageCount(serialNumber) == 0)
+    {
+        return true;
+    }
+
+    // The final PCM position of a Link must equal the Granule Position of its End-Of-Stream Page.
+    long long sampleCountDifference = this->m_streamingLinkPcmPosition - lastGranulePosition;
+    if (sampleCountDifference < 0)
+    {
+        this->RecordCountError(DecoderErrorCode::MISSING_SAMPLES, -sampleCountDifference);
+        return false;
+    }
+    else if (sampleCountDifference > 0)
+    {
+        this->RecordCountError(DecoderErrorCode::EXTRA_SAMPLES, sampleCountDifference);
+        return false;
+    }
+
+    return true;
+}
+
+void OggVorbisDecoder::ConfigureSegmentVerifier()
+{
+    // Segments are cut from the resident File data, so the Memory Buffer is required.
+    // URI: https://xiph.org/vorbis/doc/vorbisfile/ov_streams.html
+    if (this->m_segmentThreadCount < 2UL || this->m_stream.GetMemoryBufferPtr() == nullptr || ov_streams(&this->m_oggVorbisFileStruct) != 1)
+    {
+        return;
+    }
+
+    // URI: https://xiph.org/vorbis/doc/vorbisfile/ov_serialnumber.html
+    this->m_segmentVerifierPtr = std::make_unique<OggVorbisSegmentVerifier>(this->m_stream.GetMemoryBufferPtr(), this->m_stream.GetMemoryBufferSize(), 
+        ov_serialnumber(&this->m_oggVorbisFileStruct, 0), this->m_streamSampleRate);
+
+    if (!this->m_segmentVerifierPtr->Prepare(this->m_segmentThreadCount))
+    {
+        // The File is too small, or could NOT be cut. Use the regular single Thread decode.
+        this->m_segmentVerifierPtr.reset();
+    }
+}
+
+long long OggVorbisDecoder::ReadSegments()
+{
+    if (!this->m_segmentVerifierIsStarted)
+    {
+        this->m_segmentVerifierPtr->Start();
+        this->m_segmentVerifierIsStarted = true;
+    }
+
+    long long numberOfSamplesVerified = static_cast<long long>(this->m_segmentVerifierPtr->WaitForProgress());
+    if (numberOfSamplesVerified > 0LL)
+    {
+        return numberOfSamplesVerified;
+    }
+
+    // All of the Segments have finished.
+    if (!this->m_segmentVerifierPtr->Finish(this->m_streamTotalSampleCount))
+    {
+        this->m_errorLog.Add(this->m_segmentVerifierPtr->GetLastErrorRecord());
+        return -1LL; // An error occured.
+    }
+
+    return 0LL;
+}
+
+long long OggVorbisDecoder::ReadSampled()
+{
+    unsigned long long windowPosition = 0ULL;
+    if (!this->m_sampledVerificationPlan.NextWindow(windowPosition))
+    {
+        return 0LL; // Every Window has been verified.
+    }
+
+    // URI: https://xiph.org/vorbis/doc/vorbisfile/ov_pcm_seek.html
+    if (windowPosition > 0ULL && ov_pcm_seek(&this->m_oggVorbisFileStruct, static_cast<ogg_int64_t>(windowPosition)) != 0)
+    {
+        // The Pages around the target sample could NOT be read.
+        this->RecordTimeError(DecoderErrorCode::SEEK_ERROR, windowPosition, static_cast<unsigned long>(this->m_streamSampleRate));
+        return -1LL; // An error occured.
+    }
+
+    // The sample counts of the Links are NOT checked, since most of the Pages are skipped.
+    for (unsigned long readIndex = 0UL; readIndex < OGG_VORBIS_SAMPLED_WINDOW_READ_COUNT; ++readIndex)
+    {
+        long numberOfSampleBytesRead = ov_read_float(&this->m_oggVorbisFileStruct, &this->m_decodedOutputBuffer, this->m_readChunkSize, &this->m_bitstream);
+        if (numberOfSampleBytesRead == 0L)
+        {
+            if (!this->m_oggVorbisFileStruct.os.e_o_s)
+            {
+                this->RecordError(DecoderErrorCode::TRUNCATED);
+                return -1LL; // An error occured.
+            }
+            break;
+        }
+        else if (numberOfSampleBytesRead == OV_HOLE)
+        {
+            this->RecordDecodingTimeError(DecoderErrorCode::OGG_VORBIS_HOLE);
+            return -1LL; // An error occured.
+        }
+        else if (numberOfSampleBytesRead == OV_EBADLINK)
+        {
+            this->RecordDecodingTimeError(DecoderErrorCode::OGG_VORBIS_EBADLINK);
+            return -1LL; // An error occured.
+        }
+        else if (numberOfSampleBytesRead < 0L)
+        {
+            this->RecordError(DecoderErrorCode::UNREADABLE_OR_CORRUPT_HEADER);
+            return -1LL; // An error occured.
+        }
+    }
+
+    return static_cast<long long>(this->m_sampledVerificationPlan.GetWindowProgressUnits(static_cast<unsigned long long>(this->m_streamTotalSampleCount)));
+}
+
+void OggVorbisDecoder::RecordDecodingTimeError(DecoderErrorCode code)
+{
+    // Get the current Decoding offset in seconds, and record it in milliseconds.
+    // URI: https://www.xiph.org/vorbis/doc/vorbisfile/ov_time_tell.html
+    double decodingTimeOffset = ov_time_tell(&this->m_oggVorbisFileStruct);
+    unsigned long long decodingTimeMilliseconds = (decodingTimeOffset > 0.0) ? static_cast<unsigned long long>(decodingTimeOffset * 1000.0) : 0ULL;
+    this->RecordTimeError(code, decodingTimeMilliseconds, 1000UL);
+}
+
 #pragma endregion Private_Member_Functions_Region
\ No newline at end of file
@@ -0,0 +1,460 @@
+#include "OggVorbisSegmentVerifier.h"
+#include <cstring>
+
+/// <summary>
+/// Purpose: The Header Type flag indicating the last Page of a logical bitstream.
+/// </summary>
+constexpr auto OGG_HEADER_TYPE_END_OF_STREAM = 0x04;
+
+/// <summary>
+/// Purpose: The number of verified samples a Segment accumulates before waking up the Thread waiting for progress.
+/// </summary>
+constexpr auto PROGRESS_NOTIFICATION_SAMPLE_COUNT = 65536LL;
+
+/// <summary>
+/// Purpose: With-args Constructor.
+/// </summary>
+/// <param name="bufferPtr"></param>
+/// <param name="bufferSize"></param>
+/// <param name="serialNumber"></param>
+/// <param name="sampleRate"></param>
+OggVorbisSegmentVerifier::OggVorbisSegmentVerifier(const unsigned char* bufferPtr, size_t bufferSize, long serialNumber, long sampleRate)
+{
+    this->m_bufferPtr = bufferPtr;
+    this->m_bufferSize = bufferSize;
+    this->m_serialNumber = serialNumber;
+    this->m_sampleRate = sampleRate;
+}
+
+OggVorbisSegmentVerifier::~OggVorbisSegmentVerifier()
+{
+    this->Cancel();
+}
+
+#pragma region Public_Member_Functions_Region
+
+bool OggVorbisSegmentVerifier::Prepare(unsigned long maximumSegmentCount)
+{
+    this->IndexPages();
+
+    size_t audioStartPageIndex = 0;
+    if (this->m_pages.empty() || !this->ExtractHeaderPackets(audioStartPageIndex) || audioStartPageIndex >= this->m_pages.size())
+    {
+        return false;
+    }
+
+    // Limit the number of Segments, so that each Segment is worth the cost of a Thread.
+    unsigned long long segmentCount = this->m_bufferSize / OGG_VORBIS_MINIMUM_SEGMENT_SIZE;
+    if (segmentCount > maximumSegmentCount)
+    {
+        segmentCount = maximumSegmentCount;
+    }
+
+    if (segmentCount < 2)
+    {
+        return false;
+    }
+
+    // Cut the File into Segments of roughly equal size, at the first suitable Page at or after each target offset.
+    std::vector<size_t> cutPageIndexes{ audioStartPageIndex };
+    size_t pageIndex = audioStartPageIndex;
+    for (unsigned long long segmentIndex = 1; segmentIndex < segmentCount; segmentIndex++)
+    {
+        size_t targetOffset = static_cast<size_t>((this->m_bufferSize * segmentIndex) / segmentCount);
+        while (pageIndex < this->m_pages.size() && (this->m_pages[pageIndex].offset < targetOffset || !this->IsCutPoint(pageIndex, audioStartPageIndex)))
+        {
+            pageIndex++;
+        }
+
+        if (pageIndex >= this->m_pages.size())
+        {
+            break;
+        }
+
+        cutPageIndexes.push_back(pageIndex);
+    }
+
+    if (cutPageIndexes.size() < 2)
+    {
+        return false;
+    }
+
+    this->m_segments = std::vector<Segment>(cutPageIndexes.size());
+    for (size_t segmentIndex = 0; segmentIndex < cutPageIndexes.size(); segmentIndex++)
+    {
+        Segment& segment = this->m_segments[segmentIndex];
+        segment.firstPageIndex = cutPageIndexes[segmentIndex];
+        segment.endPageIndex = (segmentIndex + 1 < cutPageIndexes.size()) ? cutPageIndexes[segmentIndex + 1] : this->m_pages.size();
+
+        // The first Segment starts at the first Audio Page, exactly as a regular decode would.
+        // Every other Segment starts two Pages early, so the Packet before its first owned Packet is decoded in full.
+        segment.preRollPageIndex = (segmentIndex == 0) ? segment.firstPageIndex : segment.firstPageIndex - 2;
+    }
+
+    return true;
+}
+
+void OggVorbisSegmentVerifier::Start()
+{
+    for (Segment& segment : this->m_segments)
+    {
+        this->m_threads.emplace_back(&OggVorbisSegmentVerifier::VerifySegment, this, std::ref(segment));
+    }
+}
+
+unsigned long long OggVorbisSegmentVerifier::WaitForProgress()
+{
+    std::unique_lock<std::mutex> lock(this->m_progressMutex);
+    this->m_progressConditionVariable.wait(lock, [this]
+    {
+        return this->m_verifiedSampleCount.load() > this->m_reportedSampleCount || this->m_finishedSegmentCount == this->m_segments.size();
+    });
+
+    unsigned long long verifiedSampleCount = this->m_verifiedSampleCount.load();
+    unsigned long long newSampleCount = verifiedSampleCount - this->m_reportedSampleCount;
+    this->m_reportedSampleCount = verifiedSampleCount;
+    return newSampleCount;
+}
+
+bool OggVorbisSegmentVerifier::Finish(long long expectedTotalSampleCount)
+{
+    this->Cancel(); // All of the Segments have finished. Join the Threads.
+
+    long long totalSampleCount = 0;
+    for (size_t segmentIndex = 0; segmentIndex < this->m_segments.size(); segmentIndex++)
+    {
+        const Segment& segment = this->m_segments[segmentIndex];
+
+        // Report the first error in Stream order.
+        if (segment.errorRecord.code != DecoderErrorCode::NONE)
+        {
+            this->m_errorRecord = segment.errorRecord;
+            return false;
+        }
+
+        totalSampleCount += segment.decodedSampleCount;
+    }
+
+    if (!this->m_segments.back().endOfStreamSeen)
+    {
+        // The End-Of-Stream Page was never reached.
+        this->m_errorRecord.code = DecoderErrorCode::TRUNCATED;
+        return false;
+    }
+
+    // The stitched sample count must match the total computed by 'libvorbisfile'.
+    long long sampleCountDifference = totalSampleCount - expectedTotalSampleCount;
+    if (sampleCountDifference < 0)
+    {
+        this->m_errorRecord.code = DecoderErrorCode::MISSING_SAMPLES;
+        this->m_errorRecord.detail = -sampleCountDifference;
+        return false;
+    }
+    else if (sampleCountDifference > 0)
+    {
+        this->m_errorRecord.code = DecoderErrorCode::EXTRA_SAMPLES;
+        this->m_errorRecord.detail = sampleCountDifference;
+        return false;
+    }
+
+    return true;
+}
+
+void OggVorbisSegmentVerifier::Cancel()
+{
+    if (this->m_threads.empty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->m_progressMutex);
+        if (this->m_finishedSegmentCount != this->m_segments.size())
+        {
+            this->m_cancelRequested = true;
+        }
+    }
+
+    for (std::thread& thread : this->m_threads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    this->m_threads.clear();
+}
+
+const DecoderErrorRecord& OggVorbisSegmentVerifier::GetLastErrorRecord() const
+{
+    return this->m_errorRecord;
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+void OggVorbisSegmentVerifier::IndexPages()
+{
+    size_t offset = 0;
+    while (offset + OGG_PAGE_HEADER_FIXED_SIZE <= this->m_bufferSize)
+    {
+        OggPageHeaderInfo pageHeaderInfo{};
+        if (OggPageTracker::ParsePageHeader(this->m_bufferPtr + offset, this->m_bufferSize - offset, pageHeaderInfo))
+        {
+            if (pageHeaderInfo.serialNumber == this->m_serialNumber)
+            {
+                this->m_pages.push_back({ offset, pageHeaderInfo });
+            }
+
+            offset += pageHeaderInfo.headerSize + pageHeaderInfo.bodySize;
+        }
+        else
+        {
+            // Garbage, or a truncated Page. Resume at the next Capture Pattern.
+            const void* capturePatternPtr = memchr(this->m_bufferPtr + offset + 1, 'O', this->m_bufferSize - offset - 1);
+            if (capturePatternPtr == nullptr)
+            {
+                break;
+            }
+
+            offset = static_cast<const unsigned char*>(capturePatternPtr) - this->m_bufferPtr;
+        }
+    }
+}
+
+bool OggVorbisSegmentVerifier::ExtractHeaderPackets(size_t& audioStartPageIndexRef)
+{
+    ogg_stream_state oggStreamState{};
+    ogg_stream_init(&oggStreamState, this->m_serialNumber);
+
+    unsigned char headerCopy[OGG_PAGE_HEADER_MAXIMUM_SIZE]{};
+    int headerPacketCount = 0;
+    size_t pageIndex = 0;
+    while (headerPacketCount < 3 && pageIndex < this->m_pages.size())
+    {
+        ogg_page oggPage{};
+        if (!this->LoadPage(pageIndex, oggPage, headerCopy) || ogg_stream_pagein(&oggStreamState, &oggPage) != 0)
+        {
+            break;
+        }
+        pageIndex++;
+
+        ogg_packet oggPacket{};
+        while (headerPacketCount < 3 && ogg_stream_packetout(&oggStreamState, &oggPacket) == 1)
+        {
+            // Copy the Packet, since the Stream State owns the Packet data.
+            this->m_headerPacketData[headerPacketCount].assign(oggPacket.packet, oggPacket.packet + oggPacket.bytes);
+            this->m_headerPackets[headerPacketCount] = oggPacket;
+            this->m_headerPackets[headerPacketCount].packet = this->m_headerPacketData[headerPacketCount].data();
+            headerPacketCount++;
+        }
+    }
+
+    ogg_stream_clear(&oggStreamState);
+
+    // The Vorbis Setup Header always finishes a Page, so the first Audio Packet starts on the next Page.
+    audioStartPageIndexRef = pageIndex;
+    return headerPacketCount == 3;
+}
+
+bool OggVorbisSegmentVerifier::IsCutPoint(size_t pageIndex, size_t audioStartPageIndex) const
+{
+    if (pageIndex < audioStartPageIndex + 2)
+    {
+        return false;
+    }
+
+    return this->m_pages[pageIndex - 1].headerInfo.granulePosition != -1LL && this->m_pages[pageIndex - 2].headerInfo.granulePosition != -1LL;
+}
+
+bool OggVorbisSegmentVerifier::LoadPage(size_t pageIndex, ogg_page& pageRef, unsigned char* headerCopyPtr) const
+{
+    const PageEntry& pageEntry = this->m_pages[pageIndex];
+    const unsigned char* pagePtr = this->m_bufferPtr + pageEntry.offset;
+
+    // The Body is used in-place. Only the Header is copied, since computing the CRC overwrites the CRC field.
+    memcpy(headerCopyPtr, pagePtr, pageEntry.headerInfo.headerSize);
+    pageRef.header = headerCopyPtr;
+    pageRef.header_len = static_cast<long>(pageEntry.headerInfo.headerSize);
+    pageRef.body = const_cast<unsigned char*>(pagePtr + pageEntry.headerInfo.headerSize);
+    pageRef.body_len = static_cast<long>(pageEntry.headerInfo.bodySize);
+
+    // URI: https://xiph.org/ogg/doc/libogg/ogg_page_checksum_set.html
+    ogg_page_checksum_set(&pageRef);
+    return memcmp(headerCopyPtr + 22, pagePtr + 22, 4) == 0;
+}
+
+void OggVorbisSegmentVerifier::VerifySegment(Segment& segmentRef)
+{
+    // Every Segment uses its own Vorbis Info, since libvorbis lazily initializes shared codec setup data.
+    vorbis_info vorbisInfo{};
+    vorbis_comment vorbisComment{};
+    vorbis_info_init(&vorbisInfo);
+    vorbis_comment_init(&vorbisComment);
+
+    bool headersAreValid = true;
+    for (int headerIndex = 0; headerIndex < 3; headerIndex++)
+    {
+        ogg_packet headerPacket = this->m_headerPackets[headerIndex];
+        if (vorbis_synthesis_headerin(&vorbisInfo, &vorbisComment, &headerPacket) != 0)
+        {
+            headersAreValid = false;
+            break;
+        }
+    }
+
+    if (headersAreValid)
+    {
+        ogg_stream_state oggStreamState{};
+        vorbis_dsp_state vorbisDspState{};
+        vorbis_block vorbisBlock{};
+
+        // Reset the Stream State, so the first Page is NOT treated as a gap in the Page Sequence.
+        ogg_stream_init(&oggStreamState, this->m_serialNumber);
+        ogg_stream_reset(&oggStreamState);
+        vorbis_synthesis_init(&vorbisDspState, &vorbisInfo);
+        vorbis_block_init(&vorbisDspState, &vorbisBlock);
+
+        unsigned char headerCopy[OGG_PAGE_HEADER_MAXIMUM_SIZE]{};
+        long long pendingProgressSampleCount = 0;
+        bool errorOccurred = false;
+
+        for (size_t pageIndex = segmentRef.preRollPageIndex; pageIndex < segmentRef.endPageIndex && !errorOccurred && !this->m_cancelRequested; pageIndex++)
+        {
+            // Samples are owned once the first Page of the Segment is reached. Pre-roll samples are discarded.
+            bool pageIsOwned = pageIndex >= segmentRef.firstPageIndex;
+
+            ogg_page oggPage{};
+            if (!this->LoadPage(pageIndex, oggPage, headerCopy))
+            {
+                // Corrupt Page (CRC mismatch).
+                this->RecordPageError(segmentRef, DecoderErrorCode::OGG_VORBIS_HOLE, pageIndex);
+                break;
+            }
+
+            ogg_stream_pagein(&oggStreamState, &oggPage);
+
+            ogg_packet oggPacket{};
+            int packetResult = ogg_stream_packetout(&oggStreamState, &oggPacket);
+            while (packetResult != 0)
+            {
+                if (packetResult < 0)
+                {
+                    if (pageIsOwned)
+                    {
+                        // Indicates that there was an interruption in the Data.
+                        this->RecordPageError(segmentRef, DecoderErrorCode::OGG_VORBIS_HOLE, pageIndex);
+                        errorOccurred = true;
+                        break;
+                    }
+                }
+                else if (vorbis_synthesis(&vorbisBlock, &oggPacket) == 0)
+                {
+                    vorbis_synthesis_blockin(&vorbisDspState, &vorbisBlock);
+
+                    float** pcmPtr = nullptr;
+                    int sampleCount = vorbis_synthesis_pcmout(&vorbisDspState, &pcmPtr);
+                    while (sampleCount > 0)
+                    {
+                        if (pageIsOwned)
+                        {
+                            segmentRef.decodedSampleCount += sampleCount;
+                            pendingProgressSampleCount += sampleCount;
+                        }
+
+                        vorbis_synthesis_read(&vorbisDspState, sampleCount);
+                        sampleCount = vorbis_synthesis_pcmout(&vorbisDspState, &pcmPtr);
+                    }
+                }
+
+                packetResult = ogg_stream_packetout(&oggStreamState, &oggPacket);
+            }
+
+            if (oggPage.header[5] & OGG_HEADER_TYPE_END_OF_STREAM)
+            {
+                segmentRef.endOfStreamSeen = true;
+            }
+
+            if (pendingProgressSampleCount >= PROGRESS_NOTIFICATION_SAMPLE_COUNT)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(this->m_progressMutex);
+                    this->m_verifiedSampleCount += pendingProgressSampleCount;
+                }
+                pendingProgressSampleCount = 0;
+                this->m_progressConditionVariable.notify_one();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->m_progressMutex);
+            this->m_verifiedSampleCount += pendingProgressSampleCount;
+        }
+
+        // The first Segment is covered by the stitched total, since the Stream may NOT start at Granule Position 0.
+        if (segmentRef.errorRecord.code == DecoderErrorCode::NONE && segmentRef.preRollPageIndex != segmentRef.firstPageIndex && !this->m_cancelRequested)
+        {
+            // The samples owned by the Segment must equal the Granule Position difference across the Segment.
+            long long startGranulePosition = this->m_pages[segmentRef.firstPageIndex - 1].headerInfo.granulePosition;
+            long long endGranulePosition = -1LL;
+            for (size_t pageIndex = segmentRef.endPageIndex; pageIndex > segmentRef.firstPageIndex && endGranulePosition == -1LL; pageIndex--)
+            {
+                endGranulePosition = this->m_pages[pageIndex - 1].headerInfo.granulePosition;
+            }
+
+            if (endGranulePosition != -1LL)
+            {
+                long long sampleCountDifference = segmentRef.decodedSampleCount - (endGranulePosition - startGranulePosition);
+                if (sampleCountDifference < 0)
+                {
+                    segmentRef.errorRecord.code = DecoderErrorCode::MISSING_SAMPLES;
+                    segmentRef.errorRecord.detail = -sampleCountDifference;
+                }
+                else if (sampleCountDifference > 0)
+                {
+                    segmentRef.errorRecord.code = DecoderErrorCode::EXTRA_SAMPLES;
+                    segmentRef.errorRecord.detail = sampleCountDifference;
+                }
+            }
+        }
+
+        vorbis_block_clear(&vorbisBlock);
+        vorbis_dsp_clear(&vorbisDspState);
+        ogg_stream_clear(&oggStreamState);
+    }
+    else
+    {
+        segmentRef.errorRecord.code = DecoderErrorCode::INVALID_VORBIS_HEADER;
+    }
+
+    vorbis_comment_clear(&vorbisComment);
+    vorbis_info_clear(&vorbisInfo);
+
+    {
+        std::lock_guard<std::mutex> lock(this->m_progressMutex);
+        this->m_finishedSegmentCount++;
+    }
+    this->m_progressConditionVariable.notify_one();
+}
+
+void OggVorbisSegmentVerifier::RecordPageError(Segment& segmentRef, DecoderErrorCode code, size_t pageIndex) const
+{
+    // Use the closest preceding Granule Position as the time of the error.
+    long long granulePosition = 0;
+    for (size_t index = pageIndex; index > 0; index--)
+    {
+        if (this->m_pages[index - 1].headerInfo.granulePosition > 0)
+        {
+            granulePosition = this->m_pages[index - 1].headerInfo.granulePosition;
+            break;
+        }
+    }
+
+    segmentRef.errorRecord.code = code;
+    segmentRef.errorRecord.position = (this->m_sampleRate > 0) ? static_cast<unsigned long long>(granulePosition) : 0ULL;
+    segmentRef.errorRecord.timeBase = (this->m_sampleRate > 0) ? static_cast<unsigned long>(this->m_sampleRate) : 1UL;
+}
+
+#pragma endregion Private_Member_Functions_Region
@@ -0,0 +1,433 @@
+#include "PcmAnalyzer.h"
+#include <algorithm>
+#include <cmath>
+
+#pragma region SIMD_ADJUSTMENT_FOR_COMPILATION_TARGET
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+// _M_X64 is defined when the compilation target is x64, which always supports SSE2.
+// _M_IX86_FP is 2 when the compilation target is x86, and SSE2 code generation is enabled (i.e. /arch:SSE2, the default).
+
+#define PCM_ANALYZER_SSE2_ENABLED
+#include <emmintrin.h>
+
+#endif
+#pragma endregion SIMD_ADJUSTMENT_FOR_COMPILATION_TARGET
+
+PcmAnalyzer::PcmAnalyzer(unsigned long sampleRate)
+{
+    this->m_sampleRate = sampleRate;
+}
+
+PcmAnalyzer::~PcmAnalyzer()
+{
+
+}
+
+#pragma region Public_Member_Functions_Region
+
+void PcmAnalyzer::AddPlanar(const int32_t* const channelPtrs[], unsigned long channelCount, unsigned long frameCount, unsigned long bitsPerSample)
+{
+    if (channelCount == 0UL || frameCount == 0UL)
+    {
+        return;
+    }
+
+    this->BeginBlock(channelCount, frameCount);
+    for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+    {
+        this->AnalyzeIntegerChannel(this->m_channelStates[channelIndex], channelPtrs[channelIndex], frameCount, bitsPerSample);
+    }
+    this->AnalyzeIntegerFrames(channelPtrs, channelCount, frameCount);
+}
+
+void PcmAnalyzer::AddInterleaved(const int32_t* samplePtr, unsigned long channelCount, unsigned long frameCount, unsigned long bitsPerSample)
+{
+    if (channelCount == 0UL || frameCount == 0UL)
+    {
+        return;
+    }
+
+    // Deinterleave into the Scratch Buffer, one contiguous run of samples per channel.
+    this->m_integerScratch.resize(static_cast<size_t>(channelCount) * frameCount);
+    this->m_integerChannelPtrs.resize(channelCount);
+    for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+    {
+        int32_t* channelPtr = this->m_integerScratch.data() + static_cast<size_t>(channelIndex) * frameCount;
+        const int32_t* sourcePtr = samplePtr + channelIndex;
+        for (unsigned long frameIndex = 0UL; frameIndex < frameCount; ++frameIndex)
+        {
+            channelPtr[frameIndex] = *sourcePtr;
+            sourcePtr += channelCount;
+        }
+        this->m_integerChannelPtrs[channelIndex] = channelPtr;
+    }
+
+    this->AddPlanar(this->m_integerChannelPtrs.data(), channelCount, frameCount, bitsPerSample);
+}
+
+void PcmAnalyzer::AddPlanar(const float* const channelPtrs[], unsigned long channelCount, unsigned long frameCount)
+{
+    if (channelCount == 0UL || frameCount == 0UL)
+    {
+        return;
+    }
+
+    this->BeginBlock(channelCount, frameCount);
+    for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+    {
+        this->AnalyzeFloatChannel(this->m_channelStates[channelIndex], channelPtrs[channelIndex], frameCount);
+    }
+    this->AnalyzeFloatFrames(channelPtrs, channelCount, frameCount);
+}
+
+void PcmAnalyzer::AddInterleaved(const float* samplePtr, unsigned long channelCount, unsigned long frameCount)
+{
+    if (channelCount == 0UL || frameCount == 0UL)
+    {
+        return;
+    }
+
+    // Deinterleave into the Scratch Buffer, one contiguous run of samples per channel.
+    this->m_floatScratch.resize(static_cast<size_t>(channelCount) * frameCount);
+    this->m_floatChannelPtrs.resize(channelCount);
+    for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+    {
+        float* channelPtr = this->m_floatScratch.data() + static_cast<size_t>(channelIndex) * frameCount;
+        const float* sourcePtr = samplePtr + channelIndex;
+        for (unsigned long frameIndex = 0UL; frameIndex < frameCount; ++frameIndex)
+        {
+            channelPtr[frameIndex] = *sourcePtr;
+            sourcePtr += channelCount;
+        }
+        this->m_floatChannelPtrs[channelIndex] = channelPtr;
+    }
+
+    this->AddPlanar(this->m_floatChannelPtrs.data(), channelCount, frameCount);
+}
+
+PcmAnalysisResult PcmAnalyzer::GetResult() const
+{
+    PcmAnalysisResult result{};
+    result.sampleRate = this->m_sampleRate;
+    result.channelCount = this->m_channelCount;
+    result.frameCount = this->m_frameCount;
+    result.clippedRunCount = this->m_clippedRunCount;
+    result.clippedSampleCount = this->m_clippedSampleCount;
+    result.silentFrameCount = this->m_silentFrameCount;
+    result.longestSilentRunFrameCount = (std::max)(this->m_longestSilentRunFrameCount, this->m_silentRunLength);
+
+    for (const ChannelState& state : this->m_channelStates)
+    {
+        result.peak = (std::max)(result.peak, state.peak);
+        if (this->m_frameCount > 0ULL)
+        {
+            result.dcOffset = (std::max)(result.dcOffset, std::fabs(state.sum / static_cast<double>(this->m_frameCount)));
+        }
+
+        // Close a run that reaches the end of the File.
+        if (state.clipRunLength >= PCM_ANALYSIS_CLIP_RUN_MINIMUM_LENGTH)
+        {
+            result.clippedRunCount++;
+            result.clippedSampleCount += state.clipRunLength;
+        }
+    }
+
+    // A silent File trivially has equal channels, so it is only reported as silent.
+    result.isDualMono = this->m_channelCount == 2UL && !this->m_channelCountChanged && !this->m_channelsDiffer &&
+        this->m_frameCount > 0ULL && this->m_silentFrameCount < this->m_frameCount;
+
+    return result;
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+void PcmAnalyzer::BeginBlock(unsigned long channelCount, unsigned long frameCount)
+{
+    if (this->m_channelCount == 0UL)
+    {
+        this->m_channelCount = channelCount;
+    }
+    else if (this->m_channelCount != channelCount)
+    {
+        this->m_channelCountChanged = true;
+        this->m_channelCount = (std::max)(this->m_channelCount, channelCount);
+    }
+
+    if (this->m_channelStates.size() < channelCount)
+    {
+        this->m_channelStates.resize(channelCount);
+    }
+
+    this->m_frameCount += frameCount;
+}
+
+void PcmAnalyzer::UpdateClipRun(ChannelState& stateRef, unsigned int clipMask, unsigned int sampleCount)
+{
+    const unsigned int fullMask = (1U << sampleCount) - 1U;
+    if (clipMask == fullMask)
+    {
+        stateRef.clipRunLength += sampleCount;
+        return;
+    }
+
+    for (unsigned int sampleIndex = 0U; sampleIndex < sampleCount; ++sampleIndex)
+    {
+        if ((clipMask >> sampleIndex) & 1U)
+        {
+            stateRef.clipRunLength++;
+        }
+        else if (stateRef.clipRunLength > 0ULL)
+        {
+            if (stateRef.clipRunLength >= PCM_ANALYSIS_CLIP_RUN_MINIMUM_LENGTH)
+            {
+                this->m_clippedRunCount++;
+                this->m_clippedSampleCount += stateRef.clipRunLength;
+            }
+            stateRef.clipRunLength = 0ULL;
+        }
+    }
+}
+
+void PcmAnalyzer::UpdateSilentRun(unsigned int silentMask, unsigned int frameCount)
+{
+    const unsigned int fullMask = (1U << frameCount) - 1U;
+    if (silentMask == fullMask)
+    {
+        this->m_silentRunLength += frameCount;
+        this->m_silentFrameCount += frameCount;
+        return;
+    }
+
+    for (unsigned int frameIndex = 0U; frameIndex < frameCount; ++frameIndex)
+    {
+        if ((silentMask >> frameIndex) & 1U)
+        {
+            this->m_silentRunLength++;
+            this->m_silentFrameCount++;
+        }
+        else if (this->m_silentRunLength > 0ULL)
+        {
+            this->m_longestSilentRunFrameCount = (std::max)(this->m_longestSilentRunFrameCount, this->m_silentRunLength);
+            this->m_silentRunLength = 0ULL;
+        }
+    }
+}
+
+void PcmAnalyzer::AnalyzeIntegerChannel(ChannelState& stateRef, const int32_t* samplePtr, unsigned long frameCount, unsigned long bitsPerSample)
+{
+    const unsigned long bitDepth = (std::min)((std::max)(bitsPerSample, 2UL), 32UL);
+
+    // A sample is at full scale when its magnitude reaches the largest positive value (e.g. 32767 for 16-bit samples).
+    const uint32_t clipThreshold = (1U << (bitDepth - 1UL)) - 1U;
+    const double fullScale = std::ldexp(1.0, static_cast<int>(bitDepth - 1UL));
+
+    uint32_t peakMagnitude = 0U;
+    long long sum = 0LL;
+    unsigned long frameIndex = 0UL;
+
+#if defined(PCM_ANALYZER_SSE2_ENABLED)
+    // SSE2 has no unsigned 32-bit compare, so the magnitudes are compared with the sign bit flipped (i.e. biased).
+    // The magnitude of the most negative sample (e.g. 0x80000000) is then still ordered correctly.
+    const __m128i signBit = _mm_set1_epi32(static_cast<int>(0x80000000U));
+    const __m128i clipThresholdBiased = _mm_set1_epi32(static_cast<int>((clipThreshold - 1U) ^ 0x80000000U));
+    __m128i peakBiased = signBit;
+    __m128i sum64 = _mm_setzero_si128();
+
+    for (; frameIndex + 4UL <= frameCount; frameIndex += 4UL)
+    {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samplePtr + frameIndex));
+        __m128i sign = _mm_srai_epi32(samples, 31);
+        __m128i magnitudeBiased = _mm_xor_si128(_mm_sub_epi32(_mm_xor_si128(samples, sign), sign), signBit);
+
+        __m128i greater = _mm_cmpgt_epi32(magnitudeBiased, peakBiased);
+        peakBiased = _mm_or_si128(_mm_and_si128(greater, magnitudeBiased), _mm_andnot_si128(greater, peakBiased));
+
+        // Sign extend the samples to 64-bit, and accumulate two lanes.
+        sum64 = _mm_add_epi64(sum64, _mm_add_epi64(_mm_unpacklo_epi32(samples, sign), _mm_unpackhi_epi32(samples, sign)));
+
+        unsigned int clipMask = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(magnitudeBiased, clipThresholdBiased))));
+        if (clipMask != 0U || stateRef.clipRunLength > 0ULL)
+        {
+            this->UpdateClipRun(stateRef, clipMask, 4U);
+        }
+    }
+
+    alignas(16) uint32_t peakLanes[4]{};
+    alignas(16) long long sumLanes[2]{};
+    _mm_store_si128(reinterpret_cast<__m128i*>(peakLanes), peakBiased);
+    _mm_store_si128(reinterpret_cast<__m128i*>(sumLanes), sum64);
+    for (uint32_t peakLane : peakLanes)
+    {
+        peakMagnitude = (std::max)(peakMagnitude, peakLane ^ 0x80000000U);
+    }
+    sum = sumLanes[0] + sumLanes[1];
+#endif
+
+    for (; frameIndex < frameCount; ++frameIndex)
+    {
+        int32_t sample = samplePtr[frameIndex];
+        uint32_t magnitude = (sample < 0) ? (0U - static_cast<uint32_t>(sample)) : static_cast<uint32_t>(sample);
+        peakMagnitude = (std::max)(peakMagnitude, magnitude);
+        sum += sample;
+        this->UpdateClipRun(stateRef, (magnitude >= clipThreshold) ? 1U : 0U, 1U);
+    }
+
+    stateRef.peak = (std::max)(stateRef.peak, peakMagnitude / fullScale);
+    stateRef.sum += sum / fullScale;
+}
+
+void PcmAnalyzer::AnalyzeFloatChannel(ChannelState& stateRef, const float* samplePtr, unsigned long frameCount)
+{
+    float peakMagnitude = 0.0f;
+    double sum = 0.0;
+    unsigned long frameIndex = 0UL;
+
+#if defined(PCM_ANALYZER_SSE2_ENABLED)
+    const __m128 magnitudeMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 fullScale = _mm_set1_ps(1.0f);
+    __m128 peak = _mm_setzero_ps();
+    __m128d sum2 = _mm_setzero_pd();
+
+    for (; frameIndex + 4UL <= frameCount; frameIndex += 4UL)
+    {
+        __m128 samples = _mm_loadu_ps(samplePtr + frameIndex);
+        __m128 magnitude = _mm_and_ps(samples, magnitudeMask);
+        peak = _mm_max_ps(peak, magnitude);
+
+        // Accumulate in double precision, since a float sum loses the DC offset of a long File.
+        sum2 = _mm_add_pd(sum2, _mm_add_pd(_mm_cvtps_pd(samples), _mm_cvtps_pd(_mm_movehl_ps(samples, samples))));
+
+        unsigned int clipMask = static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpge_ps(magnitude, fullScale)));
+        if (clipMask != 0U || stateRef.clipRunLength > 0ULL)
+        {
+            this->UpdateClipRun(stateRef, clipMask, 4U);
+        }
+    }
+
+    alignas(16) float peakLanes[4]{};
+    alignas(16) double sumLanes[2]{};
+    _mm_store_ps(peakLanes, peak);
+    _mm_store_pd(sumLanes, sum2);
+    for (float peakLane : peakLanes)
+    {
+        peakMagnitude = (std::max)(peakMagnitude, peakLane);
+    }
+    sum = sumLanes[0] + sumLanes[1];
+#endif
+
+    for (; frameIndex < frameCount; ++frameIndex)
+    {
+        float sample = samplePtr[frameIndex];
+        float magnitude = std::fabs(sample);
+        peakMagnitude = (std::max)(peakMagnitude, magnitude);
+        sum += sample;
+        this->UpdateClipRun(stateRef, (magnitude >= 1.0f) ? 1U : 0U, 1U);
+    }
+
+    stateRef.peak = (std::max)(stateRef.peak, static_cast<double>(peakMagnitude));
+    stateRef.sum += sum;
+}
+
+void PcmAnalyzer::AnalyzeIntegerFrames(const int32_t* const channelPtrs[], unsigned long channelCount, unsigned long frameCount)
+{
+    bool checkDualMono = (channelCount == 2UL && !this->m_channelsDiffer);
+    unsigned long frameIndex = 0UL;
+
+#if defined(PCM_ANALYZER_SSE2_ENABLED)
+    const __m128i zero = _mm_setzero_si128();
+    for (; frameIndex + 4UL <= frameCount; frameIndex += 4UL)
+    {
+        // A frame is silent when the bitwise OR of all of its channels is zero.
+        __m128i anyChannel = zero;
+        for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+        {
+            anyChannel = _mm_or_si128(anyChannel, _mm_loadu_si128(reinterpret_cast<const __m128i*>(channelPtrs[channelIndex] + frameIndex)));
+        }
+
+        unsigned int silentMask = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(anyChannel, zero))));
+        if (silentMask != 0U || this->m_silentRunLength > 0ULL)
+        {
+            this->UpdateSilentRun(silentMask, 4U);
+        }
+
+        if (checkDualMono)
+        {
+            __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(channelPtrs[0] + frameIndex)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(channelPtrs[1] + frameIndex)));
+            if (_mm_movemask_ps(_mm_castsi128_ps(equal)) != 0xF)
+            {
+                this->m_channelsDiffer = true;
+                checkDualMono = false;
+            }
+        }
+    }
+#endif
+
+    for (; frameIndex < frameCount; ++frameIndex)
+    {
+        int32_t anyChannel = 0;
+        for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+        {
+            anyChannel |= channelPtrs[channelIndex][frameIndex];
+        }
+        this->UpdateSilentRun((anyChannel == 0) ? 1U : 0U, 1U);
+
+        if (checkDualMono && channelPtrs[0][frameIndex] != channelPtrs[1][frameIndex])
+        {
+            this->m_channelsDiffer = true;
+            checkDualMono = false;
+        }
+    }
+}
+
+void PcmAnalyzer::AnalyzeFloatFrames(const float* const channelPtrs[], unsigned long channelCount, unsigned long frameCount)
+{
+    bool checkDualMono = (channelCount == 2UL && !this->m_channelsDiffer);
+    unsigned long frameIndex = 0UL;
+
+#if defined(PCM_ANALYZER_SSE2_ENABLED)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 allSet = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (; frameIndex + 4UL <= frameCount; frameIndex += 4UL)
+    {
+        // A frame is silent when every channel is equal to zero.
+        __m128 allChannels = allSet;
+        for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+        {
+            allChannels = _mm_and_ps(allChannels, _mm_cmpeq_ps(_mm_loadu_ps(channelPtrs[channelIndex] + frameIndex), zero));
+        }
+
+        unsigned int silentMask = static_cast<unsigned int>(_mm_movemask_ps(allChannels));
+        if (silentMask != 0U || this->m_silentRunLength > 0ULL)
+        {
+            this->UpdateSilentRun(silentMask, 4U);
+        }
+
+        if (checkDualMono && _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(channelPtrs[0] + frameIndex), _mm_loadu_ps(channelPtrs[1] + frameIndex))) != 0xF)
+        {
+            this->m_channelsDiffer = true;
+            checkDualMono = false;
+        }
+    }
+#endif
+
+    for (; frameIndex < frameCount; ++frameIndex)
+    {
+        bool frameIsSilent = true;
+        for (unsigned long channelIndex = 0UL; channelIndex < channelCount && frameIsSilent; ++channelIndex)
+        {
+            frameIsSilent = (channelPtrs[channelIndex][frameIndex] == 0.0f);
+        }
+        this->UpdateSilentRun(frameIsSilent ? 1U : 0U, 1U);
+
+        if (checkDualMono && channelPtrs[0][frameIndex] != channelPtrs[1][frameIndex])
+        {
+            this->m_channelsDiffer = true;
+            checkDualMono = false;
+        }
+    }
+}
+
+#pragma endregion Private_Member_Functions_Region
@@ -0,0 +1,204 @@
+#include "PcmPipeline.h"
+#include <cstring>
+
+namespace PcmPipelineSupport
+{
+    /// <summary>
+    /// Purpose: The Worker registered for the current Thread. The Worker is owned by the Thread that registers it, NOT by this pointer.
+    /// </summary>
+    thread_local PcmPipelineWorker* t_currentThreadWorkerPtr = nullptr;
+}
+
+PcmPipelineWorker::PcmPipelineWorker()
+{
+
+}
+
+PcmPipelineWorker::~PcmPipelineWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_stopRequested = true;
+    }
+    this->m_blockStateCondition.notify_all();
+
+    if (this->m_pipelineThread.joinable())
+    {
+        this->m_pipelineThread.join();
+    }
+}
+
+PcmPipeline::PcmPipeline(ConsumerFunction consumerFunction)
+{
+    PcmPipelineWorker* currentThreadWorkerPtr = PcmPipelineSupport::t_currentThreadWorkerPtr;
+    if (currentThreadWorkerPtr != nullptr && !currentThreadWorkerPtr->m_isAttached)
+    {
+        this->m_workerPtr = currentThreadWorkerPtr;
+    }
+    else
+    {
+        this->m_ownedWorkerPtr = std::make_unique<PcmPipelineWorker>();
+        this->m_workerPtr = this->m_ownedWorkerPtr.get();
+    }
+
+    this->m_workerPtr->Attach(consumerFunction);
+}
+
+PcmPipeline::~PcmPipeline()
+{
+    this->m_workerPtr->Detach();
+}
+
+#pragma region Public_Member_Functions_Region
+
+void PcmPipelineWorker::SetCurrentThreadWorker(PcmPipelineWorker* workerPtr)
+{
+    PcmPipelineSupport::t_currentThreadWorkerPtr = workerPtr;
+}
+
+void PcmPipeline::Write(const int32_t* samplePtr, size_t sampleCount)
+{
+    int32_t* destinationPtr = this->m_workerPtr->Reserve(sampleCount);
+    memcpy(destinationPtr, samplePtr, sampleCount * sizeof(int32_t));
+}
+
+void PcmPipeline::WritePlanar(const int32_t* const channelPtrs[], unsigned long channelCount, unsigned long frameCount)
+{
+    int32_t* destinationPtr = this->m_workerPtr->Reserve(static_cast<size_t>(channelCount) * frameCount);
+    for (unsigned long frameIndex = 0UL; frameIndex < frameCount; ++frameIndex)
+    {
+        for (unsigned long channelIndex = 0UL; channelIndex < channelCount; ++channelIndex)
+        {
+            *destinationPtr++ = channelPtrs[channelIndex][frameIndex];
+        }
+    }
+}
+
+void PcmPipeline::Flush()
+{
+    this->m_workerPtr->Flush();
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+void PcmPipelineWorker::Attach(ConsumerFunction consumerFunction)
+{
+    for (Block& blockRef : this->m_blocks)
+    {
+        if (blockRef.samples.size() < PCM_PIPELINE_BLOCK_SAMPLE_COUNT)
+        {
+            blockRef.samples.resize(PCM_PIPELINE_BLOCK_SAMPLE_COUNT);
+        }
+        blockRef.sampleCount = 0;
+    }
+    this->m_fillBlockIndex = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_consumerFunction = consumerFunction;
+        this->m_isAttached = true;
+    }
+
+    if (!this->m_pipelineThread.joinable())
+    {
+        this->m_pipelineThread = std::thread(&PcmPipelineWorker::PipelineThreadProc, this);
+    }
+}
+
+void PcmPipelineWorker::Detach()
+{
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+
+    // Discard the Blocks NOT yet consumed, and wait for the Block being consumed.
+    for (size_t blockIndex = 0; blockIndex < 2; ++blockIndex)
+    {
+        if (!this->m_isConsuming || blockIndex != this->m_consumeBlockIndex)
+        {
+            this->m_blocks[blockIndex].isReady = false;
+        }
+    }
+    this->m_blockStateCondition.wait(lock, [this]() { return !this->m_isConsuming; });
+
+    // The next File starts with the first Block.
+    this->m_consumeBlockIndex = 0;
+    this->m_consumerFunction = nullptr;
+    this->m_isAttached = false;
+}
+
+int32_t* PcmPipelineWorker::Reserve(size_t sampleCount)
+{
+    Block* fillBlockPtr = &this->m_blocks[this->m_fillBlockIndex];
+    if (fillBlockPtr->sampleCount > 0 && fillBlockPtr->sampleCount + sampleCount > fillBlockPtr->samples.size())
+    {
+        // The samples do NOT fit, and a Frame is NOT split across Blocks.
+        this->HandOver();
+        fillBlockPtr = &this->m_blocks[this->m_fillBlockIndex];
+    }
+
+    if (sampleCount > fillBlockPtr->samples.size())
+    {
+        fillBlockPtr->samples.resize(sampleCount);
+    }
+
+    int32_t* destinationPtr = fillBlockPtr->samples.data() + fillBlockPtr->sampleCount;
+    fillBlockPtr->sampleCount += sampleCount;
+    return destinationPtr;
+}
+
+void PcmPipelineWorker::HandOver()
+{
+    size_t otherBlockIndex = this->m_fillBlockIndex ^ 1;
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        this->m_blocks[this->m_fillBlockIndex].isReady = true;
+        this->m_blockStateCondition.notify_all();
+
+        // Double buffering: wait until the Pipeline Thread has consumed the other Block.
+        this->m_blockStateCondition.wait(lock, [this, otherBlockIndex]() { return !this->m_blocks[otherBlockIndex].isReady; });
+    }
+
+    this->m_fillBlockIndex = otherBlockIndex;
+    this->m_blocks[otherBlockIndex].sampleCount = 0;
+}
+
+void PcmPipelineWorker::Flush()
+{
+    if (this->m_blocks[this->m_fillBlockIndex].sampleCount > 0)
+    {
+        this->HandOver();
+    }
+
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    this->m_blockStateCondition.wait(lock, [this]() { return !this->m_blocks[0].isReady && !this->m_blocks[1].isReady; });
+}
+
+void PcmPipelineWorker::PipelineThreadProc()
+{
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    while (true)
+    {
+        this->m_blockStateCondition.wait(lock, [this]() { return this->m_blocks[this->m_consumeBlockIndex].isReady || this->m_stopRequested; });
+        if (this->m_stopRequested)
+        {
+            return;
+        }
+
+        Block& blockRef = this->m_blocks[this->m_consumeBlockIndex];
+        this->m_isConsuming = true;
+        lock.unlock();
+
+        this->m_consumerFunction(blockRef.samples.data(), blockRef.sampleCount);
+
+        lock.lock();
+        this->m_isConsuming = false;
+        blockRef.isReady = false;
+
+        // The Blocks are filled in turn.
+        this->m_consumeBlockIndex ^= 1;
+        this->m_blockStateCondition.notify_all();
+    }
+}
+
+#pragma endregion Private_Member_Functions_Region
@@ -0,0 +1,626 @@
+#include "RemoteStreamSource.h"
+#include <windows.h>
+#include <winhttp.h>
+#include <io.h>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#pragma comment(lib, "Winhttp.lib")
+
+namespace RemoteStreamSourceSupport
+{
+    /// <summary>
+    /// Purpose: The number of times a range request is sent before the range is reported as NOT fetched.
+    /// </summary>
+    constexpr auto RANGE_REQUEST_ATTEMPT_COUNT = 3UL;
+
+    /// <summary>
+    /// Purpose: The number of connections the session keeps to each server. Enough for the parallel range requests of every Decoder Thread.
+    /// </summary>
+    constexpr auto MAXIMUM_CONNECTIONS_PER_SERVER = 64UL;
+
+    /// <summary>
+    /// Purpose: A URL List larger than this is NOT read (16 MB).
+    /// </summary>
+    constexpr auto MAXIMUM_URL_LIST_SIZE = 16777216L;
+
+    /// <summary>
+    /// Purpose: The largest ETag or Last-Modified header value kept, in characters.
+    /// </summary>
+    constexpr auto MAXIMUM_VALIDATOR_SIZE = 256UL;
+
+    std::mutex g_settingsMutex{};
+    RemoteStreamSettings g_settings{};
+
+    /// <summary>
+    /// Purpose: The process-wide WinHTTP session, and a connection Handle for each server. Both are kept for the lifetime of the process,
+    /// so the connections opened for a File are reused by the next File.
+    /// </summary>
+    std::mutex g_sessionMutex{};
+    HINTERNET g_sessionHandle{ NULL };
+    std::map<std::wstring, HINTERNET> g_connectionHandleMap{};
+
+    /// <summary>
+    /// Purpose: Splits a URL into its parts.
+    /// URI: https://learn.microsoft.com/en-us/windows/win32/api/winhttp/nf-winhttp-winhttpcrackurl
+    /// </summary>
+    bool ParseUrl(const wchar_t* urlPtr, RemoteUrl& urlRef)
+    {
+        URL_COMPONENTS components{};
+        components.dwStructSize = sizeof(components);
+        components.dwSchemeLength = static_cast<DWORD>(-1);
+        components.dwHostNameLength = static_cast<DWORD>(-1);
+        components.dwUrlPathLength = static_cast<DWORD>(-1);
+        components.dwExtraInfoLength = static_cast<DWORD>(-1);
+        if (!WinHttpCrackUrl(urlPtr, 0, 0, &components) || components.dwHostNameLength == 0 ||
+            (components.nScheme != INTERNET_SCHEME_HTTP && components.nScheme != INTERNET_SCHEME_HTTPS))
+        {
+            return false;
+        }
+
+        urlRef.hostName.assign(components.lpszHostName, components.dwHostNameLength);
+        urlRef.port = components.nPort;
+        urlRef.isSecure = (components.nScheme == INTERNET_SCHEME_HTTPS);
+        urlRef.objectName.assign(components.lpszUrlPath, components.dwUrlPathLength);
+        urlRef.objectName.append(components.lpszExtraInfo, components.dwExtraInfoLength);
+        if (urlRef.objectName.empty())
+        {
+            urlRef.objectName = L"/";
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Purpose: Gets the connection Handle of a server, opening the session and the connection when they are first used.
+    /// </summary>
+    /// <returns>The connection Handle. Otherwise, NULL.</returns>
+    HINTERNET GetConnectionHandle(const RemoteUrl& urlRef)
+    {
+        std::lock_guard<std::mutex> lock(g_sessionMutex);
+        if (g_sessionHandle == NULL)
+        {
+            // URI: https://learn.microsoft.com/en-us/windows/win32/api/winhttp/nf-winhttp-winhttpopen
+            g_sessionHandle = WinHttpOpen(L"WinAudioDecodeR", WINHTTP_ACCESS_TYPE_DEFAULT_PROXY, WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
+            if (g_sessionHandle == NULL)
+            {
+                return NULL;
+            }
+
+            // URI: https://learn.microsoft.com/en-us/windows/win32/winhttp/option-flags
+            DWORD maximumConnectionCount = MAXIMUM_CONNECTIONS_PER_SERVER;
+            WinHttpSetOption(g_sessionHandle, WINHTTP_OPTION_MAX_CONNS_PER_SERVER, &maximumConnectionCount, sizeof(maximumConnectionCount));
+        }
+
+        std::wstring serverKey = urlRef.hostName + L":" + std::to_wstring(urlRef.port);
+        std::map<std::wstring, HINTERNET>::const_iterator iterator = g_connectionHandleMap.find(serverKey);
+        if (iterator != g_connectionHandleMap.end())
+        {
+            return iterator->second;
+        }
+
+        // URI: https://learn.microsoft.com/en-us/windows/win32/api/winhttp/nf-winhttp-winhttpconnect
+        HINTERNET connectionHandle = WinHttpConnect(g_sessionHandle, urlRef.hostName.c_str(), urlRef.port, 0);
+        if (connectionHandle != NULL)
+        {
+            g_connectionHandleMap[serverKey] = connectionHandle;
+        }
+
+        return connectionHandle;
+    }
+
+    /// <summary>
+    /// Purpose: Parses the Content-Range header of a partial response (e.g. "bytes 0-1048575/73400320").
+    /// </summary>
+    bool ParseContentRange(const wchar_t* contentRangePtr, unsigned long long& firstByteRef, unsigned long long& totalLengthRef)
+    {
+        unsigned long long lastByte = 0ULL;
+        return swscanf_s(contentRangePtr, L"bytes %llu-%llu/%llu", &firstByteRef, &lastByte, &totalLengthRef) == 3;
+    }
+
+    /// <summary>
+    /// Purpose: Gets the validator of a response, which identifies the version of the File: its strong ETag, otherwise its Last-Modified date.
+    /// A weak ETag (e.g. W/"abc") can NOT be sent in an If-Range header, so it is NOT used.
+    /// URI: https://www.rfc-editor.org/rfc/rfc9110#name-if-range
+    /// </summary>
+    /// <returns>The validator. Empty when the server sent neither.</returns>
+    std::wstring QueryValidator(HINTERNET requestHandle)
+    {
+        wchar_t value[MAXIMUM_VALIDATOR_SIZE]{};
+        DWORD valueSize = sizeof(value);
+        if (WinHttpQueryHeaders(requestHandle, WINHTTP_QUERY_ETAG, WINHTTP_HEADER_NAME_BY_INDEX, value, &valueSize, WINHTTP_NO_HEADER_INDEX) && wcsncmp(value, L"W/", 2) != 0)
+        {
+            return value;
+        }
+
+        valueSize = sizeof(value);
+        if (WinHttpQueryHeaders(requestHandle, WINHTTP_QUERY_LAST_MODIFIED, WINHTTP_HEADER_NAME_BY_INDEX, value, &valueSize, WINHTTP_NO_HEADER_INDEX))
+        {
+            return value;
+        }
+
+        return std::wstring{};
+    }
+
+    /// <summary>
+    /// Purpose: Sends a single range request, and reads its response body. The response is read completely, so its connection can be reused.
+    /// </summary>
+    /// <param name="validatorRef">The validator of the File when it was opened, sent in an If-Range header. Empty for the first request.
+    /// A response for another version of the File (i.e. the File was replaced on the server) is NOT valid.</param>
+    /// <param name="responseValidatorRef">The validator of the response.</param>
+    /// <param name="totalLengthRef">The length of the File. A server that ignores the Range header returns the whole File, so the length is the size of the body.</param>
+    /// <returns>TRUE if the range, or the whole File, was read. Otherwise, FALSE.</returns>
+    bool SendRangeRequest(const RemoteUrl& urlRef, unsigned long long offset, unsigned long long length, unsigned long injectedLatencyMilliseconds,
+        const std::wstring& validatorRef, std::vector<unsigned char>& bodyRef, unsigned long long& totalLengthRef, std::wstring& responseValidatorRef)
+    {
+        if (injectedLatencyMilliseconds > 0UL)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(injectedLatencyMilliseconds));
+        }
+
+        HINTERNET connectionHandle = GetConnectionHandle(urlRef);
+        if (connectionHandle == NULL)
+        {
+            return false;
+        }
+
+        // URI: https://learn.microsoft.com/en-us/windows/win32/api/winhttp/nf-winhttp-winhttpopenrequest
+        HINTERNET requestHandle = WinHttpOpenRequest(connectionHandle, L"GET", urlRef.objectName.c_str(), NULL, WINHTTP_NO_REFERER, WINHTTP_DEFAULT_ACCEPT_TYPES,
+            urlRef.isSecure ? WINHTTP_FLAG_SECURE : 0);
+        if (requestHandle == NULL)
+        {
+            return false;
+        }
+
+        // URI: https://www.rfc-editor.org/rfc/rfc9110#name-range
+        // With If-Range, a server whose File no longer matches the validator returns the whole (new) File instead of the range.
+        std::wstring requestHeaders = L"Range: bytes=" + std::to_wstring(offset) + L"-" + std::to_wstring(offset + length - 1ULL);
+        if (!validatorRef.empty())
+        {
+            requestHeaders += L"\r\nIf-Range: " + validatorRef;
+        }
+
+        bool responseIsValid = false;
+        DWORD statusCode = 0;
+        DWORD statusCodeSize = sizeof(statusCode);
+
+        // URI: https://learn.microsoft.com/en-us/windows/win32/api/winhttp/nf-winhttp-winhttpsendrequest
+        // URI: https://learn.microsoft.com/en-us/windows/win32/api/winhttp/nf-winhttp-winhttpqueryheaders
+        if (WinHttpSendRequest(requestHandle, requestHeaders.c_str(), static_cast<DWORD>(-1L), WINHTTP_NO_REQUEST_DATA, 0, 0, 0) &&
+            WinHttpReceiveResponse(requestHandle, NULL) &&
+            WinHttpQueryHeaders(requestHandle, WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER, WINHTTP_HEADER_NAME_BY_INDEX, &statusCode, &statusCodeSize, WINHTTP_NO_HEADER_INDEX))
+        {
+            // The validator is also compared, since a server that ignores If-Range still returns the range of the new File.
+            unsigned long long firstByte = 0ULL;
+            responseValidatorRef = QueryValidator(requestHandle);
+            if (!validatorRef.empty() && responseValidatorRef != validatorRef)
+            {
+                responseIsValid = false;
+            }
+            else if (statusCode == 206)
+            {
+                wchar_t contentRange[128]{};
+                DWORD contentRangeSize = sizeof(contentRange);
+                responseIsValid = WinHttpQueryHeaders(requestHandle, WINHTTP_QUERY_CONTENT_RANGE, WINHTTP_HEADER_NAME_BY_INDEX, contentRange, &contentRangeSize, WINHTTP_NO_HEADER_INDEX) &&
+                    ParseContentRange(contentRange, firstByte, totalLengthRef) && firstByte == offset;
+            }
+            else if (statusCode == 200 && offset == 0ULL)
+            {
+                // The Range header was ignored, so the whole File is returned.
+                responseIsValid = true;
+            }
+        }
+
+        bodyRef.clear();
+        if (responseIsValid)
+        {
+            bodyRef.reserve(static_cast<size_t>(length));
+
+            // URI: https://learn.microsoft.com/en-us/windows/win32/api/winhttp/nf-winhttp-winhttpquerydataavailable
+            // URI: https://learn.microsoft.com/en-us/windows/win32/api/winhttp/nf-winhttp-winhttpreaddata
+            DWORD availableSize = 0;
+            while (responseIsValid && WinHttpQueryDataAvailable(requestHandle, &availableSize) && availableSize > 0)
+            {
+                size_t bodySize = bodyRef.size();
+                bodyRef.resize(bodySize + availableSize);
+
+                DWORD bytesRead = 0;
+                responseIsValid = WinHttpReadData(requestHandle, bodyRef.data() + bodySize, availableSize, &bytesRead) && bytesRead > 0;
+                bodyRef.resize(bodySize + bytesRead);
+            }
+
+            if (statusCode == 200)
+            {
+                totalLengthRef = bodyRef.size();
+            }
+        }
+
+        WinHttpCloseHandle(requestHandle);
+        return responseIsValid;
+    }
+
+    bool EndsWithExtension(const std::wstring& filenameRef, const wchar_t* extensionPtr)
+    {
+        size_t extensionLength = wcslen(extensionPtr);
+        return filenameRef.size() > extensionLength && _wcsicmp(filenameRef.c_str() + filenameRef.size() - extensionLength, extensionPtr) == 0;
+    }
+}
+
+/// <summary>
+/// Purpose: No-arg Constructor.
+/// </summary>
+RemoteStreamSource::RemoteStreamSource()
+{
+
+}
+
+/// <summary>
+/// Purpose: Destructor
+/// </summary>
+RemoteStreamSource::~RemoteStreamSource()
+{
+    this->Close();
+}
+
+#pragma region Public_Member_Functions_Region
+
+bool RemoteStreamSource::IsRemotePath(const wchar_t* pathPtr)
+{
+    return _wcsnicmp(pathPtr, L"http://", 7) == 0 || _wcsnicmp(pathPtr, L"https://", 8) == 0;
+}
+
+bool RemoteStreamSource::GetOrigin(const wchar_t* urlPtr, std::wstring& originRef)
+{
+    RemoteUrl url{};
+    if (!RemoteStreamSource::IsRemotePath(urlPtr) || !RemoteStreamSourceSupport::ParseUrl(urlPtr, url))
+    {
+        return false;
+    }
+
+    originRef = (url.isSecure ? L"https://" : L"http://") + url.hostName + L":" + std::to_wstring(url.port) + L"/";
+    return true;
+}
+
+bool RemoteStreamSource::IsUrlListType(const wchar_t* filenamePtr)
+{
+    std::wstring filename(filenamePtr);
+    return RemoteStreamSourceSupport::EndsWithExtension(filename, L".m3u") || RemoteStreamSourceSupport::EndsWithExtension(filename, L".m3u8");
+}
+
+bool RemoteStreamSource::ReadUrlList(const wchar_t* listFilenamePtr, std::vector<std::wstring>& urlsRef)
+{
+    FILE* fileStreamPtr = nullptr;
+    if (_wfopen_s(&fileStreamPtr, listFilenamePtr, L"rb") != 0 || fileStreamPtr == nullptr)
+    {
+        return false;
+    }
+
+    long long fileLength = _filelengthi64(_fileno(fileStreamPtr));
+    if (fileLength < 0LL || fileLength > RemoteStreamSourceSupport::MAXIMUM_URL_LIST_SIZE)
+    {
+        fclose(fileStreamPtr);
+        return false;
+    }
+
+    std::string text(static_cast<size_t>(fileLength), '\0');
+    size_t bytesRead = fread(&text[0], 1, text.size(), fileStreamPtr);
+    fclose(fileStreamPtr);
+    text.resize(bytesRead);
+
+    // Skip the UTF-8 Byte Order Mark of an M3U8 Playlist.
+    size_t lineStart = (text.compare(0, 3, "\xEF\xBB\xBF") == 0) ? 3 : 0;
+    while (lineStart < text.size())
+    {
+        size_t lineEnd = text.find('\n', lineStart);
+        if (lineEnd == std::string::npos)
+        {
+            lineEnd = text.size();
+        }
+
+        // Trim the surrounding white space (including the '\r' of a Windows line ending).
+        size_t first = lineStart;
+        size_t last = lineEnd;
+        while (first < last && isspace(static_cast<unsigned char>(text[first])))
+        {
+            ++first;
+        }
+
+        while (last > first && isspace(static_cast<unsigned char>(text[last - 1])))
+        {
+            --last;
+        }
+
+        if (last > first && text[first] != '#')
+        {
+            // A URL is ASCII (with its other characters percent-encoded), but a Playlist may hold UTF-8 characters.
+            // URI: https://learn.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
+            int wideLength = MultiByteToWideChar(CP_UTF8, 0, text.data() + first, static_cast<int>(last - first), nullptr, 0);
+            if (wideLength > 0)
+            {
+                std::wstring url(static_cast<size_t>(wideLength), L'\0');
+                MultiByteToWideChar(CP_UTF8, 0, text.data() + first, static_cast<int>(last - first), &url[0], wideLength);
+                if (RemoteStreamSource::IsRemotePath(url.c_str()))
+                {
+                    urlsRef.push_back(std::move(url));
+                }
+            }
+        }
+
+        lineStart = lineEnd + 1;
+    }
+
+    return true;
+}
+
+void RemoteStreamSource::Configure(const RemoteStreamSettings& settingsRef)
+{
+    std::lock_guard<std::mutex> lock(RemoteStreamSourceSupport::g_settingsMutex);
+    RemoteStreamSettings& settings = RemoteStreamSourceSupport::g_settings;
+    settings = settingsRef;
+    settings.rangeSize = (settings.rangeSize > 0UL) ? settings.rangeSize : 1UL;
+    settings.prefetchRangeCount = (settings.prefetchRangeCount > 0UL) ? settings.prefetchRangeCount : 1UL;
+    settings.windowRangeCount = (settings.windowRangeCount > settings.prefetchRangeCount) ? settings.windowRangeCount : settings.prefetchRangeCount + 1UL;
+}
+
+bool RemoteStreamSource::Open(const wchar_t* urlPtr)
+{
+    this->Close();
+
+    if (!RemoteStreamSourceSupport::ParseUrl(urlPtr, this->m_url))
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(RemoteStreamSourceSupport::g_settingsMutex);
+        this->m_settings = RemoteStreamSourceSupport::g_settings;
+    }
+
+    // The first range is fetched now, since its response holds the length of the File, and the validator sent with the other range requests.
+    std::shared_ptr<std::vector<unsigned char>> firstRangePtr = std::make_shared<std::vector<unsigned char>>();
+    unsigned long long totalLength = 0ULL;
+    bool firstRangeWasFetched = false;
+    for (unsigned long attempt = 0UL; !firstRangeWasFetched && attempt < RemoteStreamSourceSupport::RANGE_REQUEST_ATTEMPT_COUNT; ++attempt)
+    {
+        firstRangeWasFetched = RemoteStreamSourceSupport::SendRangeRequest(this->m_url, 0ULL, this->m_settings.rangeSize, this->m_settings.injectedLatencyMilliseconds, std::wstring{},
+            *firstRangePtr, totalLength, this->m_validator);
+    }
+
+    if (!firstRangeWasFetched || totalLength == 0ULL)
+    {
+        return false;
+    }
+
+    // A server that ignored the Range header returned the whole File, which becomes a single range.
+    this->m_length = totalLength;
+    this->m_rangeSize = (firstRangePtr->size() == totalLength && totalLength > this->m_settings.rangeSize) ? totalLength : this->m_settings.rangeSize;
+    if (firstRangePtr->size() != ((this->m_length < this->m_rangeSize) ? this->m_length : this->m_rangeSize))
+    {
+        return false;
+    }
+
+    std::promise<std::shared_ptr<const std::vector<unsigned char>>> firstRangePromise{};
+    firstRangePromise.set_value(firstRangePtr);
+    this->m_rangeFutures[0ULL] = firstRangePromise.get_future().share();
+
+    this->m_isOpen = true;
+    return true;
+}
+
+void RemoteStreamSource::Close()
+{
+    // Wait for the range requests still in flight, before their results are dropped.
+    for (std::pair<const unsigned long long, RangeFuture>& rangeFutureRef : this->m_rangeFutures)
+    {
+        rangeFutureRef.second.wait();
+    }
+
+    // Reset to default values.
+    this->m_rangeFutures.clear();
+    this->m_url = RemoteUrl{};
+    this->m_validator.clear();
+    this->m_rangeSize = 0ULL;
+    this->m_length = 0ULL;
+    this->m_position = 0ULL;
+    this->m_isEOF = false;
+    this->m_isOpen = false;
+}
+
+bool RemoteStreamSource::ReadAll(unsigned char* destinationPtr)
+{
+    if (!this->m_isOpen)
+    {
+        return false;
+    }
+
+    // Keep up to prefetchRangeCount requests in flight, and copy each range as it arrives, in order.
+    unsigned long long rangeCount = (this->m_length + this->m_rangeSize - 1ULL) / this->m_rangeSize;
+    std::deque<std::pair<unsigned long long, RangeFuture>> pendingRanges{};
+    unsigned long long nextRangeIndex = 0ULL;
+    bool rangesWereFetched = true;
+
+    while (rangesWereFetched && (nextRangeIndex < rangeCount || !pendingRanges.empty()))
+    {
+        while (nextRangeIndex < rangeCount && pendingRanges.size() < this->m_settings.prefetchRangeCount)
+        {
+            std::map<unsigned long long, RangeFuture>::const_iterator iterator = this->m_rangeFutures.find(nextRangeIndex);
+            pendingRanges.emplace_back(nextRangeIndex, (iterator != this->m_rangeFutures.end()) ? iterator->second : this->RequestRange(nextRangeIndex));
+            ++nextRangeIndex;
+        }
+
+        std::shared_ptr<const std::vector<unsigned char>> rangePtr = pendingRanges.front().second.get();
+        if (rangePtr != nullptr)
+        {
+            memcpy(destinationPtr + pendingRanges.front().first * this->m_rangeSize, rangePtr->data(), rangePtr->size());
+        }
+
+        rangesWereFetched = (rangePtr != nullptr);
+        pendingRanges.pop_front();
+    }
+
+    // The requests still in flight after a failure are waited for, so they do NOT outlive the Buffer.
+    for (std::pair<unsigned long long, RangeFuture>& pendingRangeRef : pendingRanges)
+    {
+        pendingRangeRef.second.wait();
+    }
+
+    return rangesWereFetched;
+}
+
+size_t RemoteStreamSource::Read(void* bufferPtr, size_t size)
+{
+    unsigned char* destinationPtr = static_cast<unsigned char*>(bufferPtr);
+    size_t bytesRead = 0;
+    while (this->m_isOpen && bytesRead < size)
+    {
+        if (this->m_position >= this->m_length)
+        {
+            this->m_isEOF = true;
+            break;
+        }
+
+        unsigned long long rangeIndex = this->m_position / this->m_rangeSize;
+        this->PrefetchRanges(rangeIndex);
+
+        std::shared_ptr<const std::vector<unsigned char>> rangePtr = this->m_rangeFutures[rangeIndex].get();
+        size_t rangeOffset = static_cast<size_t>(this->m_position - rangeIndex * this->m_rangeSize);
+        if (rangePtr == nullptr || rangeOffset >= rangePtr->size())
+        {
+            // The range could NOT be fetched. It is requested again by the next Read().
+            this->m_rangeFutures.erase(rangeIndex);
+            this->m_isEOF = true;
+            break;
+        }
+
+        size_t copySize = rangePtr->size() - rangeOffset;
+        if (copySize > size - bytesRead)
+        {
+            copySize = size - bytesRead;
+        }
+
+        memcpy(destinationPtr + bytesRead, rangePtr->data() + rangeOffset, copySize);
+        bytesRead += copySize;
+        this->m_position += copySize;
+    }
+
+    return bytesRead;
+}
+
+int RemoteStreamSource::Seek(long long offset, int origin)
+{
+    long long position = 0LL;
+    switch (origin)
+    {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position = static_cast<long long>(this->m_position) + offset;
+            break;
+        case SEEK_END:
+            position = static_cast<long long>(this->m_length) + offset;
+            break;
+        default:
+            // Seek Error
+            return -1;
+    }
+
+    if (!this->m_isOpen || position < 0LL || position > static_cast<long long>(this->m_length))
+    {
+        // Seek Error
+        return -1;
+    }
+
+    this->m_position = static_cast<unsigned long long>(position);
+    this->m_isEOF = false;
+    return 0;
+}
+
+long long RemoteStreamSource::Tell() const
+{
+    return static_cast<long long>(this->m_position);
+}
+
+long long RemoteStreamSource::Length() const
+{
+    return static_cast<long long>(this->m_length);
+}
+
+bool RemoteStreamSource::EndOfFile() const
+{
+    return this->m_isEOF;
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+RemoteStreamSource::RangeFuture RemoteStreamSource::RequestRange(unsigned long long rangeIndex) const
+{
+    // The request only uses copies of the URL and settings, so it does NOT depend on the lifetime of the source.
+    RemoteUrl url = this->m_url;
+    std::wstring validator = this->m_validator;
+    unsigned long long fileLength = this->m_length;
+    unsigned long long offset = rangeIndex * this->m_rangeSize;
+    unsigned long long length = (this->m_length - offset < this->m_rangeSize) ? this->m_length - offset : this->m_rangeSize;
+    unsigned long injectedLatencyMilliseconds = this->m_settings.injectedLatencyMilliseconds;
+
+    return std::async(std::launch::async, [url, validator, fileLength, offset, length, injectedLatencyMilliseconds]() -> std::shared_ptr<const std::vector<unsigned char>>
+    {
+        std::shared_ptr<std::vector<unsigned char>> rangePtr = std::make_shared<std::vector<unsigned char>>();
+        unsigned long long totalLength = 0ULL;
+        std::wstring responseValidator{};
+        for (unsigned long attempt = 0UL; attempt < RemoteStreamSourceSupport::RANGE_REQUEST_ATTEMPT_COUNT; ++attempt)
+        {
+            // A File whose length changed was replaced on the server, even when the server sent NO validator.
+            if (RemoteStreamSourceSupport::SendRangeRequest(url, offset, length, injectedLatencyMilliseconds, validator, *rangePtr, totalLength, responseValidator) &&
+                rangePtr->size() == length && totalLength == fileLength)
+            {
+                return rangePtr;
+            }
+        }
+
+        return nullptr;
+    }).share();
+}
+
+void RemoteStreamSource::PrefetchRanges(unsigned long long rangeIndex)
+{
+    unsigned long long rangeCount = (this->m_length + this->m_rangeSize - 1ULL) / this->m_rangeSize;
+    unsigned long long endRangeIndex = rangeIndex + this->m_settings.prefetchRangeCount;
+    if (endRangeIndex > rangeCount)
+    {
+        endRangeIndex = rangeCount;
+    }
+
+    for (unsigned long long index = rangeIndex; index < endRangeIndex; ++index)
+    {
+        if (this->m_rangeFutures.find(index) == this->m_rangeFutures.end())
+        {
+            this->m_rangeFutures[index] = this->RequestRange(index);
+        }
+    }
+
+    // Drop the ranges behind the position first (oldest first), then the ranges beyond the prefetch (furthest first).
+    while (this->m_rangeFutures.size() > this->m_settings.windowRangeCount)
+    {
+        std::map<unsigned long long, RangeFuture>::iterator firstIterator = this->m_rangeFutures.begin();
+        std::map<unsigned long long, RangeFuture>::iterator lastIterator = std::prev(this->m_rangeFutures.end());
+        std::map<unsigned long long, RangeFuture>::iterator droppedIterator = (firstIterator->first < rangeIndex) ? firstIterator : lastIterator;
+        if (droppedIterator->first >= rangeIndex && droppedIterator->first < endRangeIndex)
+        {
+            break;
+        }
+
+        droppedIterator->second.wait(); // A range still in flight is waited for, so its Thread does NOT outlive the window.
+        this->m_rangeFutures.erase(droppedIterator);
+    }
+}
+
+#pragma endregion Private_Member_Functions_Region
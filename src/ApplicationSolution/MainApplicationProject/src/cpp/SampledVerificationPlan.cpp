@@ -0,0 +1,99 @@
+#include "SampledVerificationPlan.h"
+#include <cmath>
+#include <random>
+
+SampledVerificationPlan::SampledVerificationPlan()
+{
+
+}
+
+SampledVerificationPlan::~SampledVerificationPlan()
+{
+
+}
+
+unsigned long SampledVerificationPlan::CalculateWindowCount(double confidence, double damagedFraction)
+{
+    if (confidence <= 0.0 || damagedFraction >= 1.0)
+    {
+        return 1UL;
+    }
+
+    if (confidence >= 1.0 || damagedFraction <= 0.0)
+    {
+        // Certainty can NOT be reached by sampling.
+        return 0xFFFFFFFFUL;
+    }
+
+    double windowCount = std::ceil(std::log(1.0 - confidence) / std::log(1.0 - damagedFraction));
+    return (windowCount < 1.0) ? 1UL : static_cast<unsigned long>(windowCount);
+}
+
+bool SampledVerificationPlan::Configure(unsigned long windowCount, unsigned long long rangeStart, unsigned long long rangeEnd)
+{
+    this->m_positions.clear();
+    this->m_nextIndex = 0;
+
+    if (windowCount == 0UL || rangeEnd <= rangeStart)
+    {
+        return false;
+    }
+
+    unsigned long long rangeSize = rangeEnd - rangeStart;
+    if (windowCount > rangeSize)
+    {
+        windowCount = static_cast<unsigned long>(rangeSize);
+    }
+
+    std::random_device randomDevice;
+    std::mt19937_64 randomGenerator(randomDevice());
+
+    this->m_positions.reserve(windowCount);
+    for (unsigned long windowIndex = 0UL; windowIndex < windowCount; ++windowIndex)
+    {
+        // The bounds of the stratum. The strata cover the range without gaps.
+        unsigned long long stratumStart = rangeStart + static_cast<unsigned long long>(static_cast<double>(rangeSize) * windowIndex / windowCount);
+        unsigned long long stratumEnd = rangeStart + static_cast<unsigned long long>(static_cast<double>(rangeSize) * (windowIndex + 1UL) / windowCount);
+
+        if (windowIndex == 0UL || stratumEnd <= stratumStart + 1ULL)
+        {
+            this->m_positions.push_back(stratumStart);
+        }
+        else
+        {
+            std::uniform_int_distribution<unsigned long long> distribution(stratumStart, stratumEnd - 1ULL);
+            this->m_positions.push_back(distribution(randomGenerator));
+        }
+    }
+
+    return true;
+}
+
+bool SampledVerificationPlan::IsEnabled() const
+{
+    return !this->m_positions.empty();
+}
+
+bool SampledVerificationPlan::NextWindow(unsigned long long& positionRef)
+{
+    if (this->m_nextIndex >= this->m_positions.size())
+    {
+        return false;
+    }
+
+    positionRef = this->m_positions[this->m_nextIndex++];
+    return true;
+}
+
+unsigned long long SampledVerificationPlan::GetWindowProgressUnits(unsigned long long total) const
+{
+    if (this->m_positions.empty() || this->m_nextIndex == 0)
+    {
+        return 1ULL;
+    }
+
+    double windowCount = static_cast<double>(this->m_positions.size());
+    unsigned long long progressStart = static_cast<unsigned long long>(static_cast<double>(total) * (this->m_nextIndex - 1) / windowCount);
+    unsigned long long progressEnd = static_cast<unsigned long long>(static_cast<double>(total) * this->m_nextIndex / windowCount);
+    return (progressEnd > progressStart) ? (progressEnd - progressStart) : 1ULL;
+}
@@ -0,0 +1,402 @@
+#include "SidecarManifest.h"
+#include <windows.h>
+#include <io.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <cwctype>
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace SidecarManifestSupport
+{
+    /// <summary>
+    /// Purpose: A manifest larger than this is NOT read (16 MB).
+    /// </summary>
+    constexpr auto MAXIMUM_MANIFEST_SIZE = 16777216L;
+
+    /// <summary>
+    /// Purpose: A manifest entry. The expected checksum is kept in the byte order it is written in the manifest.
+    /// </summary>
+    struct ManifestEntry
+    {
+        SidecarEntryResult result{};
+        unsigned char expectedDigest[16]{};
+    };
+
+    /// <summary>
+    /// Purpose: The manifest entries, by the upper case filename (Windows filenames are NOT case sensitive). A File may be listed by more than one manifest.
+    /// </summary>
+    std::mutex g_manifestMutex{};
+    std::multimap<std::wstring, ManifestEntry> g_entries{};
+    std::set<std::wstring> g_manifestFilenames{};
+
+    bool EndsWithExtension(const std::wstring& filenameRef, const wchar_t* extensionPtr)
+    {
+        size_t extensionLength = wcslen(extensionPtr);
+        return filenameRef.size() > extensionLength && _wcsicmp(filenameRef.c_str() + filenameRef.size() - extensionLength, extensionPtr) == 0;
+    }
+
+    std::wstring ToKey(const std::wstring& filenameRef)
+    {
+        std::wstring key(filenameRef);
+        std::transform(key.begin(), key.end(), key.begin(), [](wchar_t character) { return static_cast<wchar_t>(towupper(character)); });
+        return key;
+    }
+
+    /// <summary>
+    /// Purpose: Converts a hexadecimal checksum to bytes. Both upper and lower case digits are accepted.
+    /// </summary>
+    /// <returns>TRUE if the text is exactly digestSize bytes of hexadecimal digits. Otherwise, FALSE.</returns>
+    bool ParseHexDigest(const std::string& textRef, unsigned char* digestPtr, size_t digestSize)
+    {
+        if (textRef.size() != digestSize * 2)
+        {
+            return false;
+        }
+
+        for (size_t byteIndex = 0; byteIndex < digestSize; ++byteIndex)
+        {
+            unsigned int byteValue = 0U;
+            for (size_t digitIndex = 0; digitIndex < 2; ++digitIndex)
+            {
+                char digit = textRef[byteIndex * 2 + digitIndex];
+                if (!isxdigit(static_cast<unsigned char>(digit)))
+                {
+                    return false;
+                }
+
+                byteValue = (byteValue << 4) | static_cast<unsigned int>(isdigit(static_cast<unsigned char>(digit)) ? digit - '0' : (tolower(static_cast<unsigned char>(digit)) - 'a' + 10));
+            }
+
+            digestPtr[byteIndex] = static_cast<unsigned char>(byteValue);
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Purpose: Converts a filename from a manifest to a full path. The filename is UTF-8 when it is valid UTF-8, otherwise it is in the ANSI Code Page (as written by older tools).
+    /// URI: https://learn.microsoft.com/en-us/windows/win32/api/stringapiset/nf-stringapiset-multibytetowidechar
+    /// </summary>
+    bool ToFullPath(const std::string& nameRef, const std::wstring& folderPathRef, std::wstring& fullPathRef)
+    {
+        if (nameRef.empty())
+        {
+            return false;
+        }
+
+        UINT codePage = CP_UTF8;
+        int wideLength = MultiByteToWideChar(codePage, MB_ERR_INVALID_CHARS, nameRef.data(), static_cast<int>(nameRef.size()), nullptr, 0);
+        if (wideLength <= 0)
+        {
+            codePage = CP_ACP;
+            wideLength = MultiByteToWideChar(codePage, 0, nameRef.data(), static_cast<int>(nameRef.size()), nullptr, 0);
+            if (wideLength <= 0)
+            {
+                return false;
+            }
+        }
+
+        std::wstring name(static_cast<size_t>(wideLength), L'\0');
+        MultiByteToWideChar(codePage, (codePage == CP_UTF8) ? MB_ERR_INVALID_CHARS : 0, nameRef.data(), static_cast<int>(nameRef.size()), &name[0], wideLength);
+
+        // A manifest written on another System may use '/' as the separator.
+        std::replace(name.begin(), name.end(), L'/', L'\\');
+        while (name.compare(0, 2, L".\\") == 0)
+        {
+            name.erase(0, 2);
+        }
+
+        bool isAbsolutePath = (name.size() >= 2 && name[1] == L':') || name.compare(0, 2, L"\\\\") == 0;
+        fullPathRef = isAbsolutePath ? name : folderPathRef + name;
+        return true;
+    }
+
+    /// <summary>
+    /// Purpose: Parses a line of a .sfv manifest: "name CRC32" (the name may contain spaces, so the checksum follows the last space).
+    /// </summary>
+    bool ParseSfvLine(const std::string& lineRef, std::string& nameRef, unsigned char* digestPtr)
+    {
+        size_t separator = lineRef.find_last_of(" \t");
+        if (separator == std::string::npos || lineRef[0] == ';')
+        {
+            return false;
+        }
+
+        size_t nameEnd = lineRef.find_last_not_of(" \t", separator);
+        if (nameEnd == std::string::npos)
+        {
+            return false;
+        }
+
+        nameRef = lineRef.substr(0, nameEnd + 1);
+        return ParseHexDigest(lineRef.substr(separator + 1), digestPtr, 4);
+    }
+
+    /// <summary>
+    /// Purpose: Parses a line of a .md5 or .xxh64 manifest, in either the GNU form "checksum *name" (or "checksum  name"), or the BSD form "ALGORITHM (name) = checksum".
+    /// </summary>
+    bool ParseDigestLine(const std::string& lineRef, size_t digestSize, std::string& nameRef, unsigned char* digestPtr)
+    {
+        if (lineRef[0] == '#' || lineRef[0] == ';')
+        {
+            return false;
+        }
+
+        size_t nameStart = lineRef.find(" (");
+        size_t nameEnd = lineRef.rfind(") = ");
+        if (nameStart != std::string::npos && nameEnd != std::string::npos && nameEnd > nameStart)
+        {
+            nameRef = lineRef.substr(nameStart + 2, nameEnd - nameStart - 2);
+            return ParseHexDigest(lineRef.substr(nameEnd + 4), digestPtr, digestSize);
+        }
+
+        size_t digestEnd = lineRef.find_first_of(" \t");
+        if (digestEnd == std::string::npos || !ParseHexDigest(lineRef.substr(0, digestEnd), digestPtr, digestSize))
+        {
+            return false;
+        }
+
+        // Skip the separator, and the '*' (binary mode) or ' ' (text mode) flag.
+        nameStart = lineRef.find_first_not_of(" \t", digestEnd);
+        if (nameStart != std::string::npos && lineRef[nameStart] == '*')
+        {
+            ++nameStart;
+        }
+
+        if (nameStart == std::string::npos || nameStart >= lineRef.size())
+        {
+            return false;
+        }
+
+        nameRef = lineRef.substr(nameStart);
+        return true;
+    }
+
+    /// <summary>
+    /// Purpose: Parses a line of a .ffp manifest (as written by "metaflac --show-md5sum --with-filename"): "name:signature".
+    /// </summary>
+    bool ParseFfpLine(const std::string& lineRef, std::string& nameRef, unsigned char* digestPtr)
+    {
+        size_t separator = lineRef.rfind(':');
+        if (separator == std::string::npos || separator == 0 || lineRef[0] == ';' || lineRef[0] == '#')
+        {
+            return false;
+        }
+
+        nameRef = lineRef.substr(0, separator);
+        return ParseHexDigest(lineRef.substr(separator + 1), digestPtr, 16);
+    }
+}
+
+bool SidecarManifest::IsManifestType(const wchar_t* filenamePtr)
+{
+    std::wstring filename(filenamePtr);
+    return SidecarManifestSupport::EndsWithExtension(filename, L".md5") || SidecarManifestSupport::EndsWithExtension(filename, L".sfv") ||
+        SidecarManifestSupport::EndsWithExtension(filename, L".ffp") || SidecarManifestSupport::EndsWithExtension(filename, L".xxh64");
+}
+
+bool SidecarManifest::AddManifest(const wchar_t* manifestFilenamePtr)
+{
+    std::wstring manifestFilename(manifestFilenamePtr);
+    {
+        std::lock_guard<std::mutex> lock(SidecarManifestSupport::g_manifestMutex);
+        if (!SidecarManifestSupport::g_manifestFilenames.insert(SidecarManifestSupport::ToKey(manifestFilename)).second)
+        {
+            return true; // The manifest was already added (e.g. its Folder was added twice).
+        }
+    }
+
+    FileHashAlgorithm algorithm = FileHashAlgorithm::MD5;
+    size_t digestSize = 16;
+    if (SidecarManifestSupport::EndsWithExtension(manifestFilename, L".sfv"))
+    {
+        algorithm = FileHashAlgorithm::CRC32;
+        digestSize = 4;
+    }
+    else if (SidecarManifestSupport::EndsWithExtension(manifestFilename, L".xxh64"))
+    {
+        algorithm = FileHashAlgorithm::XXH64;
+        digestSize = 8;
+    }
+    else if (SidecarManifestSupport::EndsWithExtension(manifestFilename, L".ffp"))
+    {
+        algorithm = FileHashAlgorithm::FLAC_SIGNATURE;
+    }
+
+    FILE* fileStreamPtr = nullptr;
+    if (_wfopen_s(&fileStreamPtr, manifestFilenamePtr, L"rb") != 0 || fileStreamPtr == nullptr)
+    {
+        return false;
+    }
+
+    long long fileLength = _filelengthi64(_fileno(fileStreamPtr));
+    if (fileLength < 0LL || fileLength > SidecarManifestSupport::MAXIMUM_MANIFEST_SIZE)
+    {
+        fclose(fileStreamPtr);
+        return false;
+    }
+
+    std::string text(static_cast<size_t>(fileLength), '\0');
+    size_t bytesRead = fread(&text[0], 1, text.size(), fileStreamPtr);
+    fclose(fileStreamPtr);
+    text.resize(bytesRead);
+
+    // The filenames in a manifest are relative to the Folder of the manifest.
+    size_t lastSeparator = manifestFilename.find_last_of(L"\\/");
+    std::wstring folderPath = (lastSeparator == std::wstring::npos) ? std::wstring() : manifestFilename.substr(0, lastSeparator + 1);
+
+    std::vector<std::pair<std::wstring, SidecarManifestSupport::ManifestEntry>> entries{};
+
+    // Skip the UTF-8 Byte Order Mark.
+    size_t lineStart = (text.compare(0, 3, "\xEF\xBB\xBF") == 0) ? 3 : 0;
+    while (lineStart < text.size())
+    {
+        size_t lineEnd = text.find('\n', lineStart);
+        if (lineEnd == std::string::npos)
+        {
+            lineEnd = text.size();
+        }
+
+        // Trim the surrounding white space (including the '\r' of a Windows line ending).
+        size_t first = lineStart;
+        size_t last = lineEnd;
+        while (first < last && isspace(static_cast<unsigned char>(text[first])))
+        {
+            ++first;
+        }
+
+        while (last > first && isspace(static_cast<unsigned char>(text[last - 1])))
+        {
+            --last;
+        }
+
+        if (last > first)
+        {
+            std::string line = text.substr(first, last - first);
+            std::string name{};
+            SidecarManifestSupport::ManifestEntry entry{};
+
+            bool lineIsValid = false;
+            switch (algorithm)
+            {
+                case FileHashAlgorithm::CRC32:
+                    lineIsValid = SidecarManifestSupport::ParseSfvLine(line, name, entry.expectedDigest);
+                    break;
+                case FileHashAlgorithm::FLAC_SIGNATURE:
+                    lineIsValid = SidecarManifestSupport::ParseFfpLine(line, name, entry.expectedDigest);
+                    break;
+                default:
+                    lineIsValid = SidecarManifestSupport::ParseDigestLine(line, digestSize, name, entry.expectedDigest);
+                    break;
+            }
+
+            if (lineIsValid && SidecarManifestSupport::ToFullPath(name, folderPath, entry.result.filename))
+            {
+                entry.result.manifestFilename = manifestFilename;
+                entry.result.algorithm = algorithm;
+                entries.emplace_back(SidecarManifestSupport::ToKey(entry.result.filename), std::move(entry));
+            }
+        }
+
+        lineStart = lineEnd + 1;
+    }
+
+    std::lock_guard<std::mutex> lock(SidecarManifestSupport::g_manifestMutex);
+    for (auto& entryRef : entries)
+    {
+        SidecarManifestSupport::g_entries.insert(std::move(entryRef));
+    }
+
+    return true;
+}
+
+unsigned int SidecarManifest::GetPendingAlgorithmMask(const wchar_t* filenamePtr)
+{
+    std::wstring key = SidecarManifestSupport::ToKey(filenamePtr);
+    unsigned int algorithmMask = 0U;
+
+    std::lock_guard<std::mutex> lock(SidecarManifestSupport::g_manifestMutex);
+    if (SidecarManifestSupport::g_entries.empty())
+    {
+        return 0U;
+    }
+
+    auto entryRange = SidecarManifestSupport::g_entries.equal_range(key);
+    for (auto entryIterator = entryRange.first; entryIterator != entryRange.second; ++entryIterator)
+    {
+        if (entryIterator->second.result.verdict == SidecarVerdict::NOT_VERIFIED)
+        {
+            algorithmMask |= FileHasher::GetAlgorithmMask(entryIterator->second.result.algorithm);
+        }
+    }
+
+    return algorithmMask;
+}
+
+void SidecarManifest::RecordDigests(const wchar_t* filenamePtr, const FileDigests& digestsRef)
+{
+    std::wstring key = SidecarManifestSupport::ToKey(filenamePtr);
+
+    std::lock_guard<std::mutex> lock(SidecarManifestSupport::g_manifestMutex);
+    auto entryRange = SidecarManifestSupport::g_entries.equal_range(key);
+    for (auto entryIterator = entryRange.first; entryIterator != entryRange.second; ++entryIterator)
+    {
+        SidecarManifestSupport::ManifestEntry& entryRef = entryIterator->second;
+
+        const unsigned char* actualDigestPtr = nullptr;
+        size_t digestSize = 0;
+        switch (entryRef.result.algorithm)
+        {
+            case FileHashAlgorithm::MD5:
+                actualDigestPtr = digestsRef.md5;
+                digestSize = sizeof(digestsRef.md5);
+                break;
+            case FileHashAlgorithm::CRC32:
+                actualDigestPtr = digestsRef.crc32;
+                digestSize = sizeof(digestsRef.crc32);
+                break;
+            case FileHashAlgorithm::XXH64:
+                actualDigestPtr = digestsRef.xxh64;
+                digestSize = sizeof(digestsRef.xxh64);
+                break;
+            case FileHashAlgorithm::FLAC_SIGNATURE:
+                // A File without a STREAMINFO Block is left to the Decoder, which reports it.
+                if (!digestsRef.flacSignatureIsKnown)
+                {
+                    continue;
+                }
+
+                actualDigestPtr = digestsRef.flacSignature;
+                digestSize = sizeof(digestsRef.flacSignature);
+                break;
+        }
+
+        entryRef.result.verdict = (memcmp(entryRef.expectedDigest, actualDigestPtr, digestSize) == 0) ? SidecarVerdict::MATCH : SidecarVerdict::MISMATCH;
+    }
+}
+
+std::vector<SidecarEntryResult> SidecarManifest::GetResults()
+{
+    std::vector<SidecarEntryResult> results{};
+
+    std::lock_guard<std::mutex> lock(SidecarManifestSupport::g_manifestMutex);
+    results.reserve(SidecarManifestSupport::g_entries.size());
+    for (const auto& entryRef : SidecarManifestSupport::g_entries)
+    {
+        results.push_back(entryRef.second.result);
+    }
+
+    return results;
+}
+
+void SidecarManifest::Clear()
+{
+    std::lock_guard<std::mutex> lock(SidecarManifestSupport::g_manifestMutex);
+    SidecarManifestSupport::g_entries.clear();
+    SidecarManifestSupport::g_manifestFilenames.clear();
+}
@@ -0,0 +1,396 @@
+#include "SparseLoadProbe.h"
+#include <cstring>
+
+namespace SparseLoadProbeSupport
+{
+    constexpr auto ID3V2_HEADER_SIZE = 10ULL;
+    constexpr auto ID3V2_FOOTER_SIZE = 10ULL;
+    constexpr auto FLAC_METADATA_BLOCK_HEADER_SIZE = 4ULL;
+    constexpr auto APE_TAG_FOOTER_SIZE = 32ULL;
+    constexpr auto ID3V1_TAG_SIZE = 128ULL;
+
+    /// <summary>
+    /// Purpose: The FLAC Metadata Blocks that are read by the FLAC Decoder. The other Metadata Blocks are skipped by libFLAC, unless a Client asks for them.
+    /// </summary>
+    constexpr unsigned char FLAC_STREAMINFO_BLOCK_TYPE = 0;
+    constexpr unsigned char FLAC_SEEKTABLE_BLOCK_TYPE = 3;
+    constexpr unsigned char FLAC_INVALID_BLOCK_TYPE = 127;
+
+    /// <summary>
+    /// Purpose: Limits the number of headers read from a damaged File, whose lengths would otherwise lead the probe through the whole File a few bytes at a time.
+    /// </summary>
+    constexpr auto MAX_FLAC_METADATA_BLOCK_COUNT = 1024UL;
+    constexpr auto MAX_ID3V2_FRAME_COUNT = 4096UL;
+
+    constexpr auto MAX_APE_TAG_ITEM_KEY_SIZE = 256UL;
+    constexpr unsigned long APE_TAG_FLAG_CONTAINS_HEADER_MASK = (1UL << 31);
+
+    bool ReadAt(FILE* fileStreamPtr, unsigned long long offset, void* bufferPtr, size_t size)
+    {
+        return (_fseeki64(fileStreamPtr, static_cast<long long>(offset), SEEK_SET) == 0) && (fread(bufferPtr, sizeof(char), size, fileStreamPtr) == size);
+    }
+
+    unsigned long ReadBigEndian(const unsigned char* bytesPtr, size_t byteCount)
+    {
+        unsigned long value = 0UL;
+        for (size_t index = 0; index < byteCount; ++index)
+        {
+            value = (value << 8) | bytesPtr[index];
+        }
+
+        return value;
+    }
+
+    unsigned long ReadLittleEndian32(const unsigned char* bytesPtr)
+    {
+        return static_cast<unsigned long>(bytesPtr[0]) | (static_cast<unsigned long>(bytesPtr[1]) << 8)
+            | (static_cast<unsigned long>(bytesPtr[2]) << 16) | (static_cast<unsigned long>(bytesPtr[3]) << 24);
+    }
+
+    /// <summary>
+    /// Purpose: Reads a 28-bit ID3v2 synchsafe integer (i.e. 7 bits per byte).
+    /// </summary>
+    unsigned long ReadSynchsafe32(const unsigned char* bytesPtr)
+    {
+        return (static_cast<unsigned long>(bytesPtr[0]) << 21) | (static_cast<unsigned long>(bytesPtr[1]) << 14)
+            | (static_cast<unsigned long>(bytesPtr[2]) << 7) | static_cast<unsigned long>(bytesPtr[3]);
+    }
+
+    void AddRange(std::vector<SparseLoadRange>& rangesRef, unsigned long long offset, unsigned long long length, unsigned long long minimumRangeLength)
+    {
+        if (length > 0ULL && length >= minimumRangeLength)
+        {
+            rangesRef.push_back(SparseLoadRange{ offset, length });
+        }
+    }
+
+    /// <summary>
+    /// Purpose: Walks the Frame headers of an ID3v2 Tag, seeking over each Frame body.
+    /// </summary>
+    /// <returns>TRUE if the Frames fill the Tag exactly, or are followed by padding. Otherwise, FALSE.</returns>
+    bool ValidateID3v2Framing(FILE* fileStreamPtr, unsigned char majorVersion, unsigned char flags, unsigned long long tagBodyEnd)
+    {
+        // An unsynchronised Tag can NOT be walked without reading all of it, since the Frame bodies may hold inserted bytes.
+        if ((flags & 0x80) && majorVersion < 4)
+        {
+            return false;
+        }
+
+        unsigned long long position = ID3V2_HEADER_SIZE;
+        unsigned char bytes[10]{};
+
+        // Skip the Extended Header. Its size excludes itself in ID3v2.3, and includes itself in ID3v2.4.
+        if ((flags & 0x40) && majorVersion >= 3)
+        {
+            if (!ReadAt(fileStreamPtr, position, bytes, 4))
+            {
+                return false;
+            }
+
+            position += (majorVersion == 3) ? (4ULL + ReadBigEndian(bytes, 4)) : ReadSynchsafe32(bytes);
+        }
+
+        // An ID3v2.2 Frame header has a 3 character ID and a 24-bit size. Later versions have a 4 character ID and a 32-bit size.
+        const unsigned long long frameHeaderSize = (majorVersion == 2) ? 6ULL : 10ULL;
+        const size_t frameIdSize = (majorVersion == 2) ? 3 : 4;
+
+        for (unsigned long frameCount = 0UL; frameCount < MAX_ID3V2_FRAME_COUNT; ++frameCount)
+        {
+            if (position + frameHeaderSize > tagBodyEnd)
+            {
+                // Too few bytes remain for another Frame, so they can only be padding.
+                return position <= tagBodyEnd;
+            }
+
+            if (!ReadAt(fileStreamPtr, position, bytes, static_cast<size_t>(frameHeaderSize)))
+            {
+                return false;
+            }
+
+            if (bytes[0] == 0)
+            {
+                // The padding after the last Frame.
+                return true;
+            }
+
+            for (size_t index = 0; index < frameIdSize; ++index)
+            {
+                bool isIdCharacter = (bytes[index] >= 'A' && bytes[index] <= 'Z') || (bytes[index] >= '0' && bytes[index] <= '9');
+                if (!isIdCharacter)
+                {
+                    return false;
+                }
+            }
+
+            unsigned long frameSize = 0UL;
+            if (majorVersion == 2)
+            {
+                frameSize = ReadBigEndian(bytes + 3, 3);
+            }
+            else if (majorVersion == 3)
+            {
+                frameSize = ReadBigEndian(bytes + 4, 4);
+            }
+            else
+            {
+                frameSize = ReadSynchsafe32(bytes + 4);
+            }
+
+            position += frameHeaderSize + frameSize;
+            if (position > tagBodyEnd)
+            {
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    /// <summary>
+    /// Purpose: Finds the body of an ID3v2 Tag at the start of the File. Uses the same header checks as the MP3 Decoder, which skips the whole Tag.
+    /// </summary>
+    /// <returns>The length of the Tag, including its header and footer. Otherwise, 0 if the File does NOT start with an ID3v2 Tag.</returns>
+    unsigned long long ProbeID3v2Tag(FILE* fileStreamPtr, unsigned long long fileLength, unsigned long long minimumRangeLength, bool framingValidationIsEnabled,
+        std::vector<SparseLoadRange>& rangesRef)
+    {
+        unsigned char header[10]{};
+        if (!ReadAt(fileStreamPtr, 0ULL, header, sizeof(header)) || header[0] != 'I' || header[1] != 'D' || header[2] != '3')
+        {
+            return 0ULL;
+        }
+
+        if (header[3] == 0xff || header[4] == 0xff || header[6] >= 0x80 || header[7] >= 0x80 || header[8] >= 0x80 || header[9] >= 0x80)
+        {
+            return 0ULL;
+        }
+
+        unsigned long long tagBodyEnd = ID3V2_HEADER_SIZE + ReadSynchsafe32(header + 6);
+        unsigned long long tagLength = tagBodyEnd + (((header[3] == 4) && (header[5] & 0x10)) ? ID3V2_FOOTER_SIZE : 0ULL);
+        if (tagLength > fileLength)
+        {
+            return 0ULL;
+        }
+
+        if (!framingValidationIsEnabled || ValidateID3v2Framing(fileStreamPtr, header[3], header[5], tagBodyEnd))
+        {
+            AddRange(rangesRef, ID3V2_HEADER_SIZE, tagBodyEnd - ID3V2_HEADER_SIZE, minimumRangeLength);
+        }
+
+        return tagLength;
+    }
+
+    /// <summary>
+    /// Purpose: Finds the bodies of the FLAC Metadata Blocks skipped by libFLAC. The Block headers are kept, since libFLAC reads each of them.
+    /// </summary>
+    void ProbeFlacMetadata(FILE* fileStreamPtr, unsigned long long streamOffset, unsigned long long fileLength, unsigned long long minimumRangeLength,
+        bool framingValidationIsEnabled, std::vector<SparseLoadRange>& rangesRef)
+    {
+        // The ranges are only kept when the whole Metadata chain is found.
+        std::vector<SparseLoadRange> blockRanges{};
+        unsigned long long position = streamOffset + 4ULL; // Skip the "fLaC" marker.
+        bool isLastBlock = false;
+
+        for (unsigned long blockCount = 0UL; blockCount < MAX_FLAC_METADATA_BLOCK_COUNT && !isLastBlock; ++blockCount)
+        {
+            unsigned char header[4]{};
+            if (!ReadAt(fileStreamPtr, position, header, sizeof(header)))
+            {
+                return;
+            }
+
+            isLastBlock = (header[0] & 0x80) != 0;
+            unsigned char blockType = header[0] & 0x7F;
+            unsigned long long blockLength = ReadBigEndian(header + 1, 3);
+            unsigned long long blockBodyOffset = position + FLAC_METADATA_BLOCK_HEADER_SIZE;
+
+            if (blockType == FLAC_INVALID_BLOCK_TYPE || blockBodyOffset + blockLength > fileLength)
+            {
+                return;
+            }
+
+            if (blockType != FLAC_STREAMINFO_BLOCK_TYPE && blockType != FLAC_SEEKTABLE_BLOCK_TYPE)
+            {
+                AddRange(blockRanges, blockBodyOffset, blockLength, minimumRangeLength);
+            }
+
+            position = blockBodyOffset + blockLength;
+        }
+
+        if (!isLastBlock)
+        {
+            return;
+        }
+
+        if (framingValidationIsEnabled)
+        {
+            // The last Metadata Block must be followed by the Sync Code of the first Frame (0xFFF8 or 0xFFF9).
+            unsigned char syncCode[2]{};
+            if (!ReadAt(fileStreamPtr, position, syncCode, sizeof(syncCode)) || syncCode[0] != 0xFF || (syncCode[1] & 0xFE) != 0xF8)
+            {
+                return;
+            }
+        }
+
+        rangesRef.insert(rangesRef.end(), blockRanges.begin(), blockRanges.end());
+    }
+
+    /// <summary>
+    /// Purpose: Walks the item headers of an APEv2 Tag, seeking over each item value.
+    /// </summary>
+    /// <returns>TRUE if the items fill the Tag exactly. Otherwise, FALSE.</returns>
+    bool ValidateApeTagFraming(FILE* fileStreamPtr, unsigned long long itemsOffset, unsigned long long itemsEnd, unsigned long itemCount)
+    {
+        unsigned long long position = itemsOffset;
+        for (unsigned long itemIndex = 0UL; itemIndex < itemCount; ++itemIndex)
+        {
+            // Each item is a 32-bit value size, 32-bit flags, a NULL terminated ASCII key, and the value.
+            unsigned char itemHeader[8]{};
+            if (position + sizeof(itemHeader) > itemsEnd || !ReadAt(fileStreamPtr, position, itemHeader, sizeof(itemHeader)))
+            {
+                return false;
+            }
+
+            position += sizeof(itemHeader);
+
+            unsigned long long keyBufferSize = itemsEnd - position;
+            if (keyBufferSize > MAX_APE_TAG_ITEM_KEY_SIZE)
+            {
+                keyBufferSize = MAX_APE_TAG_ITEM_KEY_SIZE;
+            }
+
+            unsigned char key[MAX_APE_TAG_ITEM_KEY_SIZE]{};
+            if (keyBufferSize == 0ULL || !ReadAt(fileStreamPtr, position, key, static_cast<size_t>(keyBufferSize)))
+            {
+                return false;
+            }
+
+            const void* terminatorPtr = memchr(key, 0, static_cast<size_t>(keyBufferSize));
+            if (terminatorPtr == nullptr)
+            {
+                return false;
+            }
+
+            size_t keyLength = static_cast<const unsigned char*>(terminatorPtr) - key;
+            for (size_t index = 0; index < keyLength; ++index)
+            {
+                if (key[index] < 0x20 || key[index] > 0x7E)
+                {
+                    return false;
+                }
+            }
+
+            position += keyLength + 1 + ReadLittleEndian32(itemHeader);
+            if (keyLength < 2 || position > itemsEnd)
+            {
+                return false;
+            }
+        }
+
+        return position == itemsEnd;
+    }
+
+    /// <summary>
+    /// Purpose: Finds the items of an APEv2 Tag at the end of the File, before an optional ID3v1 Tag. The Tag header and footer are kept, since the MP3 Decoder reads them.
+    /// </summary>
+    void ProbeApeTag(FILE* fileStreamPtr, unsigned long long fileLength, unsigned long long minimumRangeLength, bool framingValidationIsEnabled,
+        std::vector<SparseLoadRange>& rangesRef)
+    {
+        unsigned long long tagEnd = fileLength;
+
+        char id3v1Id[3]{};
+        if (fileLength >= ID3V1_TAG_SIZE && ReadAt(fileStreamPtr, fileLength - ID3V1_TAG_SIZE, id3v1Id, sizeof(id3v1Id)) && strncmp(id3v1Id, "TAG", 3) == 0)
+        {
+            tagEnd -= ID3V1_TAG_SIZE;
+        }
+
+        // The footer holds the "APETAGEX" ID, the version, the size of the items and the footer, the item count, and the flags.
+        unsigned char footer[32]{};
+        if (tagEnd < APE_TAG_FOOTER_SIZE || !ReadAt(fileStreamPtr, tagEnd - APE_TAG_FOOTER_SIZE, footer, sizeof(footer)) || memcmp(footer, "APETAGEX", 8) != 0)
+        {
+            return;
+        }
+
+        unsigned long long tagSize = ReadLittleEndian32(footer + 12);
+        unsigned long itemCount = ReadLittleEndian32(footer + 16);
+        unsigned long flags = ReadLittleEndian32(footer + 20);
+        if (tagSize < APE_TAG_FOOTER_SIZE || tagSize > tagEnd)
+        {
+            return;
+        }
+
+        unsigned long long itemsOffset = tagEnd - tagSize;
+        unsigned long long itemsEnd = tagEnd - APE_TAG_FOOTER_SIZE;
+
+        if (framingValidationIsEnabled)
+        {
+            if (flags & APE_TAG_FLAG_CONTAINS_HEADER_MASK)
+            {
+                char headerId[8]{};
+                if (itemsOffset < APE_TAG_FOOTER_SIZE || !ReadAt(fileStreamPtr, itemsOffset - APE_TAG_FOOTER_SIZE, headerId, sizeof(headerId))
+                    || memcmp(headerId, "APETAGEX", 8) != 0)
+                {
+                    return;
+                }
+            }
+
+            if (!ValidateApeTagFraming(fileStreamPtr, itemsOffset, itemsEnd, itemCount))
+            {
+                return;
+            }
+        }
+
+        AddRange(rangesRef, itemsOffset, itemsEnd - itemsOffset, minimumRangeLength);
+    }
+}
+
+#pragma region SparseLoadProbe_Functions_Region
+
+bool SparseLoadProbe::FindSkippedRanges(FILE* fileStreamPtr, unsigned long long fileLength, unsigned long long minimumRangeLength, bool framingValidationIsEnabled,
+    std::vector<SparseLoadRange>& skippedRangesRef)
+{
+    skippedRangesRef.clear();
+    if (fileStreamPtr == nullptr)
+    {
+        return false;
+    }
+
+    unsigned long long streamOffset = SparseLoadProbeSupport::ProbeID3v2Tag(fileStreamPtr, fileLength, minimumRangeLength, framingValidationIsEnabled, skippedRangesRef);
+
+    // The marker of the Stream that follows the ID3v2 Tag (if any) decides which containers the Decoder skips.
+    char marker[4]{};
+    if (!SparseLoadProbeSupport::ReadAt(fileStreamPtr, streamOffset, marker, sizeof(marker)))
+    {
+        skippedRangesRef.clear();
+        return false;
+    }
+
+    if (memcmp(marker, "OggS", 4) == 0 || memcmp(marker, "wvpk", 4) == 0)
+    {
+        // The Ogg-Vorbis and WavPack Decoders read their tags, so the File is loaded completely.
+        skippedRangesRef.clear();
+        return false;
+    }
+
+    if (memcmp(marker, "fLaC", 4) == 0)
+    {
+        SparseLoadProbeSupport::ProbeFlacMetadata(fileStreamPtr, streamOffset, fileLength, minimumRangeLength, framingValidationIsEnabled, skippedRangesRef);
+    }
+    else
+    {
+        SparseLoadProbeSupport::ProbeApeTag(fileStreamPtr, fileLength, minimumRangeLength, framingValidationIsEnabled, skippedRangesRef);
+    }
+
+    // The containers of a damaged File can overlap (e.g. an APEv2 Tag size that reaches into the ID3v2 Tag). Then the File is loaded completely.
+    for (size_t index = 1; index < skippedRangesRef.size(); ++index)
+    {
+        if (skippedRangesRef[index].offset < skippedRangesRef[index - 1].offset + skippedRangesRef[index - 1].length)
+        {
+            skippedRangesRef.clear();
+            break;
+        }
+    }
+
+    return !skippedRangesRef.empty();
+}
+
+#pragma endregion SparseLoadProbe_Functions_Region
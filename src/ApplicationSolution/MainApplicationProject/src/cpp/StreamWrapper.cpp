@@ -1,10 +1,88 @@
 #include "StreamWrapper.h"
+#include "DecoderTuning.h"
+#include "SidecarManifest.h"
 #include <windows.h>
+#include <fcntl.h>
+#include <malloc.h>
+#include <atomic>
+#include <map>
+#include <mutex>
 
-/// <summary>
-/// Purpose: The maximum Block Size for NTFS and ReFS (64k).
-/// </summary>
-constexpr auto BLOCK_SIZE = 65536;
+namespace StreamWrapperSupport
+{
+    /// <summary>
+    /// Purpose: The alignment of the Buffer address, File offset, and size of each read without the Cache. A multiple of the sector size of every common Disk (512 bytes and 4k).
+    /// </summary>
+    constexpr auto UNBUFFERED_ALIGNMENT = 4096UL;
+
+    /// <summary>
+    /// Purpose: The aligned Buffers are allocated in multiples of this size (1 MB), so a Buffer can be reused by the next File of a similar size.
+    /// </summary>
+    constexpr auto POOLED_BUFFER_GRANULARITY = 1048576UL;
+
+    /// <summary>
+    /// Purpose: The limits of the Buffer Pool. A Buffer released while the Pool is full is freed.
+    /// </summary>
+    constexpr auto MAX_POOLED_BUFFER_COUNT = 16UL;
+    constexpr auto MAX_POOLED_BUFFER_BYTES = 536870912ULL;
+
+    std::atomic<StreamCachePolicy> g_cachePolicy{ StreamCachePolicy::DEFAULT };
+    std::atomic<unsigned long long> g_totalBytesRead{ 0ULL };
+    std::atomic<unsigned long long> g_totalBytesSkipped{ 0ULL };
+
+    std::atomic<bool> g_sparseLoadingIsEnabled{ false };
+    std::atomic<unsigned long long> g_sparseLoadingMinimumRangeLength{ 0ULL };
+    std::atomic<bool> g_sparseLoadingFramingValidationIsEnabled{ false };
+
+    /// <summary>
+    /// Purpose: The free aligned Buffers, by capacity.
+    /// </summary>
+    std::mutex g_bufferPoolMutex{};
+    std::multimap<size_t, unsigned char*> g_bufferPool{};
+    unsigned long long g_pooledByteCount{ 0ULL };
+
+    size_t RoundUp(size_t size, size_t alignment)
+    {
+        return ((size + alignment - 1) / alignment) * alignment;
+    }
+
+    unsigned char* AcquireAlignedBuffer(size_t size, size_t& capacityRef)
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_bufferPoolMutex);
+            std::multimap<size_t, unsigned char*>::iterator iterator = g_bufferPool.lower_bound(size);
+            if (iterator != g_bufferPool.end())
+            {
+                unsigned char* bufferPtr = iterator->second;
+                capacityRef = iterator->first;
+                g_pooledByteCount -= iterator->first;
+                g_bufferPool.erase(iterator);
+                return bufferPtr;
+            }
+        }
+
+        // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/aligned-malloc
+        size_t capacity = RoundUp(size, POOLED_BUFFER_GRANULARITY);
+        unsigned char* bufferPtr = static_cast<unsigned char*>(_aligned_malloc(capacity, UNBUFFERED_ALIGNMENT));
+        capacityRef = (bufferPtr != nullptr) ? capacity : 0;
+        return bufferPtr;
+    }
+
+    void ReleaseAlignedBuffer(unsigned char* bufferPtr, size_t capacity)
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_bufferPoolMutex);
+            if (g_bufferPool.size() < MAX_POOLED_BUFFER_COUNT && g_pooledByteCount + capacity <= MAX_POOLED_BUFFER_BYTES)
+            {
+                g_bufferPool.emplace(capacity, bufferPtr);
+                g_pooledByteCount += capacity;
+                return;
+            }
+        }
+
+        _aligned_free(bufferPtr);
+    }
+}
 
 /// <summary>
 /// Purpose: No-arg Constructor.
@@ -27,10 +105,41 @@ bool StreamWrapper::Open(const wchar_t* filenamePtr, bool useMemoryBufferEnabled
     this->m_isMemoryBufferEnabled = useMemoryBufferEnabled;
     bool fileWasOpenedFlag = false;
 
+    // Reading without the Cache requires the aligned reads of the Memory Buffer.
+    StreamCachePolicy cachePolicy = StreamWrapper::GetCachePolicy();
+    if (cachePolicy == StreamCachePolicy::NO_BUFFERING && !useMemoryBufferEnabled)
+    {
+        cachePolicy = StreamCachePolicy::SEQUENTIAL_SCAN;
+    }
+
+    this->m_cachePolicy = cachePolicy;
+
+    // A File within an Archive is read from the Archive, without extracting it.
+    std::wstring archiveFilename{};
+    std::wstring memberName{};
+    if (ArchiveReader::SplitMemberPath(filenamePtr, archiveFilename, memberName))
+    {
+        return this->OpenArchiveMember(archiveFilename, memberName, useMemoryBufferEnabled);
+    }
+
+    // A File on a web server is read with range requests, without downloading it first.
+    if (RemoteStreamSource::IsRemotePath(filenamePtr))
+    {
+        return this->OpenRemoteStream(filenamePtr, useMemoryBufferEnabled);
+    }
+
     if (useMemoryBufferEnabled)
     {
         // Open the File using the Memory Buffer.
         fileWasOpenedFlag = this->OpenFileWithMemoryBuffer(filenamePtr, true);
+
+        if (cachePolicy == StreamCachePolicy::NO_BUFFERING && !this->m_isOpen)
+        {
+            // The Volume rejected the aligned reads (e.g. a network share, or a Disk with a larger sector size). Read the File through the Cache instead.
+            this->m_isMemoryBufferEnabled = true;
+            this->m_cachePolicy = StreamCachePolicy::SEQUENTIAL_SCAN;
+            fileWasOpenedFlag = this->OpenFileWithMemoryBuffer(filenamePtr, true);
+        }
     }
     else
     {
@@ -53,11 +162,8 @@ void StreamWrapper::Close()
         this->m_fileObjectStreamPtr = nullptr;
     }
 
-    if (this->m_fileMemoryBufferPtr != nullptr)
-    {
-        delete[] this->m_fileMemoryBufferPtr;
-        this->m_fileMemoryBufferPtr = nullptr;
-    }
+    this->ReleaseMemoryBuffer();
+    this->m_streamSourcePtr.reset(); // Unmaps an Archive, after the Memory Buffer that may point into it.
 
     if (this->m_fileModeBufferPtr != nullptr)
     {
@@ -71,6 +177,12 @@ void StreamWrapper::Close()
     this->m_isEOF = false;
     this->m_isOpen = false; // Mark the File Stream as Closed.
     this->m_isMemoryBufferEnabled = false;
+    this->m_cachePolicy = StreamCachePolicy::DEFAULT;
+    this->m_residentExtents.clear();
+
+    // A File that was NOT read to the end is NOT verified.
+    this->m_fileHasherPtr.reset();
+    this->m_hashedFilename.clear();
 }
 
 size_t StreamWrapper::Read(void* bufferPtr, size_t size)
@@ -92,9 +204,7 @@ size_t StreamWrapper::Read(void* bufferPtr, size_t size)
         if (size > 0)
         {
             // Copy the data to the memory buffer location from the file buffer.
-
-            const void* srcFileBuffferPtr = this->m_fileMemoryBufferPtr + this->m_fileMemoryBufferPosition;
-            memcpy(bufferPtr, srcFileBuffferPtr, size); // URI: https://cplusplus.com/reference/cstring/memcpy/
+            this->CopyMemoryBuffer(bufferPtr, this->m_fileMemoryBufferPosition, size);
 
             // Update the file buffer position by adding the size of data read.
             this->m_fileMemoryBufferPosition += size;
@@ -103,11 +213,25 @@ size_t StreamWrapper::Read(void* bufferPtr, size_t size)
         // Return the number of Bytes read.
         return size;
     }
+    else if (this->m_streamSourcePtr != nullptr)
+    {
+        // Inflate the Archive member, or fetch the ranges of the remote File, on demand.
+        return this->m_streamSourcePtr->Read(bufferPtr, size);
+    }
     else
     {
         // Use C-Style File I/O Library to Read.
         // Read data from the file stream using the fread() function and return the number of Bytes read.
-        return fread(bufferPtr, sizeof(char), size, this->m_fileObjectStreamPtr);
+        long long position = (this->m_fileHasherPtr != nullptr) ? _ftelli64(this->m_fileObjectStreamPtr) : 0LL;
+        size_t bytesRead = fread(bufferPtr, sizeof(char), size, this->m_fileObjectStreamPtr);
+        StreamWrapperSupport::g_totalBytesRead += bytesRead;
+
+        if (this->m_fileHasherPtr != nullptr && position >= 0LL)
+        {
+            this->HashFileBytes(static_cast<unsigned long long>(position), static_cast<const unsigned char*>(bufferPtr), bytesRead);
+        }
+
+        return bytesRead;
     }
 }
 
@@ -164,6 +288,10 @@ int StreamWrapper::Seek(long long offset, int origin)
                 return -1;
         }
     }
+    else if (this->m_streamSourcePtr != nullptr)
+    {
+        return this->m_streamSourcePtr->Seek(offset, origin);
+    }
     else
     {
         // Use C-Style File I/O Library to Seek.
@@ -179,6 +307,10 @@ long long StreamWrapper::Tell()
     {
         return this->m_fileMemoryBufferPosition;
     }
+    else if (this->m_streamSourcePtr != nullptr)
+    {
+        return this->m_streamSourcePtr->Tell();
+    }
     else
     {
         // Use C-Style File I/O Library to tell.
@@ -194,6 +326,10 @@ long long StreamWrapper::Length()
     {
         return this->m_fileMemoryBufferSize;
     }
+    else if (this->m_streamSourcePtr != nullptr)
+    {
+        return this->m_streamSourcePtr->Length();
+    }
     else
     {
         // Use C-Style File I/O Library to determine File Length.
@@ -201,9 +337,49 @@ long long StreamWrapper::Length()
     }
 }
 
+size_t StreamWrapper::ReadTail(void* bufferPtr, size_t size)
+{
+    long long length = this->Length();
+    if (length <= 0LL)
+    {
+        return 0;
+    }
+
+    size_t tailSize = (static_cast<unsigned long long>(length) < size) ? static_cast<size_t>(length) : size;
+
+    if (this->m_fileMemoryBufferPtr != nullptr && this->m_isMemoryBufferEnabled)
+    {
+        // Copy the tail directly from the File Buffer. The File Buffer Position is NOT used.
+        this->CopyMemoryBuffer(bufferPtr, this->m_fileMemoryBufferSize - tailSize, tailSize);
+        return tailSize;
+    }
+
+    // Read the tail, and then restore the File Position Indicator. Seeking also clears the EOF indicator set by reading the tail.
+    long long position = this->Tell();
+    if (position < 0LL)
+    {
+        return 0;
+    }
+
+    size_t readSize = 0;
+    if (this->Seek(-static_cast<long long>(tailSize), SEEK_END) == 0)
+    {
+        readSize = this->Read(bufferPtr, tailSize);
+    }
+
+    this->Seek(position, SEEK_SET);
+    return readSize;
+}
+
 bool StreamWrapper::EndOfFile()
 {
     if (this->isOpen()) {
+        if (this->m_fileObjectStreamPtr == nullptr)
+        {
+            // A File within an Archive, or on a web server, has NO File Stream.
+            return (this->m_fileMemoryBufferPtr == nullptr && this->m_streamSourcePtr != nullptr) ? this->m_streamSourcePtr->EndOfFile() : this->m_isEOF;
+        }
+
         if (feof(this->m_fileObjectStreamPtr) != 0)
         {
             return true;
@@ -224,15 +400,422 @@ bool StreamWrapper::isOpen() const
     return this->m_isOpen;
 }
 
-bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool readFixedSizeBlocksEnabled)
+const unsigned char* StreamWrapper::GetMemoryBufferPtr() const
 {
-    // Open the File Stream. (Using security enhanced function)
-    // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fopen-s-wfopen-s
+    return (this->m_isMemoryBufferEnabled && this->m_residentExtents.empty()) ? this->m_fileMemoryBufferPtr : nullptr;
+}
 
-    bool fileWasOpenedFlag = false;
-    errno_t errorCode = _wfopen_s(&this->m_fileObjectStreamPtr, filenamePtr, L"rb"); // Open the File for reading in binary mode.
+size_t StreamWrapper::GetMemoryBufferSize() const
+{
+    return (this->m_isMemoryBufferEnabled && this->m_fileMemoryBufferPtr != nullptr && this->m_residentExtents.empty()) ? this->m_fileMemoryBufferSize : 0;
+}
+
+const unsigned char* StreamWrapper::GetResidentDataPtr(long long offset, size_t& residentSizeRef) const
+{
+    if (!this->m_isMemoryBufferEnabled || this->m_fileMemoryBufferPtr == nullptr || offset < 0LL || static_cast<unsigned long long>(offset) > this->m_fileMemoryBufferSize)
+    {
+        return nullptr;
+    }
+
+    size_t position = static_cast<size_t>(offset);
+    if (this->m_residentExtents.empty())
+    {
+        residentSizeRef = this->m_fileMemoryBufferSize - position;
+        return this->m_fileMemoryBufferPtr + position;
+    }
+
+    for (const ResidentExtent& extentRef : this->m_residentExtents)
+    {
+        // The end of the last Extent is also accepted, so the end of the File can be reached.
+        if (position >= extentRef.fileOffset && position <= extentRef.fileOffset + extentRef.length)
+        {
+            residentSizeRef = extentRef.fileOffset + extentRef.length - position;
+            return this->m_fileMemoryBufferPtr + extentRef.bufferOffset + (position - extentRef.fileOffset);
+        }
+    }
+
+    return nullptr;
+}
+
+StreamCachePolicy StreamWrapper::GetFileCachePolicy() const
+{
+    return this->m_cachePolicy;
+}
+
+void StreamWrapper::SetCachePolicy(StreamCachePolicy cachePolicy)
+{
+    StreamWrapperSupport::g_cachePolicy = cachePolicy;
+}
+
+StreamCachePolicy StreamWrapper::GetCachePolicy()
+{
+    return StreamWrapperSupport::g_cachePolicy;
+}
+
+const wchar_t* StreamWrapper::GetCachePolicyName(StreamCachePolicy cachePolicy)
+{
+    switch (cachePolicy)
+    {
+        case StreamCachePolicy::SEQUENTIAL_SCAN:
+            return L"SEQUENTIAL_SCAN";
+        case StreamCachePolicy::NO_BUFFERING:
+            return L"NO_BUFFERING";
+        default:
+            return L"DEFAULT";
+    }
+}
+
+unsigned long long StreamWrapper::GetTotalBytesRead()
+{
+    return StreamWrapperSupport::g_totalBytesRead;
+}
+
+void StreamWrapper::SetSparseLoading(bool sparseLoadingIsEnabled, unsigned long long minimumRangeLength, bool framingValidationIsEnabled)
+{
+    StreamWrapperSupport::g_sparseLoadingMinimumRangeLength = minimumRangeLength;
+    StreamWrapperSupport::g_sparseLoadingFramingValidationIsEnabled = framingValidationIsEnabled;
+    StreamWrapperSupport::g_sparseLoadingIsEnabled = sparseLoadingIsEnabled;
+}
+
+unsigned long long StreamWrapper::GetTotalBytesSkipped()
+{
+    return StreamWrapperSupport::g_totalBytesSkipped;
+}
+
+void StreamWrapper::ResetTotalBytesRead()
+{
+    StreamWrapperSupport::g_totalBytesRead = 0ULL;
+    StreamWrapperSupport::g_totalBytesSkipped = 0ULL;
+}
+
+bool StreamWrapper::OpenFileStream(const wchar_t* filenamePtr)
+{
+    if (this->m_cachePolicy == StreamCachePolicy::DEFAULT)
+    {
+        // Open the File Stream. (Using security enhanced function)
+        // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fopen-s-wfopen-s
+        errno_t errorCode = _wfopen_s(&this->m_fileObjectStreamPtr, filenamePtr, L"rb"); // Open the File for reading in binary mode.
+        return (errorCode == 0 && this->m_fileObjectStreamPtr != nullptr);
+    }
+
+    // The File flags can NOT be set by _wfopen_s(), so the File is opened by CreateFile(), and its Handle is wrapped in a File Stream.
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    DWORD flagsAndAttributes = FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN;
+    if (this->m_cachePolicy == StreamCachePolicy::NO_BUFFERING)
+    {
+        flagsAndAttributes |= FILE_FLAG_NO_BUFFERING;
+    }
+
+    HANDLE hFile = CreateFile(filenamePtr, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, flagsAndAttributes, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    // The File Descriptor takes ownership of the Handle, and the File Stream takes ownership of the File Descriptor, so fclose() closes all of them.
+    // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/open-osfhandle
+    // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fdopen-wfdopen
+    int fileDescriptor = _open_osfhandle(reinterpret_cast<intptr_t>(hFile), _O_RDONLY | _O_BINARY);
+    if (fileDescriptor == -1)
+    {
+        CloseHandle(hFile);
+        return false;
+    }
+
+    this->m_fileObjectStreamPtr = _fdopen(fileDescriptor, "rb");
+    if (this->m_fileObjectStreamPtr == nullptr)
+    {
+        _close(fileDescriptor);
+        return false;
+    }
+
+    return true;
+}
+
+bool StreamWrapper::ReadUnbufferedMemoryBuffer(size_t fileLengthBytes)
+{
+    // Every read must start at an aligned File offset, into an aligned Buffer, for a whole number of sectors.
+    // URI: https://learn.microsoft.com/en-us/windows/win32/fileio/file-buffering
+    const size_t alignment = StreamWrapperSupport::UNBUFFERED_ALIGNMENT;
+    const size_t blockSize = StreamWrapperSupport::RoundUp(DecoderTuning::GetProfile().streamReadBlockSize, alignment);
+
+    this->m_fileMemoryBufferPtr = StreamWrapperSupport::AcquireAlignedBuffer(StreamWrapperSupport::RoundUp(fileLengthBytes, alignment), this->m_fileMemoryBufferCapacity);
+    if (this->m_fileMemoryBufferPtr == nullptr)
+    {
+        return false;
+    }
+
+    // The reads bypass the File Stream, which would split them into unaligned reads.
+    HANDLE hFile = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(this->m_fileObjectStreamPtr)));
+    unsigned char* readBufferPtr = this->m_fileMemoryBufferPtr;
+
+    while (fileLengthBytes > 0)
+    {
+        // The last read is rounded up to a whole sector. ReadFile() stops at the end of the File.
+        size_t requestSize = (fileLengthBytes < blockSize) ? StreamWrapperSupport::RoundUp(fileLengthBytes, alignment) : blockSize;
+
+        // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-readfile
+        DWORD bytesRead = 0;
+        if (!ReadFile(hFile, readBufferPtr, static_cast<DWORD>(requestSize), &bytesRead, NULL) || bytesRead == 0)
+        {
+            return false;
+        }
+
+        size_t bytesUsed = (bytesRead < fileLengthBytes) ? bytesRead : fileLengthBytes;
+        this->HashFileBytes(static_cast<unsigned long long>(readBufferPtr - this->m_fileMemoryBufferPtr), readBufferPtr, bytesUsed);
+        readBufferPtr += bytesUsed;
+        fileLengthBytes -= bytesUsed;
+
+        // A short read before the end of the File would leave the next read unaligned.
+        if (bytesRead < requestSize && fileLengthBytes > 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void StreamWrapper::BeginFileHash(const wchar_t* filenamePtr, unsigned long long fileLength)
+{
+    this->m_fileHasherPtr.reset();
+    this->m_hashedLength = 0ULL;
+    this->m_hashFileLength = fileLength;
+
+    unsigned int algorithmMask = SidecarManifest::GetPendingAlgorithmMask(filenamePtr);
+    if (algorithmMask == 0U)
+    {
+        return;
+    }
+
+    this->m_fileHasherPtr = std::make_unique<FileHasher>(algorithmMask);
+    this->m_hashedFilename = filenamePtr;
+
+    if (fileLength == 0ULL)
+    {
+        // An empty File is complete before it is read.
+        this->HashFileBytes(0ULL, nullptr, 0);
+    }
+}
+
+void StreamWrapper::HashFileBytes(unsigned long long offset, const unsigned char* dataPtr, size_t size)
+{
+    if (this->m_fileHasherPtr == nullptr || offset > this->m_hashedLength)
+    {
+        return; // NOT hashed, or the bytes are after a gap (e.g. the Decoder read the tail of the File first).
+    }
+
+    // Skip the bytes that were already hashed (e.g. the Decoder seeked back to re-read a header).
+    unsigned long long alreadyHashedSize = this->m_hashedLength - offset;
+    if (alreadyHashedSize < size)
+    {
+        this->m_fileHasherPtr->Update(dataPtr + alreadyHashedSize, size - static_cast<size_t>(alreadyHashedSize));
+        this->m_hashedLength = offset + size;
+    }
+
+    if (this->m_hashedLength >= this->m_hashFileLength)
+    {
+        SidecarManifest::RecordDigests(this->m_hashedFilename.c_str(), this->m_fileHasherPtr->Finish());
+        this->m_fileHasherPtr.reset();
+    }
+}
+
+bool StreamWrapper::ReadSparseMemoryBuffer(size_t fileLengthBytes, const std::vector<SparseLoadRange>& skippedRangesRef)
+{
+    // The resident Extents are the gaps between the skipped ranges.
+    size_t fileOffset = 0;
+    size_t bufferOffset = 0;
+    for (const SparseLoadRange& rangeRef : skippedRangesRef)
+    {
+        if (rangeRef.offset > fileOffset)
+        {
+            size_t length = static_cast<size_t>(rangeRef.offset) - fileOffset;
+            this->m_residentExtents.push_back(ResidentExtent{ fileOffset, length, bufferOffset });
+            bufferOffset += length;
+        }
 
-    if (errorCode == 0 && this->m_fileObjectStreamPtr != nullptr)
+        fileOffset = static_cast<size_t>(rangeRef.offset + rangeRef.length);
+    }
+
+    if (fileOffset < fileLengthBytes)
+    {
+        this->m_residentExtents.push_back(ResidentExtent{ fileOffset, fileLengthBytes - fileOffset, bufferOffset });
+        bufferOffset += fileLengthBytes - fileOffset;
+    }
+
+    // Create a new memory buffer of bytes on the Heap, equal in size to the number of resident bytes.
+    this->m_fileMemoryBufferPtr = new unsigned char[(bufferOffset > 0) ? bufferOffset : 1]{};
+
+    // Read each Extent using fixed-size Blocks, seeking over the skipped ranges.
+    const size_t blockSize = DecoderTuning::GetProfile().streamReadBlockSize;
+    for (const ResidentExtent& extentRef : this->m_residentExtents)
+    {
+        if (_fseeki64(this->m_fileObjectStreamPtr, static_cast<long long>(extentRef.fileOffset), SEEK_SET) != 0)
+        {
+            return false;
+        }
+
+        unsigned char* readBufferPtr = this->m_fileMemoryBufferPtr + extentRef.bufferOffset;
+        size_t bytesRemaining = extentRef.length;
+        while (bytesRemaining > 0)
+        {
+            size_t elementCount = (bytesRemaining < blockSize) ? bytesRemaining : blockSize;
+
+            // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fread-s
+            if (fread_s(readBufferPtr, bytesRemaining, sizeof(char), elementCount, this->m_fileObjectStreamPtr) != elementCount)
+            {
+                return false;
+            }
+
+            readBufferPtr += elementCount;
+            bytesRemaining -= elementCount;
+        }
+    }
+
+    return true;
+}
+
+void StreamWrapper::CopyMemoryBuffer(void* destinationPtr, size_t position, size_t size) const
+{
+    if (this->m_residentExtents.empty())
+    {
+        // URI: https://cplusplus.com/reference/cstring/memcpy/
+        memcpy(destinationPtr, this->m_fileMemoryBufferPtr + position, size);
+        return;
+    }
+
+    unsigned char* destinationBytePtr = static_cast<unsigned char*>(destinationPtr);
+    size_t extentIndex = 0;
+    while (size > 0)
+    {
+        // Find the first Extent that ends after the position. The Extents are in increasing order of File offset.
+        while (extentIndex < this->m_residentExtents.size() && this->m_residentExtents[extentIndex].fileOffset + this->m_residentExtents[extentIndex].length <= position)
+        {
+            ++extentIndex;
+        }
+
+        size_t copySize = size;
+        if (extentIndex < this->m_residentExtents.size() && position >= this->m_residentExtents[extentIndex].fileOffset)
+        {
+            // The position is resident.
+            const ResidentExtent& extentRef = this->m_residentExtents[extentIndex];
+            size_t residentSize = extentRef.fileOffset + extentRef.length - position;
+            copySize = (size < residentSize) ? size : residentSize;
+            memcpy(destinationBytePtr, this->m_fileMemoryBufferPtr + extentRef.bufferOffset + (position - extentRef.fileOffset), copySize);
+        }
+        else
+        {
+            // The position is within a skipped range, which ends at the next Extent (or the end of the File).
+            if (extentIndex < this->m_residentExtents.size())
+            {
+                size_t skippedSize = this->m_residentExtents[extentIndex].fileOffset - position;
+                copySize = (size < skippedSize) ? size : skippedSize;
+            }
+
+            memset(destinationBytePtr, 0, copySize);
+        }
+
+        destinationBytePtr += copySize;
+        position += copySize;
+        size -= copySize;
+    }
+}
+
+void StreamWrapper::ReleaseMemoryBuffer()
+{
+    // A mapped Memory Buffer belongs to the Archive member, which unmaps it.
+    if (this->m_fileMemoryBufferPtr != nullptr && !this->m_isMemoryBufferMapped)
+    {
+        if (this->m_fileMemoryBufferCapacity > 0)
+        {
+            StreamWrapperSupport::ReleaseAlignedBuffer(this->m_fileMemoryBufferPtr, this->m_fileMemoryBufferCapacity);
+        }
+        else
+        {
+            delete[] this->m_fileMemoryBufferPtr;
+        }
+    }
+
+    this->m_fileMemoryBufferPtr = nullptr;
+    this->m_fileMemoryBufferCapacity = 0;
+    this->m_isMemoryBufferMapped = false;
+}
+
+bool StreamWrapper::OpenArchiveMember(const std::wstring& archiveFilenameRef, const std::wstring& memberNameRef, bool useMemoryBufferEnabled)
+{
+    ArchiveMember member{};
+    if (!ArchiveReader::FindMember(archiveFilenameRef.c_str(), memberNameRef, member))
+    {
+        return false;
+    }
+
+    std::unique_ptr<ArchiveMemberSource> archiveMemberSourcePtr = std::make_unique<ArchiveMemberSource>();
+    if (!archiveMemberSourcePtr->Open(archiveFilenameRef.c_str(), member, this->m_cachePolicy != StreamCachePolicy::DEFAULT))
+    {
+        return false;
+    }
+
+    if (archiveMemberSourcePtr->IsStored())
+    {
+        // The member is used in place, so its pages are read from the Archive as the Decoder reaches them.
+        this->m_fileMemoryBufferPtr = const_cast<unsigned char*>(archiveMemberSourcePtr->GetStoredDataPtr());
+        this->m_fileMemoryBufferSize = static_cast<size_t>(member.uncompressedSize);
+        this->m_isMemoryBufferMapped = true;
+        this->m_isMemoryBufferEnabled = true;
+    }
+    else if (useMemoryBufferEnabled)
+    {
+        // Create a new memory buffer of bytes on the Heap, equal in size to the inflated member.
+        this->m_fileMemoryBufferPtr = new unsigned char[static_cast<size_t>(member.uncompressedSize)];
+        this->m_fileMemoryBufferSize = static_cast<size_t>(member.uncompressedSize);
+        if (!archiveMemberSourcePtr->InflateAll(this->m_fileMemoryBufferPtr))
+        {
+            this->Close();
+            return false;
+        }
+    }
+
+    this->m_streamSourcePtr = std::move(archiveMemberSourcePtr);
+    this->m_isOpen = true; // Mark the File Stream as Open.
+    StreamWrapperSupport::g_totalBytesRead += member.compressedSize;
+    return true;
+}
+
+bool StreamWrapper::OpenRemoteStream(const wchar_t* urlPtr, bool useMemoryBufferEnabled)
+{
+    std::unique_ptr<RemoteStreamSource> remoteStreamSourcePtr = std::make_unique<RemoteStreamSource>();
+    if (!remoteStreamSourcePtr->Open(urlPtr))
+    {
+        return false;
+    }
+
+    size_t fileLengthBytes = static_cast<size_t>(remoteStreamSourcePtr->Length());
+    if (useMemoryBufferEnabled)
+    {
+        // Create a new memory buffer of bytes on the Heap, equal in size to the remote File, and fetch every range into it.
+        this->m_fileMemoryBufferPtr = new unsigned char[fileLengthBytes];
+        this->m_fileMemoryBufferSize = fileLengthBytes;
+        if (!remoteStreamSourcePtr->ReadAll(this->m_fileMemoryBufferPtr))
+        {
+            this->Close();
+            return false;
+        }
+    }
+    else
+    {
+        this->m_streamSourcePtr = std::move(remoteStreamSourcePtr);
+    }
+
+    this->m_isOpen = true; // Mark the File Stream as Open.
+    StreamWrapperSupport::g_totalBytesRead += fileLengthBytes;
+    return true;
+}
+
+bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool readFixedSizeBlocksEnabled)
+{
+    // Open the File Stream, with the File flags of the Cache Policy.
+    bool fileWasOpenedFlag = false;
+    if (this->OpenFileStream(filenamePtr))
     {
         this->m_isOpen = true;  // Mark the File Stream as Open.
 
@@ -247,6 +830,9 @@ bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool re
         // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/filelength-filelengthi64
         size_t fileLengthBytes = _filelength(fileDescriptor); // Initialize the loop control variable.
 
+        // Hash the File for its sidecar manifests, as each Block is read.
+        this->BeginFileHash(filenamePtr, fileLengthBytes);
+
         if (fileLengthBytes > 0)
         {
             this->m_fileMemoryBufferSize = fileLengthBytes;
@@ -254,14 +840,29 @@ bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool re
 
                 // Free any existing memory pointed to by the Memory Buffer.
                 if (this->m_fileMemoryBufferPtr != nullptr) {
-                    delete[] this->m_fileMemoryBufferPtr;
-                    this->m_fileMemoryBufferPtr = nullptr;
+                    this->ReleaseMemoryBuffer();
                     this->m_fileMemoryBufferPosition = 0;
                     this->m_isEOF = false;
                 }
 
-                // Create a new memory buffer of bytes on the Heap, equal in size to the number of bytes in the File.
-                this->m_fileMemoryBufferPtr = new unsigned char[this->m_fileMemoryBufferSize]{};
+                // Without the Cache, the Memory Buffer must be aligned, so it is taken from the Buffer Pool when the File is read.
+                bool unbufferedReadEnabled = (this->m_cachePolicy == StreamCachePolicy::NO_BUFFERING);
+
+                // Probe the metadata containers of the File, so the bytes NO Decoder reads are NOT loaded. The probe reads through the File Stream, so the File is rewound afterwards.
+                std::vector<SparseLoadRange> skippedRanges{};
+                bool sparseReadEnabled = false;
+                if (!unbufferedReadEnabled && StreamWrapperSupport::g_sparseLoadingIsEnabled && this->m_fileHasherPtr == nullptr)
+                {
+                    sparseReadEnabled = SparseLoadProbe::FindSkippedRanges(this->m_fileObjectStreamPtr, fileLengthBytes,
+                        StreamWrapperSupport::g_sparseLoadingMinimumRangeLength, StreamWrapperSupport::g_sparseLoadingFramingValidationIsEnabled, skippedRanges);
+                    _fseeki64(this->m_fileObjectStreamPtr, 0LL, SEEK_SET);
+                }
+
+                if (!unbufferedReadEnabled && !sparseReadEnabled)
+                {
+                    // Create a new memory buffer of bytes on the Heap, equal in size to the number of bytes in the File.
+                    this->m_fileMemoryBufferPtr = new unsigned char[this->m_fileMemoryBufferSize]{};
+                }
 
                 // Initialize the buffer pointer used for reading the File, at the start of the Memory Buffer.
                 unsigned char* readBufferPtr = this->m_fileMemoryBufferPtr; // Pointer to a block of Memory with a size of at least (elementSize * elementCount) bytes.
@@ -273,14 +874,26 @@ bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool re
                 size_t elementSize = sizeof(char); // Representing 1-byte (Size in bytes, of each element to be read.)
                 size_t elementCount = 0; // Number of elements, each one with a size of elementSize bytes.
                 
-                if (readFixedSizeBlocksEnabled)
+                if (unbufferedReadEnabled)
+                {
+                    // Read using sector-aligned Blocks, directly from the Disk.
+                    readErrorFlagEnabled = !this->ReadUnbufferedMemoryBuffer(fileLengthBytes);
+                }
+                else if (sparseReadEnabled)
+                {
+                    // Read the resident Extents only.
+                    readErrorFlagEnabled = !this->ReadSparseMemoryBuffer(fileLengthBytes, skippedRanges);
+                }
+                else if (readFixedSizeBlocksEnabled)
                 {
                     // Read a fixed-size Block at a time using multiple calls to the fread_s() function.
+                    // The Block Size is read from the Decoder tuning profile (64k, unless tuned for this machine).
+                    const size_t blockSize = DecoderTuning::GetProfile().streamReadBlockSize;
 
                     while (fileLengthBytes > 0)
                     {
                         // Set the maximum number of bytes to be read for this iteration.
-                        elementCount = (fileLengthBytes < BLOCK_SIZE) ? fileLengthBytes : BLOCK_SIZE;
+                        elementCount = (fileLengthBytes < blockSize) ? fileLengthBytes : blockSize;
 
                         // Returns the total number of elements successfully read from the file.
                         // If this number differs from the count parameter, either a reading error occurred or the EOF was reached while reading.
@@ -292,6 +905,7 @@ bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool re
 
                         if (fileBytesRead == elementCount)
                         {
+                            this->HashFileBytes(static_cast<unsigned long long>(readBufferPtr - this->m_fileMemoryBufferPtr), readBufferPtr, elementCount);
                             readBufferPtr += elementCount; // Increment the read buffer pointer forward by the size of the last read length of file bytes.
                             fileLengthBytes -= elementCount; // Decrement the loop control variable.
                         }
@@ -327,7 +941,11 @@ bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool re
                     // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fread-s
                     fileBytesRead = fread_s(readBufferPtr, bufferSize, elementSize, elementCount, this->m_fileObjectStreamPtr);
 
-                    if (fileBytesRead != elementCount)
+                    if (fileBytesRead == elementCount)
+                    {
+                        this->HashFileBytes(0ULL, readBufferPtr, elementCount);
+                    }
+                    else
                     {
                         // Either EOF was reached while reading the file, or an error occurred.
                         if (feof(this->m_fileObjectStreamPtr) != 0)
@@ -347,6 +965,17 @@ bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool re
                 if (readEndOfFileFlagEnabled || readErrorFlagEnabled) {
                     this->Close();
                 }
+                else
+                {
+                    unsigned long long skippedByteCount = 0ULL;
+                    for (const SparseLoadRange& rangeRef : skippedRanges)
+                    {
+                        skippedByteCount += rangeRef.length;
+                    }
+
+                    StreamWrapperSupport::g_totalBytesRead += this->m_fileMemoryBufferSize - skippedByteCount;
+                    StreamWrapperSupport::g_totalBytesSkipped += skippedByteCount;
+                }
             }
             catch (std::exception& e) {
                 this->Close();
@@ -370,14 +999,17 @@ bool StreamWrapper::OpenFileWithMemoryBuffer(const wchar_t* filenamePtr, bool re
 
 bool StreamWrapper::OpenFileMode(const wchar_t* filenamePtr, int mode)
 {
-    // Open the File Stream. (Using security enhanced function)
-    // URI: https://learn.microsoft.com/en-us/cpp/c-runtime-library/reference/fopen-s-wfopen-s
-
+    // Open the File Stream, with the File flags of the Cache Policy.
     bool fileWasOpenedFlag = false;
-    errno_t errorCode = _wfopen_s(&this->m_fileObjectStreamPtr, filenamePtr, L"rb"); // Open the File for reading in binary mode.
-
-    if (errorCode == 0 && this->m_fileObjectStreamPtr != nullptr)
+    if (this->OpenFileStream(filenamePtr))
     {
+        // Hash the File for its sidecar manifests, as the Decoder reads it.
+        long long fileLength = _filelengthi64(_fileno(this->m_fileObjectStreamPtr));
+        if (fileLength >= 0LL)
+        {
+            this->BeginFileHash(filenamePtr, static_cast<unsigned long long>(fileLength));
+        }
+
         if (mode == _IOFBF)
         {
             // Set the File Stream to be buffered. (Full Buffering)
@@ -0,0 +1,602 @@
+#include "VolumeAdmission.h"
+#include "ArchiveReader.h"
+#include "RemoteStreamSource.h"
+#include <cwchar>
+#include <cwctype>
+
+namespace VolumeAdmissionSupport
+{
+    constexpr const wchar_t* STORAGE_CLASS_NAMES[] = { L"UNKNOWN", L"ROTATIONAL", L"SOLID_STATE", L"NETWORK" };
+    constexpr auto STORAGE_CLASS_COUNT = sizeof(STORAGE_CLASS_NAMES) / sizeof(STORAGE_CLASS_NAMES[0]);
+
+    /// <summary>
+    /// Purpose: The number of Files read from a Volume before its latency is measured, and the class of an UNKNOWN Volume is learned from it.
+    /// </summary>
+    constexpr auto LEARNING_FILE_COUNT = 8UL;
+
+    /// <summary>
+    /// Purpose: The latency (i.e. the part of the read time that does NOT depend on the File Size) above which a Volume is classed as ROTATIONAL.
+    /// A seek and a half rotation of a 7200 RPM Disk take about 12 ms, while Solid State storage answers in well under 1 ms.
+    /// </summary>
+    constexpr auto ROTATIONAL_LATENCY_THRESHOLD_SECONDS = 0.004;
+
+    /// <summary>
+    /// Purpose: The number of Files read in each order, before the order is switched, when the physical order and the order the Files were found are compared.
+    /// </summary>
+    constexpr auto ORDER_COMPARISON_FILE_COUNT = 32UL;
+
+    constexpr auto MAX_REPORT_LINE_SIZE = 256;
+
+    std::wstring ToUpper(const std::wstring& text)
+    {
+        std::wstring upperText{};
+        for (wchar_t character : text)
+        {
+            upperText += static_cast<wchar_t>(towupper(character));
+        }
+
+        return upperText;
+    }
+
+    /// <summary>
+    /// Purpose: Normalizes a Volume root, so the configured roots and the found roots can be compared.
+    /// </summary>
+    std::wstring ToVolumeRootKey(const std::wstring& volumeRoot)
+    {
+        std::wstring volumeRootKey = ToUpper(volumeRoot);
+        if (volumeRootKey.empty() || volumeRootKey.back() != L'\\')
+        {
+            volumeRootKey += L'\\';
+        }
+
+        return volumeRootKey;
+    }
+
+    unsigned long long GetClusterDistance(unsigned long long firstCluster, unsigned long long secondCluster)
+    {
+        return (firstCluster > secondCluster) ? (firstCluster - secondCluster) : (secondCluster - firstCluster);
+    }
+
+    /// <summary>
+    /// Purpose: Gets the Folder of a File, by which its Volume is cached. The Files of a web server share the origin of their URLs.
+    /// </summary>
+    std::wstring GetFolderKey(const wchar_t* filenamePtr)
+    {
+        std::wstring origin{};
+        if (RemoteStreamSource::GetOrigin(filenamePtr, origin))
+        {
+            return origin;
+        }
+
+        const wchar_t* lastSeparatorPtr = wcsrchr(filenamePtr, L'\\');
+        return (lastSeparatorPtr != nullptr) ? std::wstring(filenamePtr, lastSeparatorPtr) : std::wstring{};
+    }
+}
+
+VolumeAdmission::VolumeAdmission()
+{
+
+}
+
+VolumeAdmission::~VolumeAdmission()
+{
+
+}
+
+#pragma region Public_Member_Functions_Region
+
+void VolumeAdmission::Configure(const VolumeAdmissionLimits& limitsRef, const wchar_t* storageClassOverridesPtr)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    this->m_limits = limitsRef;
+    this->m_storageClassOverrideMap.clear();
+
+    // Parse the "ROOT=CLASS" entries, separated by ';'. An entry with an unknown class is ignored.
+    std::wstring overrides = (storageClassOverridesPtr != nullptr) ? storageClassOverridesPtr : L"";
+    size_t entryStart = 0;
+    while (entryStart < overrides.size())
+    {
+        size_t entryEnd = overrides.find(L';', entryStart);
+        if (entryEnd == std::wstring::npos)
+        {
+            entryEnd = overrides.size();
+        }
+
+        std::wstring entry = overrides.substr(entryStart, entryEnd - entryStart);
+        size_t separatorPosition = entry.rfind(L'=');
+        if (separatorPosition != std::wstring::npos && separatorPosition > 0)
+        {
+            std::wstring className = VolumeAdmissionSupport::ToUpper(entry.substr(separatorPosition + 1));
+            for (size_t classIndex = 1; classIndex < VolumeAdmissionSupport::STORAGE_CLASS_COUNT; ++classIndex)
+            {
+                if (className == VolumeAdmissionSupport::STORAGE_CLASS_NAMES[classIndex])
+                {
+                    this->m_storageClassOverrideMap[VolumeAdmissionSupport::ToVolumeRootKey(entry.substr(0, separatorPosition))] = static_cast<StorageClass>(classIndex);
+                }
+            }
+        }
+
+        entryStart = entryEnd + 1;
+    }
+}
+
+void VolumeAdmission::SetExtentOrderingEnabled(bool extentOrderingIsEnabled, bool comparisonIsEnabled)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_extentOrderingIsEnabled = extentOrderingIsEnabled;
+    this->m_comparisonIsEnabled = extentOrderingIsEnabled && comparisonIsEnabled;
+}
+
+void VolumeAdmission::AddFile(const wchar_t* filenamePtr)
+{
+    // The Volume is found while the Files are found, so FindAdmissibleFile() only looks it up.
+    size_t volumeIndex = this->FindVolume(filenamePtr);
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        if (!this->m_extentOrderingIsEnabled)
+        {
+            return;
+        }
+
+        // Only the Files of a Disk reported (or configured) as rotational are ordered, since Solid State storage and network shares do NOT seek.
+        // The location of a File on a Volume NOT yet classed is NOT read, since reading it opens the File (i.e. a File System call for every File of the scan).
+        // The File is kept, and located if the Volume is learned to be ROTATIONAL.
+        Volume& volumeRef = this->m_volumes[volumeIndex];
+        if (volumeRef.storageClass == StorageClass::UNKNOWN)
+        {
+            volumeRef.unlocatedFilenames.push_back(filenamePtr);
+            this->m_unlocatedFileSet.insert(filenamePtr);
+            return;
+        }
+
+        if (volumeRef.storageClass != StorageClass::ROTATIONAL)
+        {
+            return;
+        }
+
+        this->m_unlocatedFileSet.insert(filenamePtr);
+    }
+
+    this->LocateFiles(volumeIndex, std::vector<std::wstring>{ filenamePtr });
+}
+
+void VolumeAdmission::ClearFiles()
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_fileStartingClusterMap.clear();
+    this->m_unlocatedFileSet.clear();
+    for (Volume& volumeRef : this->m_volumes)
+    {
+        volumeRef.unlocatedFilenames.clear();
+    }
+}
+
+VolumeAdmissionTicket VolumeAdmission::Admit(const wchar_t* filenamePtr)
+{
+    VolumeAdmissionTicket ticket{};
+    ticket.volumeIndex = this->FindVolume(filenamePtr);
+    {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+
+        // The Volume is found by index, since the Vector can grow while the Thread waits.
+        this->m_admissionCondition.wait(lock, [this, &ticket]() { return this->m_volumes[ticket.volumeIndex].activeCount < this->m_volumes[ticket.volumeIndex].admissionLimit; });
+        ++this->m_volumes[ticket.volumeIndex].activeCount;
+        ticket.isExtentOrdered = this->m_volumes[ticket.volumeIndex].isExtentOrderedPeriod;
+    }
+
+    // The File Size is read after the admission, since reading the File System of a busy Volume also competes for the Disk.
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getfileattributesexw
+    // A member of an Archive reads its compressed size from the Archive.
+    WIN32_FILE_ATTRIBUTE_DATA fileAttributeData{};
+    std::wstring archiveFilename{};
+    std::wstring memberName{};
+    ArchiveMember member{};
+    if (ArchiveReader::SplitMemberPath(filenamePtr, archiveFilename, memberName))
+    {
+        if (ArchiveReader::FindMember(archiveFilename.c_str(), memberName, member))
+        {
+            ticket.byteCount = member.compressedSize;
+        }
+    }
+    else if (GetFileAttributesEx(filenamePtr, GetFileExInfoStandard, &fileAttributeData))
+    {
+        ticket.byteCount = (static_cast<unsigned long long>(fileAttributeData.nFileSizeHigh) << 32ULL) | fileAttributeData.nFileSizeLow;
+    }
+
+    ticket.admittedTime = std::chrono::steady_clock::now();
+    return ticket;
+}
+
+void VolumeAdmission::Release(const VolumeAdmissionTicket& ticketRef)
+{
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - ticketRef.admittedTime).count();
+    std::vector<std::wstring> unlocatedFilenames{};
+    bool volumeIsRotational = false;
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        Volume& volumeRef = this->m_volumes[ticketRef.volumeIndex];
+        --volumeRef.activeCount;
+
+        double byteCount = static_cast<double>(ticketRef.byteCount);
+        ++volumeRef.fileCount;
+        volumeRef.byteSum += byteCount;
+        volumeRef.secondsSum += seconds;
+        volumeRef.byteSquaredSum += byteCount * byteCount;
+        volumeRef.byteSecondsProductSum += byteCount * seconds;
+
+        size_t orderIndex = ticketRef.isExtentOrdered ? 1 : 0;
+        volumeRef.orderByteSum[orderIndex] += byteCount;
+        volumeRef.orderSecondsSum[orderIndex] += seconds;
+
+        if (volumeRef.fileCount >= VolumeAdmissionSupport::LEARNING_FILE_COUNT)
+        {
+            this->UpdateLatency(volumeRef);
+        }
+
+        // The Files found while the Volume was NOT yet classed are taken once its class is learned.
+        if (volumeRef.storageClassIsLearned && !volumeRef.unlocatedFilenames.empty())
+        {
+            unlocatedFilenames.swap(volumeRef.unlocatedFilenames);
+            volumeIsRotational = volumeRef.storageClass == StorageClass::ROTATIONAL;
+            if (!volumeIsRotational)
+            {
+                for (const std::wstring& filenameRef : unlocatedFilenames)
+                {
+                    this->m_unlocatedFileSet.erase(filenameRef);
+                }
+            }
+        }
+    }
+
+    // The admission limit can also have been raised, so every waiting Thread checks its Volume again.
+    this->m_admissionCondition.notify_all();
+
+    // The Files found before the Volume was learned to be ROTATIONAL are located now, so the pending Files are read in the physical order.
+    if (volumeIsRotational)
+    {
+        this->LocateFiles(ticketRef.volumeIndex, unlocatedFilenames);
+    }
+}
+
+std::list<std::wstring>::iterator VolumeAdmission::FindAdmissibleFile(std::list<std::wstring>& filenameListRef, size_t lookaheadCount)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    std::list<std::wstring>::iterator chosenIterator = filenameListRef.begin();
+    size_t fileIndex = 0;
+    for (std::list<std::wstring>::iterator iterator = filenameListRef.begin(); iterator != filenameListRef.end() && fileIndex < lookaheadCount; ++iterator, ++fileIndex)
+    {
+        // The Volume of a File is NOT known when the File was NOT added (i.e. its Volume is found by Admit()), so the File is chosen.
+        size_t volumeIndex = 0;
+        if (!this->FindKnownVolume(iterator->c_str(), volumeIndex))
+        {
+            chosenIterator = iterator;
+            break;
+        }
+
+        const Volume& volumeRef = this->m_volumes[volumeIndex];
+        if (volumeRef.activeCount < volumeRef.admissionLimit)
+        {
+            chosenIterator = iterator;
+            if (this->m_extentOrderingIsEnabled && volumeRef.storageClass == StorageClass::ROTATIONAL)
+            {
+                chosenIterator = this->FindNextExtentOrderedFile(filenameListRef, lookaheadCount - fileIndex, volumeIndex, iterator);
+            }
+
+            break;
+        }
+    }
+
+    if (chosenIterator != filenameListRef.end())
+    {
+        this->m_fileStartingClusterMap.erase(*chosenIterator);
+        this->m_unlocatedFileSet.erase(*chosenIterator);
+    }
+
+    return chosenIterator;
+}
+
+std::wstring VolumeAdmission::GetReport() const
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    std::wstring report{};
+    wchar_t line[VolumeAdmissionSupport::MAX_REPORT_LINE_SIZE]{};
+    for (const Volume& volumeRef : this->m_volumes)
+    {
+        double megabytesPerSecond = (volumeRef.secondsSum > 0.0) ? (volumeRef.byteSum / volumeRef.secondsSum / 1000000.0) : 0.0;
+        swprintf(line, VolumeAdmissionSupport::MAX_REPORT_LINE_SIZE, L"%ls%ls x%lu (%lu %ls, %.1f MB/s per read, latency %.1f ms",
+            VolumeAdmissionSupport::STORAGE_CLASS_NAMES[static_cast<size_t>(volumeRef.storageClass)], volumeRef.storageClassIsLearned ? L" (learned)" : L"",
+            volumeRef.admissionLimit, volumeRef.fileCount, (volumeRef.fileCount == 1UL) ? L"File" : L"Files", megabytesPerSecond, volumeRef.latencySeconds * 1000.0); // Write to the buffer.
+
+        report += L"\r\n";
+        report += volumeRef.volumeMountPoint;
+        report += L"\t";
+        report += line;
+
+        if (volumeRef.chosenSeekCount > 0UL && volumeRef.foundSeekCount > 0UL)
+        {
+            // The mean distance between consecutive Files, as read, and as found by the scan.
+            swprintf(line, VolumeAdmissionSupport::MAX_REPORT_LINE_SIZE, L", %.0f Clusters per seek (%.0f in the order found)",
+                volumeRef.chosenSeekSum / volumeRef.chosenSeekCount, volumeRef.foundSeekSum / volumeRef.foundSeekCount); // Write to the buffer.
+            report += line;
+        }
+
+        if (this->m_comparisonIsEnabled && volumeRef.orderSecondsSum[0] > 0.0 && volumeRef.orderSecondsSum[1] > 0.0)
+        {
+            swprintf(line, VolumeAdmissionSupport::MAX_REPORT_LINE_SIZE, L", elevator order %.1f MB/s vs order found %.1f MB/s",
+                volumeRef.orderByteSum[1] / volumeRef.orderSecondsSum[1] / 1000000.0, volumeRef.orderByteSum[0] / volumeRef.orderSecondsSum[0] / 1000000.0); // Write to the buffer.
+            report += line;
+        }
+
+        report += L")";
+    }
+
+    return report;
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+size_t VolumeAdmission::FindVolume(const wchar_t* filenamePtr)
+{
+    std::wstring folder = VolumeAdmissionSupport::GetFolderKey(filenamePtr);
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        std::map<std::wstring, size_t>::const_iterator folderIterator = this->m_folderToVolumeIndexMap.find(folder);
+        if (folderIterator != this->m_folderToVolumeIndexMap.end())
+        {
+            return folderIterator->second;
+        }
+    }
+
+    // The Volume is read from the File System without holding the Mutex, so a slow (e.g. spinning up) Disk does NOT hold back the Threads reading the other Volumes.
+    // The Files of a web server share a single NETWORK Volume, named by the origin of their URLs.
+    // A File whose Volume can NOT be found shares a single Volume, which is treated as an UNKNOWN storage class.
+    std::wstring volumeName{};
+    std::wstring volumeMountPoint{};
+    bool isRemote = false;
+    if (RemoteStreamSource::GetOrigin(filenamePtr, volumeName))
+    {
+        volumeMountPoint = volumeName;
+        isRemote = true;
+    }
+    else if (!WinAPIUtils::GetFileVolume(filenamePtr, volumeName, volumeMountPoint, isRemote))
+    {
+        volumeName.clear();
+        volumeMountPoint = L"?";
+    }
+
+    // A configured class replaces the reported class.
+    StorageClass storageClass = StorageClass::UNKNOWN;
+    bool storageClassIsConfigured = false;
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        std::map<std::wstring, size_t>::const_iterator volumeIterator = this->m_volumeNameToIndexMap.find(volumeName);
+        if (volumeIterator != this->m_volumeNameToIndexMap.end())
+        {
+            this->m_folderToVolumeIndexMap[folder] = volumeIterator->second;
+            return volumeIterator->second;
+        }
+
+        std::map<std::wstring, StorageClass>::const_iterator overrideIterator = this->m_storageClassOverrideMap.find(VolumeAdmissionSupport::ToVolumeRootKey(volumeMountPoint));
+        if (overrideIterator != this->m_storageClassOverrideMap.end())
+        {
+            storageClass = overrideIterator->second;
+            storageClassIsConfigured = true;
+        }
+    }
+
+    // Otherwise, a local Volume reports whether it incurs a seek penalty. The storage is also queried without holding the Mutex.
+    if (!storageClassIsConfigured)
+    {
+        bool incursSeekPenalty = false;
+        if (isRemote)
+        {
+            storageClass = StorageClass::NETWORK;
+        }
+        else if (!volumeName.empty() && WinAPIUtils::GetVolumeSeekPenalty(volumeName, incursSeekPenalty))
+        {
+            storageClass = incursSeekPenalty ? StorageClass::ROTATIONAL : StorageClass::SOLID_STATE;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+
+    // Another Thread may have added the Volume meanwhile.
+    size_t volumeIndex = 0;
+    std::map<std::wstring, size_t>::const_iterator volumeIterator = this->m_volumeNameToIndexMap.find(volumeName);
+    if (volumeIterator != this->m_volumeNameToIndexMap.end())
+    {
+        volumeIndex = volumeIterator->second;
+    }
+    else
+    {
+        Volume volume{};
+        volume.volumeMountPoint = volumeMountPoint;
+        volume.storageClass = storageClass;
+        volume.admissionLimit = this->GetAdmissionLimit(volume.storageClass);
+
+        volumeIndex = this->m_volumes.size();
+        this->m_volumes.push_back(volume);
+        this->m_volumeNameToIndexMap[volumeName] = volumeIndex;
+    }
+
+    this->m_folderToVolumeIndexMap[folder] = volumeIndex;
+    return volumeIndex;
+}
+
+bool VolumeAdmission::FindKnownVolume(const wchar_t* filenamePtr, size_t& volumeIndexRef) const
+{
+    std::map<std::wstring, size_t>::const_iterator folderIterator = this->m_folderToVolumeIndexMap.find(VolumeAdmissionSupport::GetFolderKey(filenamePtr));
+    if (folderIterator == this->m_folderToVolumeIndexMap.end())
+    {
+        return false;
+    }
+
+    volumeIndexRef = folderIterator->second;
+    return true;
+}
+
+std::list<std::wstring>::iterator VolumeAdmission::FindNextExtentOrderedFile(std::list<std::wstring>& filenameListRef, size_t lookaheadCount, size_t volumeIndex, std::list<std::wstring>::iterator firstFileIterator)
+{
+    Volume& volumeRef = this->m_volumes[volumeIndex];
+
+    // When the orders are compared, the order is switched every ORDER_COMPARISON_FILE_COUNT Files.
+    volumeRef.isExtentOrderedPeriod = !this->m_comparisonIsEnabled || ((volumeRef.chosenFileCount / VolumeAdmissionSupport::ORDER_COMPARISON_FILE_COUNT) % 2UL == 0UL);
+    ++volumeRef.chosenFileCount;
+
+    std::list<std::wstring>::iterator chosenIterator = firstFileIterator;
+    std::map<std::wstring, unsigned long long>::const_iterator clusterIterator = this->m_fileStartingClusterMap.find(*firstFileIterator);
+    bool hasChosenCluster = clusterIterator != this->m_fileStartingClusterMap.end();
+    unsigned long long chosenCluster = hasChosenCluster ? clusterIterator->second : 0ULL;
+
+    if (volumeRef.isExtentOrderedPeriod)
+    {
+        // C-SCAN: the nearest File at or after the elevator position. When every File is behind the position, the sweep starts again from the lowest File.
+        // The Files before firstFileIterator are on busy Volumes, so the search starts at firstFileIterator.
+        bool hasAheadFile = false;
+        bool hasLowestFile = false;
+        unsigned long long aheadCluster = 0ULL;
+        unsigned long long lowestCluster = 0ULL;
+        std::list<std::wstring>::iterator aheadIterator = firstFileIterator;
+        std::list<std::wstring>::iterator lowestIterator = firstFileIterator;
+
+        size_t fileIndex = 0;
+        for (std::list<std::wstring>::iterator iterator = firstFileIterator; iterator != filenameListRef.end() && fileIndex < lookaheadCount; ++iterator, ++fileIndex)
+        {
+            size_t fileVolumeIndex = 0;
+            clusterIterator = this->m_fileStartingClusterMap.find(*iterator);
+            if (clusterIterator == this->m_fileStartingClusterMap.end() || !this->FindKnownVolume(iterator->c_str(), fileVolumeIndex) || fileVolumeIndex != volumeIndex)
+            {
+                continue;
+            }
+
+            unsigned long long cluster = clusterIterator->second;
+            if ((!volumeRef.hasHeadCluster || cluster >= volumeRef.headCluster) && (!hasAheadFile || cluster < aheadCluster))
+            {
+                hasAheadFile = true;
+                aheadCluster = cluster;
+                aheadIterator = iterator;
+            }
+
+            if (!hasLowestFile || cluster < lowestCluster)
+            {
+                hasLowestFile = true;
+                lowestCluster = cluster;
+                lowestIterator = iterator;
+            }
+        }
+
+        if (hasAheadFile || hasLowestFile)
+        {
+            hasChosenCluster = true;
+            chosenCluster = hasAheadFile ? aheadCluster : lowestCluster;
+            chosenIterator = hasAheadFile ? aheadIterator : lowestIterator;
+        }
+    }
+
+    if (hasChosenCluster)
+    {
+        if (volumeRef.hasHeadCluster)
+        {
+            volumeRef.chosenSeekSum += static_cast<double>(VolumeAdmissionSupport::GetClusterDistance(volumeRef.headCluster, chosenCluster));
+            ++volumeRef.chosenSeekCount;
+        }
+
+        volumeRef.headCluster = chosenCluster;
+        volumeRef.hasHeadCluster = true;
+    }
+
+    return chosenIterator;
+}
+
+void VolumeAdmission::LocateFiles(size_t volumeIndex, const std::vector<std::wstring>& filenamesRef)
+{
+    for (const std::wstring& filenameRef : filenamesRef)
+    {
+        // The physical location is read without holding the Mutex, since it reads the File System.
+        // The members of an Archive share the location of the Archive, so they stay in the order they were found.
+        std::wstring archiveFilename{};
+        std::wstring memberName{};
+        bool fileIsArchiveMember = ArchiveReader::SplitMemberPath(filenameRef.c_str(), archiveFilename, memberName);
+        unsigned long long startingCluster = 0ULL;
+        bool fileIsLocated = WinAPIUtils::GetFileStartingCluster(fileIsArchiveMember ? archiveFilename.c_str() : filenameRef.c_str(), startingCluster);
+
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+
+        // A File chosen meanwhile is NOT pending anymore, so its location is NOT added.
+        if (this->m_unlocatedFileSet.erase(filenameRef) == 0 || !fileIsLocated)
+        {
+            continue;
+        }
+
+        this->m_fileStartingClusterMap[filenameRef] = startingCluster;
+
+        Volume& volumeRef = this->m_volumes[volumeIndex];
+        if (volumeRef.hasLastFoundCluster)
+        {
+            volumeRef.foundSeekSum += static_cast<double>(VolumeAdmissionSupport::GetClusterDistance(volumeRef.lastFoundCluster, startingCluster));
+            ++volumeRef.foundSeekCount;
+        }
+
+        volumeRef.lastFoundCluster = startingCluster;
+        volumeRef.hasLastFoundCluster = true;
+    }
+}
+
+void VolumeAdmission::UpdateLatency(Volume& volumeRef)
+{
+    // The read time of a File is fitted to (latency + byte count / bandwidth). The latency is the intercept of the least-squares line.
+    // When every File has the same size, the line can NOT be fitted, and the mean read time is used as the latency.
+    double fileCount = static_cast<double>(volumeRef.fileCount);
+    double denominator = fileCount * volumeRef.byteSquaredSum - volumeRef.byteSum * volumeRef.byteSum;
+    double latencySeconds = volumeRef.secondsSum / fileCount;
+    if (denominator > 0.0)
+    {
+        double slope = (fileCount * volumeRef.byteSecondsProductSum - volumeRef.byteSum * volumeRef.secondsSum) / denominator;
+        double intercept = (volumeRef.secondsSum - slope * volumeRef.byteSum) / fileCount;
+        if (slope > 0.0 && intercept >= 0.0)
+        {
+            latencySeconds = intercept;
+        }
+    }
+
+    volumeRef.latencySeconds = latencySeconds;
+    if (volumeRef.storageClass != StorageClass::UNKNOWN)
+    {
+        // The class was reported or configured, and is kept.
+        return;
+    }
+
+    volumeRef.storageClass = (latencySeconds > VolumeAdmissionSupport::ROTATIONAL_LATENCY_THRESHOLD_SECONDS) ? StorageClass::ROTATIONAL : StorageClass::SOLID_STATE;
+    volumeRef.storageClassIsLearned = true;
+    volumeRef.admissionLimit = this->GetAdmissionLimit(volumeRef.storageClass);
+}
+
+unsigned long VolumeAdmission::GetAdmissionLimit(StorageClass storageClass) const
+{
+    unsigned long admissionLimit = 1UL;
+    switch (storageClass)
+    {
+        case StorageClass::SOLID_STATE:
+            admissionLimit = this->m_limits.solidStateLimit;
+            break;
+        case StorageClass::NETWORK:
+            admissionLimit = this->m_limits.networkLimit;
+            break;
+        case StorageClass::ROTATIONAL:
+            admissionLimit = this->m_limits.rotationalLimit;
+            break;
+        case StorageClass::UNKNOWN:
+            // Until its latency is measured, the Volume is treated as a rotational Disk, which is the safest class.
+            admissionLimit = this->m_limits.rotationalLimit;
+            break;
+    }
+
+    return (admissionLimit > 0UL) ? admissionLimit : 1UL;
+}
+
+#pragma endregion Private_Member_Functions_Region
@@ -180,9 +180,21 @@ WavPackDecoder::WavPackDecoder() : AbstractBaseDecoder(DECODER_NAME)
 /// </summary>
 /// <param name="filenamePtr"></param>
 /// <param name="memoryBufferIsEnabled"></param>
-WavPackDecoder::WavPackDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled) : WavPackDecoder()
+WavPackDecoder::WavPackDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled) : WavPackDecoder(filenamePtr, memoryBufferIsEnabled, nullptr)
+{
+
+}
+
+/// <summary>
+/// Purpose: With-args Constructor that opens the Decoder using the specified File, and hashes the MD5 Input Message using the shared MD5 service.
+/// </summary>
+/// <param name="filenamePtr"></param>
+/// <param name="memoryBufferIsEnabled"></param>
+/// <param name="md5ServicePtr">The shared MD5 service. When NULL, the MD5 Input Message is hashed on the Decoder Thread.</param>
+WavPackDecoder::WavPackDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled, MultiBufferMD5Service* md5ServicePtr) : WavPackDecoder()
 {
     this->m_decoderMemoryBufferIsEnabled = memoryBufferIsEnabled;
+    this->m_md5ServicePtr = md5ServicePtr;
 
     // Open the WavPack File.
     this->OpenFile(filenamePtr, memoryBufferIsEnabled);
@@ -190,6 +202,15 @@ WavPackDecoder::WavPackDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEn
 
 WavPackDecoder::~WavPackDecoder()
 {
+    // Stop the Pipeline Thread before the state it updates is destroyed.
+    this->m_pcmPipelinePtr.reset();
+
+    if (this->m_md5StreamId != 0UL)
+    {
+        // The File was NOT fully decoded.
+        this->m_md5ServicePtr->Cancel(this->m_md5StreamId);
+    }
+
     // Close all Streams and Files.
     this->CloseFiles();
 }
@@ -198,39 +219,50 @@ WavPackDecoder::~WavPackDecoder()
 
 long long WavPackDecoder::Read()
 {
+    if (this->m_sampledVerificationPlan.IsEnabled())
+    {
+        return this->ReadSampled();
+    }
+
     // The actual number of Samples unpacked should be equal to the number of Samples requested, unless the end-of-file is encountered OR an error occurs.
     // If all Samples have been unpacked then 0 will be returned.
-    long long numberOfUnpackedSamplesPerChannel = WavpackUnpackSamples(this->m_wavPackContextPtr, this->m_unpackedSampleBuffer, this->m_requestedCompleteSamples);
+    long long numberOfUnpackedSamplesPerChannel = WavpackUnpackSamples(this->m_wavPackContextPtr, this->m_unpackedSampleBuffer.data(), this->m_requestedCompleteSamples);
 
     if (numberOfUnpackedSamplesPerChannel > 0LL)
     {
-        if (this->m_md5ModeIsEnabled)
+        if (this->m_pcmPipelinePtr != nullptr)
+        {
+            // The Samples are copied into the Pipeline, and processed on the Pipeline Thread.
+            this->m_pcmPipelinePtr->Write(this->m_unpackedSampleBuffer.data(), static_cast<size_t>(numberOfUnpackedSamplesPerChannel * this->m_numberOfChannels));
+        }
+        else
         {
-            long long numberOfUnpackedSamplesForAllChannels = numberOfUnpackedSamplesPerChannel * this->m_numberOfChannels;
-            this->UpdateMD5(numberOfUnpackedSamplesForAllChannels);
+            this->ProcessUnpackedSamples(this->m_unpackedSampleBuffer.data(), numberOfUnpackedSamplesPerChannel);
         }
         this->m_totalUnpackedSampleCount += numberOfUnpackedSamplesPerChannel;
     }
     else if (numberOfUnpackedSamplesPerChannel == 0LL)
     {
         // All Samples have been unpacked.
+
+        if (this->m_pcmPipelinePtr != nullptr)
+        {
+            // The MD5 Checksum, the PCM analysis, and the checksums need every unpacked Sample.
+            this->m_pcmPipelinePtr->Flush();
+        }
         
         // Check for the number of errors encountered so far. These are possibly CRC errors, but could also be Missing Blocks.
         int numberOfErrors = WavpackGetNumErrors(this->m_wavPackContextPtr);
         if (numberOfErrors > 0)
         {
-            std::wstring errorMessage = this->GetLastWavPackErrorMessage();
-
             // Errors were encountered.
-            swprintf(this->m_errorMessage, MAX_ERROR_SIZE, L"%d BAD_BLOC%s", numberOfErrors, numberOfErrors > 1 ? L"KS" : L"K");
+            this->RecordCountError(DecoderErrorCode::BAD_BLOCKS, numberOfErrors);
             numberOfUnpackedSamplesPerChannel = -1LL;
         }
         else
         {
             // Errors were NOT encountered.
 
-            std::wstring errorMessage = this->GetLastWavPackErrorMessage();
-            
             if (this->m_totalUnpackedSampleCount == this->m_streamTotalSampleCount)
             {
                 // Expected sample count match.
@@ -246,13 +278,21 @@ long long WavPackDecoder::Read()
                         
                         // Compute the MD5 Hash Digest using all of the Input Message data.
                         unsigned char computedMD5Checksum[16]{}; // MD5 Algorithm produces a 128-bit Hash (32 Hexadecimal characters = 16 bytes).
-                        md5_finish(&this->m_stateStructMD5Algorithm, computedMD5Checksum);
+                        if (this->m_md5StreamId != 0UL)
+                        {
+                            this->m_md5ServicePtr->Finish(this->m_md5StreamId, computedMD5Checksum);
+                            this->m_md5StreamId = 0UL;
+                        }
+                        else
+                        {
+                            md5_finish(&this->m_stateStructMD5Algorithm, computedMD5Checksum);
+                        }
                         
                         // Compare the MD5 Checksum values stored at the two memory locations.
                         // URI: https://cplusplus.com/reference/cstring/memcmp/
                         if (memcmp(md5ChecksumWavPack, computedMD5Checksum, 16) != 0)
                         {
-                            wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, L"MD5_MISMATCH");
+                            this->RecordError(DecoderErrorCode::MD5_MISMATCH);
                             return -1LL;
                         }
                     }
@@ -266,30 +306,22 @@ long long WavPackDecoder::Read()
             {
                 // A sample count mismatch was found.
 
-                std::wstring errorMessage;
-                int sampleCountMismatch = 0;
                 if (this->m_streamTotalSampleCount < 0LL)
                 {
                     // Unknown number of samples encountered.
-                    sampleCountMismatch = 0;
-                    errorMessage = L"SAMPLE_COUNT_UNKNOWN_ERROR";
+                    this->RecordCountError(DecoderErrorCode::SAMPLE_COUNT_UNKNOWN_ERROR, 0LL);
                 }
                 else if (this->m_totalUnpackedSampleCount < static_cast<unsigned long long>(this->m_streamTotalSampleCount))
                 {
                     // Missing Samples.
-                    sampleCountMismatch = static_cast<int>(this->m_streamTotalSampleCount - this->m_totalUnpackedSampleCount);
-                    errorMessage = L"MISSING_SAMPL";
-                    sampleCountMismatch == 1 ? errorMessage += L"E" : errorMessage += L"ES";
+                    this->RecordCountError(DecoderErrorCode::MISSING_SAMPLES, static_cast<long long>(this->m_streamTotalSampleCount - this->m_totalUnpackedSampleCount));
                 }
-                else if (this->m_totalUnpackedSampleCount > static_cast<unsigned long long>(this->m_streamTotalSampleCount))
+                else
                 {
                     // Extra Samples.
-                    sampleCountMismatch = static_cast<int>(this->m_totalUnpackedSampleCount - this->m_streamTotalSampleCount);
-                    errorMessage = L"EXTRA_SAMPL";
-                    sampleCountMismatch == 1 ? errorMessage += L"E" : errorMessage += L"ES";
+                    this->RecordCountError(DecoderErrorCode::EXTRA_SAMPLES, static_cast<long long>(this->m_totalUnpackedSampleCount - this->m_streamTotalSampleCount));
                 }
 
-                swprintf(this->m_errorMessage, MAX_ERROR_SIZE, L"%d %s", sampleCountMismatch, errorMessage.c_str());
                 numberOfUnpackedSamplesPerChannel = -1LL;
             }
         }
@@ -298,6 +330,11 @@ long long WavPackDecoder::Read()
     return numberOfUnpackedSamplesPerChannel;
 }
 
+long long WavPackDecoder::Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds)
+{
+    return this->DecodeBatch<WavPackDecoder>(audioUnitBudget, timeBudgetMilliseconds);
+}
+
 unsigned long long WavPackDecoder::GetDecodedAudioDataTotal()
 {
     if (this->m_streamTotalSampleCount < 0LL)
@@ -311,25 +348,175 @@ unsigned long long WavPackDecoder::GetDecodedAudioDataTotal()
     }
 }
 
-const wchar_t* WavPackDecoder::GetLastErrorMessage()
+const wchar_t* WavPackDecoder::GetSupportedTypes()
 {
-    return this->m_errorMessage;
+    return WavPackDecoder::FILE_EXTENSION_TYPES;
 }
 
-const wchar_t* WavPackDecoder::GetSupportedTypes()
+bool WavPackDecoder::CheckForTruncation()
 {
-    return WavPackDecoder::FILE_EXTENSION_TYPES;
+    if (this->m_streamTotalSampleCount < 0LL)
+    {
+        // Unknown number of Samples encountered.
+        return false;
+    }
+
+    std::vector<unsigned char> tailBuffer(WAVPACK_TAIL_CHECK_SIZE);
+    size_t tailSize = this->m_streamRegularData.ReadTail(tailBuffer.data(), tailBuffer.size());
+    const unsigned char* tailPtr = tailBuffer.data();
+
+    // Scan backwards for Block Headers. Any Tags (e.g. APEv2 or ID3v1) follow the last Block.
+    // Block Header layout (all multi-byte fields are little-endian):
+    // [0-3] "wvpk", [4-7] Block size (minus 8), [8-9] Version, [10] Block Index (upper 8 bits), [11] Total Samples (upper 8 bits),
+    // [12-15] Total Samples, [16-19] Block Index, [20-23] Block Samples, [24-27] Flags, [28-31] CRC.
+    bool lastBlockWasFound = false;
+    for (size_t index = (tailSize >= WAVPACK_BLOCK_HEADER_SIZE) ? tailSize - WAVPACK_BLOCK_HEADER_SIZE + 1 : 0; index-- > 0; )
+    {
+        const unsigned char* headerPtr = tailPtr + index;
+        if (memcmp(headerPtr, "wvpk", 4) != 0)
+        {
+            continue;
+        }
+
+        unsigned long blockSize = static_cast<unsigned long>(headerPtr[4]) | (static_cast<unsigned long>(headerPtr[5]) << 8) |
+            (static_cast<unsigned long>(headerPtr[6]) << 16) | (static_cast<unsigned long>(headerPtr[7]) << 24);
+        unsigned int version = static_cast<unsigned int>(headerPtr[8]) | (static_cast<unsigned int>(headerPtr[9]) << 8);
+        if (version < 0x402 || version > 0x410 || blockSize < WAVPACK_BLOCK_HEADER_SIZE - 8UL)
+        {
+            continue;
+        }
+
+        long long blockIndex = (static_cast<long long>(headerPtr[10]) << 32) | static_cast<long long>(headerPtr[16]) | (static_cast<long long>(headerPtr[17]) << 8) |
+            (static_cast<long long>(headerPtr[18]) << 16) | (static_cast<long long>(headerPtr[19]) << 24);
+        unsigned long blockSamples = static_cast<unsigned long>(headerPtr[20]) | (static_cast<unsigned long>(headerPtr[21]) << 8) |
+            (static_cast<unsigned long>(headerPtr[22]) << 16) | (static_cast<unsigned long>(headerPtr[23]) << 24);
+
+        long long lastSampleIndex = blockIndex;
+        if (!lastBlockWasFound)
+        {
+            lastBlockWasFound = true;
+            if (index + 8UL + blockSize > tailSize)
+            {
+                // The File ends part way through the last Block.
+            }
+            else if (blockSamples == 0UL)
+            {
+                // A trailing Block that holds only Metadata (e.g. a RIFF trailer). Keep scanning for the last Block that holds samples.
+                continue;
+            }
+            else
+            {
+                lastSampleIndex += blockSamples;
+            }
+        }
+        else if (blockSamples == 0UL)
+        {
+            continue;
+        }
+        else
+        {
+            lastSampleIndex += blockSamples;
+        }
+
+        if (lastSampleIndex < this->m_streamTotalSampleCount)
+        {
+            // The File ends before the total Samples stored in the Block Headers. The time is the end of the last complete Block.
+            this->RecordSampleTimeError(DecoderErrorCode::TRUNCATED, static_cast<unsigned long long>(lastSampleIndex));
+            return true;
+        }
+
+        return false;
+    }
+
+    return false;
+}
+
+bool WavPackDecoder::EnableSampledVerification(unsigned long windowCount)
+{
+    if (this->m_streamTotalSampleCount <= 0LL)
+    {
+        // Unknown number of Samples encountered, so the Windows can NOT be chosen.
+        return false;
+    }
+
+    return this->m_sampledVerificationPlan.Configure(windowCount, 0ULL, static_cast<unsigned long long>(this->m_streamTotalSampleCount));
+}
+
+bool WavPackDecoder::EnablePcmAnalysis()
+{
+    if (this->m_DSDAudioFlagEnabled)
+    {
+        return false;
+    }
+
+    this->m_pcmAnalyzerPtr = std::make_unique<PcmAnalyzer>(WavpackGetSampleRate(this->m_wavPackContextPtr));
+    return true;
+}
+
+bool WavPackDecoder::EnableAccurateRipChecksum()
+{
+    // URI: https://www.wavpack.com/wavpack_doc.html
+    int mode = WavpackGetMode(this->m_wavPackContextPtr);
+    if (this->m_DSDAudioFlagEnabled || this->m_floatAudioFlagEnabled || !(mode & MODE_LOSSLESS) ||
+        !AccurateRipChecksum::IsSupportedFormat(WavpackGetSampleRate(this->m_wavPackContextPtr), static_cast<unsigned long>(this->m_numberOfChannels), static_cast<unsigned long>(WavpackGetBitsPerSample(this->m_wavPackContextPtr))))
+    {
+        return false;
+    }
+
+    this->m_accurateRipChecksumPtr = std::make_unique<AccurateRipChecksum>();
+    return true;
+}
+
+bool WavPackDecoder::EnablePcmPipeline()
+{
+    if (!this->m_md5ModeIsEnabled && this->m_pcmAnalyzerPtr == nullptr && this->m_accurateRipChecksumPtr == nullptr)
+    {
+        // There is NO per-sample work to move to the Pipeline Thread.
+        return false;
+    }
+
+    this->m_pcmPipelinePtr = std::make_unique<PcmPipeline>([this](int32_t* samplePtr, size_t sampleCount) 
+        { this->ProcessUnpackedSamples(samplePtr, static_cast<long long>(sampleCount / this->m_numberOfChannels)); });
+    return true;
 }
 
 #pragma endregion Overridden_Base_Class_Functions_Region
 
 #pragma region Private_Member_Functions_Region
 
-void WavPackDecoder::UpdateMD5(long long sampleCount)
+void WavPackDecoder::ProcessUnpackedSamples(int32_t* samplePtr, long long sampleCountPerChannel)
+{
+    if (this->m_pcmAnalyzerPtr != nullptr)
+    {
+        // Must be analyzed before UpdateMD5(), which packs the Samples in place.
+        if (this->m_floatAudioFlagEnabled)
+        {
+            this->m_pcmAnalyzerPtr->AddInterleaved(reinterpret_cast<const float*>(samplePtr), this->m_numberOfChannels, static_cast<unsigned long>(sampleCountPerChannel));
+        }
+        else
+        {
+            this->m_pcmAnalyzerPtr->AddInterleaved(samplePtr, this->m_numberOfChannels, static_cast<unsigned long>(sampleCountPerChannel), this->m_bytesPerSample * 8UL);
+        }
+    }
+
+    if (this->m_accurateRipChecksumPtr != nullptr)
+    {
+        // Must also be done before UpdateMD5(), which packs the Samples in place.
+        this->m_accurateRipChecksumPtr->AddInterleaved(samplePtr, static_cast<unsigned long>(sampleCountPerChannel));
+    }
+
+    if (this->m_md5ModeIsEnabled)
+    {
+        long long sampleCountForAllChannels = sampleCountPerChannel * this->m_numberOfChannels;
+        this->UpdateMD5(samplePtr, sampleCountForAllChannels);
+    }
+}
+
+void WavPackDecoder::UpdateMD5(int32_t* samplePtr, long long sampleCount)
 {
     int32_t tempIntegerValue{};
-    int32_t* srcIntBufferPtr = this->m_unpackedSampleBuffer; // Access the Buffer through an Integer Pointer.
-    unsigned char* dstByteBufferPtr = (unsigned char*)this->m_unpackedSampleBuffer; // Access the Buffer through a Byte Pointer.
+    int32_t* srcIntBufferPtr = samplePtr; // Access the Buffer through an Integer Pointer.
+    unsigned char* dstByteBufferPtr = (unsigned char*)samplePtr; // Access the Buffer through a Byte Pointer.
     long long sampleCountLoopVar = sampleCount;
 
     // Prepare the Sample Buffer for an MD5 calculation.
@@ -447,29 +634,61 @@ void WavPackDecoder::UpdateMD5(long long sampleCount)
     // Sample Buffer values have been modified and are ready for an MD5 calculation.
     // Append a String to the Input Message.
     int numberOfBytes = static_cast<long>(sampleCount) * this->m_bytesPerSample;
-    md5_append(&this->m_stateStructMD5Algorithm, (unsigned char*)this->m_unpackedSampleBuffer, numberOfBytes);
+    if (this->m_md5StreamId != 0UL)
+    {
+        // The bytes are copied by the shared MD5 service, and hashed together with the Input Messages of other Files.
+        this->m_md5ServicePtr->Submit(this->m_md5StreamId, reinterpret_cast<const unsigned char*>(samplePtr), static_cast<size_t>(numberOfBytes));
+    }
+    else
+    {
+        md5_append(&this->m_stateStructMD5Algorithm, (unsigned char*)samplePtr, numberOfBytes);
+    }
 }
 
-std::wstring WavPackDecoder::GetLastWavPackErrorMessage()
+long long WavPackDecoder::ReadSampled()
 {
-    std::wstring errorMessage = L"No errors messages reported by WavPack.";
+    unsigned long long windowPosition = 0ULL;
+    if (!this->m_sampledVerificationPlan.NextWindow(windowPosition))
+    {
+        return 0LL; // Every Window has been verified.
+    }
+
+    if (windowPosition > 0ULL && !WavpackSeekSample64(this->m_wavPackContextPtr, static_cast<int64_t>(windowPosition)))
+    {
+        // The Blocks around the target sample could NOT be read. The WavPack Context can NOT be used after a failed seek.
+        this->RecordSampleTimeError(DecoderErrorCode::SEEK_ERROR, windowPosition);
+        return -1LL; // An error occurred.
+    }
 
-    // Get a pointer to a string describing the last error generated by WavPack. 
-    // This may provide useful information about why something is not working the way it should.
-    char* errorMessagePtr = WavpackGetErrorMessage(this->m_wavPackContextPtr);
-    size_t errorMessageSize = strlen(errorMessagePtr);
-    if (errorMessageSize > 0)
+    // The samples are NOT added to the MD5 Hash, and the sample count is NOT checked, since most of the Blocks are skipped.
+    int numberOfErrors = WavpackGetNumErrors(this->m_wavPackContextPtr);
+    unsigned long long sampleNumber = windowPosition;
+    for (unsigned long readIndex = 0UL; readIndex < WAVPACK_SAMPLED_WINDOW_READ_COUNT; ++readIndex)
     {
-        std::string errorMessageWavPack;
-        errorMessageWavPack += "The following error message was reported by WavPack: ";
-        errorMessageWavPack += errorMessagePtr;
+        uint32_t numberOfUnpackedSamplesPerChannel = WavpackUnpackSamples(this->m_wavPackContextPtr, this->m_unpackedSampleBuffer.data(), this->m_requestedCompleteSamples);
 
-        // Convert string type.
-        std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-        errorMessage = converter.from_bytes(errorMessageWavPack);
+        if (WavpackGetNumErrors(this->m_wavPackContextPtr) > numberOfErrors)
+        {
+            // A Block within the Window failed its CRC check, or is missing.
+            this->RecordSampleTimeError(DecoderErrorCode::BAD_BLOCKS, sampleNumber);
+            return -1LL; // An error occurred.
+        }
+
+        if (numberOfUnpackedSamplesPerChannel == 0U)
+        {
+            // All Samples have been unpacked.
+            break;
+        }
+
+        sampleNumber += numberOfUnpackedSamplesPerChannel;
     }
 
-    return errorMessage;
+    return static_cast<long long>(this->m_sampledVerificationPlan.GetWindowProgressUnits(static_cast<unsigned long long>(this->m_streamTotalSampleCount)));
+}
+
+void WavPackDecoder::RecordSampleTimeError(DecoderErrorCode code, unsigned long long sampleNumber)
+{
+    this->RecordTimeError(code, sampleNumber, WavpackGetSampleRate(this->m_wavPackContextPtr));
 }
 
 void WavPackDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled)
@@ -571,7 +790,10 @@ void WavPackDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEna
         this->m_numberOfChannels = WavpackGetNumChannels(this->m_wavPackContextPtr);
 
         this->maximumRequiredSampleBufferSize = 4 * this->m_streamTotalSampleCount * this->m_numberOfChannels;
-        this->m_requestedCompleteSamples = MAX_UNPACKED_SAMPLE_BUFFER_SIZE / this->m_numberOfChannels;
+        // At least one complete Sample is requested, however many channels there are (e.g. multichannel DSD).
+        unsigned long unpackSampleCount = DecoderTuning::GetProfile().wavPackUnpackSampleCount;
+        this->m_requestedCompleteSamples = (unpackSampleCount > static_cast<unsigned long>(this->m_numberOfChannels)) ? (unpackSampleCount / this->m_numberOfChannels) : 1UL;
+        this->m_unpackedSampleBuffer.assign(static_cast<size_t>(this->m_requestedCompleteSamples) * this->m_numberOfChannels, 0);
 
         // Get the Qualify Mode to determine whether DSD Audio is present within the specified WavPack file. 
         int qualifyMode = WavpackGetQualifyMode(this->m_wavPackContextPtr);
@@ -588,12 +810,20 @@ void WavPackDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEna
 
         // Check if the File contains an MD5 Checksum value AND whether the File decoding is Lossless (e.g. either Pure or Hybrid).
         int mode = WavpackGetMode(this->m_wavPackContextPtr);
+        this->m_floatAudioFlagEnabled = (mode & MODE_FLOAT) != 0;
         if ((mode & MODE_MD5) && (mode & MODE_LOSSLESS))
         {
             this->m_md5ModeIsEnabled = true;
 
             // Initialize the MD5 Algorithm.
-            md5_init(&this->m_stateStructMD5Algorithm);
+            if (this->m_md5ServicePtr != nullptr)
+            {
+                this->m_md5StreamId = this->m_md5ServicePtr->Join();
+            }
+            else
+            {
+                md5_init(&this->m_stateStructMD5Algorithm);
+            }
         }
         else
         {
@@ -608,16 +838,8 @@ void WavPackDecoder::OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEna
     {
         // Opening WavPack File failed.
 
-        // An error occcured.
-        std::string errorMessageWavPack;
-        errorMessageWavPack += "An error occurred opening the WavPack File. The following error was reported by WavPack: ";
-        errorMessageWavPack += error;
-
-        // Convert string type.
-        std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-        std::wstring errorMessage = converter.from_bytes(errorMessageWavPack);
-
-        wcscpy_s(this->m_errorMessage, MAX_ERROR_SIZE, errorMessage.c_str());
+        // An error occcured. The text in the error buffer is NOT kept, since the Final Report only shows that the Decoder could NOT be opened.
+        this->RecordError(DecoderErrorCode::UNABLE_TO_OPEN_DECODER);
 
         // Set the Decoder Status as Closed.
         this->SetDecoderIsOpenStatus(false);
@@ -126,4 +126,131 @@ bool WinAPIUtils::IsFolderType(const wchar_t* filenamePtr)
     {
         return false;
     }
-}
\ No newline at end of file
+}
+
+bool WinAPIUtils::GetFileVolume(const wchar_t* filenamePtr, std::wstring& volumeNameRef, std::wstring& volumeMountPointRef, bool& isRemoteRef)
+{
+    // Get the root of the Volume (e.g. "C:\", a Mount Point Folder, or "\\server\share\").
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getvolumepathnamew
+    wchar_t volumeMountPoint[MAX_PATH]{};
+    if (!GetVolumePathName(filenamePtr, volumeMountPoint, MAX_PATH))
+    {
+        return false;
+    }
+
+    volumeMountPointRef = volumeMountPoint;
+
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getdrivetypew
+    isRemoteRef = GetDriveType(volumeMountPoint) == DRIVE_REMOTE;
+
+    // A local Volume has a unique name, whichever Drive Letter or Mount Point is used to reach it. A network share does NOT.
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getvolumenameforvolumemountpointw
+    wchar_t volumeName[MAX_PATH]{};
+    if (!isRemoteRef && GetVolumeNameForVolumeMountPoint(volumeMountPoint, volumeName, MAX_PATH))
+    {
+        volumeNameRef = volumeName;
+    }
+    else
+    {
+        volumeNameRef = volumeMountPoint;
+    }
+
+    return true;
+}
+
+bool WinAPIUtils::GetVolumeSeekPenalty(const std::wstring& volumeNameRef, bool& incursSeekPenaltyRef)
+{
+    // The Volume Device is opened without the trailing backslash of the Volume name (i.e. "\\?\Volume{GUID}").
+    // With a dwDesiredAccess of zero, the Device attributes can be queried without Administrative Privileges.
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    std::wstring volumeDevicePath = volumeNameRef;
+    if (!volumeDevicePath.empty() && volumeDevicePath.back() == L'\\')
+    {
+        volumeDevicePath.pop_back();
+    }
+
+    HANDLE hDevice = CreateFile(volumeDevicePath.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL);
+    if (hDevice == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/winioctl/ni-winioctl-ioctl_storage_query_property
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/winioctl/ns-winioctl-device_seek_penalty_descriptor
+    STORAGE_PROPERTY_QUERY propertyQuery{};
+    propertyQuery.PropertyId = StorageDeviceSeekPenaltyProperty;
+    propertyQuery.QueryType = PropertyStandardQuery;
+
+    DEVICE_SEEK_PENALTY_DESCRIPTOR seekPenaltyDescriptor{};
+    DWORD bytesReturned = 0;
+    bool seekPenaltyWasObtained = DeviceIoControl(hDevice, IOCTL_STORAGE_QUERY_PROPERTY, &propertyQuery, sizeof(propertyQuery),
+        &seekPenaltyDescriptor, sizeof(seekPenaltyDescriptor), &bytesReturned, NULL) && bytesReturned >= sizeof(seekPenaltyDescriptor);
+
+    CloseHandle(hDevice);
+
+    if (seekPenaltyWasObtained)
+    {
+        incursSeekPenaltyRef = seekPenaltyDescriptor.IncursSeekPenalty != FALSE;
+    }
+
+    return seekPenaltyWasObtained;
+}
+
+bool WinAPIUtils::GetFileStartingCluster(const wchar_t* filenamePtr, unsigned long long& startingClusterRef)
+{
+    // Only the File attributes are read, so the File can be open in other Processes.
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-createfilew
+    HANDLE hFile = CreateFile(filenamePtr, FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, 0, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    // The Output Buffer holds the first Extent only. ERROR_MORE_DATA is returned when the File has more Extents, and the first Extent is still returned.
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/winioctl/ni-winioctl-fsctl_get_retrieval_pointers
+    STARTING_VCN_INPUT_BUFFER startingVcnBuffer{};
+    startingVcnBuffer.StartingVcn.QuadPart = 0;
+    RETRIEVAL_POINTERS_BUFFER retrievalPointersBuffer{};
+    DWORD bytesReturned = 0;
+    bool firstExtentWasObtained = DeviceIoControl(hFile, FSCTL_GET_RETRIEVAL_POINTERS, &startingVcnBuffer, sizeof(startingVcnBuffer),
+        &retrievalPointersBuffer, sizeof(retrievalPointersBuffer), &bytesReturned, NULL) || GetLastError() == ERROR_MORE_DATA;
+
+    CloseHandle(hFile);
+
+    // An LCN of -1 marks an Extent that is NOT stored on the Disk (e.g. a sparse or compressed range).
+    if (!firstExtentWasObtained || retrievalPointersBuffer.ExtentCount == 0 || retrievalPointersBuffer.Extents[0].Lcn.QuadPart < 0)
+    {
+        return false;
+    }
+
+    startingClusterRef = static_cast<unsigned long long>(retrievalPointersBuffer.Extents[0].Lcn.QuadPart);
+    return true;
+}
+
+bool WinAPIUtils::GetSystemCacheSize(unsigned long long& systemCacheSizeRef)
+{
+    // GetPerformanceInfo() is exported by Kernel32 (as K32GetPerformanceInfo), so NO additional Library is linked.
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/psapi/nf-psapi-getperformanceinfo
+    PERFORMANCE_INFORMATION performanceInformation{};
+    if (!GetPerformanceInfo(&performanceInformation, sizeof(performanceInformation)))
+    {
+        return false;
+    }
+
+    // The System Cache is reported in Pages.
+    systemCacheSizeRef = static_cast<unsigned long long>(performanceInformation.SystemCache) * performanceInformation.PageSize;
+    return true;
+}
+
+bool WinAPIUtils::GetFileSize(const wchar_t* filenamePtr, unsigned long long& fileSizeRef)
+{
+    // URI: https://learn.microsoft.com/en-us/windows/win32/api/fileapi/nf-fileapi-getfileattributesexw
+    WIN32_FILE_ATTRIBUTE_DATA fileAttributeData{};
+    if (!GetFileAttributesEx(filenamePtr, GetFileExInfoStandard, &fileAttributeData))
+    {
+        return false;
+    }
+
+    fileSizeRef = (static_cast<unsigned long long>(fileAttributeData.nFileSizeHigh) << 32ULL) | fileAttributeData.nFileSizeLow;
+    return true;
+}
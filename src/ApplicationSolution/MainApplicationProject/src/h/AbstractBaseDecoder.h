@@ -2,6 +2,14 @@
 #define ABSTRACT_BASE_DECODER_H
 
 #include "PureAbstractBaseDecoder.h"
+#include "PcmPipeline.h"
+#include <chrono>
+#include <memory>
+
+/// <summary>
+/// Purpose: The number of Read() calls made by Decode() between checks of the time budget, so the clock is NOT read for every Frame.
+/// </summary>
+constexpr auto DECODE_TIME_CHECK_INTERVAL = 16UL;
 
 /// <summary>
 /// Purpose: An Abstract Base Class (ABC) for all Decoders. 
@@ -21,6 +29,10 @@ public:
     #pragma region Overridden_Base_Class_Functions_Region
 
     std::wstring GetName();
+    const wchar_t* GetLastErrorMessage();
+    DecoderErrorRecord GetLastErrorRecord();
+    bool GetPcmAnalysisResult(PcmAnalysisResult& resultRef);
+    bool GetAccurateRipChecksumResult(AccurateRipChecksumResult& resultRef);
 
     #pragma endregion Overridden_Base_Class_Functions_Region
 
@@ -37,8 +49,97 @@ protected:
     void SetDecoderIsOpenStatus(bool value);
     bool IsDecoderMemoryBufferIsEnabled() const;
 
+    /// <summary>
+    /// Purpose: The errors reported for the File. Recording an error does NOT format any text.
+    /// </summary>
+    DecoderErrorLog m_errorLog{};
+
+    /// <summary>
+    /// Purpose: Records an error without a position (e.g. MD5_MISMATCH).
+    /// </summary>
+    void RecordError(DecoderErrorCode code);
+
+    /// <summary>
+    /// Purpose: Records a count based error (e.g. 12 MISSING_SAMPLES).
+    /// </summary>
+    void RecordCountError(DecoderErrorCode code, long long count);
+
+    /// <summary>
+    /// Purpose: Records an error reported with the time at which it occurred (e.g. LOST_SYNC @ 1m 05s).
+    /// </summary>
+    /// <param name="code">The Error Code.</param>
+    /// <param name="position">The position of the error (e.g. a sample number).</param>
+    /// <param name="timeBase">The number of position units per second (e.g. the Sampling Rate).</param>
+    void RecordTimeError(DecoderErrorCode code, unsigned long long position, unsigned long timeBase);
+
+    /// <summary>
+    /// Purpose: The optional sink for the decoded PCM. NULL unless the analysis was enabled, so the Decoders only pay for a pointer check.
+    /// </summary>
+    std::unique_ptr<PcmAnalyzer> m_pcmAnalyzerPtr{};
+
+    /// <summary>
+    /// Purpose: The optional sink for the checksums of the decoded PCM. NULL unless the checksums were enabled for lossless CD Audio.
+    /// </summary>
+    std::unique_ptr<AccurateRipChecksum> m_accurateRipChecksumPtr{};
+
+    /// <summary>
+    /// Purpose: The optional second stage for the per-sample work (e.g. MD5 signature, analysis, checksums). NULL unless the Pipeline was enabled.
+    /// A Derived Class must reset it in its Destructor, since the Pipeline Thread uses the state of the Derived Class.
+    /// </summary>
+    std::unique_ptr<PcmPipeline> m_pcmPipelinePtr{};
+
+    /// <summary>
+    /// Purpose: The Decode() loop, instantiated per concrete Decoder. Read() is called through the concrete type (i.e. NOT through the vtable), 
+    /// so the Compiler can inline it and its StreamWrapper calls into the loop. The virtual call is made once per batch, instead of once per Frame.
+    /// The end of the File is remembered, so Read() is NOT called again once it has returned 0 (e.g. FLAC can NOT be read after finish()).
+    /// A Derived Class of DecoderType that overrides Read() must instantiate its own loop.
+    /// </summary>
+    /// <typeparam name="DecoderType">The concrete Decoder. Must derive from this class.</typeparam>
+    template <typename DecoderType>
+    long long DecodeBatch(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds)
+    {
+        if (this->m_endOfFileReached)
+        {
+            return 0LL; // The end of the File was reached by the previous call.
+        }
+
+        DecoderType* decoderPtr = static_cast<DecoderType*>(this);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeBudgetMilliseconds);
+        unsigned long long totalAudioUnitsRead = 0ULL;
+        unsigned long readCount = 0UL;
+
+        while (true)
+        {
+            long long audioUnitsRead = decoderPtr->DecoderType::Read(); // A statically dispatched call.
+            if (audioUnitsRead < 0LL)
+            {
+                return -1LL; // An error occurred. The Record of the error is the latest in the Error Log, so GetLastErrorRecord() reports it.
+            }
+            else if (audioUnitsRead == 0LL)
+            {
+                this->m_endOfFileReached = true;
+                break;
+            }
+
+            totalAudioUnitsRead += static_cast<unsigned long long>(audioUnitsRead);
+            if (totalAudioUnitsRead >= audioUnitBudget)
+            {
+                break;
+            }
+
+            if (++readCount % DECODE_TIME_CHECK_INTERVAL == 0UL && std::chrono::steady_clock::now() >= deadline)
+            {
+                break;
+            }
+        }
+
+        return static_cast<long long>(totalAudioUnitsRead);
+    }
+
 private:
     bool m_decoderIsOpen{ false };
+    bool m_endOfFileReached{ false };
+    wchar_t m_errorMessage[MAX_ERROR_SIZE]{}; // The last error, rendered on request.
     std::wstring decoderName;
 };
 
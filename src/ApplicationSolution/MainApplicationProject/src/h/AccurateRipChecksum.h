@@ -0,0 +1,120 @@
+#ifndef ACCURATERIP_CHECKSUM_H
+#define ACCURATERIP_CHECKSUM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Purpose: The Audio format of a Compact Disc (Red Book). AccurateRip checksums are only defined for this format.
+/// </summary>
+constexpr auto ACCURATERIP_SAMPLE_RATE = 44100UL;
+constexpr auto ACCURATERIP_CHANNEL_COUNT = 2UL;
+constexpr auto ACCURATERIP_BITS_PER_SAMPLE = 16UL;
+
+/// <summary>
+/// Purpose: The number of stereo samples in a single CD Sector (2352 bytes).
+/// </summary>
+constexpr auto ACCURATERIP_SECTOR_FRAME_COUNT = 588ULL;
+
+/// <summary>
+/// Purpose: The number of stereo samples excluded from the start of the first Track, and the end of the last Track (i.e. 5 Sectors),
+/// since drives with different read offsets can NOT read them the same way.
+/// </summary>
+constexpr auto ACCURATERIP_SKIPPED_FRAME_COUNT = 5ULL * ACCURATERIP_SECTOR_FRAME_COUNT;
+
+/// <summary>
+/// Purpose: The checksums of the decoded PCM of a single Track (i.e. a single File).
+/// A File does NOT know its position on the Disc, so the AccurateRip checksums are computed as if the Track was a middle Track, the first Track, and the last Track.
+/// </summary>
+struct AccurateRipChecksumResult
+{
+    unsigned long long frameCount{}; // The number of stereo samples.
+
+    uint32_t accurateRipV1{};
+    uint32_t accurateRipV1FirstTrack{};
+    uint32_t accurateRipV1LastTrack{};
+
+    uint32_t accurateRipV2{};
+    uint32_t accurateRipV2FirstTrack{};
+    uint32_t accurateRipV2LastTrack{};
+
+    /// <summary>
+    /// Purpose: The CRC32 of the PCM bytes (16-bit little-endian, interleaved), as reported by CD ripping tools (i.e. 'Copy CRC').
+    /// </summary>
+    uint32_t crc32{};
+};
+
+/// <summary>
+/// Purpose: An optional sink for the PCM produced by a Decoder, that computes the AccurateRip v1, AccurateRip v2, and CRC32 checksums of a CD Track
+/// in the same pass as the decode. The multiply-accumulate kernel uses SSE2 or AVX2, and the CRC32 uses carry-less multiplication (PCLMULQDQ), when the CPU supports them.
+///
+/// Each stereo sample is packed as (Right << 16) | Left, and multiplied by its 1-based position in the Track (mod 2^32).
+/// AccurateRip v1 is the sum of the low 32-bits of the products. AccurateRip v2 is the sum of the low and the high 32-bits of the products.
+/// URI: http://www.accuraterip.com/
+/// </summary>
+class AccurateRipChecksum
+{
+    public:
+        AccurateRipChecksum();
+        virtual ~AccurateRipChecksum();
+        AccurateRipChecksum(const AccurateRipChecksum& other) = delete; // Delete Copy Constructor
+        AccurateRipChecksum& operator=(const AccurateRipChecksum& other) = delete; // Delete Assignment Operator (Overloaded)
+        AccurateRipChecksum(AccurateRipChecksum&& other) noexcept = delete; // Delete The Move Constructor
+        AccurateRipChecksum& operator=(AccurateRipChecksum&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Adds a block of planar 16-bit stereo samples (e.g. a decoded FLAC Frame).
+        /// </summary>
+        /// <param name="channelPtrs">Two pointers (Left and Right), to frameCount samples each.</param>
+        /// <param name="frameCount">The number of samples per channel.</param>
+        void AddPlanar(const int32_t* const channelPtrs[], unsigned long frameCount);
+
+        /// <summary>
+        /// Purpose: Adds a block of interleaved 16-bit stereo samples (e.g. unpacked WavPack samples).
+        /// </summary>
+        void AddInterleaved(const int32_t* samplePtr, unsigned long frameCount);
+
+        /// <summary>
+        /// Purpose: Gets the checksums of all of the samples added so far.
+        /// </summary>
+        AccurateRipChecksumResult GetResult() const;
+
+        /// <summary>
+        /// Purpose: Checks whether AccurateRip checksums are defined for an Audio format (i.e. 44.1kHz, 16-bit, stereo).
+        /// </summary>
+        static bool IsSupportedFormat(unsigned long sampleRate, unsigned long channelCount, unsigned long bitsPerSample);
+
+        /// <summary>
+        /// Purpose: Updates a CRC32 (reflected polynomial 0xEDB88320) with the kernel chosen for the CPU. Also used for the CRC32 of whole Files.
+        /// </summary>
+        /// <param name="crc">The CRC32 so far, starting from 0xFFFFFFFF. The final CRC32 is the complement of the returned value.</param>
+        static uint32_t UpdateCrc32(uint32_t crc, const unsigned char* dataPtr, size_t size);
+
+    private:
+        unsigned long long m_frameCount{};
+
+        /// <summary>
+        /// Purpose: The sums of the low and the high 32-bits of the products, for all samples, and for the samples excluded from the first Track.
+        /// </summary>
+        uint32_t m_productLowSum{};
+        uint32_t m_productHighSum{};
+        uint32_t m_firstTrackSkippedLowSum{};
+        uint32_t m_firstTrackSkippedHighSum{};
+
+        uint32_t m_crc32{ 0xFFFFFFFFUL };
+
+        /// <summary>
+        /// Purpose: The packed samples of the current block, and a Ring Buffer of the last ACCURATERIP_SKIPPED_FRAME_COUNT packed samples,
+        /// which are excluded from the last Track once the length of the Track is known.
+        /// </summary>
+        std::vector<uint32_t> m_packedScratch{};
+        std::vector<uint32_t> m_tailRingBuffer{};
+
+        /// <summary>
+        /// Purpose: Multiplies and accumulates the packed samples of a block, then updates the CRC32 and the Ring Buffer.
+        /// </summary>
+        void AddPacked(const uint32_t* packedPtr, size_t frameCount);
+};
+
+#endif // ACCURATERIP_CHECKSUM_H
@@ -5,9 +5,21 @@
 #include <string>
 #include <cassert>
 #include <functional>
+#include <list>
+#include <map>
+#include <set>
 #include "MainWinAPI.h"
 #include "DecoderManager.h"
+#include "DecoderErrorLog.h"
+#include "PcmAnalyzer.h"
 #include "ExecutionManager.h"
+#include "CpuDispatch.h"
+#include "DecoderTuning.h"
+#include "VolumeAdmission.h"
+#include "StreamWrapper.h"
+#include "ArchiveReader.h"
+#include "RemoteStreamSource.h"
+#include "SidecarManifest.h"
 
 // Universal Naming Convention (UNC) path support via "\\?\UNC" prefix. (Example: "\\?\UNC\server\share").
 constexpr auto FILE_NAMESPACE_UNC_PREFIX = L"\\\\?\\UNC\\";
@@ -22,6 +34,201 @@ constexpr auto FILE_NAMESPACE_PREFIX_SIZE = 4;
 /// </summary>
 constexpr auto FORCE_SINGLE_CPU_ENABLED = false;
 
+/// <summary>
+/// Purpose: Enable to verify MP3 Files by fully decoding the Audio Data of every Frame, instead of only walking the Frame Headers. Slower, but reports decoding errors.
+/// </summary>
+constexpr auto MP3_DEEP_DECODE_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to report a File as soon as the quick tail-only truncation check finds it truncated, instead of also fully decoding it.
+/// Faster for truncated Files, but any other errors in the File are NOT reported. When disabled, the full decode decides the result.
+/// Either way, the Files found truncated are listed first in the Final Report.
+/// </summary>
+constexpr auto QUICK_TRUNCATION_POLICY_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to verify a number of randomly placed Windows spread across every File, instead of fully decoding it.
+/// Much faster for large collections, but damage between the Windows is NOT found, so a File is reported as 'sampled clean' instead of 'passed'.
+/// </summary>
+constexpr auto SAMPLED_VERIFICATION_ENABLED = false;
+
+/// <summary>
+/// Purpose: The number of Windows verified per File, when sampled verification is enabled.
+/// When 0, the number of Windows is derived from the confidence and damaged fraction below.
+/// </summary>
+constexpr auto SAMPLED_VERIFICATION_WINDOW_COUNT = 0UL;
+
+/// <summary>
+/// Purpose: The probability of finding the damage in a File, when the damage affects at least the damaged fraction of the File.
+/// The defaults need 59 Windows per File.
+/// </summary>
+constexpr auto SAMPLED_VERIFICATION_CONFIDENCE = 0.95;
+constexpr auto SAMPLED_VERIFICATION_DAMAGED_FRACTION = 0.05;
+
+/// <summary>
+/// Purpose: The number of Progress Bar steps per File. Each Decoder Thread decodes the File in this many batches, 
+/// checking for termination and updating its progress once per batch, instead of once per Frame.
+/// </summary>
+constexpr auto DECODE_PROGRESS_STEP_COUNT = 256ULL;
+
+/// <summary>
+/// Purpose: The longest time a batch may take, so termination is still noticed promptly for slow Files (e.g. on a network share).
+/// </summary>
+constexpr auto DECODE_TIME_BUDGET_MILLISECONDS = 50UL;
+
+/// <summary>
+/// Purpose: Enable to analyze the decoded PCM of every fully decoded File, in the same pass as the decode. Files with clipping, DC offset, 
+/// long digital silence, or identical channels are listed in the Final Report. MP3 Files are only analyzed when MP3_DEEP_DECODE_ENABLED is enabled.
+/// </summary>
+constexpr auto PCM_ANALYSIS_ENABLED = false;
+
+/// <summary>
+/// Purpose: The smallest DC offset (relative to full scale) that is reported, and the shortest run of digital silence (in seconds) that is reported.
+/// </summary>
+constexpr auto PCM_ANALYSIS_DC_OFFSET_THRESHOLD = 0.001;
+constexpr auto PCM_ANALYSIS_SILENCE_THRESHOLD_SECONDS = 2.0;
+
+/// <summary>
+/// Purpose: Enable to compute the AccurateRip v1, AccurateRip v2, and CRC32 checksums of every fully decoded lossless CD Audio File (i.e. FLAC and WavPack), 
+/// in the same pass as the decode. The checksums are listed in the Final Report, so a Track can be checked against the AccurateRip Database without another decode.
+/// </summary>
+constexpr auto ACCURATERIP_CHECKSUM_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to choose the Decoder of every File from the magic bytes at its start (e.g. 'fLaC'), instead of from its File Extension.
+/// A misnamed File is then verified with the right Decoder, at the cost of reading the start of every File once more.
+/// </summary>
+constexpr auto MAGIC_BYTE_SNIFFING_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to hash the MD5 signatures of the FLAC and WavPack Files decoded by different Threads together, one File per SIMD lane,
+/// instead of one File at a time on each Decoder Thread. Only used when more than one CPU is used.
+/// </summary>
+constexpr auto MULTI_BUFFER_MD5_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to compute the MD5 signature (and the PCM analysis and checksums) of a FLAC or WavPack File on a second Thread, while the File is decoded.
+/// Only used when a File is given a spare CPU (e.g. the last large Files of a scan).
+/// </summary>
+constexpr auto PCM_PIPELINE_ENABLED = false;
+
+/// <summary>
+/// Purpose: Limits the instruction sets used by the SIMD kernels (e.g. "SSE2"), to test the slower kernel variants on a newer CPU.
+/// When empty, the WINAUDIODECODER_CPU_DISPATCH Environment Variable is used. The chosen variants are listed in the Final Report.
+/// </summary>
+constexpr auto CPU_DISPATCH_LEVEL = "";
+
+/// <summary>
+/// Purpose: Enable the tuning mode. A sample of the scanned Files is decoded once per candidate read and unpack size (e.g. the fread_s() Block Size),
+/// and the fastest sizes are saved to the tuning profile of this machine, which is loaded at every startup. The throughput of each candidate is listed in the Final Report.
+/// Every File is still verified normally, so a scan in the tuning mode takes several times longer.
+/// </summary>
+constexpr auto DECODER_TUNING_ENABLED = false;
+
+/// <summary>
+/// Purpose: The Files sampled by the tuning mode. Every DECODER_TUNING_SAMPLE_STRIDE-th File of each Decoder is sampled, up to DECODER_TUNING_SAMPLE_FILE_COUNT Files per Decoder.
+/// </summary>
+constexpr auto DECODER_TUNING_SAMPLE_STRIDE = 8UL;
+constexpr auto DECODER_TUNING_SAMPLE_FILE_COUNT = 16UL;
+
+/// <summary>
+/// Purpose: Enable to admit the File reads of each Volume separately, by the storage class of the Volume, instead of reading a single File at a time across every Volume.
+/// Each rotational Disk is then read by one Thread at a time, while the Files on the other Disks, Solid State Drives, and network shares are read concurrently.
+/// </summary>
+constexpr auto VOLUME_ADMISSION_ENABLED = false;
+
+/// <summary>
+/// Purpose: The number of concurrent File reads admitted on a Volume of each storage class.
+/// </summary>
+constexpr auto VOLUME_ADMISSION_ROTATIONAL_LIMIT = 1UL;
+constexpr auto VOLUME_ADMISSION_SOLID_STATE_LIMIT = 8UL;
+constexpr auto VOLUME_ADMISSION_NETWORK_LIMIT = 4UL;
+
+/// <summary>
+/// Purpose: The configured storage class of a Volume, by Volume root (e.g. L"D:\\=ROTATIONAL;\\\\nas\\music\\=NETWORK"). Replaces the class reported by the storage,
+/// or learned from the measured latency (e.g. for a RAID Controller, or a USB bridge).
+/// </summary>
+constexpr auto VOLUME_STORAGE_CLASS_OVERRIDES = L"";
+
+/// <summary>
+/// Purpose: The number of pending Files searched for one whose Volume admits another read, when a Decoder Thread takes its next File.
+/// Also the window within which the Files of a rotational Disk are put in physical order, so a larger window gives shorter seeks.
+/// </summary>
+constexpr auto VOLUME_ADMISSION_LOOKAHEAD_FILE_COUNT = 1024UL;
+
+/// <summary>
+/// Purpose: Enable to read the Files of a rotational Disk in the order of their physical location (i.e. their first Cluster), instead of the order they were found,
+/// which shortens the seeks between Files. The location of each File is read when the File is added, which opens the File, so only the Files of a Volume reported
+/// (or configured in VOLUME_STORAGE_CLASS_OVERRIDES) as ROTATIONAL are ordered. The Files of a Volume whose class is learned to be ROTATIONAL are located once it is learned.
+/// Only used when VOLUME_ADMISSION_ENABLED is TRUE.
+/// </summary>
+constexpr auto EXTENT_ORDERED_READING_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to alternate the physical order and the order found on each rotational Disk, and to add the throughput of both orders to the Final Report.
+/// </summary>
+constexpr auto EXTENT_ORDER_COMPARISON_ENABLED = false;
+
+/// <summary>
+/// Purpose: How the Files read by the Decoders use the System File Cache. A full library scan reads every File once, which otherwise evicts the Files cached for other Applications.
+/// SEQUENTIAL_SCAN hints the Cache to read ahead and to drop the pages behind the reads. NO_BUFFERING reads around the Cache, into pooled aligned Memory Buffers.
+/// The scan throughput and the size of the System File Cache are added to the Final Report, so the policies can be compared.
+/// </summary>
+constexpr auto STREAM_CACHE_POLICY = StreamCachePolicy::DEFAULT;
+
+/// <summary>
+/// Purpose: Enable to NOT load the metadata that NO Decoder reads (e.g. the cover art in ID3v2 Tags, FLAC PICTURE Blocks, and APEv2 Tags) into the Memory Buffers.
+/// Only the headers of the containers are read, to find their lengths. Reduces the bytes read and the Memory used, for Files with large embedded artwork.
+/// </summary>
+constexpr auto SPARSE_LOADING_ENABLED = false;
+
+/// <summary>
+/// Purpose: The smallest container body that is NOT loaded (64k). A smaller body costs less to read than an extra seek.
+/// </summary>
+constexpr auto SPARSE_LOADING_MINIMUM_SKIP_SIZE = 65536ULL;
+
+/// <summary>
+/// Purpose: Enable to walk the framing of each container (e.g. its Frame or item headers) before it is skipped. A container with damaged framing is loaded instead.
+/// </summary>
+constexpr auto SPARSE_LOADING_FRAMING_VALIDATION_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to verify the supported Files within ZIP and TAR Archives, without extracting them. The members are listed as "archive!member".
+/// </summary>
+constexpr auto ARCHIVE_SCANNING_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to verify the Files listed by URL in an M3U Playlist (e.g. the pre-signed URLs of an S3-compatible object gateway), without downloading them first.
+/// Each File is read with HTTP range requests, over connections that are kept alive from one File to the next.
+/// </summary>
+constexpr auto REMOTE_STREAMING_ENABLED = false;
+
+/// <summary>
+/// Purpose: Enable to verify the .md5, .sfv, .xxh64, and .ffp manifests found while scanning, against the Files they list.
+/// Each File is hashed as it is read for the Decoder, so it is NOT read twice. A File that is NOT read to the end (e.g. when the Decoder samples it) is NOT verified.
+/// </summary>
+constexpr auto SIDECAR_VERIFICATION_ENABLED = false;
+
+/// <summary>
+/// Purpose: The number of bytes fetched by each HTTP range request (1 MB).
+/// </summary>
+constexpr auto REMOTE_STREAM_RANGE_SIZE = 1048576UL;
+
+/// <summary>
+/// Purpose: The number of range requests sent in parallel for each File, which hides the round trip time of each request.
+/// </summary>
+constexpr auto REMOTE_STREAM_PREFETCH_RANGE_COUNT = 4UL;
+
+/// <summary>
+/// Purpose: The number of ranges of each File kept in Memory, when the File is NOT read into a Memory Buffer. At least REMOTE_STREAM_PREFETCH_RANGE_COUNT + 1.
+/// </summary>
+constexpr auto REMOTE_STREAM_WINDOW_RANGE_COUNT = 8UL;
+
+/// <summary>
+/// Purpose: A delay added before each range request (in milliseconds), so a local stand-in server can be measured with the latency of a distant gateway. 0 to disable.
+/// </summary>
+constexpr auto REMOTE_STREAM_INJECTED_LATENCY_MILLISECONDS = 0UL;
+
 /// <summary>
 /// Purpose: This namespace contains the Main Application elements, other than the WinAPI elements. 
 /// The existence of this namespace helps to reduce unneccessary global variables.
@@ -166,12 +373,32 @@ namespace MainApplication {
             bool GetNextAvailableFilename(std::wstring& filenameRef, HANDLE handlePendingEvent);
             
             /// <summary>
-            /// Purpose: Formats and displays text for the Edit Window. NOTE: Any wchar_t* passed as argument to this function, will be deleted. 
+            /// Purpose: Formats and displays text for the Edit Window. NOTE: Any pointer passed as argument to this function, will be deleted. 
             /// Uses the Critical Section to perform this operation.
             /// </summary>
             /// <param name="filenamePtr">This will be deleted.</param>
-            /// <param name="errorMessagePtr">This willl be deleted.</param>
-            void SetEditWindowText(wchar_t* filenamePtr, wchar_t* errorMessagePtr);
+            /// <param name="errorRecordPtr">This will be deleted. The text of the Record is rendered in the Final Report.</param>
+            void SetEditWindowText(wchar_t* filenamePtr, DecoderErrorRecord* errorRecordPtr);
+
+            /// <summary>
+            /// Purpose: Stores the PCM analysis of a File for the Final Report. NOTE: Any pointer passed as argument to this function, will be deleted.
+            /// </summary>
+            /// <param name="filenamePtr">This will be deleted.</param>
+            /// <param name="analysisResultPtr">This will be deleted.</param>
+            void AddFileAnalysisResult(wchar_t* filenamePtr, PcmAnalysisResult* analysisResultPtr);
+
+            /// <summary>
+            /// Purpose: Stores the AccurateRip and CRC32 checksums of a File for the Final Report. NOTE: Any pointer passed as argument to this function, will be deleted.
+            /// </summary>
+            /// <param name="filenamePtr">This will be deleted.</param>
+            /// <param name="checksumResultPtr">This will be deleted.</param>
+            void AddFileChecksumResult(wchar_t* filenamePtr, AccurateRipChecksumResult* checksumResultPtr);
+
+            /// <summary>
+            /// Purpose: Stores a File that the quick tail-only check found truncated, so it is listed first in the Final Report. NOTE: Any pointer passed as argument to this function, will be deleted.
+            /// </summary>
+            /// <param name="filenamePtr">This will be deleted.</param>
+            void AddTruncatedFile(wchar_t* filenamePtr);
             
             /// <summary>
             /// Purpose: Sets the start of the Timer Tick Count.
@@ -205,12 +432,46 @@ namespace MainApplication {
             /// It is the Caller's responsibility to dispose of the Heap Memory associated with the returned wchar_t*.</returns>
             wchar_t* GetSecondCommandLineArgument();
 
+            /// <summary>
+            /// Purpose: Reserves the Threads for a File taken from the queue. The idle CPUs that the queued Files do NOT need are lent to the File,
+            /// in proportion to the size of the File against the queued bytes, but only as many as its Decoder can use.
+            /// Called before the File is opened, and outside of any read serialization, since it reads the size of the File.
+            /// </summary>
+            /// <param name="filenamePtr">The filename.</param>
+            /// <returns>The number of Threads reserved for the Decoder (at least 1). Must be returned with ReleaseDecoderThreads(), once the File is decoded.</returns>
+            unsigned long ReserveDecoderThreads(const wchar_t* filenamePtr);
+
             /// <summary>
             /// Purpose: Opens a Decoder for the specified filename and returns Memory-managed Smart Pointer to the Decoder.
             /// </summary>
             /// <param name="filenamePtr">The filename.</param>
+            /// <param name="reservedThreadCount">The number of Threads reserved for the Decoder by ReserveDecoderThreads().</param>
+            /// <returns>A Memory-managed Smart Pointer to the Decoder. The returned pointer can be NULL.</returns>
+            std::unique_ptr<PureAbstractBaseDecoder> OpenDecoder(const wchar_t* filenamePtr, unsigned long reservedThreadCount);
+
+            /// <summary>
+            /// Purpose: Returns the Threads reserved by ReserveDecoderThreads(), so their CPUs can be lent to the next File.
+            /// </summary>
+            void ReleaseDecoderThreads(unsigned long reservedThreadCount);
+
+            /// <summary>
+            /// Purpose: When the File is sampled by the tuning mode, decodes it once per candidate value of each read and unpack size used by its Decoder,
+            /// and records the throughput of each candidate. Called by the Decoder Threads, before the File is verified.
+            /// </summary>
+            /// <param name="filenamePtr">The filename.</param>
+            void TuneDecoder(const wchar_t* filenamePtr);
+
+            /// <summary>
+            /// Purpose: Opens a Decoder for the specified filename, once the Volume of the File admits another read. Used instead of OpenDecoder() within the
+            /// Critical Section, when the reads are admitted per Volume.
+            /// Like the Critical Section, the admission only covers the open, and is released before the File is decoded: with more than one CPU, 
+            /// the Decoders read the whole File into their Memory Buffer while they are opened, so the decode does NOT read the Volume.
+            /// (A STORED Archive member is the exception. It is paged in from the mapping of the Archive while it is decoded.)
+            /// </summary>
+            /// <param name="filenamePtr">The filename.</param>
+            /// <param name="reservedThreadCount">See OpenDecoder().</param>
             /// <returns>A Memory-managed Smart Pointer to the Decoder. The returned pointer can be NULL.</returns>
-            std::unique_ptr<PureAbstractBaseDecoder> OpenDecoder(const wchar_t* filenamePtr);
+            std::unique_ptr<PureAbstractBaseDecoder> OpenAdmittedDecoder(const wchar_t* filenamePtr, unsigned long reservedThreadCount);
 
             /// <summary>
             /// Purpose: Increments number of Files Processed. Typically invoked after a MSG_THREAD_FILE_PROCESSED Message, which is when a Thread finishes processsing a File.
@@ -336,13 +597,32 @@ namespace MainApplication {
         private:
             std::list<std::wstring> listOfFilenames{};
             std::list<std::wstring> filePassedList{};
-            std::map<std::wstring, std::list<std::wstring>*> filenameToErrorListMap{};
+            std::map<std::wstring, std::list<DecoderErrorRecord>*> filenameToErrorListMap{};
+            std::map<std::wstring, PcmAnalysisResult> filenameToAnalysisResultMap{};
+            std::map<std::wstring, AccurateRipChecksumResult> filenameToChecksumResultMap{};
+            std::set<std::wstring> truncatedFilenameSet{};
+            DecoderTuner decoderTuner{};
+            std::wstring decoderTuningProfileFilename{};
+            VolumeAdmission volumeAdmission{};
+            unsigned long long systemCacheSizeAtStart{};
+            bool systemCacheSizeAtStartIsKnown{ false };
 
             LPCRITICAL_SECTION criticalSectionPtr{ nullptr };
             DecoderManager* decoderManagerPtr{ nullptr };
             ExecutionManager* executionManagerPtr{ nullptr };
 
             DWORD maxCPUCount{};
+
+            /// <summary>
+            /// Purpose: The number of CPUs used by the Files being decoded, including the Threads lent to them. (Shared Data, guarded by the Critical Section)
+            /// </summary>
+            unsigned long busyThreadCount{};
+
+            /// <summary>
+            /// Purpose: The total size in bytes of the queued Files. Kept up to date as Files are queued and taken, so the queue is NOT walked 
+            /// to lend the idle CPUs. (Shared Data, guarded by the Critical Section)
+            /// </summary>
+            unsigned long long queuedByteCount{};
             float elapsedTimerCount{};
             int filesProcessedCount{};
             int totalFilesToProcess{};
@@ -453,6 +733,14 @@ namespace MainApplication {
             /// <param name="folderPtr">The starting Folder for the search.</param>
             void rScanFolderWithCallback(const std::function<void(const wchar_t*)>& boundCallbackRef, const wchar_t* folderPtr);
 
+            /// <summary>
+            /// Purpose: Lists the members of a ZIP or TAR Archive, searching for all supported File Types.
+            /// Each supported member is processed using the specified Callback Function, as "archive!member".
+            /// </summary>
+            /// <param name="boundCallbackRef">A Callback Function used to perform an operation on the supported File Types.</param>
+            /// <param name="archiveFilenamePtr">The Archive.</param>
+            void ScanArchiveWithCallback(const std::function<void(const wchar_t*)>& boundCallbackRef, const wchar_t* archiveFilenamePtr);
+
             /// <summary>
             /// Purpose: Adds a Filename to an internally managed List of Filenames. Uses the Critical Section to perform this operation.
             /// </summary>
@@ -482,7 +770,7 @@ namespace MainApplication {
             void ResetEditWindowSuppport();
 
             /// <summary>
-            /// Purpose: Creates File(s) Errored Text for the Edit Window.
+            /// Purpose: Creates File(s) Errored Text for the Edit Window. When more than one File failed, the errors are also counted by type.
             /// </summary>
             /// <param name="outputFormat"></param>
             void CreateFileErroredText(wchar_t* outputFormat);
@@ -492,6 +780,56 @@ namespace MainApplication {
             /// </summary>
             /// <param name="outputFormat"></param>
             void CreateFilePassedText(wchar_t* outputFormat);
+
+            /// <summary>
+            /// Purpose: Creates the PCM analysis Text for the Edit Window. Only the Files with findings are listed.
+            /// </summary>
+            /// <param name="outputFormat"></param>
+            void CreateFileAnalysisText(wchar_t* outputFormat);
+
+            /// <summary>
+            /// Purpose: Creates the AccurateRip and CRC32 checksum Text for the Edit Window.
+            /// </summary>
+            /// <param name="outputFormat"></param>
+            void CreateFileChecksumText(wchar_t* outputFormat);
+
+            /// <summary>
+            /// Purpose: Creates the sidecar manifest Text for the Edit Window. Only the entries that did NOT match are listed.
+            /// </summary>
+            /// <param name="outputFormat"></param>
+            void CreateSidecarVerificationText(wchar_t* outputFormat);
+
+            /// <summary>
+            /// Purpose: Saves the fastest read and unpack sizes measured by the tuning mode, and creates the throughput curve Text for the Edit Window.
+            /// </summary>
+            void CreateDecoderTuningText();
+
+            /// <summary>
+            /// Purpose: Creates the Text for the Cache Policy, the bytes read and their throughput, the bytes skipped by sparse loading,
+            /// and the size of the System File Cache at the start and the end of the scan.
+            /// </summary>
+            void CreateCachePolicyText();
+
+            /// <summary>
+            /// Purpose: Opens and fully decodes a File using the given tuning profile, on the calling Thread.
+            /// </summary>
+            /// <param name="secondsRef">The time taken to open and decode the File.</param>
+            /// <returns>TRUE if the whole File was decoded. Otherwise, FALSE (e.g. a decoding error, or the Decoder Threads are terminating).</returns>
+            bool DecodeForTuning(const wchar_t* filenamePtr, const DecoderTuningProfile& profileRef, double& secondsRef);
+
+            /// <summary>
+            /// Purpose: Gets the filename of the tuning profile of this machine (i.e. "%LOCALAPPDATA%\WinAudioDecodeR\DecoderTuning.[Computer Name].profile").
+            /// The Folder is created when it does NOT exist.
+            /// </summary>
+            /// <returns>The filename. Empty when the Local AppData Folder could NOT be found.</returns>
+            std::wstring GetDecoderTuningProfileFilename() const;
+
+            /// <summary>
+            /// Purpose: Gets the size of the File Namespace prefix (e.g. "\\?\UNC\") at the start of a filename, which is NOT displayed.
+            /// </summary>
+            /// <param name="filenamePtr"></param>
+            /// <returns>The number of characters to skip. 0 when the filename has NO prefix.</returns>
+            int GetFilenamePrefixSize(const wchar_t* filenamePtr) const;
             
             /// <summary>
             /// Purpose: Configures and creates the Edit Window.
@@ -0,0 +1,109 @@
+#ifndef ARCHIVE_MEMBER_SOURCE_H
+#define ARCHIVE_MEMBER_SOURCE_H
+
+#include <memory>
+#include <vector>
+#include "ArchiveReader.h"
+#include "PureAbstractStreamSource.h"
+
+struct z_stream_s; // The zlib inflate state. (Defined by zlib.h)
+
+/// <summary>
+/// Purpose: The data of a File within a ZIP or TAR Archive, read without extracting the File.
+///
+/// The member is read through a read-only mapping of the Archive, so a STORED member is used in place (zero-copy).
+/// A DEFLATED member is either inflated completely into a Memory Buffer, or inflated on demand into a sliding window,
+/// which is inflated again from the start of the member when an earlier position is read.
+/// </summary>
+class ArchiveMemberSource : public PureAbstractStreamSource
+{
+    public:
+        ArchiveMemberSource();
+        virtual ~ArchiveMemberSource();
+        ArchiveMemberSource(const ArchiveMemberSource& other) = delete; // Delete Copy Constructor
+        ArchiveMemberSource& operator=(const ArchiveMemberSource& other) = delete; // Delete Assignment Operator (Overloaded)
+        ArchiveMemberSource(ArchiveMemberSource&& other) noexcept = delete; // Delete The Move Constructor
+        ArchiveMemberSource& operator=(ArchiveMemberSource&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Maps the data of an Archive member.
+        /// </summary>
+        /// <param name="sequentialScanIsEnabled">Set to TRUE to open the Archive with FILE_FLAG_SEQUENTIAL_SCAN.</param>
+        /// <returns>TRUE if the member was mapped. Otherwise, FALSE (e.g. the member is encrypted, or uses an unsupported compression method).</returns>
+        bool Open(const wchar_t* archiveFilenamePtr, const ArchiveMember& memberRef, bool sequentialScanIsEnabled);
+
+        void Close();
+
+        /// <summary>
+        /// Purpose: Determines whether the member is STORED, so its data can be used in place.
+        /// </summary>
+        bool IsStored() const;
+
+        /// <summary>
+        /// Purpose: Gets a read-only pointer to the data of a STORED member, within the mapping of the Archive.
+        /// </summary>
+        /// <returns>The member data. Otherwise, nullptr if the member is NOT STORED.</returns>
+        const unsigned char* GetStoredDataPtr() const;
+
+        /// <summary>
+        /// Purpose: Gets the number of bytes in the Archive used by the member (i.e. the compressed size).
+        /// </summary>
+        unsigned long long GetCompressedLength() const;
+
+        /// <summary>
+        /// Purpose: Inflates the entire member into a Buffer, and verifies it against the CRC-32 of the ZIP Central Directory.
+        /// </summary>
+        /// <param name="destinationPtr">A Buffer of at least Length() bytes.</param>
+        /// <returns>TRUE if the member was inflated, and its CRC-32 matches. Otherwise, FALSE.</returns>
+        bool InflateAll(unsigned char* destinationPtr);
+
+        /// <summary>
+        /// Purpose: Reads the member through the sliding window, and advances the position by the number of bytes read.
+        /// </summary>
+        /// <returns>The number of bytes read. Less than the size when the end of the member is reached, or its compressed data is damaged.</returns>
+        size_t Read(void* bufferPtr, size_t size) override;
+
+        /// <summary>
+        /// Purpose: Moves the position within the member. Only the position is changed, so the member is inflated by the next Read().
+        /// </summary>
+        /// <returns>0 if the seek was successful. Otherwise, a non-zero value.</returns>
+        int Seek(long long offset, int origin) override;
+
+        long long Tell() const override;
+        long long Length() const override;
+        bool EndOfFile() const override;
+
+    private:
+        void* m_viewPtr{ nullptr }; // The mapped view of the Archive. The File and mapping Handles are closed once the view is mapped.
+        const unsigned char* m_dataPtr{ nullptr };
+        ArchiveMember m_member{};
+
+        std::unique_ptr<z_stream_s> m_inflateStreamPtr{};
+        bool m_inflateIsInitialized{ false };
+        bool m_inflateIsFinished{ false };
+        unsigned long long m_compressedPosition{};
+
+        /// <summary>
+        /// Purpose: The sliding window holds the inflated bytes from m_windowStart. A refill keeps the end of the previous window, so a short seek backwards does NOT restart the inflate.
+        /// </summary>
+        std::vector<unsigned char> m_window{};
+        unsigned long long m_windowStart{};
+        size_t m_windowLength{};
+
+        unsigned long long m_position{};
+        bool m_isEOF{ false };
+
+        /// <summary>
+        /// Purpose: Restarts the inflate from the start of the member, with an empty window.
+        /// </summary>
+        /// <returns>TRUE if the inflate was restarted. Otherwise, FALSE.</returns>
+        bool RestartInflate();
+
+        /// <summary>
+        /// Purpose: Slides the window forwards, and inflates the next bytes of the member into it.
+        /// </summary>
+        /// <returns>TRUE if more bytes were inflated. Otherwise, FALSE (i.e. the end of the member, or damaged compressed data).</returns>
+        bool FillWindow();
+};
+
+#endif // ARCHIVE_MEMBER_SOURCE_H
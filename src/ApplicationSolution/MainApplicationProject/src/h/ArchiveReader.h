@@ -0,0 +1,68 @@
+#ifndef ARCHIVE_READER_H
+#define ARCHIVE_READER_H
+
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Purpose: Separates the Archive filename from the name of a member within it (e.g. L"D:\\Music\\Album.zip!CD1/01 Track.flac").
+/// </summary>
+constexpr auto ARCHIVE_MEMBER_SEPARATOR = L'!';
+
+/// <summary>
+/// Purpose: How the data of an Archive member is stored.
+/// </summary>
+enum class ArchiveCompressionMethod : unsigned char
+{
+    STORED = 0, // The data is NOT compressed, so it is read directly from the Archive.
+    DEFLATED,
+    UNSUPPORTED // Any other ZIP compression method. The member is listed, but can NOT be opened.
+};
+
+/// <summary>
+/// Purpose: A File within a ZIP or TAR Archive.
+/// </summary>
+struct ArchiveMember
+{
+    std::wstring name{}; // The name stored in the Archive, with '/' separating its Folders.
+    unsigned long long offset{}; // The offset of the ZIP Local File Header, or the offset of the TAR member data.
+    unsigned long long compressedSize{};
+    unsigned long long uncompressedSize{};
+    unsigned long crc32{};
+    ArchiveCompressionMethod compressionMethod{ ArchiveCompressionMethod::STORED };
+    bool hasLocalHeader{ false }; // TRUE for a ZIP member, whose data follows a Local File Header of variable size.
+    bool isEncrypted{ false };
+};
+
+/// <summary>
+/// Purpose: Lists the members of ZIP and TAR Archives, without extracting them.
+/// A ZIP Archive is listed from its Central Directory (including ZIP64), and a TAR Archive from its member headers (ustar, GNU long names, and pax paths).
+/// The listing of recently used Archives is cached, so a member is found without reading the Archive again. Thread-safe.
+/// </summary>
+namespace ArchiveReader
+{
+    /// <summary>
+    /// Purpose: Determines whether a filename is a ZIP or TAR Archive, using its File Extension. NOT case sensitive.
+    /// </summary>
+    bool IsArchiveType(const wchar_t* filenamePtr);
+
+    /// <summary>
+    /// Purpose: Splits the path of an Archive member at the separator that follows the Archive File Extension.
+    /// </summary>
+    /// <returns>TRUE if the path names an Archive member. Otherwise, FALSE (i.e. an ordinary File).</returns>
+    bool SplitMemberPath(const wchar_t* pathPtr, std::wstring& archiveFilenameRef, std::wstring& memberNameRef);
+
+    /// <summary>
+    /// Purpose: Lists the Files of an Archive, in the order they are stored. Folders are NOT listed.
+    /// </summary>
+    /// <returns>TRUE if the Archive was read. Otherwise, FALSE (e.g. the File is NOT a valid Archive).</returns>
+    bool ListMembers(const wchar_t* archiveFilenamePtr, std::vector<ArchiveMember>& membersRef);
+
+    /// <summary>
+    /// Purpose: Finds a File of an Archive by its name. Case sensitive.
+    /// </summary>
+    /// <returns>TRUE if the member was found. Otherwise, FALSE.</returns>
+    bool FindMember(const wchar_t* archiveFilenamePtr, const std::wstring& memberNameRef, ArchiveMember& memberRef);
+}
+
+#endif // ARCHIVE_READER_H
@@ -0,0 +1,32 @@
+#ifndef CRC16_H
+#define CRC16_H
+
+#include <cstddef>
+
+/// <summary>
+/// Purpose: The CRC-16 calculations (Polynomial 0x8005) shared by the Decoders. Both use slice-by-8 Lookup Tables, built at compile time.
+/// 
+/// URI: https://reveng.sourceforge.io/crc-catalogue/16.htm
+/// </summary>
+namespace CRC16
+{
+    /// <summary>
+    /// Purpose: Performs the CRC-16 calculation processed most significant bit first (i.e. the FLAC Frame Footer, and the MPEG Audio Frame CRC), 8 bytes at a time.
+    /// </summary>
+    /// <param name="crc">The running CRC value. Use the Initial value of the CRC for the first call (0 for FLAC, 0xFFFF for MPEG Audio).</param>
+    /// <param name="dataPtr">The Buffer data to check with the CRC-16 Algorithm.</param>
+    /// <param name="dataLength">The length of the Buffer Data.</param>
+    /// <returns>The updated CRC value.</returns>
+    unsigned short Update(unsigned short crc, const unsigned char* dataPtr, size_t dataLength);
+
+    /// <summary>
+    /// Purpose: Performs the CRC-16 calculation processed least significant bit first (Polynomial 0xA001 reflected, i.e. the LAME Tag CRC), 8 bytes at a time.
+    /// </summary>
+    /// <param name="crc">The running CRC value. Use 0 for the first call.</param>
+    /// <param name="dataPtr">The Buffer data to check with the CRC-16 Algorithm.</param>
+    /// <param name="dataLength">The length of the Buffer Data.</param>
+    /// <returns>The updated CRC value.</returns>
+    unsigned short UpdateReflected(unsigned short crc, const unsigned char* dataPtr, size_t dataLength);
+}
+
+#endif // CRC16_H
@@ -0,0 +1,95 @@
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+#include <string>
+
+#pragma region CPU_DISPATCH_ADJUSTMENT_FOR_COMPILATION_TARGET
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+// _M_X64 and _M_IX86 are defined by MSVC, __x86_64__ and __i386__ by GCC and Clang, when the compilation target is x64 or x86.
+// The SIMD kernel variants are only compiled for these targets. Other targets (e.g. ARM64) always use the scalar kernels.
+
+#define CPU_DISPATCH_X86_ENABLED
+
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+// GCC and Clang only emit the instructions enabled for a function, so every SIMD kernel variant names its own target (e.g. "avx2").
+// The helper functions of a variant use CPU_DISPATCH_INLINE_TARGET, and the entry function uses CPU_DISPATCH_TARGET,
+// which inlines every call into the entry function (i.e. flatten), including the calls made by shared templates (e.g. the MD5 Transform).
+
+#define CPU_DISPATCH_TARGET(targetName) __attribute__((target(targetName), flatten))
+#define CPU_DISPATCH_INLINE_TARGET(targetName) __attribute__((target(targetName))) inline
+
+#else
+// MSVC emits the intrinsics of every instruction set, regardless of the /arch option, so NO attribute is needed.
+
+#define CPU_DISPATCH_TARGET(targetName)
+#define CPU_DISPATCH_INLINE_TARGET(targetName) inline
+
+#endif
+#pragma endregion CPU_DISPATCH_ADJUSTMENT_FOR_COMPILATION_TARGET
+
+/// <summary>
+/// Purpose: The name of the Environment Variable that limits the instruction sets used by the kernels (e.g. "SSE2" to test the SSE2 variants on an AVX-512 CPU).
+/// </summary>
+constexpr auto CPU_DISPATCH_ENVIRONMENT_VARIABLE = "WINAUDIODECODER_CPU_DISPATCH";
+
+/// <summary>
+/// Purpose: The instruction sets, in order. A level includes every level below it.
+/// </summary>
+enum class CpuDispatchLevel : unsigned char
+{
+    SCALAR = 0,
+    SSE2,
+    SSE4_2, // Also includes PCLMULQDQ and SHA.
+    AVX2,
+    AVX512
+};
+
+/// <summary>
+/// Purpose: The CPU features used by the kernels. A feature is only set when both the CPU and the OS support it (i.e. the OS saves the AVX registers).
+/// </summary>
+struct CpuFeatures
+{
+    bool sse2{ false };
+    bool sse42{ false };
+    bool pclmul{ false };
+    bool sha{ false };
+    bool avx2{ false };
+    bool avx512f{ false };
+};
+
+/// <summary>
+/// Purpose: The runtime CPU feature dispatch shared by the SIMD kernels (e.g. the MD5 lanes, CRC32, and AccurateRip).
+///
+/// The CPU features are detected once, on first use. Each kernel family binds its function pointers once, from the features,
+/// and records the chosen variant, so the variants can be listed in the Final Report.
+/// </summary>
+namespace CpuDispatch
+{
+    /// <summary>
+    /// Purpose: Sets the highest instruction set used by the kernels. Must be called before any kernel is used, otherwise it has NO effect.
+    /// When NOT called, or called with nullptr or an empty String, the CPU_DISPATCH_ENVIRONMENT_VARIABLE Environment Variable is used.
+    /// </summary>
+    /// <param name="levelNamePtr">"SCALAR", "SSE2", "SSE4.2", "AVX2", or "AVX512". NOT case sensitive.</param>
+    void Initialize(const char* levelNamePtr);
+
+    /// <summary>
+    /// Purpose: Gets the CPU features, limited to the level set by Initialize() or the Environment Variable.
+    /// </summary>
+    const CpuFeatures& GetFeatures();
+
+    /// <summary>
+    /// Purpose: Records the variant chosen for a kernel family. Called once per kernel family, when its function pointers are bound.
+    /// </summary>
+    /// <param name="familyNamePtr">The kernel family (e.g. "CRC32"). Must be a String literal.</param>
+    /// <param name="variantNamePtr">The variant (e.g. "PCLMUL"). Must be a String literal.</param>
+    void RecordVariant(const char* familyNamePtr, const char* variantNamePtr);
+
+    /// <summary>
+    /// Purpose: Renders the CPU features, and the variant chosen for every kernel family used so far (e.g. "SSE2 SSE4.2 AVX2 | CRC32: PCLMUL, MD5 lanes: AVX2 (8 lanes)").
+    /// </summary>
+    std::wstring GetReport();
+}
+
+#endif // CPU_DISPATCH_H
@@ -0,0 +1,148 @@
+#ifndef DECODER_ERROR_LOG_H
+#define DECODER_ERROR_LOG_H
+
+#include <cstddef>
+
+/// <summary>
+/// Purpose: The maximum number of Error Records kept per File. Once full, the last Record is overwritten, so the latest error is always kept.
+/// </summary>
+constexpr auto MAX_DECODER_ERROR_RECORD_COUNT = 8UL;
+
+/// <summary>
+/// Purpose: The type of an error reported by a Decoder. The text of each type is only rendered when the error is reported.
+/// See the Error Message Guide for the meaning of each type.
+/// </summary>
+enum class DecoderErrorCode : unsigned short
+{
+    NONE = 0,
+
+    // General
+    UNABLE_TO_OPEN_DECODER,
+    TRUNCATED,
+    LOST_SYNC,
+    LOST_SYNC_AT_END_OF_FILE,
+    SEEK_ERROR,
+    MD5_MISMATCH,
+    MISSING_SAMPLES,
+    EXTRA_SAMPLES,
+
+    // FLAC
+    LOST_SYNC_ID3v1_TAG_FOUND,
+    BAD_HEADER,
+    FRAME_CRC_MISMATCH,
+    UNPARSEABLE_STREAM,
+    BAD_METADATA,
+    DECODER_ABORTED,
+    MEMORY_ALLOCATION_ERROR,
+    OGG_LAYER_ERROR,
+    DECODER_ERROR,
+    DECODER_LOST_SYNC,
+
+    // MP3
+    UNRECOGNIZED_FORMAT,
+    BAD_ID3v2_TAG,
+    BAD_STARTING_SYNC,
+    BAD_APE_TAG,
+    BAD_LYRICS3v1_TAG,
+    BAD_LYRICS3v2_TAG,
+    CRC_ERROR,
+    DECODE_ERROR,
+    MISSING_FRAMES,
+    EXTRA_FRAMES,
+    MISSING_BYTES,
+    EXTRA_BYTES,
+    MUSIC_CRC_MISMATCH,
+    BIT_RESERVOIR_ERROR,
+
+    // WavPack
+    BAD_BLOCKS,
+    SAMPLE_COUNT_UNKNOWN_ERROR,
+
+    // Ogg-Vorbis
+    OGG_VORBIS_HOLE,
+    OGG_VORBIS_EBADLINK,
+    UNREADABLE_OR_CORRUPT_HEADER,
+    READ_ERROR,
+    NON_VORBIS_DATA_IN_BITSTREAM,
+    VORBIS_VERSION_MISMATCH,
+    INVALID_VORBIS_HEADER,
+    DECODER_FAULT_OCCURRED,
+
+    COUNT // The number of Error Codes. Must be last.
+};
+
+/// <summary>
+/// Purpose: A compact record of a single error. Recording an error does NOT format any text.
+/// </summary>
+struct DecoderErrorRecord
+{
+    DecoderErrorCode code{ DecoderErrorCode::NONE };
+
+    /// <summary>
+    /// Purpose: The number of position units per second (e.g. the Sampling Rate). When 0, the position is NOT reported as a time.
+    /// </summary>
+    unsigned long timeBase{};
+
+    /// <summary>
+    /// Purpose: The position of the error within the Stream (e.g. a sample number), in units of the time base.
+    /// </summary>
+    unsigned long long position{};
+
+    /// <summary>
+    /// Purpose: A codec-specific detail word. For the count based types (e.g. MISSING_SAMPLES) the count.
+    /// </summary>
+    long long detail{};
+};
+
+/// <summary>
+/// Purpose: A fixed-size, per-File list of Error Records. No memory is allocated when an error is recorded.
+/// </summary>
+class DecoderErrorLog
+{
+    public:
+        DecoderErrorLog();
+        virtual ~DecoderErrorLog();
+        DecoderErrorLog(const DecoderErrorLog& other) = delete; // Delete Copy Constructor
+        DecoderErrorLog& operator=(const DecoderErrorLog& other) = delete; // Delete Assignment Operator (Overloaded)
+        DecoderErrorLog(DecoderErrorLog&& other) noexcept = delete; // Delete The Move Constructor
+        DecoderErrorLog& operator=(DecoderErrorLog&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Records an error. Once the Log is full, the last Record is overwritten.
+        /// </summary>
+        void Add(const DecoderErrorRecord& record);
+
+        /// <summary>
+        /// Purpose: The number of Records held.
+        /// </summary>
+        size_t GetCount() const;
+
+        /// <summary>
+        /// Purpose: Gets a Record by index, in the order the errors were recorded.
+        /// </summary>
+        const DecoderErrorRecord& GetRecord(size_t index) const;
+
+        /// <summary>
+        /// Purpose: Gets the latest Record. The code is NONE when no error was recorded.
+        /// </summary>
+        const DecoderErrorRecord& GetLast() const;
+
+        /// <summary>
+        /// Purpose: Renders the text of a Record, as shown in the Final Report (e.g. "LOST_SYNC @ 1m 05s" or "12 MISSING_SAMPLES").
+        /// </summary>
+        /// <param name="record">The Record.</param>
+        /// <param name="bufferPtr">Receives the null-terminated text.</param>
+        /// <param name="bufferSize">The size of the buffer in characters.</param>
+        static void Render(const DecoderErrorRecord& record, wchar_t* bufferPtr, size_t bufferSize);
+
+        /// <summary>
+        /// Purpose: Gets the name of an Error Code, used to group the errors by type.
+        /// </summary>
+        static const wchar_t* GetCodeName(DecoderErrorCode code);
+
+    private:
+        DecoderErrorRecord m_records[MAX_DECODER_ERROR_RECORD_COUNT]{};
+        size_t m_count{};
+};
+
+#endif // DECODER_ERROR_LOG_H
@@ -2,14 +2,15 @@
 #define DECODER_MANAGER_H
 
 #include <list>
-#include <map>
 #include <memory>
-#include "Utils.h"
 #include "PureAbstractBaseDecoder.h"
+#include "DecoderRegistry.h"
 #include "MP3Decoder.h"
+#include "MP3DeepDecoder.h"
 #include "OggVorbisDecoder.h"
 #include "FlacDecoder.h"
 #include "WavPackDecoder.h"
+#include "MultiBufferMD5Service.h"
 
 /// <summary>
 /// Purpose: A Class used to manage Decoders.
@@ -31,12 +32,30 @@ class DecoderManager
         /// <returns>A Memory-managed Smart Pointer to the Decoder. The returned pointer can be NULL.</returns>
         std::unique_ptr<PureAbstractBaseDecoder> OpenDecoderSmartPointer(const wchar_t* filenamePtr);
 
+        /// <summary>
+        /// Purpose: Opens a Decoder for the specified filename and returns Memory-managed Smart Pointer to the Decoder.
+        /// </summary>
+        /// <param name="filenamePtr">The filename.</param>
+        /// <param name="availableThreadCount">The number of Threads the Decoder may use to verify a single large File concurrently.</param>
+        /// <returns>A Memory-managed Smart Pointer to the Decoder. The returned pointer can be NULL.</returns>
+        std::unique_ptr<PureAbstractBaseDecoder> OpenDecoderSmartPointer(const wchar_t* filenamePtr, unsigned long availableThreadCount);
+
         /// <summary>
         /// Purpose: Determines whether the filename is considered to be type supported by the available Decoders.
         /// </summary>
         /// <param name="filenamePtr">The filename to be checked for Decoder support.</param>
         /// <returns>TRUE if the file is supported by an available Decoder. Otherwise, FALSE if the file is not supported by any of the available Decoders.</returns>
         bool IsSupportedType(const wchar_t* filenamePtr);
+
+        /// <summary>
+        /// Purpose: Gets the number of Threads, beyond the Decoder Thread, that the Decoder of the File can put to use. 
+        /// An Ogg-Vorbis File held in a Memory Buffer can use one Thread per Segment, and a FLAC or WavPack File can use one Thread for its PCM Pipeline.
+        /// Other Decoders (e.g. MP3) only run on the Decoder Thread. The Decoder is chosen by File Extension, so the File is NOT read.
+        /// </summary>
+        /// <param name="filenamePtr">The filename.</param>
+        /// <param name="spareThreadCount">The number of Threads that are spare.</param>
+        /// <returns>The number of spare Threads the Decoder can use. 0 if it can NOT use any.</returns>
+        unsigned long GetUsableSpareThreadCount(const wchar_t* filenamePtr, unsigned long spareThreadCount) const;
         
         /// <summary>
         /// Purpose: Set the Decoder Manager configuration to enable/disable the use of Memory Buffers with managed Decoders.
@@ -45,33 +64,83 @@ class DecoderManager
         /// <param name="value"></param>
         void SetDecoderMemoryBufferEnabled(bool value);
 
+        /// <summary>
+        /// Purpose: Set the Decoder Manager configuration to enable/disable fully decoding MP3 Files, instead of only walking the MP3 Frame Headers.
+        /// </summary>
+        /// <param name="value"></param>
+        void SetMP3DeepDecodeEnabled(bool value);
+
+        /// <summary>
+        /// Purpose: Set the Decoder Manager configuration to verify a number of sampled Windows of every opened File, instead of fully decoding it.
+        /// A value of 0 disables sampling. Files that can NOT be sampled are still fully decoded.
+        /// </summary>
+        /// <param name="value">The number of Windows to verify per File.</param>
+        void SetSampledVerificationWindowCount(unsigned long value);
+
+        /// <summary>
+        /// Purpose: Set the Decoder Manager configuration to enable/disable the analysis of the decoded PCM of every fully decoded File.
+        /// A sampled File is NOT analyzed, since most of its samples are NOT decoded.
+        /// </summary>
+        /// <param name="value"></param>
+        void SetPcmAnalysisEnabled(bool value);
+
+        /// <summary>
+        /// Purpose: Set the Decoder Manager configuration to enable/disable the AccurateRip and CRC32 checksums of every fully decoded lossless CD Audio File.
+        /// </summary>
+        /// <param name="value"></param>
+        void SetAccurateRipChecksumEnabled(bool value);
+
+        /// <summary>
+        /// Purpose: Set the Decoder Manager configuration to enable/disable choosing the Decoder from the magic bytes at the start of each opened File, 
+        /// instead of from its File Extension. A misnamed File (e.g. a FLAC File named '.mp3') is then opened with the right Decoder.
+        /// </summary>
+        /// <param name="value"></param>
+        void SetMagicByteSniffingEnabled(bool value);
+
+        /// <summary>
+        /// Purpose: Set the Decoder Manager configuration to enable/disable a second Thread per File for the MD5 signature, the PCM analysis, and the checksums,
+        /// when the File is given more than one available Thread (e.g. the last large Files of a scan).
+        /// </summary>
+        /// <param name="value"></param>
+        void SetPcmPipelineEnabled(bool value);
+
+        /// <summary>
+        /// Purpose: Set the Decoder Manager configuration to enable/disable hashing the MD5 Input Messages of the opened FLAC and WavPack Files together, 
+        /// using a single MD5 service shared by the Decoder Threads. Must NOT be changed while any opened Decoder is in use.
+        /// </summary>
+        /// <param name="value"></param>
+        void SetMultiBufferMD5Enabled(bool value);
+
         
     private:
-        static constexpr auto UNSUPPORTED_TYPE = L"UNSUPPORTED";
-        std::map<std::wstring, std::wstring> m_fileExtensionToDecoderNameMap{};
         bool decoderMemoryBufferEnabled{ false };
+        bool mp3DeepDecodeEnabled{ false };
+        unsigned long sampledVerificationWindowCount{ 0UL };
+        bool pcmAnalysisEnabled{ false };
+        bool accurateRipChecksumEnabled{ false };
+        bool magicByteSniffingEnabled{ false };
+        bool pcmPipelineEnabled{ false };
 
         /// <summary>
-        /// Purpose: An internal helper function used to populate an internal Map used by the Decoder Manager, that 
-        /// associated a File Extension with a Decoder. The Map is useful for quick file extension to Decoder name lookups.
+        /// Purpose: The MD5 service shared by the opened Decoders. NULL when the multi-buffer MD5 is disabled.
         /// </summary>
-        /// <param name="supportedTypesPtr">An Array of null-terminated File Extensions.</param>
-        /// <param name="decoderName">The Decoder name to be associated with the File Extensions.</param>
-        void PopulateFileExtensionToDecoderNameMap(const wchar_t* supportedTypesPtr, const wchar_t* decoderName);
+        std::unique_ptr<MultiBufferMD5Service> multiBufferMD5ServicePtr{};
 
         /// <summary>
-        /// Purpose: A read-only private helper function used to find a Decoder Name for the given filename. The Object state is not modified.
+        /// Purpose: A read-only private helper function used to find the Decoder for the given filename. The Object state is not modified.
+        /// When magic byte sniffing is enabled, the start of the File is read. Otherwise, only the File Extension is used.
         /// </summary>
         /// <param name="filenamePtr"></param>
-        /// <returns></returns>
-        std::wstring FindDecoderType(const wchar_t* filenamePtr) const;
+        /// <returns>The Decoder. UNSUPPORTED when NO Decoder was found.</returns>
+        DecoderType FindDecoderType(const wchar_t* filenamePtr) const;
         
         /// <summary>
         /// Purpose: Opens a Decoder on the specified filename.
         /// </summary>
         /// <param name="filenamePtr"></param>
+        /// <param name="availableThreadCount">The number of Threads the Decoder may use to verify a single large File concurrently.</param>
         /// <returns>A Raw Pointer to a Pure Abstract Base Class (PABC) Interface for the Decoder.</returns>
-        PureAbstractBaseDecoder* OpenDecoder(const wchar_t* filenamePtr) const;
+        PureAbstractBaseDecoder* OpenDecoder(const wchar_t* filenamePtr, unsigned long availableThreadCount) const;
 };
 
 #endif // DECODER_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef DECODER_REGISTRY_H
+#define DECODER_REGISTRY_H
+
+#include <cstddef>
+
+/// <summary>
+/// Purpose: The Decoders that can be opened by the Decoder Manager.
+/// </summary>
+enum class DecoderType : unsigned char
+{
+    UNSUPPORTED = 0,
+    FLAC,
+    MP3,
+    WAV_PACK,
+    OGG_VORBIS
+};
+
+/// <summary>
+/// Purpose: The number of leading bytes of a File needed to identify its Decoder by content (i.e. the magic bytes, and an ID3v2 Tag Header).
+/// </summary>
+constexpr auto DECODER_REGISTRY_SNIFF_SIZE = 10UL;
+
+/// <summary>
+/// Purpose: A Registry of the Decoders, built at compile time from the File Extensions of each Decoder.
+/// The File Extension lookup uses a Perfect Hash Table, so it does NOT allocate Memory or compare Strings.
+/// </summary>
+namespace DecoderRegistry
+{
+    /// <summary>
+    /// Purpose: Finds the Decoder for a filename, using its File Extension. The File Extension is NOT case sensitive.
+    /// </summary>
+    /// <param name="filenamePtr">The filename.</param>
+    /// <returns>The Decoder. UNSUPPORTED when the File Extension does NOT belong to any Decoder.</returns>
+    DecoderType FindByExtension(const wchar_t* filenamePtr);
+
+    /// <summary>
+    /// Purpose: Finds the Decoder for a File, using the magic bytes at the start of the File ('fLaC', 'ID3' or an MPEG Frame Sync, 'OggS', 'wvpk').
+    /// An ID3v2 Tag is skipped, since some FLAC Files start with one.
+    /// </summary>
+    /// <param name="filenamePtr">The filename.</param>
+    /// <returns>The Decoder. UNSUPPORTED when the File can NOT be read, or the content is NOT recognized.</returns>
+    DecoderType FindByContent(const wchar_t* filenamePtr);
+
+    /// <summary>
+    /// Purpose: Identifies the Decoder from the leading bytes of a File.
+    /// </summary>
+    /// <param name="headerPtr">The leading bytes of the File.</param>
+    /// <param name="size">The number of leading bytes. Should be at least DECODER_REGISTRY_SNIFF_SIZE.</param>
+    /// <returns>The Decoder. UNSUPPORTED when the content is NOT recognized.</returns>
+    DecoderType Sniff(const unsigned char* headerPtr, size_t size);
+}
+
+#endif // DECODER_REGISTRY_H
@@ -0,0 +1,187 @@
+#ifndef DECODER_TUNING_H
+#define DECODER_TUNING_H
+
+#include "DecoderRegistry.h"
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Purpose: The default size of each fread_s() call, when a File is read into a Memory Buffer. The maximum Block Size for NTFS and ReFS (64k).
+/// </summary>
+constexpr auto DEFAULT_STREAM_READ_BLOCK_SIZE = 65536UL;
+
+/// <summary>
+/// Purpose: The default maximum number of decoded Ogg-Vorbis Samples (per channel) produced by each ov_read_float() call.
+/// </summary>
+constexpr auto DEFAULT_OGG_VORBIS_READ_CHUNK_SIZE = 4096UL;
+
+/// <summary>
+/// Purpose: The default number of Unpacked WavPack Samples (all channels) requested by each WavpackUnpackSamples() call.
+/// </summary>
+constexpr auto DEFAULT_WAVPACK_UNPACK_SAMPLE_COUNT = 4096UL;
+
+/// <summary>
+/// Purpose: The read and unpack sizes used by the Decoders. The values are measured per machine in the tuning mode, and loaded from a profile File at startup.
+/// </summary>
+struct DecoderTuningProfile
+{
+    unsigned long streamReadBlockSize{ DEFAULT_STREAM_READ_BLOCK_SIZE };
+    unsigned long oggVorbisReadChunkSize{ DEFAULT_OGG_VORBIS_READ_CHUNK_SIZE };
+    unsigned long wavPackUnpackSampleCount{ DEFAULT_WAVPACK_UNPACK_SAMPLE_COUNT };
+};
+
+/// <summary>
+/// Purpose: The tunable values of a DecoderTuningProfile, in the order they are swept.
+/// </summary>
+enum class DecoderTuningParameter : unsigned char
+{
+    STREAM_READ_BLOCK_SIZE = 0,
+    OGG_VORBIS_READ_CHUNK_SIZE,
+    WAVPACK_UNPACK_SAMPLE_COUNT
+};
+
+constexpr auto DECODER_TUNING_PARAMETER_COUNT = 3UL;
+
+/// <summary>
+/// Purpose: The process-wide Decoder tuning profile, and its profile File.
+///
+/// The Decoders read the profile when a File is opened. A Thread may replace the profile for itself only (see DecoderTuningScope),
+/// so a File can be decoded with candidate values while the other Decoder Threads keep the process-wide values.
+/// </summary>
+namespace DecoderTuning
+{
+    /// <summary>
+    /// Purpose: Gets the profile of the calling Thread. This is the process-wide profile, unless a DecoderTuningScope is active on the Thread.
+    /// </summary>
+    DecoderTuningProfile GetProfile();
+
+    /// <summary>
+    /// Purpose: Sets the process-wide profile. Used by the Files opened afterwards.
+    /// </summary>
+    void SetProfile(const DecoderTuningProfile& profileRef);
+
+    /// <summary>
+    /// Purpose: Loads a profile File. A missing or invalid value keeps the value already in the profile.
+    /// </summary>
+    /// <returns>TRUE if the File was read. Otherwise, FALSE (e.g. the File does NOT exist yet).</returns>
+    bool LoadProfile(const wchar_t* filenamePtr, DecoderTuningProfile& profileRef);
+
+    /// <summary>
+    /// Purpose: Saves a profile File, as one "NAME=VALUE" line per parameter.
+    /// </summary>
+    /// <returns>TRUE if the File was written. Otherwise, FALSE.</returns>
+    bool SaveProfile(const wchar_t* filenamePtr, const DecoderTuningProfile& profileRef);
+
+    /// <summary>
+    /// Purpose: Gets the name of a parameter, as written in the profile File (e.g. "STREAM_READ_BLOCK_SIZE").
+    /// </summary>
+    const wchar_t* GetParameterName(DecoderTuningParameter parameter);
+
+    /// <summary>
+    /// Purpose: Gets the candidate values swept for a parameter, in increasing order.
+    /// </summary>
+    const std::vector<unsigned long>& GetCandidateValues(DecoderTuningParameter parameter);
+
+    /// <summary>
+    /// Purpose: Gets the value of a parameter within a profile.
+    /// </summary>
+    unsigned long GetValue(const DecoderTuningProfile& profileRef, DecoderTuningParameter parameter);
+
+    /// <summary>
+    /// Purpose: Sets the value of a parameter within a profile.
+    /// </summary>
+    void SetValue(DecoderTuningProfile& profileRef, DecoderTuningParameter parameter, unsigned long value);
+
+    /// <summary>
+    /// Purpose: Determines whether a parameter changes how a File of the given Decoder is read.
+    /// </summary>
+    /// <param name="memoryBufferIsEnabled">The read Block Size is only used when the File is read into a Memory Buffer.</param>
+    bool IsUsedByDecoder(DecoderTuningParameter parameter, DecoderType decoderType, bool memoryBufferIsEnabled);
+}
+
+/// <summary>
+/// Purpose: Replaces the profile of the calling Thread, until the Scope ends. Scopes must NOT be nested.
+/// </summary>
+class DecoderTuningScope
+{
+    public:
+        explicit DecoderTuningScope(const DecoderTuningProfile& profileRef);
+        virtual ~DecoderTuningScope();
+        DecoderTuningScope(const DecoderTuningScope& other) = delete; // Delete Copy Constructor
+        DecoderTuningScope& operator=(const DecoderTuningScope& other) = delete; // Delete Assignment Operator (Overloaded)
+        DecoderTuningScope(DecoderTuningScope&& other) noexcept = delete; // Delete The Move Constructor
+        DecoderTuningScope& operator=(DecoderTuningScope&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+    private:
+        DecoderTuningProfile m_profile{};
+};
+
+/// <summary>
+/// Purpose: Collects the throughput measured for each candidate value, from the Files sampled by the Decoder Threads, and picks the fastest values.
+/// Thread-safe.
+/// </summary>
+class DecoderTuner
+{
+    public:
+        DecoderTuner();
+        virtual ~DecoderTuner();
+        DecoderTuner(const DecoderTuner& other) = delete; // Delete Copy Constructor
+        DecoderTuner& operator=(const DecoderTuner& other) = delete; // Delete Assignment Operator (Overloaded)
+        DecoderTuner(DecoderTuner&& other) noexcept = delete; // Delete The Move Constructor
+        DecoderTuner& operator=(DecoderTuner&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Decides whether a File is added to the sample. Every sampleStride-th File of each Decoder is taken, up to sampleFileCount Files per Decoder,
+        /// so the sample is spread across the scan (e.g. across the folders of a library) instead of taken from its start.
+        /// </summary>
+        /// <param name="sampleIndexRef">The index of the File within the sample. Used to rotate the order of the candidate values.</param>
+        /// <returns>TRUE if the File is sampled. Otherwise, FALSE.</returns>
+        bool AcceptSample(DecoderType decoderType, unsigned long sampleStride, unsigned long sampleFileCount, unsigned long& sampleIndexRef);
+
+        /// <summary>
+        /// Purpose: Adds the time taken to open and decode a File of byteCount bytes, using the candidate value.
+        /// </summary>
+        void AddMeasurement(DecoderTuningParameter parameter, unsigned long value, unsigned long long byteCount, double seconds);
+
+        /// <summary>
+        /// Purpose: Gets the number of Files sampled so far.
+        /// </summary>
+        unsigned long GetSampleCount() const;
+
+        /// <summary>
+        /// Purpose: Gets the fastest measured value of each parameter. A parameter without measurements keeps its value from the base profile.
+        /// </summary>
+        DecoderTuningProfile GetBestProfile(const DecoderTuningProfile& baseProfileRef) const;
+
+        /// <summary>
+        /// Purpose: Renders the throughput (MB/s) measured for each candidate value, one line per value, marking the values of the best profile.
+        /// </summary>
+        std::wstring GetThroughputCurve(const DecoderTuningProfile& bestProfileRef) const;
+
+    private:
+        struct Measurement
+        {
+            unsigned long long byteCount{};
+            double seconds{};
+            unsigned long fileCount{};
+        };
+
+        mutable std::mutex m_mutex{};
+
+        /// <summary>
+        /// Purpose: The number of Files seen, and the number of Files sampled, for each Decoder.
+        /// </summary>
+        std::map<DecoderType, std::pair<unsigned long, unsigned long>> m_decoderFileCountMap{};
+        unsigned long m_sampleCount{ 0UL };
+
+        /// <summary>
+        /// Purpose: The measurements of each candidate value, sorted by parameter, then by value.
+        /// </summary>
+        std::map<std::pair<DecoderTuningParameter, unsigned long>, Measurement> m_measurementMap{};
+};
+
+#endif // DECODER_TUNING_H
@@ -67,7 +67,7 @@ namespace MainApplication {
             void AddToProcessedFileList(const wchar_t* filenamePtr);
 
             /// <summary>
-            /// Purpose: Clears the list of processed file names.
+            /// Purpose: Clears the list of processed file names, and their total size.
             /// </summary>
             void ClearProcessedFileList();
 
@@ -76,6 +76,12 @@ namespace MainApplication {
             /// </summary>
             /// <returns>A Reference to the File List.</returns>
             std::list<std::wstring>& GetProcessedFileListRef();
+
+            /// <summary>
+            /// Purpose: Gets the total size in bytes of the processed Files, read while each File was added.
+            /// </summary>
+            /// <returns>The total size in bytes.</returns>
+            unsigned long long GetProcessedByteCount() const;
             
             #pragma region Getter_Setter_Functions_Region
 
@@ -104,6 +110,11 @@ namespace MainApplication {
             /// </summary>
             std::list<std::wstring> processedFileList{};
 
+            /// <summary>
+            /// Purpose: The total size in bytes of the Files in the processed File List.
+            /// </summary>
+            unsigned long long processedByteCount{};
+
             DWORD folderThreadId{};
             HANDLE handleFolderThread{};
 
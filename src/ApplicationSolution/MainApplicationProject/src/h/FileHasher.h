@@ -0,0 +1,96 @@
+#ifndef FILE_HASHER_H
+#define FILE_HASHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include "md5.h"
+
+/// <summary>
+/// Purpose: The whole-File checksums that can be verified against a sidecar manifest.
+/// FLAC_SIGNATURE is NOT computed from the File bytes. It is the MD5 signature of the decoded Audio, stored in the FLAC STREAMINFO Block (as listed in a .ffp fingerprint File).
+/// </summary>
+enum class FileHashAlgorithm : unsigned char
+{
+    MD5 = 0,
+    CRC32,
+    XXH64,
+    FLAC_SIGNATURE
+};
+
+/// <summary>
+/// Purpose: The checksums of a whole File, in the byte order they are written in a manifest (i.e. CRC32 and XXH64 are big-endian).
+/// </summary>
+struct FileDigests
+{
+    unsigned char md5[16]{};
+    unsigned char crc32[4]{};
+    unsigned char xxh64[8]{};
+    unsigned char flacSignature[16]{};
+    bool flacSignatureIsKnown{ false }; // FALSE when the File does NOT start with a FLAC STREAMINFO Block.
+};
+
+/// <summary>
+/// Purpose: Computes the checksums of a whole File from its bytes, in File order. Each Block is hashed once, while it is still in the CPU Cache
+/// (i.e. right after it was read), so the File is NOT read a second time. Only the requested checksums are computed.
+/// The CRC32 uses carry-less multiplication (PCLMULQDQ) when the CPU supports it.
+/// URI: https://www.rfc-editor.org/rfc/rfc1321
+/// URI: https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+/// </summary>
+class FileHasher
+{
+    public:
+        /// <param name="algorithmMask">The checksums to compute. See GetAlgorithmMask().</param>
+        explicit FileHasher(unsigned int algorithmMask);
+        virtual ~FileHasher();
+        FileHasher(const FileHasher& other) = delete; // Delete Copy Constructor
+        FileHasher& operator=(const FileHasher& other) = delete; // Delete Assignment Operator (Overloaded)
+        FileHasher(FileHasher&& other) noexcept = delete; // Delete The Move Constructor
+        FileHasher& operator=(FileHasher&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Gets the bit of a checksum in an algorithm mask.
+        /// </summary>
+        static unsigned int GetAlgorithmMask(FileHashAlgorithm algorithm);
+
+        /// <summary>
+        /// Purpose: Gets the name of a checksum (e.g. L"MD5").
+        /// </summary>
+        static const wchar_t* GetAlgorithmName(FileHashAlgorithm algorithm);
+
+        /// <summary>
+        /// Purpose: Adds the next bytes of the File.
+        /// </summary>
+        void Update(const unsigned char* dataPtr, size_t size);
+
+        /// <summary>
+        /// Purpose: Gets the checksums of all of the bytes added. Must only be called once.
+        /// </summary>
+        FileDigests Finish();
+
+    private:
+        unsigned int m_algorithmMask{};
+        unsigned long long m_totalSize{};
+
+        md5_state_t m_md5State{};
+        uint32_t m_crc32{ 0xFFFFFFFFUL };
+
+        /// <summary>
+        /// Purpose: The four XXH64 accumulators, and the bytes of an incomplete 32-byte Stripe.
+        /// </summary>
+        uint64_t m_xxh64Accumulators[4]{};
+        unsigned char m_xxh64Stripe[32]{};
+        size_t m_xxh64StripeSize{};
+
+        /// <summary>
+        /// Purpose: The start of the File, which holds the FLAC STREAMINFO Block ("fLaC", the 4-byte Block Header, and the 34-byte STREAMINFO).
+        /// </summary>
+        unsigned char m_header[42]{};
+        size_t m_headerSize{};
+
+        /// <summary>
+        /// Purpose: Adds whole 32-byte Stripes to the XXH64 accumulators.
+        /// </summary>
+        void UpdateXxh64Stripes(const unsigned char* dataPtr, size_t stripeCount);
+};
+
+#endif // FILE_HASHER_H
@@ -4,9 +4,23 @@
 #include "PureAbstractBaseDecoder.h"
 #include "AbstractBaseDecoder.h"
 #include "StreamWrapper.h"
+#include "SampledVerificationPlan.h"
+#include "MultiBufferMD5Service.h"
+#include "md5.h"
 #include <stdio.h>
-#include <sstream>
 #include <FLAC++/all.h>
+#include <vector>
+
+/// <summary>
+/// Purpose: The size in bytes of the Frame Header fields and the Subframe Headers, added to the uncompressed Block size to bound the Frame size,
+/// when the STREAMINFO Block does NOT store the maximum Frame size.
+/// </summary>
+constexpr auto FLAC_FRAME_OVERHEAD_BYTES = 64UL;
+
+/// <summary>
+/// Purpose: The number of Frames decoded per Window, when the File is sampled.
+/// </summary>
+constexpr auto FLAC_SAMPLED_WINDOW_FRAME_COUNT = 4UL;
 
 /// FLAC Nomenclature:
 /// 
@@ -41,6 +55,8 @@ class FlacDecoder : public AbstractBaseDecoder, public FLAC::Decoder::Stream
     public:
         FlacDecoder();
         FlacDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled);
+        FlacDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled, MultiBufferMD5Service* md5ServicePtr);
+        FlacDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled, MultiBufferMD5Service* md5ServicePtr, bool pcmPipelineIsRequested);
         virtual ~FlacDecoder();
         FlacDecoder(const FlacDecoder& other) = delete; // Delete Copy Constructor
         FlacDecoder& operator=(const FlacDecoder& other) = delete; // Delete Assignment Operator (Overloaded)
@@ -55,10 +71,37 @@ class FlacDecoder : public AbstractBaseDecoder, public FLAC::Decoder::Stream
         /// <returns>The size of Audio Frame that was read/decoded OR -1 indicating an error occcured.</returns>
         long long Read();
 
+        /// <summary>
+        /// Purpose: Decodes many Audio Frames per call, using the statically dispatched Decode() loop.
+        /// </summary>
+        long long Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds);
+
         unsigned long long GetDecodedAudioDataTotal();
-        const wchar_t* GetLastErrorMessage();
         const wchar_t* GetSupportedTypes();
 
+        /// <summary>
+        /// Purpose: Finds the last Frame in the tail of the File, and compares the sample number at the end of the last Frame against the STREAMINFO total samples.
+        /// </summary>
+        /// <returns>TRUE if the File is truncated. Otherwise, FALSE.</returns>
+        bool CheckForTruncation();
+
+        /// <summary>
+        /// Purpose: Chooses the Windows by sample number. Requires the STREAMINFO total samples.
+        /// </summary>
+        bool EnableSampledVerification(unsigned long windowCount);
+        bool EnablePcmAnalysis();
+
+        /// <summary>
+        /// Purpose: Requires a 44.1kHz, 16-bit, stereo Stream (i.e. CD Audio).
+        /// </summary>
+        bool EnableAccurateRipChecksum();
+
+        /// <summary>
+        /// Purpose: Moves the MD5 signature, the PCM analysis, and the checksums to the Pipeline Thread. Requires an MD5 signature in the STREAMINFO Block, 
+        /// or the PCM analysis or checksums to be enabled.
+        /// </summary>
+        bool EnablePcmPipeline();
+
         #pragma endregion Overridden_Base_Class_Functions_Region
 
         #pragma region Protected_FLAC_Decoder_Stream_Functions_Region
@@ -131,14 +174,90 @@ class FlacDecoder : public AbstractBaseDecoder, public FLAC::Decoder::Stream
         /// </summary>
         unsigned long m_streamSampleRate{};
 
+        /// <summary>
+        /// Purpose: The number of channels and the bits per sample for the Stream.
+        /// </summary>
+        unsigned long m_streamChannelCount{};
+        unsigned long m_streamBitsPerSample{};
+
+        /// <summary>
+        /// Purpose: The minimum and maximum Block Size in samples used in the Stream (the minimum excludes the last Block), 
+        /// and the maximum Frame size in bytes (estimated from the uncompressed Block size when the STREAMINFO Block stores 0).
+        /// </summary>
+        unsigned long m_streamMinimumBlockSize{};
+        unsigned long m_streamMaximumBlockSize{};
+        unsigned long m_streamMaximumFrameSize{};
+
         bool m_errorCallbackFlagEnabled{ false };
-        wchar_t m_errorMessage[MAX_ERROR_SIZE]{};
+
+        /// <summary>
+        /// Purpose: The MD5 signature from the STREAMINFO Block (all zeros when unknown).
+        /// </summary>
+        unsigned char m_streamMD5Signature[MD5_DIGEST_SIZE]{};
+
+        /// <summary>
+        /// Purpose: The MD5 checking of the libFLAC Decoder is used, when neither the shared MD5 service nor the Pipeline Thread computes the MD5 signature.
+        /// FLAC::Decoder::Stream::finish() then reports a mismatch, and the MD5 signature is NOT computed by write_callback().
+        /// </summary>
+        bool m_libFlacMD5CheckingIsEnabled{ false };
+
+        /// <summary>
+        /// Purpose: The MD5 signature is computed by write_callback() while the STREAMINFO Block has a signature, and the File is fully decoded.
+        /// </summary>
+        bool m_md5SignatureIsKnown{ false };
+        md5_state_t m_stateStructMD5Algorithm{};
+
+        /// <summary>
+        /// Purpose: The shared MD5 service, and the Stream of this File. When the Stream is 0, the MD5 Algorithm state above is used instead.
+        /// </summary>
+        MultiBufferMD5Service* m_md5ServicePtr{ nullptr };
+        MD5StreamId m_md5StreamId{ 0UL };
+        std::vector<unsigned char> m_md5PackedSampleBuffer{};
 
         StreamWrapper m_stream{};
         long long m_lastDecodedFrameSampleSize{};
 
+        /// <summary>
+        /// Purpose: The Windows to verify, when the File is sampled.
+        /// </summary>
+        SampledVerificationPlan m_sampledVerificationPlan{};
+
         void OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled);
-        void Truncated(wchar_t errorMessage[]) const;
+
+        /// <summary>
+        /// Purpose: Records the error after FLAC::Decoder::Stream::process_single() failed, or the Error Callback Function was called.
+        /// </summary>
+        void RecordProcessError();
+
+        /// <summary>
+        /// Purpose: The Read() implementation used when the File is sampled. Seeks to the next Window, and decodes its Frames.
+        /// </summary>
+        /// <returns>The Window's share of the total samples, 0 once every Window has been verified, or -1 if an error occurred.</returns>
+        long long ReadSampled();
+        void Truncated(unsigned long long sampleCount);
+
+        /// <summary>
+        /// Purpose: Packs decoded samples in the same layout as the libFLAC Decoder, and appends them to the MD5 Input Message.
+        /// </summary>
+        /// <param name="channelPtrs">A pointer to the first sample of each channel.</param>
+        /// <param name="channelStride">The distance between two samples of a channel (1 for planar samples, the channel count for interleaved samples).</param>
+        void UpdateMD5(const FLAC__int32* const channelPtrs[], unsigned long channelStride, unsigned long channelCount, unsigned long frameCount, unsigned long bitsPerSample);
+
+        /// <summary>
+        /// Purpose: The Pipeline consumer function. Analyzes, checksums, and hashes a Block of interleaved samples on the Pipeline Thread.
+        /// </summary>
+        void ConsumePipelineBlock(int32_t* samplePtr, size_t sampleCount);
+
+        /// <summary>
+        /// Purpose: Parses and validates (using the CRC-8) a Frame Header at the start of a Buffer.
+        /// URI: https://xiph.org/flac/format.html#frame_header
+        /// </summary>
+        /// <param name="dataPtr">A pointer to the start of the Frame Header.</param>
+        /// <param name="size">The number of bytes available from dataPtr.</param>
+        /// <param name="firstSampleNumberRef">Receives the sample number of the first sample in the Frame.</param>
+        /// <param name="blockSizeRef">Receives the Block Size of the Frame in samples.</param>
+        /// <returns>TRUE if a valid Frame Header was found. Otherwise, FALSE.</returns>
+        bool ParseFrameHeader(const unsigned char* dataPtr, size_t size, unsigned long long& firstSampleNumberRef, unsigned long& blockSizeRef) const;
 
         /// <summary>
         /// Purpose: Checks whether an ID3v1 Tag is embedded at the end of the FLAC file.
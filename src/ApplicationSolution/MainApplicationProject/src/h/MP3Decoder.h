@@ -4,7 +4,9 @@
 #include "PureAbstractBaseDecoder.h"
 #include "AbstractBaseDecoder.h"
 #include "StreamWrapper.h"
+#include "SampledVerificationPlan.h"
 #include <string>
+#include <vector>
 
 constexpr auto MPEG1 = 3;
 constexpr auto MPEG2 = 2;
@@ -14,10 +16,31 @@ constexpr auto LAYER_II = 2;
 constexpr auto LAYER_III = 1;
 
 /// <summary>
-/// Purpose: Used to place a limit on the total number of resynchronization attempts.
+/// Purpose: Used to place a limit on the total number of bytes scanned for a Frame Sync, while attempting resynchronization of a File.
 /// </summary>
 constexpr auto MAX_RESYNCHRONIZATION_ATTEMPTS = 65536UL;
 
+/// <summary>
+/// Purpose: The largest possible Frame Length in bytes (MPEG-2.5 Layer II, 160 kbps, 8000 Hz, Padded).
+/// Used as the look-ahead needed for validating a Frame Sync candidate against the Frame Header that follows it.
+/// </summary>
+constexpr auto MP3_MAXIMUM_FRAME_LENGTH = 2881UL;
+
+/// <summary>
+/// Purpose: The size in bytes of the Window of resident Stream data that the Frames are walked over, when the Memory Buffer is NOT enabled.
+/// </summary>
+constexpr auto MP3_WINDOW_SIZE = 256UL * 1024UL;
+
+/// <summary>
+/// Purpose: The number of Frames walked per sampled Window, when the File is sampled.
+/// </summary>
+constexpr auto MP3_SAMPLED_WINDOW_FRAME_COUNT = 16UL;
+
+/// <summary>
+/// Purpose: The largest number of bytes a Layer III Frame can take from the Bit Reservoir (the 9-bit 'main_data_begin' field).
+/// </summary>
+constexpr auto MP3_BIT_RESERVOIR_MAXIMUM_SIZE = 511UL;
+
 constexpr auto APE_TAG_FOOTER_BYTES = 32LL;
 constexpr auto APE_TAG_FOOTER_ID = "APETAGEX";
 
@@ -27,6 +50,53 @@ constexpr auto APE_TAG_FOOTER_ID = "APETAGEX";
 /// </summary>
 constexpr unsigned long APE_TAG_FLAG_CONTAINS_HEADER_MASK = (1 << 31);
 
+/// <summary>
+/// Purpose: The Xing/Info Tag stored in the first Frame of a VBR or CBR File, and the optional LAME Tag extension that follows it.
+/// 
+/// URI: http://gabriel.mp3-tech.org/mp3infotag.html
+/// URI: https://www.codeproject.com/Articles/8295/MPEG-Audio-Frame-Header#XINGHeader
+/// </summary>
+struct MP3InfoTag
+{
+    bool isPresent{ false };
+    bool frameCountIsPresent{ false };
+    bool byteCountIsPresent{ false };
+
+    /// <summary>
+    /// Purpose: Indicates whether the LAME Tag extension is present AND its own CRC-16 matched. Only then are the Music Length and Music CRC trusted.
+    /// </summary>
+    bool lameTagIsValid{ false };
+
+    /// <summary>
+    /// Purpose: The offset position of the Info Tag Frame within the Stream, and its Frame Length.
+    /// </summary>
+    long long frameOffset{};
+    unsigned long frameLength{};
+    unsigned long samplesPerFrame{};
+
+    /// <summary>
+    /// Purpose: The Frame Length at the lowest Bitrate (without Padding) for the Info Tag Frame Header. A lower bound for the length of every Audio Frame.
+    /// </summary>
+    unsigned long minimumFrameLength{};
+
+    /// <summary>
+    /// Purpose: The number of Audio Frames that follow the Info Tag Frame.
+    /// </summary>
+    unsigned long frameCount{};
+
+    /// <summary>
+    /// Purpose: The number of bytes in the Audio Data, including the Info Tag Frame.
+    /// </summary>
+    unsigned long byteCount{};
+
+    /// <summary>
+    /// Purpose: The LAME Tag Music Length (the number of bytes in the Audio Data, including the Info Tag Frame), and the
+    /// CRC-16 of the Audio Frames that follow the Info Tag Frame.
+    /// </summary>
+    unsigned long musicLength{};
+    unsigned short musicCRC{};
+};
+
 /// <summary>
 /// Purpose: A Derived Class implementing a MP3 Decoder. 
 /// 
@@ -59,18 +129,61 @@ class MP3Decoder : public AbstractBaseDecoder
         #pragma region Overridden_Base_Class_Functions_Region
 
         long long Read();
+        long long Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds);
         unsigned long long GetDecodedAudioDataTotal();
-        const wchar_t* GetLastErrorMessage();
         const wchar_t* GetSupportedTypes();
+        bool CheckForTruncation();
+
+        /// <summary>
+        /// Purpose: Chooses the Windows by byte offset within the Audio Data.
+        /// </summary>
+        bool EnableSampledVerification(unsigned long windowCount);
+
+        /// <summary>
+        /// Purpose: The Frame Headers are walked without decoding the audio, so there is NO PCM to analyze.
+        /// </summary>
+        bool EnablePcmAnalysis();
+
+        /// <summary>
+        /// Purpose: MP3 is a lossy format, so the decoded PCM never matches the AccurateRip checksums of the CD.
+        /// </summary>
+        bool EnableAccurateRipChecksum();
+
+        /// <summary>
+        /// Purpose: The MP3 Frame Header walk has NO per-sample work, and the deep decode is the per-sample work.
+        /// </summary>
+        bool EnablePcmPipeline();
 
 #		pragma endregion Overridden_Base_Class_Functions_Region
 
         static constexpr wchar_t* DECODER_NAME = L"MP3";
         static constexpr wchar_t FILE_EXTENSION_TYPES[] = L"mp3\0mp2\0m2a\0";
 
+    protected:
+        /// <summary>
+        /// Purpose: Called for each complete Frame that passed the Frame Header checks. Checks the Side Information of a Layer III Frame against the Bit Reservoir,
+        /// without decoding the Audio Data: the Frame must NOT take more bytes from the Bit Reservoir than the previous Frames left in it, and its Audio Data
+        /// must end within the Frame. A Derived Class can verify the Frame further (e.g. by decoding it).
+        /// </summary>
+        /// <param name="framePtr">A pointer to the resident Frame data, starting at the Frame Header.</param>
+        /// <param name="frameLength">The Frame Length in bytes. All of the Frame bytes are resident.</param>
+        /// <returns>TRUE if the Frame is valid. Otherwise, FALSE and the Error Message is set.</returns>
+        virtual bool VerifyFrame(const unsigned char* framePtr, unsigned long frameLength);
+
+        /// <summary>
+        /// Purpose: Records a time based error, using the current Frame Sample Position within the Stream.
+        /// </summary>
+        /// <param name="code">The Error Code, which is reported with the time.</param>
+        void RecordFrameTimeError(DecoderErrorCode code);
+
+        /// <summary>
+        /// Purpose: Called when the Frame walk jumps to a new sampled Window, to discard any state carried over from the previous Frame.
+        /// The bytes left in the Bit Reservoir are NOT known after a jump, so the first Frames of the Window may take up to the largest Bit Reservoir.
+        /// </summary>
+        virtual void ResetFrameVerification();
+
     private:
         StreamWrapper m_stream{};
-        wchar_t m_errorMessage[MAX_ERROR_SIZE]{};
 
         /// <summary>
         /// Purpose: The Sample Rate for the Stream. A Sample Rate is typically constant across all the Frames within an MP3 File.
@@ -106,79 +219,64 @@ class MP3Decoder : public AbstractBaseDecoder
         unsigned long m_frameSamplePosition{};
 
         /// <summary>
-        /// Purpose: The version of the MPEG Audio Encoding. Used to indicate whether it is MPEG-1 or MPEG-2 or MPEG-2.5 Audio Encoding.
-        /// {MPEG-1 = 3, MPEG-2 = 2, Reserved = 1, MPEG-2.5 = 0}
-        /// </summary>
-        unsigned long m_encodingVersion{};
-
-        /// <summary>
-        /// Purpose: The Layer Description is one of the following: Layer I, Layer II, Layer III, or Reserved.
-        /// {Layer I = 3, 'Layer II = 2, Layer III = 1, Reserved = 0}
+        /// Purpose: Used to the store the ID3v2 Tag Header Length for an MP3 File.
         /// </summary>
-        unsigned long m_layerDescription{};
+        unsigned long m_tagHeaderLengthBytes{};
 
         /// <summary>
-        /// Purpose: The compression rate (A higher bitrate = better quality, but larger file size). Bitrates are always displayed in kilobits (1000) per second.
-        /// NOTE: The prefix kilo (abbreviated with the small 'k') doesn't mean 1024 bits, but 1000 bits per second.
+        /// Purpose: Used to store Tag Footer Lengths for an MP3 File. Common Footer Tags include the following: ID3v1 Tag Footer, APE Tag Footer, and embedded Lyric Tags.
         /// </summary>
-        unsigned long m_bitrate{};
+        unsigned long m_tagFooterLengthBytes{};
 
         /// <summary>
-        /// Purpose: The number of Audio Samples per second.
+        /// Purpose: The current Frame Length.
         /// </summary>
-        unsigned long m_sampleRate{};
+        unsigned long m_currentFrameLength{};
 
         /// <summary>
-        /// Purpose: Used to indicate whether Frame Padding is enabled (1) or disabled (0) for a given Frame.
-        /// {Frame is Padded with one extra slot = 1 OR Frame is NOT Padded = 0}
+        /// Purpose: The number of bytes the Layer III Frames walked so far left in the Bit Reservoir, for the next Frame to take.
         /// </summary>
-        unsigned long m_framePadding{};
+        unsigned long m_bitReservoirSize{};
 
         /// <summary>
-        /// Purpose: Used to indicate whether the Channel Mode is Single Channel Mono OR any one of the following: Stereo, Joint Stereo (Stereo), or Dual channel (Stereo).
-        /// {Mono Mode = 1 OR Stereo Modes = 0}
+        /// Purpose: A counter to store the remaining number of bytes the resychronization effort will be allowed to scan, before being abandoned.
         /// </summary>
-        unsigned long m_singleChannelMono{};
+        unsigned long m_maxResynchronizationCount{};
 
         /// <summary>
-        /// Purpose: Used for accessing the columns in the MP3 Bit Rate and MP3 Sample Rate fixed size Arrays.
+        /// Purpose: Holds the Window of resident Stream data, when the Memory Buffer is NOT enabled.
         /// </summary>
-        unsigned long m_columnIndex{};
+        std::vector<unsigned char> m_windowBuffer{};
 
         /// <summary>
-        /// Purpose: Used to the store the ID3v2 Tag Header Length for an MP3 File.
+        /// Purpose: The Xing/Info Tag (and LAME Tag) parsed from the first Frame, when present.
         /// </summary>
-        unsigned long m_tagHeaderLengthBytes{};
+        MP3InfoTag m_infoTag{};
 
         /// <summary>
-        /// Purpose: Used to store Tag Footer Lengths for an MP3 File. Common Footer Tags include the following: ID3v1 Tag Footer, APE Tag Footer, and embedded Lyric Tags.
+        /// Purpose: The number of Audio Frames walked, excluding the Info Tag Frame.
         /// </summary>
-        unsigned long m_tagFooterLengthBytes{};
+        unsigned long m_frameCount{};
 
         /// <summary>
-        /// Purpose: The current Frame Length.
+        /// Purpose: The running LAME Music CRC-16 of the Audio Frames walked, excluding the Info Tag Frame.
         /// </summary>
-        unsigned long m_currentFrameLength{};
+        unsigned short m_musicCRC{};
 
         /// <summary>
-        /// Purpose: A counter to store the maximum number of times the resychronization effort will be allowed to be attempted, before being abandoned.
+        /// Purpose: The Window of resident Stream data that the Frames are walked over. Points into either the Memory Buffer or the Window Buffer.
         /// </summary>
-        unsigned long m_maxResynchronizationCount{};
-        
-        unsigned long m_CRCByteSize{};
+        const unsigned char* m_windowPtr{ nullptr };
+        size_t m_windowSize{};
+        long long m_windowOffset{};
+        bool m_windowReachesEndOfStream{ false };
 
         /// <summary>
-        /// Purpose: The 16th Bit in the Frame Header is the Protection Bit. 
-        /// The 2 possibles Protection Bit values are: 0 = Protected by CRC (16-bit CRC follows Frame Header) OR 1 = Not protected.
-        /// Initially set with the status of the Protection Bit (Enabled (0) / Disabled (1)). If enabled, it will be later used to hold the embedded 16-bit CRC Checksum value for a Frame.
+        /// Purpose: The sampled Windows to verify, when the File is sampled, and the offset of the first Frame within the Stream.
         /// </summary>
-        unsigned short m_embeddedFrameCRC{};
+        SampledVerificationPlan m_sampledVerificationPlan{};
+        long long m_audioDataOffset{};
         
-        /// <summary>
-        /// Purpose: A fixed-size array used to contain the CRC Bytes for a specific Audio Frame.
-        /// </summary>
-        unsigned char m_bufferCRCBytes[40]{};
-
         /// <summary>
         /// Purpose: Calculates and return the length of the 'ID3v2 Tag Header' in an MP3 file that uses a ID3v2 tag for Metadata.
         /// 
@@ -208,18 +306,11 @@ class MP3Decoder : public AbstractBaseDecoder
         /// <returns>The Lyrics length in bytes.</returns>
         unsigned long GetLyricsTagLength();
 
-        /// <summary>
-        /// Purpose: MP3 Frame Length is length of a Frame when compressed. It is calculated in slots. 
-        /// One slot is 4-bytes long for Layer I, and 1-byte long for Layer II and Layer III. Frame Length may change from Frame to Frame due to Padding or Bitrate Switching.
-        /// 
-        /// In contrast, Frame Size is the number of samples contained in a Frame and it is Constant and always 384 samples for Layer I and 1152 samples for Layer II and Layer III.
-        /// </summary>
-        /// <returns>The Frame Length in bytes.</returns>
-        unsigned long GetFrameLength();
-        
         /// <summary>
         /// Purpose: This function is used for attempting to resynchronize the reading of MP3 Frames within a Stream. 
-        /// This function attempts to repeatedly read in fresh bytes from the Stream and check if they eventually form a valid Frame Header.
+        /// This function scans the resident bytes after the current Frame for Frame Sync candidates, and accepts the first candidate whose Frame Header
+        /// is valid, matches the previous Frame Header (if any), and is followed by another matching Frame Header (or the end of the Audio Data).
+        /// The total number of bytes scanned per File is limited by MAX_RESYNCHRONIZATION_ATTEMPTS.
         /// 
         /// About Resynchronization:
         /// 
@@ -230,28 +321,66 @@ class MP3Decoder : public AbstractBaseDecoder
         /// <returns>TRUE if resynchronization was successful. FALSE if resynchronization was failed.</returns>
         bool ResynchronizeBitstream();
 
+        /// <summary>
+        /// Purpose: Gets a pointer to resident Stream data, starting at the offset. When the Memory Buffer is enabled, the pointer is into the Memory Buffer.
+        /// Otherwise, the data is read into the Window Buffer using a single Read().
+        /// </summary>
+        /// <param name="offset">The offset position within the Stream.</param>
+        /// <param name="requestedSize">The number of bytes requested.</param>
+        /// <param name="dataPtrRef">Receives the pointer to the data.</param>
+        /// <param name="dataSizeRef">Receives the number of bytes available, which may be less than requested at the end of the Stream.</param>
+        /// <returns>TRUE if successful. Otherwise, FALSE.</returns>
+        bool GetResidentData(long long offset, size_t requestedSize, const unsigned char*& dataPtrRef, size_t& dataSizeRef);
+
+        /// <summary>
+        /// Purpose: Gets a pointer to the resident Frame data starting at the offset, from the Window. The Window is only refilled when it does NOT hold
+        /// the requested bytes, so walking consecutive Frames does NOT call the Stream for each Frame.
+        /// </summary>
+        /// <param name="offset">The offset position within the Stream.</param>
+        /// <param name="minimumSize">The number of bytes needed, unless the end of the Stream is reached first.</param>
+        /// <param name="dataPtrRef">Receives the pointer to the data.</param>
+        /// <param name="dataSizeRef">Receives the number of resident bytes from the offset to the end of the Window.</param>
+        /// <returns>TRUE if successful. Otherwise, FALSE.</returns>
+        bool GetFrameData(long long offset, size_t minimumSize, const unsigned char*& dataPtrRef, size_t& dataSizeRef);
+
         /// <summary>
         /// Purpose: This function is used to verify the integrity of an MP3 file using a Cyclic Redundancy Check (CRC). 
         /// MPEG Audio Frames may have an optional CRC Protection Bit enabled. 
         /// If the CRC Protection Bit is enabled, then an embedded 16-bit CRC Checksum value is placed in the Frame, immediately following MPEG Audio Frame Header.
         /// After the optionally embedded 16-bit CRC Checksum value, the Audio Data begins.
         /// </summary>
+        /// <param name="framePtr">A pointer to the resident Frame data.</param>
+        /// <param name="frameDataSize">The number of resident bytes available from framePtr.</param>
         /// <returns>
         /// Returns TRUE if the CRC Protection Bit is enabled AND CRC Check passes successfully OR the CRC Protection Bit is disabled and therefore the file does NOT contain the 16-bit CRC Data. 
         /// Otherwise, returns FALSE indicating that there is a CRC error in the file, which could be due to data corruption.
         /// </returns>
-        bool CheckCRCProtection();
+        bool CheckCRCProtection(const unsigned char* framePtr, size_t frameDataSize);
+
+        /// <summary>
+        /// Purpose: Parses the Xing/Info Tag, and the LAME Tag extension, when they are present in the first Frame.
+        /// </summary>
+        void ParseInfoTag();
+
+        /// <summary>
+        /// Purpose: Verifies the Frame count, the byte count, and the LAME Music CRC against the Info Tag, once all of the Frames have been walked.
+        /// If an error occurs, the function sets an error message.
+        /// </summary>
+        /// <returns>TRUE if the Info Tag is absent or every value matches. Otherwise, FALSE.</returns>
+        bool VerifyInfoTag();
+
+        /// <summary>
+        /// Purpose: Walks a single Frame. Used by Read() for the whole File, and for each Frame of a sampled Window.
+        /// </summary>
+        /// <returns>The number of Decoded Audio Units read, 0 at the end of the Audio Data, or -1 if an error occurred.</returns>
+        long long ReadFrame();
 
         /// <summary>
-        /// Purpose: A Cyclic Redundancy Check (CRC) is a type of hash function used to produce a checksum. 
-        /// A checksum is a small, fixed-size bit string that checks the integrity of data. 
-        /// CRCs are used to detect errors in data transmission or storage.
-        /// This function performs a CRC-16 calculation.
+        /// Purpose: The Read() implementation used when the File is sampled. Jumps to the next Window, resynchronizes on the first Frame
+        /// at or after it, and walks the Frames of the Window. A failure to resynchronize is reported as a loss of sync.
         /// </summary>
-        /// <param name="bufferPtr">The Buffer data to check with the CRC-16 Algorithm.</param>
-        /// <param name="bufferLength">The length of the Buffer Data.</param>
-        /// <returns></returns>
-        unsigned short CRC16(unsigned char* bufferDataPtr, size_t bufferLength);
+        /// <returns>The Window's share of the total, 0 once every Window has been verified, or -1 if an error occurred.</returns>
+        long long ReadSampled();
 
         void OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled);
 };
@@ -0,0 +1,69 @@
+#ifndef MP3_DEEP_DECODER_H
+#define MP3_DEEP_DECODER_H
+
+#include "MP3Decoder.h"
+#include <minimp3/minimp3.h>
+
+/// <summary>
+/// Purpose: A Derived Class implementing the "deep" MP3 verification tier. Every Frame accepted by the MP3 Frame Header walk is also fully decoded
+/// (Huffman decoding, Requantization, IMDCT, and Polyphase Synthesis), so Side Information, Bit Reservoir, and Scale Factor errors that only show up while
+/// decoding are reported with the time at which they occur.
+///
+/// The Layer I/II/III decoding is done by the embedded 'minimp3' decoder, which uses SSE2 (x86/x64) or NEON (ARM) for the IMDCT and Polyphase Synthesis.
+///
+/// URI: https://github.com/lieff/minimp3
+/// </summary>
+class MP3DeepDecoder : public MP3Decoder
+{
+    public:
+        MP3DeepDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled);
+        virtual ~MP3DeepDecoder();
+        MP3DeepDecoder(const MP3DeepDecoder& other) = delete; // Delete Copy Constructor
+        MP3DeepDecoder& operator=(const MP3DeepDecoder& other) = delete; // Delete Assignment Operator (Overloaded)
+        MP3DeepDecoder(MP3DeepDecoder&& other) noexcept = delete; // Delete The Move Constructor
+        MP3DeepDecoder& operator=(MP3DeepDecoder&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: The Frames are fully decoded, so the decoded PCM can be analyzed. The analysis starts with the first decoded Frame, which sets the Sample Rate.
+        /// </summary>
+        bool EnablePcmAnalysis();
+
+    protected:
+        /// <summary>
+        /// Purpose: Decodes the Frame, and checks that the decoder consumed exactly the Frame and produced its Samples.
+        /// </summary>
+        /// <param name="framePtr">A pointer to the resident Frame data, starting at the Frame Header.</param>
+        /// <param name="frameLength">The Frame Length in bytes.</param>
+        /// <returns>TRUE if the Frame decoded successfully. Otherwise, FALSE and the Error Message is set.</returns>
+        bool VerifyFrame(const unsigned char* framePtr, unsigned long frameLength);
+
+        /// <summary>
+        /// Purpose: Resets the decoder state after a jump to a sampled Window. The Bit Reservoir is refilled from the first Frames of the Window,
+        /// so missing Samples are NOT reported for those Frames.
+        /// </summary>
+        void ResetFrameVerification();
+
+    private:
+        /// <summary>
+        /// Purpose: The decoder state, which carries the Bit Reservoir and the IMDCT/Synthesis overlap from one Frame to the next.
+        /// </summary>
+        mp3dec_t m_decoder{};
+
+        /// <summary>
+        /// Purpose: Receives the decoded PCM Samples of a single Frame. The Samples are discarded.
+        /// </summary>
+        mp3d_sample_t m_pcmBuffer[MINIMP3_MAX_SAMPLES_PER_FRAME]{};
+
+        /// <summary>
+        /// Purpose: The decoded PCM Samples of a single Frame, widened for the PCM analysis.
+        /// </summary>
+        int32_t m_pcmAnalysisBuffer[MINIMP3_MAX_SAMPLES_PER_FRAME]{};
+        bool m_pcmAnalysisIsEnabled{ false };
+
+        /// <summary>
+        /// Purpose: The number of Frame bytes still needed to refill the Bit Reservoir, after a jump to a sampled Window.
+        /// </summary>
+        unsigned long m_reservoirPrimingBytesRemaining{};
+};
+
+#endif // MP3_DEEP_DECODER_H
@@ -21,13 +21,30 @@
 #define STR_ABOUTMENU				    TEXT("About WinAudioDecodeR...")
 
 #define STR_START_EDIT_WINDOW		    TEXT("Drop files/folders here")
-#define STR_FILE_ERROR				    TEXT("UNABLE_TO_OPEN_DECODER")
 #define STR_BUTTON_TEXT				    TEXT("Stop")
 #define STR_RESULT					    TEXT("%d %s scanned in %.2f seconds")
 #define STR_FILE					    TEXT("file")
 #define STR_FILES					    TEXT("files")
 #define STR_ERROR					    TEXT("failed")
 #define STR_PASS					    TEXT("passed")
+#define STR_SAMPLED_ERROR			    TEXT("damage found")
+#define STR_SAMPLED_PASS			    TEXT("sampled clean")
+#define STR_ERROR_SUMMARY			    TEXT("\r\n---\r\nErrors by type:")
+#define STR_ERROR_SUMMARY_ENTRY		    TEXT("\r\n%llu\t%s")
+#define STR_PCM_FINDINGS			    TEXT("with PCM findings")
+#define STR_ACCURATERIP_CHECKSUMS	    TEXT("with AccurateRip checksums")
+#define STR_ACCURATERIP_CHECKSUM_ENTRY  TEXT("\t<CRC32 %08X>\t<AR_V1 %08X (FIRST %08X, LAST %08X)>\t<AR_V2 %08X (FIRST %08X, LAST %08X)>")
+#define STR_SIDECAR_CHECKSUMS		    TEXT("with sidecar checksums NOT matched")
+#define STR_SIDECAR_CHECKSUM_ENTRY	    TEXT("\t<%s %s>\t")
+#define STR_SIDECAR_CHECKSUM_MATCHES    TEXT("\r\n%llu sidecar %s matched")
+#define STR_CPU_DISPATCH			    TEXT("\r\n---\r\nCPU dispatch: ")
+#define STR_DECODER_TUNING			    TEXT("\r\n---\r\nDecoder tuning: %lu sampled %s, profile %s ")
+#define STR_DECODER_TUNING_SAVED	    TEXT("saved to")
+#define STR_DECODER_TUNING_NOT_SAVED    TEXT("NOT saved to")
+#define STR_VOLUME_ADMISSION		    TEXT("\r\n---\r\nVolume reads:")
+#define STR_CACHE_POLICY			    TEXT("\r\n---\r\nCache policy: %s, %.1f MB read at %.1f MB/s")
+#define STR_CACHE_POLICY_RESIDENCY	    TEXT(", System File Cache %.1f MB at the start, %.1f MB at the end")
+#define STR_SPARSE_LOADING			    TEXT(", %.1f MB of metadata NOT loaded")
 #define STR_OK						    TEXT("OK")
 #define STR_MESSAGE_BOX_CLOSE		    TEXT("Are you sure you want to close the Window?")
 
@@ -43,6 +60,9 @@
 #define MSG_THREAD_FILE_PROCESSED       WM_USER + 6
 #define MSG_THREAD_FINISHED				WM_USER + 7
 #define MSG_CMDLINE					    WM_USER + 8
+#define MSG_FILE_ANALYSIS_UPDATE        WM_USER + 9
+#define MSG_FILE_CHECKSUM_UPDATE        WM_USER + 10
+#define MSG_FILE_TRUNCATION_UPDATE      WM_USER + 11
 
 #define ID_ABOUT					    1974
 #define TIMER						    20
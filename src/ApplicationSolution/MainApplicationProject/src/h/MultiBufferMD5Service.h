@@ -0,0 +1,119 @@
+#ifndef MULTI_BUFFER_MD5_SERVICE_H
+#define MULTI_BUFFER_MD5_SERVICE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+/// <summary>
+/// Purpose: The size in bytes of an MD5 Digest (128-bit), and of an MD5 Input Block (512-bit).
+/// </summary>
+constexpr auto MD5_DIGEST_SIZE = 16UL;
+constexpr auto MD5_BLOCK_SIZE = 64UL;
+
+/// <summary>
+/// Purpose: The number of pending bytes of a single Stream that starts a batch. The batch also takes the pending bytes of every other idle Stream.
+/// </summary>
+constexpr auto MULTI_BUFFER_MD5_BATCH_SIZE = 64UL * 1024UL;
+
+/// <summary>
+/// Purpose: The largest number of pending bytes of a single Stream. A Decoder submitting more than this waits until its Stream is hashed.
+/// </summary>
+constexpr auto MULTI_BUFFER_MD5_MAXIMUM_PENDING_SIZE = 64UL * MULTI_BUFFER_MD5_BATCH_SIZE;
+
+/// <summary>
+/// Purpose: A Stream identifier. 0 is NOT a valid Stream.
+/// </summary>
+typedef unsigned long MD5StreamId;
+
+/// <summary>
+/// Purpose: An MD5 service shared by the Decoder Threads. MD5 is serial within a single Stream, but independent Streams can be hashed together,
+/// one Stream per SIMD lane (4 lanes using SSE2, 8 lanes using AVX2, 16 lanes using AVX-512). The widest lanes supported by the CPU are chosen at runtime.
+/// A scalar Transform is used when no SIMD is available, and when only a single Stream has pending bytes.
+///
+/// Each Decoder joins the service when its File is opened, submits its packed PCM bytes in decoding order, and leaves with the Digest at the end of the File.
+/// The submitted bytes are copied, so the Decoder may reuse its Buffer. Each Stream has its own pending Buffer and Mutex, so the copy does NOT hold the shared Mutex,
+/// and a batch only holds the Mutex of a Stream while swapping out its whole Blocks. There is NO hashing Thread: a Decoder whose Stream has a full batch pending
+/// hashes the pending bytes of every idle Stream, so Files join and leave the lanes freely.
+/// URI: https://www.rfc-editor.org/rfc/rfc1321
+/// </summary>
+class MultiBufferMD5Service
+{
+    public:
+        MultiBufferMD5Service();
+        virtual ~MultiBufferMD5Service();
+        MultiBufferMD5Service(const MultiBufferMD5Service& other) = delete; // Delete Copy Constructor
+        MultiBufferMD5Service& operator=(const MultiBufferMD5Service& other) = delete; // Delete Assignment Operator (Overloaded)
+        MultiBufferMD5Service(MultiBufferMD5Service&& other) noexcept = delete; // Delete The Move Constructor
+        MultiBufferMD5Service& operator=(MultiBufferMD5Service&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Starts a new MD5 Stream.
+        /// </summary>
+        /// <returns>The Stream identifier.</returns>
+        MD5StreamId Join();
+
+        /// <summary>
+        /// Purpose: Appends bytes to the Input Message of a Stream. May hash a batch of Streams on the calling Thread.
+        /// </summary>
+        void Submit(MD5StreamId streamId, const unsigned char* dataPtr, size_t size);
+
+        /// <summary>
+        /// Purpose: Ends a Stream, and computes its Digest.
+        /// </summary>
+        /// <param name="digest">Receives the 16-byte MD5 Digest.</param>
+        void Finish(MD5StreamId streamId, unsigned char digest[MD5_DIGEST_SIZE]);
+
+        /// <summary>
+        /// Purpose: Ends a Stream without computing its Digest (e.g. the File was NOT fully decoded).
+        /// </summary>
+        void Cancel(MD5StreamId streamId);
+
+        /// <summary>
+        /// Purpose: The number of Streams hashed together by the SIMD Transform chosen for the CPU. 1 when no SIMD is available.
+        /// </summary>
+        static unsigned long GetLaneCount();
+
+    private:
+        struct StreamState
+        {
+            uint32_t state[4]{};
+            unsigned long long messageSize{}; // The total number of submitted bytes. Only used by the Thread of the Stream.
+            std::mutex pendingMutex{}; // Guards the pending bytes. Taken after the shared Mutex, when both are held.
+            std::vector<unsigned char> pendingBytes{};
+            bool isHashing{ false }; // Guarded by the shared Mutex.
+        };
+
+        /// <summary>
+        /// Purpose: Guards the Stream list, and the hashing state of every Stream.
+        /// </summary>
+        std::mutex m_mutex{};
+        std::condition_variable m_hashingCompleteCondition{};
+
+        /// <summary>
+        /// Purpose: The Streams are NOT moved when other Streams join or leave, so a batch can hash them without holding the Mutex.
+        /// </summary>
+        std::map<MD5StreamId, StreamState> m_streams{};
+        MD5StreamId m_nextStreamId{ 1UL };
+
+        /// <summary>
+        /// Purpose: Takes the whole Blocks pending in the Stream and in up to (lane count - 1) other idle Streams, and hashes them together.
+        /// The Mutex is released while hashing, and held again on return.
+        /// </summary>
+        void HashBatch(std::unique_lock<std::mutex>& lockRef, StreamState& streamRef);
+
+        /// <summary>
+        /// Purpose: Gets the number of pending bytes of a Stream, holding the Mutex of the Stream.
+        /// </summary>
+        static size_t GetPendingSize(StreamState& streamRef);
+
+        /// <summary>
+        /// Purpose: Waits until a batch running on another Thread has finished hashing the Stream.
+        /// </summary>
+        void WaitWhileHashing(std::unique_lock<std::mutex>& lockRef, const StreamState& streamRef);
+};
+
+#endif // MULTI_BUFFER_MD5_SERVICE_H
@@ -0,0 +1,115 @@
+#ifndef OGG_PAGE_TRACKER_H
+#define OGG_PAGE_TRACKER_H
+
+#include <cstddef>
+#include <map>
+
+/// <summary>
+/// Purpose: The size in bytes of the fixed portion of an Ogg Page Header (excluding the Segment Table).
+/// </summary>
+constexpr auto OGG_PAGE_HEADER_FIXED_SIZE = 27;
+
+/// <summary>
+/// Purpose: The maximum size in bytes of an Ogg Page Header (the fixed portion plus a full 255 entry Segment Table).
+/// </summary>
+constexpr auto OGG_PAGE_HEADER_MAXIMUM_SIZE = OGG_PAGE_HEADER_FIXED_SIZE + 255;
+
+/// <summary>
+/// Purpose: The fields of a single parsed Ogg Page Header.
+/// </summary>
+struct OggPageHeaderInfo
+{
+    long long granulePosition{ -1LL };
+    long serialNumber{};
+    unsigned long sequenceNumber{};
+    unsigned char headerType{};
+    size_t headerSize{};
+    size_t bodySize{};
+};
+
+/// <summary>
+/// Purpose: Tracks the Ogg Page Headers of a physical bitstream as the bytes pass through it, without seeking and without
+/// holding on to the Page bodies. Records the last Granule Position seen for each logical bitstream (identified by its Serial Number),
+/// so a forward-only Decoder can validate its decoded sample count against the Granule Position of the final Page.
+///
+/// URI: https://xiph.org/ogg/doc/framing.html
+/// URI: https://xiph.org/vorbis/doc/Vorbis_I_spec.html#x1-132000A.2
+/// </summary>
+class OggPageTracker
+{
+    public:
+        OggPageTracker();
+        virtual ~OggPageTracker();
+        OggPageTracker(const OggPageTracker& other) = delete; // Delete Copy Constructor
+        OggPageTracker& operator=(const OggPageTracker& other) = delete; // Delete Assignment Operator (Overloaded)
+        OggPageTracker(OggPageTracker&& other) noexcept = delete; // Delete The Move Constructor
+        OggPageTracker& operator=(OggPageTracker&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Feeds the next bytes of the physical bitstream into the Page Tracker. The bytes must be supplied in Stream order.
+        /// </summary>
+        /// <param name="dataPtr">A pointer to the bytes that were just read from the Stream.</param>
+        /// <param name="size">The number of bytes.</param>
+        void Consume(const unsigned char* dataPtr, size_t size);
+
+        /// <summary>
+        /// Purpose: Gets the Granule Position of the last Page seen for the logical bitstream, that carried a Granule Position.
+        /// </summary>
+        /// <param name="serialNumber">The Serial Number of the logical bitstream.</param>
+        /// <returns>The last Granule Position. Otherwise, -1 if the logical bitstream has not been seen.</returns>
+        long long GetLastGranulePosition(long serialNumber) const;
+
+        /// <summary>
+        /// Purpose: Gets the number of Pages seen for the logical bitstream, that carried a non-zero Granule Position and were NOT the End-Of-Stream Page.
+        /// For Vorbis, these are the Audio Pages at which 'libvorbisfile' re-anchors its PCM position.
+        /// </summary>
+        /// <param name="serialNumber">The Serial Number of the logical bitstream.</param>
+        /// <returns></returns>
+        unsigned long GetAnchorPageCount(long serialNumber) const;
+
+        /// <summary>
+        /// Purpose: Determines whether the End-Of-Stream Page has been seen for the logical bitstream.
+        /// </summary>
+        /// <param name="serialNumber">The Serial Number of the logical bitstream.</param>
+        /// <returns></returns>
+        bool IsEndOfStreamSeen(long serialNumber) const;
+
+        /// <summary>
+        /// Purpose: Clears all of the tracked Page state.
+        /// </summary>
+        void Reset();
+
+        /// <summary>
+        /// Purpose: Parses the Ogg Page Header at the start of a resident Buffer. The Page CRC is NOT checked.
+        /// </summary>
+        /// <param name="dataPtr">A pointer to the start of the Page.</param>
+        /// <param name="size">The number of bytes available from dataPtr.</param>
+        /// <param name="pageHeaderInfoRef">Receives the parsed Page Header fields.</param>
+        /// <returns>TRUE if a complete Page (Header and Body) is available. Otherwise, FALSE.</returns>
+        static bool ParsePageHeader(const unsigned char* dataPtr, size_t size, OggPageHeaderInfo& pageHeaderInfoRef);
+
+    private:
+        /// <summary>
+        /// Purpose: The tracked state of a single logical bitstream.
+        /// </summary>
+        struct LogicalBitstreamState
+        {
+            long long lastGranulePosition{ -1LL };
+            unsigned long anchorPageCount{};
+            bool endOfStreamSeen{ false };
+        };
+
+        std::map<long, LogicalBitstreamState> m_serialNumberToStateMap{};
+
+        unsigned char m_pageHeaderBuffer[OGG_PAGE_HEADER_MAXIMUM_SIZE]{};
+        size_t m_pageHeaderBytesFilled{};
+        size_t m_pageHeaderBytesRequired{ OGG_PAGE_HEADER_FIXED_SIZE };
+        unsigned long long m_pageBodyBytesRemaining{};
+
+        /// <summary>
+        /// Purpose: Parses a completely buffered Page Header and records the state for its logical bitstream.
+        /// </summary>
+        void ProcessPageHeader();
+};
+
+#endif // OGG_PAGE_TRACKER_H
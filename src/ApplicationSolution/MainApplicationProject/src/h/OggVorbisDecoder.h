@@ -4,9 +4,37 @@
 #include "PureAbstractBaseDecoder.h"
 #include "AbstractBaseDecoder.h"
 #include "StreamWrapper.h"
+#include "OggPageTracker.h"
+#include "OggVorbisSegmentVerifier.h"
+#include "SampledVerificationPlan.h"
+#include "DecoderTuning.h"
 #include <vorbis/codec.h>
 #include <vorbis/vorbisfile.h>
+#include <memory>
 #include <string>
+#include <vector>
+
+/// <summary>
+/// Purpose: The number of bytes read from the tail of an Ogg File, when checking the last Page for truncation.
+/// Holds two Pages of the maximum size (27 byte fixed Header, 255 Segment Table entries, and 255 * 255 bytes of Body),
+/// so the last complete Page is found even when the File ends part way through the following Page.
+/// </summary>
+constexpr auto OGG_VORBIS_TAIL_CHECK_SIZE = 2UL * (OGG_PAGE_HEADER_MAXIMUM_SIZE + 255UL * 255UL);
+
+/// <summary>
+/// Purpose: The number of ov_read_float() calls per Window, when the File is sampled.
+/// </summary>
+constexpr auto OGG_VORBIS_SAMPLED_WINDOW_READ_COUNT = 16UL;
+
+/// <summary>
+/// Purpose: The datasource handed to the Ogg-Vorbis Callback Functions when the Decoder is opened in Streaming Mode.
+/// Every byte read from the Stream is also passed through the Page Tracker.
+/// </summary>
+struct OggVorbisStreamingDataSource
+{
+    StreamWrapper* streamWrapperPtr{ nullptr };
+    OggPageTracker* pageTrackerPtr{ nullptr };
+};
 
 /// <summary>
 /// Purpose: A Derived Class implementing an Ogg-Vorbis Decoder. 
@@ -22,6 +50,7 @@ class OggVorbisDecoder : public AbstractBaseDecoder
     public:
         OggVorbisDecoder();
         OggVorbisDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled);
+        OggVorbisDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled, bool streamingModeIsEnabled, unsigned long segmentThreadCount);
         virtual ~OggVorbisDecoder();
         OggVorbisDecoder(const OggVorbisDecoder& other) = delete; // Delete Copy Constructor
         OggVorbisDecoder& operator=(const OggVorbisDecoder& other) = delete; // Delete Assignment Operator (Overloaded)
@@ -31,10 +60,37 @@ class OggVorbisDecoder : public AbstractBaseDecoder
         #pragma region Overridden_Base_Class_Functions_Region
 
         long long Read();
+        long long Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds);
         unsigned long long GetDecodedAudioDataTotal();
-        const wchar_t* GetLastErrorMessage();
         const wchar_t* GetSupportedTypes();
 
+        /// <summary>
+        /// Purpose: Finds the last complete Page (with a matching Page CRC) in the tail of the File. The Page must be flagged as End-Of-Stream,
+        /// and must NOT be followed by a partial Page.
+        /// </summary>
+        /// <returns>TRUE if the File is truncated. Otherwise, FALSE.</returns>
+        bool CheckForTruncation();
+
+        /// <summary>
+        /// Purpose: Chooses the Windows by PCM sample position. Requires a seekable Stream (i.e. NOT Streaming Mode). Segment-parallel verification is disabled.
+        /// </summary>
+        bool EnableSampledVerification(unsigned long windowCount);
+
+        /// <summary>
+        /// Purpose: Segment-parallel verification is disabled, since the Segments decode on their own Threads.
+        /// </summary>
+        bool EnablePcmAnalysis();
+
+        /// <summary>
+        /// Purpose: Ogg-Vorbis is a lossy format, so the decoded PCM never matches the AccurateRip checksums of the CD.
+        /// </summary>
+        bool EnableAccurateRipChecksum();
+
+        /// <summary>
+        /// Purpose: Ogg-Vorbis has NO MD5 signature, and a large File is split into Segments instead.
+        /// </summary>
+        bool EnablePcmPipeline();
+
         #pragma endregion Overridden_Base_Class_Functions_Region
 
         static constexpr wchar_t* DECODER_NAME = L"OGG-VORBIS";
@@ -50,14 +106,88 @@ class OggVorbisDecoder : public AbstractBaseDecoder
         OggVorbis_File m_oggVorbisFileStruct{};
         ov_callbacks m_oggVorbisCallback{};
 
-        wchar_t m_errorMessage[MAX_ERROR_SIZE]{};
 
         long long m_streamTotalSampleCount{};
         int m_bitstream{};
         long m_streamSampleRate{};
         float** m_decodedOutputBuffer{};
+
+        /// <summary>
+        /// Purpose: The maximum number of decoded Samples (per channel) to produce with each ov_read_float() call. Read from the Decoder tuning profile.
+        /// </summary>
+        int m_readChunkSize{ static_cast<int>(DEFAULT_OGG_VORBIS_READ_CHUNK_SIZE) };
+
+        /// <summary>
+        /// Purpose: When enabled, the Stream is presented to 'libvorbisfile' as non-seekable, so opening does NOT bisect the File
+        /// to find every Link and compute ov_pcm_total(). The File is decoded in a single forward pass, and the sample count of each Link
+        /// is validated against the Granule Position of its final Page.
+        /// </summary>
+        bool m_streamingModeIsEnabled{ false };
+        OggPageTracker m_pageTracker{};
+        OggVorbisStreamingDataSource m_streamingDataSource{};
+
+        /// <summary>
+        /// Purpose: The number of Links (chained logical bitstreams) encountered so far while in Streaming Mode.
+        /// </summary>
+        unsigned long m_streamingLinkCount{};
+        long m_streamingLinkSerialNumber{};
+        long long m_streamingLinkPcmPosition{ -1LL };
+        unsigned long long m_streamingDecodedSampleCount{};
+
+        /// <summary>
+        /// Purpose: The maximum number of Threads that can be used to verify Segments of the File concurrently. 
+        /// A value of 1 disables Segment-parallel verification.
+        /// </summary>
+        unsigned long m_segmentThreadCount{ 1UL };
+
+        /// <summary>
+        /// Purpose: Used when the File is verified as concurrently decoded Segments. Otherwise, nullptr.
+        /// </summary>
+        std::unique_ptr<OggVorbisSegmentVerifier> m_segmentVerifierPtr{};
+        bool m_segmentVerifierIsStarted{ false };
+
+        /// <summary>
+        /// Purpose: The Windows to verify, when the File is sampled.
+        /// </summary>
+        SampledVerificationPlan m_sampledVerificationPlan{};
         
         void OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled);
+
+        /// <summary>
+        /// Purpose: Updates the Link state after a successful read while in Streaming Mode. When a Link boundary was crossed, 
+        /// the previous Link is validated.
+        /// </summary>
+        /// <returns>TRUE if successful. Otherwise, FALSE if the previous Link failed validation.</returns>
+        bool UpdateStreamingLinkState();
+
+        /// <summary>
+        /// Purpose: Validates the final PCM position of the current Link against the Granule Position of its last Page.
+        /// </summary>
+        /// <returns>TRUE if the Link is valid or can NOT be validated. Otherwise, FALSE and the Error Message is set.</returns>
+        bool VerifyStreamingLinkEnd();
+
+        /// <summary>
+        /// Purpose: Enables Segment-parallel verification, when the File is resident in Memory, is a single Link, and is large enough to split.
+        /// </summary>
+        void ConfigureSegmentVerifier();
+
+        /// <summary>
+        /// Purpose: The Read() implementation used for Segment-parallel verification.
+        /// </summary>
+        /// <returns>The number of samples verified since the previous call, 0 at the end, or -1 if an error occurred.</returns>
+        long long ReadSegments();
+
+        /// <summary>
+        /// Purpose: The Read() implementation used when the File is sampled. Seeks to the next Window (ov_pcm_seek() resynchronizes on the
+        /// Pages around the target), and decodes from there.
+        /// </summary>
+        /// <returns>The Window's share of the total samples, 0 once every Window has been verified, or -1 if an error occurred.</returns>
+        long long ReadSampled();
+
+        /// <summary>
+        /// Purpose: Records a time based error, using the current decoding offset.
+        /// </summary>
+        void RecordDecodingTimeError(DecoderErrorCode code);
 };
 
 #endif // OGG_VORBIS_DECODER_H
\ No newline at end of file
@@ -0,0 +1,165 @@
+#ifndef OGG_VORBIS_SEGMENT_VERIFIER_H
+#define OGG_VORBIS_SEGMENT_VERIFIER_H
+
+#include "PureAbstractBaseDecoder.h"
+#include "OggPageTracker.h"
+#include <ogg/ogg.h>
+#include <vorbis/codec.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Purpose: The minimum size in bytes of a single Segment. Files smaller than two Segments are always verified on a single Thread.
+/// </summary>
+constexpr auto OGG_VORBIS_MINIMUM_SEGMENT_SIZE = 8LL * 1024LL * 1024LL;
+
+/// <summary>
+/// Purpose: Verifies a resident single-Link Ogg-Vorbis File by cutting it at Page boundaries into Segments that are decoded concurrently.
+///
+/// Each Segment owns the Packets that complete on its Pages, and starts decoding early (from a pre-roll Page), so the Packet before
+/// its first owned Packet is decoded and the Vorbis overlap-add of the first owned Packet is correct. The samples of the pre-roll Packets are discarded.
+/// The samples owned by a Segment must equal the Granule Position difference across the Segment, and the stitched total must equal ov_pcm_total().
+///
+/// URI: https://xiph.org/vorbis/doc/Vorbis_I_spec.html#x1-120001.3.2
+/// URI: https://xiph.org/vorbis/doc/libvorbis/overview.html
+/// </summary>
+class OggVorbisSegmentVerifier
+{
+    public:
+        /// <summary>
+        /// Purpose: With-args Constructor.
+        /// </summary>
+        /// <param name="bufferPtr">The resident File data. Must remain valid until the Verifier is destroyed.</param>
+        /// <param name="bufferSize">The size in bytes of the resident File data.</param>
+        /// <param name="serialNumber">The Serial Number of the Vorbis logical bitstream.</param>
+        /// <param name="sampleRate">The Sampling rate, used for reporting the time of an error.</param>
+        OggVorbisSegmentVerifier(const unsigned char* bufferPtr, size_t bufferSize, long serialNumber, long sampleRate);
+        virtual ~OggVorbisSegmentVerifier();
+        OggVorbisSegmentVerifier(const OggVorbisSegmentVerifier& other) = delete; // Delete Copy Constructor
+        OggVorbisSegmentVerifier& operator=(const OggVorbisSegmentVerifier& other) = delete; // Delete Assignment Operator (Overloaded)
+        OggVorbisSegmentVerifier(OggVorbisSegmentVerifier&& other) noexcept = delete; // Delete The Move Constructor
+        OggVorbisSegmentVerifier& operator=(OggVorbisSegmentVerifier&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Indexes the Pages, extracts the Vorbis Header Packets, and chooses the Segment cut points.
+        /// </summary>
+        /// <param name="maximumSegmentCount">The maximum number of Segments (i.e. Threads) to use.</param>
+        /// <returns>TRUE if the File can be verified using at least two Segments. Otherwise, FALSE.</returns>
+        bool Prepare(unsigned long maximumSegmentCount);
+
+        /// <summary>
+        /// Purpose: Starts one Thread per Segment.
+        /// </summary>
+        void Start();
+
+        /// <summary>
+        /// Purpose: Blocks until more samples have been verified, or all of the Segments have finished.
+        /// </summary>
+        /// <returns>The number of samples verified since the previous call. 0 once all of the Segments have finished and every sample was reported.</returns>
+        unsigned long long WaitForProgress();
+
+        /// <summary>
+        /// Purpose: Stitches the Segment results together, once all of the Segments have finished.
+        /// </summary>
+        /// <param name="expectedTotalSampleCount">The expected total sample count (i.e. ov_pcm_total()).</param>
+        /// <returns>TRUE if every Segment and the stitched total are valid. Otherwise, FALSE and the Error Record is set.</returns>
+        bool Finish(long long expectedTotalSampleCount);
+
+        /// <summary>
+        /// Purpose: Requests all of the Segment Threads to stop, and waits for them to finish.
+        /// </summary>
+        void Cancel();
+
+        /// <summary>
+        /// Purpose: Gets the Record of the error found by Finish().
+        /// </summary>
+        const DecoderErrorRecord& GetLastErrorRecord() const;
+
+    private:
+        /// <summary>
+        /// Purpose: The location of a single Page of the Vorbis logical bitstream within the resident File data.
+        /// </summary>
+        struct PageEntry
+        {
+            size_t offset{};
+            OggPageHeaderInfo headerInfo{};
+        };
+
+        /// <summary>
+        /// Purpose: A contiguous range of Pages verified by a single Thread.
+        /// </summary>
+        struct Segment
+        {
+            size_t preRollPageIndex{};
+            size_t firstPageIndex{};
+            size_t endPageIndex{};
+            long long decodedSampleCount{};
+            bool endOfStreamSeen{ false };
+            DecoderErrorRecord errorRecord{};
+        };
+
+        const unsigned char* m_bufferPtr{ nullptr };
+        size_t m_bufferSize{};
+        long m_serialNumber{};
+        long m_sampleRate{};
+
+        std::vector<PageEntry> m_pages{};
+        std::vector<Segment> m_segments{};
+        std::vector<std::thread> m_threads{};
+
+        /// <summary>
+        /// Purpose: The three Vorbis Header Packets (Identification, Comment, Setup), shared read-only by every Segment.
+        /// </summary>
+        std::vector<unsigned char> m_headerPacketData[3]{};
+        ogg_packet m_headerPackets[3]{};
+
+        std::atomic<unsigned long long> m_verifiedSampleCount{};
+        std::atomic<bool> m_cancelRequested{ false };
+        unsigned long long m_reportedSampleCount{};
+        unsigned long m_finishedSegmentCount{};
+        std::mutex m_progressMutex{};
+        std::condition_variable m_progressConditionVariable{};
+
+        DecoderErrorRecord m_errorRecord{};
+
+        /// <summary>
+        /// Purpose: Builds the Page Index for the Vorbis logical bitstream. Garbage between Pages is skipped.
+        /// </summary>
+        void IndexPages();
+
+        /// <summary>
+        /// Purpose: Extracts the three Vorbis Header Packets.
+        /// </summary>
+        /// <param name="audioStartPageIndexRef">Receives the index of the first Page after the Header Packets.</param>
+        /// <returns>TRUE if successful. Otherwise, FALSE.</returns>
+        bool ExtractHeaderPackets(size_t& audioStartPageIndexRef);
+
+        /// <summary>
+        /// Purpose: Determines whether a Segment can start at the Page. The two Pages before it must each complete a Packet,
+        /// so the pre-roll Packet can be assembled in full.
+        /// </summary>
+        bool IsCutPoint(size_t pageIndex, size_t audioStartPageIndex) const;
+
+        /// <summary>
+        /// Purpose: Builds an ogg_page that points into the resident File data, and verifies the Page CRC.
+        /// </summary>
+        /// <returns>TRUE if the Page CRC matches. Otherwise, FALSE.</returns>
+        bool LoadPage(size_t pageIndex, ogg_page& pageRef, unsigned char* headerCopyPtr) const;
+
+        /// <summary>
+        /// Purpose: The Thread Function that decodes a single Segment.
+        /// </summary>
+        void VerifySegment(Segment& segmentRef);
+
+        /// <summary>
+        /// Purpose: Records a time based error using the Granule Position of the Page.
+        /// </summary>
+        void RecordPageError(Segment& segmentRef, DecoderErrorCode code, size_t pageIndex) const;
+};
+
+#endif // OGG_VORBIS_SEGMENT_VERIFIER_H
@@ -0,0 +1,148 @@
+#ifndef PCM_ANALYZER_H
+#define PCM_ANALYZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// Purpose: The minimum number of consecutive full scale samples on a single channel, that is counted as a clipped run.
+/// A single full scale sample is common in mastered audio, and is NOT counted.
+/// </summary>
+constexpr auto PCM_ANALYSIS_CLIP_RUN_MINIMUM_LENGTH = 3ULL;
+
+/// <summary>
+/// Purpose: The metrics of the decoded PCM of a single File. The levels are relative to full scale (i.e. 1.0 is full scale).
+/// </summary>
+struct PcmAnalysisResult
+{
+    unsigned long sampleRate{};
+    unsigned long channelCount{};
+    unsigned long long frameCount{}; // The number of samples per channel.
+
+    /// <summary>
+    /// Purpose: The largest sample magnitude of all channels.
+    /// </summary>
+    double peak{};
+
+    /// <summary>
+    /// Purpose: The number of runs of at least PCM_ANALYSIS_CLIP_RUN_MINIMUM_LENGTH full scale samples, and the total number of samples in those runs.
+    /// </summary>
+    unsigned long long clippedRunCount{};
+    unsigned long long clippedSampleCount{};
+
+    /// <summary>
+    /// Purpose: The largest mean (i.e. DC offset) of all channels, as a magnitude.
+    /// </summary>
+    double dcOffset{};
+
+    /// <summary>
+    /// Purpose: The number of frames where every channel is exactly zero, and the longest run of those frames.
+    /// </summary>
+    unsigned long long silentFrameCount{};
+    unsigned long long longestSilentRunFrameCount{};
+
+    /// <summary>
+    /// Purpose: TRUE when the File has two channels, and every left sample is equal to the right sample.
+    /// </summary>
+    bool isDualMono{ false };
+};
+
+/// <summary>
+/// Purpose: An optional sink for the PCM produced by a Decoder, that computes the metrics used to find clipping, DC offset, digital silence,
+/// and inter-channel duplication in the same pass as the decode. The kernels are vectorized using SSE2 when it is available.
+/// </summary>
+class PcmAnalyzer
+{
+    public:
+        PcmAnalyzer(unsigned long sampleRate);
+        virtual ~PcmAnalyzer();
+        PcmAnalyzer(const PcmAnalyzer& other) = delete; // Delete Copy Constructor
+        PcmAnalyzer& operator=(const PcmAnalyzer& other) = delete; // Delete Assignment Operator (Overloaded)
+        PcmAnalyzer(PcmAnalyzer&& other) noexcept = delete; // Delete The Move Constructor
+        PcmAnalyzer& operator=(PcmAnalyzer&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Analyzes a block of planar integer samples (e.g. a decoded FLAC Frame).
+        /// </summary>
+        /// <param name="channelPtrs">One pointer per channel, to frameCount samples.</param>
+        /// <param name="channelCount">The number of channels.</param>
+        /// <param name="frameCount">The number of samples per channel.</param>
+        /// <param name="bitsPerSample">The bit depth of the samples, which sets full scale.</param>
+        void AddPlanar(const int32_t* const channelPtrs[], unsigned long channelCount, unsigned long frameCount, unsigned long bitsPerSample);
+
+        /// <summary>
+        /// Purpose: Analyzes a block of interleaved integer samples (e.g. unpacked WavPack samples).
+        /// </summary>
+        void AddInterleaved(const int32_t* samplePtr, unsigned long channelCount, unsigned long frameCount, unsigned long bitsPerSample);
+
+        /// <summary>
+        /// Purpose: Analyzes a block of planar floating point samples, where full scale is 1.0 (e.g. decoded Ogg-Vorbis samples).
+        /// </summary>
+        void AddPlanar(const float* const channelPtrs[], unsigned long channelCount, unsigned long frameCount);
+
+        /// <summary>
+        /// Purpose: Analyzes a block of interleaved floating point samples, where full scale is 1.0 (e.g. unpacked floating point WavPack samples).
+        /// </summary>
+        void AddInterleaved(const float* samplePtr, unsigned long channelCount, unsigned long frameCount);
+
+        /// <summary>
+        /// Purpose: Gets the metrics of all of the samples analyzed so far. Open runs are closed, without changing the state.
+        /// </summary>
+        PcmAnalysisResult GetResult() const;
+
+    private:
+        /// <summary>
+        /// Purpose: The running state of a single channel.
+        /// </summary>
+        struct ChannelState
+        {
+            double peak{};
+            double sum{};
+            unsigned long long clipRunLength{};
+        };
+
+        unsigned long m_sampleRate{};
+        unsigned long m_channelCount{};
+        unsigned long long m_frameCount{};
+        std::vector<ChannelState> m_channelStates{};
+
+        unsigned long long m_clippedRunCount{};
+        unsigned long long m_clippedSampleCount{};
+        unsigned long long m_silentFrameCount{};
+        unsigned long long m_silentRunLength{};
+        unsigned long long m_longestSilentRunFrameCount{};
+
+        bool m_channelCountChanged{ false };
+        bool m_channelsDiffer{ false };
+
+        /// <summary>
+        /// Purpose: Scratch Buffers used to deinterleave samples, so that every layout is analyzed by the planar kernels.
+        /// </summary>
+        std::vector<int32_t> m_integerScratch{};
+        std::vector<float> m_floatScratch{};
+        std::vector<const int32_t*> m_integerChannelPtrs{};
+        std::vector<const float*> m_floatChannelPtrs{};
+
+        /// <summary>
+        /// Purpose: Prepares the channel states for a block. A change in the number of channels (e.g. a chained Ogg Stream) is remembered.
+        /// </summary>
+        void BeginBlock(unsigned long channelCount, unsigned long frameCount);
+
+        /// <summary>
+        /// Purpose: Updates the clipped run of a channel, using a bit mask of the full scale samples of a group of 4 samples (bit 0 is the first sample).
+        /// </summary>
+        void UpdateClipRun(ChannelState& stateRef, unsigned int clipMask, unsigned int sampleCount);
+
+        /// <summary>
+        /// Purpose: Updates the silent run, using a bit mask of the silent frames of a group of 4 frames (bit 0 is the first frame).
+        /// </summary>
+        void UpdateSilentRun(unsigned int silentMask, unsigned int frameCount);
+
+        void AnalyzeIntegerChannel(ChannelState& stateRef, const int32_t* samplePtr, unsigned long frameCount, unsigned long bitsPerSample);
+        void AnalyzeFloatChannel(ChannelState& stateRef, const float* samplePtr, unsigned long frameCount);
+        void AnalyzeIntegerFrames(const int32_t* const channelPtrs[], unsigned long channelCount, unsigned long frameCount);
+        void AnalyzeFloatFrames(const float* const channelPtrs[], unsigned long channelCount, unsigned long frameCount);
+};
+
+#endif // PCM_ANALYZER_H
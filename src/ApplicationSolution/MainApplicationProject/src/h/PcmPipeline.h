@@ -0,0 +1,149 @@
+#ifndef PCM_PIPELINE_H
+#define PCM_PIPELINE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Purpose: The number of samples (all channels) in a Pipeline Block. A Block holds whole Frames, so a larger Frame gets a larger Block.
+/// </summary>
+constexpr auto PCM_PIPELINE_BLOCK_SAMPLE_COUNT = 64UL * 1024UL;
+
+/// <summary>
+/// Purpose: A Pipeline Thread, and the two Blocks it consumes. A Worker registered for a Thread (e.g. a Decoder Thread) is reused by every PcmPipeline
+/// created on that Thread, so a Thread is NOT started for each File. The Pipeline Thread is started when the Worker is first used.
+/// </summary>
+class PcmPipelineWorker
+{
+    public:
+        /// <summary>
+        /// Purpose: Consumes a Block of interleaved samples.
+        /// </summary>
+        typedef std::function<void(int32_t* samplePtr, size_t sampleCount)> ConsumerFunction;
+
+        PcmPipelineWorker();
+
+        /// <summary>
+        /// Purpose: Stops the Pipeline Thread. The Worker must NOT be used by a PcmPipeline, and must NOT be registered.
+        /// </summary>
+        virtual ~PcmPipelineWorker();
+        PcmPipelineWorker(const PcmPipelineWorker& other) = delete; // Delete Copy Constructor
+        PcmPipelineWorker& operator=(const PcmPipelineWorker& other) = delete; // Delete Assignment Operator (Overloaded)
+        PcmPipelineWorker(PcmPipelineWorker&& other) noexcept = delete; // Delete The Move Constructor
+        PcmPipelineWorker& operator=(PcmPipelineWorker&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Registers the Worker used by the PcmPipelines created on the calling Thread. NULL unregisters the Worker.
+        /// </summary>
+        static void SetCurrentThreadWorker(PcmPipelineWorker* workerPtr);
+
+    private:
+        friend class PcmPipeline;
+
+        struct Block
+        {
+            std::vector<int32_t> samples{};
+            size_t sampleCount{};
+            bool isReady{ false }; // TRUE while the Block belongs to the Pipeline Thread.
+        };
+
+        ConsumerFunction m_consumerFunction{};
+        Block m_blocks[2]{};
+        size_t m_fillBlockIndex{ 0 };
+        size_t m_consumeBlockIndex{ 0 }; // The next Block consumed by the Pipeline Thread.
+        bool m_isConsuming{ false }; // TRUE while the consumer function is called.
+        bool m_isAttached{ false }; // TRUE while the Worker is used by a PcmPipeline.
+
+        std::mutex m_mutex{};
+        std::condition_variable m_blockStateCondition{};
+        bool m_stopRequested{ false };
+        std::thread m_pipelineThread{};
+
+        /// <summary>
+        /// Purpose: Starts using the Worker for a File, starting the Pipeline Thread when it is first used.
+        /// </summary>
+        void Attach(ConsumerFunction consumerFunction);
+
+        /// <summary>
+        /// Purpose: Stops using the Worker for a File. A Block being consumed is finished, but the samples NOT yet consumed are discarded.
+        /// </summary>
+        void Detach();
+
+        /// <summary>
+        /// Purpose: Makes room for sampleCount samples in the current Block, passing the Block to the Pipeline Thread when it is full.
+        /// </summary>
+        /// <returns>A pointer to the free space in the current Block.</returns>
+        int32_t* Reserve(size_t sampleCount);
+
+        /// <summary>
+        /// Purpose: Passes the current Block to the Pipeline Thread, and waits until the other Block is free to be filled.
+        /// </summary>
+        void HandOver();
+
+        /// <summary>
+        /// Purpose: Passes the current Block to the Pipeline Thread, and waits until every written sample has been consumed.
+        /// </summary>
+        void Flush();
+
+        void PipelineThreadProc();
+};
+
+/// <summary>
+/// Purpose: A two-stage Pipeline within a single File. The Decoder Thread copies the decoded samples (interleaved 32-bit Integers) into one of two Blocks,
+/// while a second Thread passes the other Block to the consumer function (e.g. the MD5 signature, the PCM analysis, and the checksums).
+/// A single large File is then decoded and hashed on two cores, instead of one.
+///
+/// The consumer function is only called on the Pipeline Thread, with the Blocks in the order they were written. It may modify the samples.
+/// Flush() must be called before reading anything the consumer function computes.
+/// </summary>
+class PcmPipeline
+{
+    public:
+        /// <summary>
+        /// Purpose: Consumes a Block of interleaved samples.
+        /// </summary>
+        typedef PcmPipelineWorker::ConsumerFunction ConsumerFunction;
+
+        /// <summary>
+        /// Purpose: Uses the Worker registered for the calling Thread. Without a registered Worker (or when it is already used), the Pipeline starts its own Thread.
+        /// </summary>
+        explicit PcmPipeline(ConsumerFunction consumerFunction);
+
+        /// <summary>
+        /// Purpose: Releases the Worker. A Block being consumed is finished, but the samples NOT yet consumed are discarded.
+        /// </summary>
+        virtual ~PcmPipeline();
+        PcmPipeline(const PcmPipeline& other) = delete; // Delete Copy Constructor
+        PcmPipeline& operator=(const PcmPipeline& other) = delete; // Delete Assignment Operator (Overloaded)
+        PcmPipeline(PcmPipeline&& other) noexcept = delete; // Delete The Move Constructor
+        PcmPipeline& operator=(PcmPipeline&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Copies interleaved samples into the current Block. Waits when both Blocks are full.
+        /// </summary>
+        /// <param name="samplePtr">The interleaved samples.</param>
+        /// <param name="sampleCount">The number of samples (all channels). Should be whole Frames.</param>
+        void Write(const int32_t* samplePtr, size_t sampleCount);
+
+        /// <summary>
+        /// Purpose: Interleaves planar samples (e.g. decoded FLAC Subframes) into the current Block. Waits when both Blocks are full.
+        /// </summary>
+        void WritePlanar(const int32_t* const channelPtrs[], unsigned long channelCount, unsigned long frameCount);
+
+        /// <summary>
+        /// Purpose: Passes the current Block to the Pipeline Thread, and waits until every written sample has been consumed.
+        /// </summary>
+        void Flush();
+
+    private:
+        std::unique_ptr<PcmPipelineWorker> m_ownedWorkerPtr{};
+        PcmPipelineWorker* m_workerPtr{ nullptr };
+};
+
+#endif // PCM_PIPELINE_H
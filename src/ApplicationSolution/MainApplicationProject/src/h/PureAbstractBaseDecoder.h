@@ -1,6 +1,9 @@
 #ifndef PURE_ABSTRACT_BASE_DECODER_H
 #define PURE_ABSTRACT_BASE_DECODER_H
 
+#include "DecoderErrorLog.h"
+#include "PcmAnalyzer.h"
+#include "AccurateRipChecksum.h"
 #include <string>
 
 // The maximum size for C-style strings used for Error Messages.
@@ -32,6 +35,15 @@ class PureAbstractBaseDecoder
         /// <returns>The number of Decoded Audio Units read OR (0 on end of file, -1 on error) during the operation.</returns>
         virtual long long Read() = 0;
 
+        /// <summary>
+        /// Purpose: Use the Decoder to read many Audio Units in a single call, until the Audio Unit budget is used, the time budget elapses, 
+        /// the end of the File is reached, or an error occurs. Amortizes the per-call overhead of Read() for the caller.
+        /// </summary>
+        /// <param name="audioUnitBudget">The number of Decoded Audio Units to read before returning. At least one Read() is always performed.</param>
+        /// <param name="timeBudgetMilliseconds">The time after which the Decoder returns, even when the Audio Unit budget is NOT used.</param>
+        /// <returns>The number of Decoded Audio Units read OR (0 on end of file, -1 on error) during the operation. Decoding stops at the first error.</returns>
+        virtual long long Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds) = 0;
+
         /// <summary>
         /// Purpose: A number representing the total number of Decoded Audio Units read using the Decoder.
         /// </summary>
@@ -39,10 +51,67 @@ class PureAbstractBaseDecoder
         virtual unsigned long long GetDecodedAudioDataTotal() = 0;
 
         /// <summary>
-        /// Purpose: Gets the last error message reported by the Decoder.
+        /// Purpose: Gets the last error message reported by the Decoder. The message is rendered from the last Error Record.
         /// </summary>
         /// <returns>The last error message reported by the Decoder.</returns>
         virtual const wchar_t* GetLastErrorMessage() = 0;
+
+        /// <summary>
+        /// Purpose: Gets the last error reported by the Decoder, without rendering its text.
+        /// </summary>
+        /// <returns>The last Error Record. The code is NONE when no error was reported.</returns>
+        virtual DecoderErrorRecord GetLastErrorRecord() = 0;
+
+        /// <summary>
+        /// Purpose: A quick pre-check that reads only the tail of the File, to detect a truncated File before it is decoded.
+        /// The expected end of the Audio Data (e.g. the total sample count) is compared against the last Frame, Block, or Page found in the tail.
+        /// </summary>
+        /// <returns>TRUE if the File is truncated, and the error message is set. Otherwise, FALSE (including when the tail can NOT be checked).</returns>
+        virtual bool CheckForTruncation() = 0;
+
+        /// <summary>
+        /// Purpose: Switches the Decoder to sampled verification, which must be done before the first Read(). Each Read() then verifies one Window
+        /// of a few Frames (or Blocks, or Pages) starting at a random position within its share of the File, instead of decoding the whole File.
+        /// Checks that need every sample (e.g. MD5 signatures and sample counts) are skipped.
+        /// </summary>
+        /// <param name="windowCount">The number of Windows to verify.</param>
+        /// <returns>TRUE if the File will be sampled. Otherwise, FALSE and the File will be fully decoded.</returns>
+        virtual bool EnableSampledVerification(unsigned long windowCount) = 0;
+
+        /// <summary>
+        /// Purpose: Enables the analysis of the decoded PCM (peak, clipping, DC offset, digital silence, and dual-mono), which must be done before the first Read().
+        /// The samples are analyzed in the same pass as the decode, so the File is NOT decoded a second time.
+        /// </summary>
+        /// <returns>TRUE if the decoded PCM will be analyzed. Otherwise, FALSE (e.g. the Decoder does NOT decode the audio).</returns>
+        virtual bool EnablePcmAnalysis() = 0;
+
+        /// <summary>
+        /// Purpose: Gets the metrics of the PCM decoded so far.
+        /// </summary>
+        /// <param name="resultRef">Receives the metrics.</param>
+        /// <returns>TRUE if the PCM was analyzed. Otherwise, FALSE and resultRef is NOT modified.</returns>
+        virtual bool GetPcmAnalysisResult(PcmAnalysisResult& resultRef) = 0;
+
+        /// <summary>
+        /// Purpose: Enables the AccurateRip and CRC32 checksums of the decoded PCM, which must be done before the first Read().
+        /// The checksums are computed in the same pass as the decode, so the File is NOT decoded a second time.
+        /// </summary>
+        /// <returns>TRUE if the checksums will be computed. Otherwise, FALSE (e.g. the File is NOT lossless CD Audio).</returns>
+        virtual bool EnableAccurateRipChecksum() = 0;
+
+        /// <summary>
+        /// Purpose: Gets the AccurateRip and CRC32 checksums of the PCM decoded so far.
+        /// </summary>
+        /// <param name="resultRef">Receives the checksums.</param>
+        /// <returns>TRUE if the checksums were computed. Otherwise, FALSE and resultRef is NOT modified.</returns>
+        virtual bool GetAccurateRipChecksumResult(AccurateRipChecksumResult& resultRef) = 0;
+
+        /// <summary>
+        /// Purpose: Moves the per-sample work on the decoded PCM (e.g. MD5 signature, analysis, checksums) to a second Thread, so a single File
+        /// is decoded and hashed on two cores. Must be done before the first Read(), and after the analysis and checksums are enabled.
+        /// </summary>
+        /// <returns>TRUE if a second Thread is used. Otherwise, FALSE (e.g. there is NO per-sample work to move).</returns>
+        virtual bool EnablePcmPipeline() = 0;
 };
 
 #endif // PURE_ABSTRACT_BASE_DECODER_H
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef PURE_ABSTRACT_STREAM_SOURCE_H
+#define PURE_ABSTRACT_STREAM_SOURCE_H
+
+#include <cstddef>
+
+/// <summary>
+/// Purpose: A Pure Abstract Base Class (PABC) for the sources a StreamWrapper reads on demand, when the File is NOT a local File Stream
+/// (e.g. a File within an Archive, or a File on a web server). Follows the File Stream semantics of the StreamWrapper.
+/// </summary>
+class PureAbstractStreamSource
+{
+    public:
+        PureAbstractStreamSource() = default;
+        virtual ~PureAbstractStreamSource() = default;
+        PureAbstractStreamSource(const PureAbstractStreamSource& other) = delete; // Delete Copy Constructor
+        PureAbstractStreamSource& operator=(const PureAbstractStreamSource& other) = delete; // Delete Assignment Operator (Overloaded)
+        PureAbstractStreamSource(PureAbstractStreamSource&& other) noexcept = delete; // Delete The Move Constructor
+        PureAbstractStreamSource& operator=(PureAbstractStreamSource&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Reads from the current position, and advances the position by the number of bytes read.
+        /// </summary>
+        /// <returns>The number of bytes read. Less than the size at the end of the source, or when the source can NOT be read.</returns>
+        virtual size_t Read(void* bufferPtr, size_t size) = 0;
+
+        /// <summary>
+        /// Purpose: Moves the position. (SEEK_SET, SEEK_CUR, SEEK_END)
+        /// </summary>
+        /// <returns>0 if the seek was successful. Otherwise, a non-zero value.</returns>
+        virtual int Seek(long long offset, int origin) = 0;
+
+        virtual long long Tell() const = 0;
+        virtual long long Length() const = 0;
+        virtual bool EndOfFile() const = 0;
+};
+
+#endif // PURE_ABSTRACT_STREAM_SOURCE_H
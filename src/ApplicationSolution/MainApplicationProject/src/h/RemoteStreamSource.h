@@ -0,0 +1,139 @@
+#ifndef REMOTE_STREAM_SOURCE_H
+#define REMOTE_STREAM_SOURCE_H
+
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "PureAbstractStreamSource.h"
+
+/// <summary>
+/// Purpose: The range requests made by each RemoteStreamSource.
+/// </summary>
+struct RemoteStreamSettings
+{
+    unsigned long rangeSize{ 1048576UL }; // The number of bytes fetched by each range request.
+    unsigned long prefetchRangeCount{ 4UL }; // The number of ranges requested in parallel, from the range being read.
+    unsigned long windowRangeCount{ 8UL }; // The number of ranges kept in Memory while streaming. At least prefetchRangeCount + 1.
+    unsigned long injectedLatencyMilliseconds{ 0UL }; // A delay added before each request, so a local stand-in server behaves like a distant object gateway.
+};
+
+/// <summary>
+/// Purpose: The parts of an http:// or https:// URL used by a request.
+/// </summary>
+struct RemoteUrl
+{
+    std::wstring hostName{};
+    unsigned short port{};
+    bool isSecure{ false };
+    std::wstring objectName{}; // The path and query (e.g. L"/music/01.flac?X-Amz-Signature=...").
+};
+
+/// <summary>
+/// Purpose: A File on a web server (e.g. an S3-compatible object gateway), read with HTTP range requests (GET with a Range header) instead of being copied to a local Disk.
+///
+/// The File is split into ranges of a fixed size. The ranges from the position onwards are requested in parallel, and a bounded window of ranges is kept,
+/// so Seek(), Tell(), and Length() are answered from the ranges already fetched. The HTTP connections belong to a process-wide WinHTTP session,
+/// so they are kept alive from one File to the next. A server that ignores the Range header returns the whole File, which is then kept as a single range.
+/// Each range request after the first sends the validator of the first response (its ETag, or Last-Modified date) in an If-Range header,
+/// so a File replaced on the server while it is read fails its remaining ranges, instead of mixing the bytes of two versions.
+/// </summary>
+class RemoteStreamSource : public PureAbstractStreamSource
+{
+    public:
+        RemoteStreamSource();
+        virtual ~RemoteStreamSource();
+        RemoteStreamSource(const RemoteStreamSource& other) = delete; // Delete Copy Constructor
+        RemoteStreamSource& operator=(const RemoteStreamSource& other) = delete; // Delete Assignment Operator (Overloaded)
+        RemoteStreamSource(RemoteStreamSource&& other) noexcept = delete; // Delete The Move Constructor
+        RemoteStreamSource& operator=(RemoteStreamSource&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Determines whether a path is an http:// or https:// URL. NOT case sensitive.
+        /// </summary>
+        static bool IsRemotePath(const wchar_t* pathPtr);
+
+        /// <summary>
+        /// Purpose: Gets the scheme, host, and port of a URL (e.g. L"https://gateway:9000/"). Used to group the Files of a server.
+        /// </summary>
+        /// <returns>TRUE if the URL is valid. Otherwise, FALSE.</returns>
+        static bool GetOrigin(const wchar_t* urlPtr, std::wstring& originRef);
+
+        /// <summary>
+        /// Purpose: Determines whether a filename is a URL List (i.e. an M3U Playlist), using its File Extension. NOT case sensitive.
+        /// </summary>
+        static bool IsUrlListType(const wchar_t* filenamePtr);
+
+        /// <summary>
+        /// Purpose: Reads the URLs of a URL List, one per line. Comment lines (starting with '#'), blank lines, and local paths are skipped.
+        /// </summary>
+        /// <returns>TRUE if the URL List was read. Otherwise, FALSE.</returns>
+        static bool ReadUrlList(const wchar_t* listFilenamePtr, std::vector<std::wstring>& urlsRef);
+
+        /// <summary>
+        /// Purpose: Sets the process-wide range request settings. Used by the Files opened afterwards.
+        /// </summary>
+        static void Configure(const RemoteStreamSettings& settingsRef);
+
+        /// <summary>
+        /// Purpose: Requests the first range of the File, which also gives the length of the File.
+        /// </summary>
+        /// <returns>TRUE if the File was found. Otherwise, FALSE.</returns>
+        bool Open(const wchar_t* urlPtr);
+
+        void Close();
+
+        /// <summary>
+        /// Purpose: Fetches the entire File into a Buffer, with up to prefetchRangeCount range requests in parallel.
+        /// </summary>
+        /// <param name="destinationPtr">A Buffer of at least Length() bytes.</param>
+        /// <returns>TRUE if every range was fetched. Otherwise, FALSE.</returns>
+        bool ReadAll(unsigned char* destinationPtr);
+
+        /// <summary>
+        /// Purpose: Reads from the ranges in the window, waiting for a range that is still being fetched. The next ranges are requested ahead of the reads.
+        /// </summary>
+        /// <returns>The number of bytes read. Less than the size at the end of the File, or when a range can NOT be fetched.</returns>
+        size_t Read(void* bufferPtr, size_t size) override;
+
+        /// <summary>
+        /// Purpose: Moves the position within the File. Only the position is changed, so the range is requested by the next Read().
+        /// </summary>
+        /// <returns>0 if the seek was successful. Otherwise, a non-zero value.</returns>
+        int Seek(long long offset, int origin) override;
+
+        long long Tell() const override;
+        long long Length() const override;
+        bool EndOfFile() const override;
+
+    private:
+        /// <summary>
+        /// Purpose: The bytes of a range, once fetched. nullptr if the range could NOT be fetched.
+        /// </summary>
+        using RangeFuture = std::shared_future<std::shared_ptr<const std::vector<unsigned char>>>;
+
+        RemoteUrl m_url{};
+        std::wstring m_validator{}; // The ETag, or Last-Modified date, of the first response. Empty when the server sent neither.
+        RemoteStreamSettings m_settings{};
+        unsigned long long m_rangeSize{};
+        unsigned long long m_length{};
+        bool m_isOpen{ false };
+
+        std::map<unsigned long long, RangeFuture> m_rangeFutures{}; // The window, by range index.
+
+        unsigned long long m_position{};
+        bool m_isEOF{ false };
+
+        /// <summary>
+        /// Purpose: Starts fetching a range on a separate Thread.
+        /// </summary>
+        RangeFuture RequestRange(unsigned long long rangeIndex) const;
+
+        /// <summary>
+        /// Purpose: Requests the ranges from the given range onwards, and drops the ranges furthest from it until the window is within its bound.
+        /// </summary>
+        void PrefetchRanges(unsigned long long rangeIndex);
+};
+
+#endif // REMOTE_STREAM_SOURCE_H
@@ -0,0 +1,66 @@
+#ifndef SAMPLED_VERIFICATION_PLAN_H
+#define SAMPLED_VERIFICATION_PLAN_H
+
+#include <cstddef>
+#include <vector>
+
+/// <summary>
+/// Purpose: Chooses the positions of the Windows that are verified when a File is sampled, instead of being fully decoded.
+///
+/// The range of the File is split into equal strata, and one Window starts at a random position within each stratum (stratified sampling),
+/// so the Windows are spread across the whole File and are visited in ascending order. The first Window always starts at the start of the range.
+/// The positions are in the units of the Decoder (e.g. Samples or bytes).
+/// </summary>
+class SampledVerificationPlan
+{
+    public:
+        SampledVerificationPlan();
+        virtual ~SampledVerificationPlan();
+        SampledVerificationPlan(const SampledVerificationPlan& other) = delete; // Delete Copy Constructor
+        SampledVerificationPlan& operator=(const SampledVerificationPlan& other) = delete; // Delete Assignment Operator (Overloaded)
+        SampledVerificationPlan(SampledVerificationPlan&& other) noexcept = delete; // Delete The Move Constructor
+        SampledVerificationPlan& operator=(SampledVerificationPlan&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Calculates the number of Windows needed to find damage with the requested confidence,
+        /// when the damage affects at least the given fraction of a File. Uses: n = ln(1 - confidence) / ln(1 - damagedFraction).
+        /// </summary>
+        /// <param name="confidence">The probability of finding the damage (e.g. 0.95).</param>
+        /// <param name="damagedFraction">The smallest fraction of a File that is damaged (e.g. 0.05).</param>
+        /// <returns>The number of Windows. At least 1.</returns>
+        static unsigned long CalculateWindowCount(double confidence, double damagedFraction);
+
+        /// <summary>
+        /// Purpose: Chooses the Window positions within the range.
+        /// </summary>
+        /// <param name="windowCount">The number of Windows. Limited to the size of the range.</param>
+        /// <param name="rangeStart">The first position of the range.</param>
+        /// <param name="rangeEnd">The position one past the end of the range.</param>
+        /// <returns>TRUE if at least one Window was chosen. Otherwise, FALSE.</returns>
+        bool Configure(unsigned long windowCount, unsigned long long rangeStart, unsigned long long rangeEnd);
+
+        /// <summary>
+        /// Purpose: Indicates whether Windows were chosen, i.e. the File is sampled.
+        /// </summary>
+        bool IsEnabled() const;
+
+        /// <summary>
+        /// Purpose: Gets the position of the next Window.
+        /// </summary>
+        /// <param name="positionRef">Receives the position.</param>
+        /// <returns>TRUE if a Window remains. Otherwise, FALSE once every Window has been taken.</returns>
+        bool NextWindow(unsigned long long& positionRef);
+
+        /// <summary>
+        /// Purpose: Gets the share of the total progress for the Window most recently taken, so the progress of all of the Windows adds up to the total.
+        /// </summary>
+        /// <param name="total">The total number of Decoded Audio Units for the File.</param>
+        /// <returns>The number of Decoded Audio Units for the Window. At least 1.</returns>
+        unsigned long long GetWindowProgressUnits(unsigned long long total) const;
+
+    private:
+        std::vector<unsigned long long> m_positions{};
+        size_t m_nextIndex{};
+};
+
+#endif // SAMPLED_VERIFICATION_PLAN_H
@@ -0,0 +1,72 @@
+#ifndef SIDECAR_MANIFEST_H
+#define SIDECAR_MANIFEST_H
+
+#include <string>
+#include <vector>
+#include "FileHasher.h"
+
+/// <summary>
+/// Purpose: The outcome of a single manifest entry.
+/// </summary>
+enum class SidecarVerdict : unsigned char
+{
+    NOT_VERIFIED = 0, // The File was NOT read completely (e.g. it is missing, or its decode was stopped), or it has NO FLAC STREAMINFO Block.
+    MATCH,
+    MISMATCH
+};
+
+/// <summary>
+/// Purpose: A manifest entry, and its outcome.
+/// </summary>
+struct SidecarEntryResult
+{
+    std::wstring filename{};
+    std::wstring manifestFilename{};
+    FileHashAlgorithm algorithm{ FileHashAlgorithm::MD5 };
+    SidecarVerdict verdict{ SidecarVerdict::NOT_VERIFIED };
+};
+
+/// <summary>
+/// Purpose: The sidecar manifests found next to the Audio Files, and the outcome of each of their entries, shared by the Decoder Threads.
+///
+/// A manifest lists the expected checksum of each File: .md5 (md5sum), .sfv (CRC32), .xxh64 (xxhsum), and .ffp (the FLAC MD5 signature of the decoded Audio).
+/// The StreamWrapper asks which checksums a File needs when it opens the File, hashes the bytes as it reads them, and records the checksums once the whole File was read,
+/// so the manifests are verified in the same pass as the decode.
+/// URI: https://www.gnu.org/software/coreutils/manual/html_node/md5sum-invocation.html
+/// </summary>
+namespace SidecarManifest
+{
+    /// <summary>
+    /// Purpose: Determines whether a filename is a sidecar manifest, using its File Extension. NOT case sensitive.
+    /// </summary>
+    bool IsManifestType(const wchar_t* filenamePtr);
+
+    /// <summary>
+    /// Purpose: Reads the entries of a manifest. A relative filename is relative to the Folder of the manifest. A manifest that was already added is skipped.
+    /// </summary>
+    /// <returns>TRUE if the manifest was read. Otherwise, FALSE.</returns>
+    bool AddManifest(const wchar_t* manifestFilenamePtr);
+
+    /// <summary>
+    /// Purpose: Gets the checksums of a File that are listed by a manifest, and NOT verified yet. (Thread-safe)
+    /// </summary>
+    /// <returns>The algorithm mask (see FileHasher::GetAlgorithmMask()). 0 when the File needs NO checksums.</returns>
+    unsigned int GetPendingAlgorithmMask(const wchar_t* filenamePtr);
+
+    /// <summary>
+    /// Purpose: Compares the checksums of a whole File with its manifest entries. (Thread-safe)
+    /// </summary>
+    void RecordDigests(const wchar_t* filenamePtr, const FileDigests& digestsRef);
+
+    /// <summary>
+    /// Purpose: Gets every manifest entry and its outcome, sorted by filename. (Thread-safe)
+    /// </summary>
+    std::vector<SidecarEntryResult> GetResults();
+
+    /// <summary>
+    /// Purpose: Removes every manifest and outcome. (Thread-safe)
+    /// </summary>
+    void Clear();
+}
+
+#endif // SIDECAR_MANIFEST_H
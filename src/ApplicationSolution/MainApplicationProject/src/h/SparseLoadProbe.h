@@ -0,0 +1,37 @@
+#ifndef SPARSE_LOAD_PROBE_H
+#define SPARSE_LOAD_PROBE_H
+
+#include <cstdio>
+#include <vector>
+
+/// <summary>
+/// Purpose: A range of File bytes that is NOT loaded into the Memory Buffer, because NO Decoder reads it (e.g. the embedded cover art of a Tag).
+/// </summary>
+struct SparseLoadRange
+{
+    unsigned long long offset{};
+    unsigned long long length{};
+};
+
+/// <summary>
+/// Purpose: A cheap probe of the metadata containers of a File, made before the File is loaded into a Memory Buffer.
+///
+/// Only the headers of the containers are read, to find the bytes the Decoders skip:
+/// the body of a leading ID3v2 Tag, the body of each FLAC Metadata Block other than STREAMINFO and SEEKTABLE (e.g. PICTURE and PADDING),
+/// and the items of a trailing APEv2 Tag. Ogg and WavPack Files are NOT probed, since their Decoders read their tags.
+/// </summary>
+namespace SparseLoadProbe
+{
+    /// <summary>
+    /// Purpose: Finds the ranges of a File that are NOT needed by its Decoder, in increasing order of offset. The File Position Indicator is left undefined.
+    /// </summary>
+    /// <param name="fileStreamPtr">The File Stream, opened for reading in binary mode.</param>
+    /// <param name="minimumRangeLength">A smaller range is loaded anyway, since skipping it saves less than the extra read costs.</param>
+    /// <param name="framingValidationIsEnabled">Set to TRUE to walk the framing of each container (i.e. the ID3v2 Frame headers, and the APEv2 item headers),
+    /// and to check that the FLAC Metadata Blocks are followed by a Frame. A container whose framing is NOT valid is loaded, so its Decoder still reads it.</param>
+    /// <returns>TRUE if at least one range is skipped. Otherwise, FALSE.</returns>
+    bool FindSkippedRanges(FILE* fileStreamPtr, unsigned long long fileLength, unsigned long long minimumRangeLength, bool framingValidationIsEnabled,
+        std::vector<SparseLoadRange>& skippedRangesRef);
+}
+
+#endif // SPARSE_LOAD_PROBE_H
@@ -8,7 +8,24 @@
 #include <io.h>
 
 #include <exception>
+#include <memory>
 #include <string>
+#include <vector>
+#include "SparseLoadProbe.h"
+#include "ArchiveMemberSource.h"
+#include "RemoteStreamSource.h"
+#include "FileHasher.h"
+
+/// <summary>
+/// Purpose: How the Files read by a StreamWrapper use the System File Cache.
+/// </summary>
+enum class StreamCachePolicy : unsigned char
+{
+    DEFAULT = 0, // The File is read through the System File Cache, with the default read-ahead.
+    SEQUENTIAL_SCAN, // The File is opened with FILE_FLAG_SEQUENTIAL_SCAN, so the Cache reads further ahead, and unmaps the pages behind the reads sooner.
+    NO_BUFFERING // The File is read into the Memory Buffer with FILE_FLAG_NO_BUFFERING, in sector-aligned Blocks, bypassing the Cache completely.
+                 // Only used with the Memory Buffer. Otherwise, or when the Volume rejects the aligned reads, SEQUENTIAL_SCAN is used.
+};
 
 /// <summary>
 /// Purpose: A File I/O Wrapper Class (Primarily uses C-Style File I/O Libraries). Uses available Memory, to prevent Disk Thrashing between Threads.
@@ -25,7 +42,8 @@ class StreamWrapper
         StreamWrapper& operator=(StreamWrapper&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
 
         /// <summary>
-        /// Purpose: 
+        /// Purpose: Opens a File. A path of the form "archive!member" opens a File within a ZIP or TAR Archive, without extracting it.
+        /// An http:// or https:// URL opens a File on a web server, without downloading it first.
         /// </summary>
         /// <param name="filenamePtr"></param>
         /// <param name="useMemoryBufferEnabled">
@@ -67,9 +85,76 @@ class StreamWrapper
         /// <returns>The total length of the Stream in bytes.</returns>
         long long Length();
 
+        /// <summary>
+        /// Purpose: Reads the last bytes of the Stream, without changing the File Position Indicator of the Stream.
+        /// </summary>
+        /// <param name="bufferPtr">A pointer to a Buffer.</param>
+        /// <param name="size">The Buffer size. Files smaller than the Buffer are read completely.</param>
+        /// <returns>Returns the number of Bytes read.</returns>
+        size_t ReadTail(void* bufferPtr, size_t size);
+
         bool EndOfFile();
         bool isOpen() const;
 
+        /// <summary>
+        /// Purpose: Gets a read-only pointer to the Memory Buffer that holds the entire File.
+        /// </summary>
+        /// <returns>A pointer to the resident File data. Otherwise, nullptr if the Memory Buffer is NOT enabled, or the File was loaded sparsely.</returns>
+        const unsigned char* GetMemoryBufferPtr() const;
+
+        /// <summary>
+        /// Purpose: Gets the size in bytes of the Memory Buffer that holds the entire File.
+        /// </summary>
+        /// <returns>The size in bytes. Otherwise, 0 if the Memory Buffer is NOT enabled, or the File was loaded sparsely.</returns>
+        size_t GetMemoryBufferSize() const;
+
+        /// <summary>
+        /// Purpose: Gets a read-only pointer to the resident File data at an offset. Unlike GetMemoryBufferPtr(), also used when the File was loaded sparsely.
+        /// </summary>
+        /// <param name="residentSizeRef">The number of contiguous resident bytes from the offset.</param>
+        /// <returns>A pointer to the resident File data. Otherwise, nullptr if the Memory Buffer is NOT enabled, or the offset was NOT loaded.</returns>
+        const unsigned char* GetResidentDataPtr(long long offset, size_t& residentSizeRef) const;
+
+        /// <summary>
+        /// Purpose: Gets the Cache Policy of the open File. NO_BUFFERING falls back to SEQUENTIAL_SCAN without the Memory Buffer, or when the Volume rejects the aligned reads.
+        /// </summary>
+        StreamCachePolicy GetFileCachePolicy() const;
+
+        /// <summary>
+        /// Purpose: Sets the process-wide Cache Policy. Used by the Files opened afterwards.
+        /// </summary>
+        static void SetCachePolicy(StreamCachePolicy cachePolicy);
+        static StreamCachePolicy GetCachePolicy();
+
+        /// <summary>
+        /// Purpose: Gets the name of a Cache Policy (e.g. "NO_BUFFERING").
+        /// </summary>
+        static const wchar_t* GetCachePolicyName(StreamCachePolicy cachePolicy);
+
+        /// <summary>
+        /// Purpose: Gets the total number of bytes read from Files by every StreamWrapper, since the count was last reset. Used to measure the scan throughput.
+        /// </summary>
+        static unsigned long long GetTotalBytesRead();
+
+        /// <summary>
+        /// Purpose: Enables sparse loading. The metadata containers of each File are probed before the File is loaded into the Memory Buffer,
+        /// and the bytes NO Decoder reads (e.g. embedded cover art) are NOT loaded. Reading a range that was NOT loaded returns zero bytes.
+        /// NOT used with the NO_BUFFERING Cache Policy.
+        /// </summary>
+        /// <param name="minimumRangeLength">A smaller range is loaded anyway.</param>
+        /// <param name="framingValidationIsEnabled">Set to TRUE to skip a container only when its framing is valid. See SparseLoadProbe::FindSkippedRanges().</param>
+        static void SetSparseLoading(bool sparseLoadingIsEnabled, unsigned long long minimumRangeLength, bool framingValidationIsEnabled);
+
+        /// <summary>
+        /// Purpose: Gets the total number of bytes NOT loaded by sparse loading, since the count was last reset.
+        /// </summary>
+        static unsigned long long GetTotalBytesSkipped();
+
+        /// <summary>
+        /// Purpose: Resets the bytes read, and the bytes skipped.
+        /// </summary>
+        static void ResetTotalBytesRead();
+
     private:
         FILE* m_fileObjectStreamPtr{ nullptr };
         bool m_isEOF{ false };
@@ -79,6 +164,89 @@ class StreamWrapper
         char* m_fileModeBufferPtr{ nullptr };
         size_t m_fileMemoryBufferSize{};
         size_t m_fileMemoryBufferPosition{};
+        size_t m_fileMemoryBufferCapacity{}; // The size of an aligned Memory Buffer taken from the Buffer Pool. Otherwise, 0.
+        StreamCachePolicy m_cachePolicy{ StreamCachePolicy::DEFAULT };
+
+        /// <summary>
+        /// Purpose: A range of the File held by a sparse Memory Buffer, which holds the ranges back to back.
+        /// </summary>
+        struct ResidentExtent
+        {
+            size_t fileOffset{};
+            size_t length{};
+            size_t bufferOffset{};
+        };
+
+        std::vector<ResidentExtent> m_residentExtents{}; // Empty, unless the File was loaded sparsely.
+
+        /// <summary>
+        /// Purpose: The source of a File that is NOT a local File Stream (i.e. an Archive member, or a File on a web server), when it is read on demand.
+        /// A STORED Archive member is used in place as the Memory Buffer, which is then NOT freed by the StreamWrapper.
+        /// </summary>
+        std::unique_ptr<PureAbstractStreamSource> m_streamSourcePtr{};
+        bool m_isMemoryBufferMapped{ false };
+
+        /// <summary>
+        /// Purpose: Hashes a local File as it is read, when a sidecar manifest lists the File. nullptr otherwise.
+        /// Only the bytes read in File order are hashed, so a File that is skipped through, or NOT read to the end, is NOT verified.
+        /// </summary>
+        std::unique_ptr<FileHasher> m_fileHasherPtr{};
+        std::wstring m_hashedFilename{};
+        unsigned long long m_hashedLength{};
+        unsigned long long m_hashFileLength{};
+
+        /// <summary>
+        /// Purpose: Opens the File Stream for reading in binary mode, with the File flags of the Cache Policy.
+        /// </summary>
+        /// <returns>TRUE if the File Stream was opened. Otherwise, FALSE.</returns>
+        bool OpenFileStream(const wchar_t* filenamePtr);
+
+        /// <summary>
+        /// Purpose: Opens a File within a ZIP or TAR Archive. A STORED member is read from the mapping of the Archive.
+        /// A DEFLATED member is inflated into the Memory Buffer when it is enabled. Otherwise, it is inflated on demand as it is read.
+        /// </summary>
+        /// <returns>TRUE if the member was opened. Otherwise, FALSE.</returns>
+        bool OpenArchiveMember(const std::wstring& archiveFilenameRef, const std::wstring& memberNameRef, bool useMemoryBufferEnabled);
+
+        /// <summary>
+        /// Purpose: Opens a File on a web server. The File is fetched into the Memory Buffer with parallel range requests when it is enabled.
+        /// Otherwise, its ranges are fetched ahead of the reads.
+        /// </summary>
+        /// <returns>TRUE if the File was opened. Otherwise, FALSE.</returns>
+        bool OpenRemoteStream(const wchar_t* urlPtr, bool useMemoryBufferEnabled);
+
+        /// <summary>
+        /// Purpose: Reads the entire File into an aligned Memory Buffer from the Buffer Pool, using sector-aligned reads. The File must be opened with FILE_FLAG_NO_BUFFERING.
+        /// </summary>
+        /// <returns>TRUE if the File was read. Otherwise, FALSE (e.g. the Volume has a sector size larger than the alignment).</returns>
+        bool ReadUnbufferedMemoryBuffer(size_t fileLengthBytes);
+
+        /// <summary>
+        /// Purpose: Starts hashing a local File, with the checksums its sidecar manifests still need. Does nothing when NO manifest lists the File.
+        /// </summary>
+        void BeginFileHash(const wchar_t* filenamePtr, unsigned long long fileLength);
+
+        /// <summary>
+        /// Purpose: Hashes bytes that were just read from the File. Once the whole File was hashed, its checksums are compared with its manifest entries.
+        /// </summary>
+        /// <param name="offset">The File offset of the bytes.</param>
+        void HashFileBytes(unsigned long long offset, const unsigned char* dataPtr, size_t size);
+
+        /// <summary>
+        /// Purpose: Reads the File into a sparse Memory Buffer, which holds every range of the File except the skipped ranges.
+        /// </summary>
+        /// <returns>TRUE if the File was read. Otherwise, FALSE.</returns>
+        bool ReadSparseMemoryBuffer(size_t fileLengthBytes, const std::vector<SparseLoadRange>& skippedRangesRef);
+
+        /// <summary>
+        /// Purpose: Copies File data from the Memory Buffer. The ranges NOT loaded by sparse loading are copied as zero bytes.
+        /// </summary>
+        void CopyMemoryBuffer(void* destinationPtr, size_t position, size_t size) const;
+
+        /// <summary>
+        /// Purpose: Frees the Memory Buffer, or returns it to the Buffer Pool.
+        /// </summary>
+        void ReleaseMemoryBuffer();
         
         /// <summary>
         /// Purpose: Opens the File Stream using Direct I/O that is Memory Buffered.
@@ -0,0 +1,226 @@
+#ifndef VOLUME_ADMISSION_H
+#define VOLUME_ADMISSION_H
+
+#include "WinAPIUtils.h"
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Purpose: The storage behind a Volume. Each class is given its own number of concurrent reads.
+/// </summary>
+enum class StorageClass : unsigned char
+{
+    UNKNOWN = 0, // The storage did NOT report its seek penalty. The class is learned from the measured open latency.
+    ROTATIONAL,
+    SOLID_STATE,
+    NETWORK
+};
+
+/// <summary>
+/// Purpose: The number of concurrent reads admitted for each storage class.
+/// </summary>
+struct VolumeAdmissionLimits
+{
+    unsigned long rotationalLimit{ 1UL };
+    unsigned long solidStateLimit{ 8UL };
+    unsigned long networkLimit{ 4UL };
+};
+
+/// <summary>
+/// Purpose: A read admitted to a Volume. Passed back to Release() when the File has been read.
+/// </summary>
+struct VolumeAdmissionTicket
+{
+    size_t volumeIndex{};
+    unsigned long long byteCount{};
+    std::chrono::steady_clock::time_point admittedTime{};
+    bool isExtentOrdered{ false }; // The File was chosen in the order of the physical location of the Files.
+};
+
+/// <summary>
+/// Purpose: Per-Volume I/O admission control. A Decoder Thread is admitted to the Volume of its File before the File is read,
+/// and each Volume admits as many concurrent reads as suits its storage (e.g. a single read for a rotational Disk, which loses its throughput to seeking
+/// when several Files are read at once). The Files on the other Volumes are read at the same time, so a busy Disk does NOT hold back the other Disks.
+///
+/// The storage class of a local Volume is reported by the storage (i.e. its seek penalty). A network share is always NETWORK.
+/// When the class is NOT reported, the Volume admits a single read until its latency has been measured.
+///
+/// When extent ordering is enabled, the Files of a rotational Disk are chosen in the order of their first Cluster, sweeping from the start of the Disk
+/// to its end, then starting again (i.e. C-SCAN elevator order), instead of in the order they were found.
+/// Thread-safe.
+/// </summary>
+class VolumeAdmission
+{
+    public:
+        VolumeAdmission();
+        virtual ~VolumeAdmission();
+        VolumeAdmission(const VolumeAdmission& other) = delete; // Delete Copy Constructor
+        VolumeAdmission& operator=(const VolumeAdmission& other) = delete; // Delete Assignment Operator (Overloaded)
+        VolumeAdmission(VolumeAdmission&& other) noexcept = delete; // Delete The Move Constructor
+        VolumeAdmission& operator=(VolumeAdmission&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Sets the number of concurrent reads of each storage class, and the configured storage classes. Must be called before any File is admitted.
+        /// </summary>
+        /// <param name="storageClassOverridesPtr">The configured storage classes (e.g. L"D:\\=ROTATIONAL;\\\\nas\\music\\=NETWORK"), by Volume root. NOT case sensitive.
+        /// Replaces the class reported by the storage. Can be nullptr.</param>
+        void Configure(const VolumeAdmissionLimits& limitsRef, const wchar_t* storageClassOverridesPtr);
+
+        /// <summary>
+        /// Purpose: Enables choosing the Files of a rotational Disk in the order of their physical location. Must be called before any File is added.
+        /// </summary>
+        /// <param name="comparisonIsEnabled">When enabled, the physical order and the order the Files were found are alternated on each rotational Disk,
+        /// so the throughput of both orders is measured on the same Disk.</param>
+        void SetExtentOrderingEnabled(bool extentOrderingIsEnabled, bool comparisonIsEnabled);
+
+        /// <summary>
+        /// Purpose: Adds a pending File, and finds its Volume, so choosing the File does NOT call the File System.
+        /// When extent ordering is enabled, the physical location of a File on a rotational Disk is read. The Files of a Volume NOT yet classed
+        /// are located once the Volume is learned to be ROTATIONAL.
+        /// Must be called before the File is added to the List passed to FindAdmissibleFile().
+        /// </summary>
+        void AddFile(const wchar_t* filenamePtr);
+
+        /// <summary>
+        /// Purpose: Removes every pending File.
+        /// </summary>
+        void ClearFiles();
+
+        /// <summary>
+        /// Purpose: Waits until the Volume of the File admits another read.
+        /// </summary>
+        /// <returns>The Ticket, which must be passed to Release().</returns>
+        VolumeAdmissionTicket Admit(const wchar_t* filenamePtr);
+
+        /// <summary>
+        /// Purpose: Ends a read, and adds its time to the latency measurements of the Volume.
+        /// </summary>
+        void Release(const VolumeAdmissionTicket& ticketRef);
+
+        /// <summary>
+        /// Purpose: Finds the first of the next lookaheadCount Files whose Volume admits another read without waiting.
+        /// Used to choose the next File of a Decoder Thread, so the Thread does NOT wait on a busy Volume while the Files of other Volumes are pending.
+        /// On a rotational Disk with extent ordering, the File next in elevator order within the lookahead is chosen instead.
+        /// The chosen File is removed from the pending Files.
+        /// </summary>
+        /// <returns>The File found. The first File when every Volume within the lookahead is busy.</returns>
+        std::list<std::wstring>::iterator FindAdmissibleFile(std::list<std::wstring>& filenameListRef, size_t lookaheadCount);
+
+        /// <summary>
+        /// Purpose: Renders the storage class, concurrent reads, and throughput of each Volume used so far (e.g. "C:\  SOLID_STATE x8 (120 Files, 85.2 MB/s per read, latency 0.3 ms)").
+        /// </summary>
+        std::wstring GetReport() const;
+
+    private:
+        struct Volume
+        {
+            std::wstring volumeMountPoint{};
+            StorageClass storageClass{ StorageClass::UNKNOWN };
+            bool storageClassIsLearned{ false };
+            unsigned long admissionLimit{ 1UL };
+            unsigned long activeCount{ 0UL };
+
+            /// <summary>
+            /// Purpose: The sums of the least-squares fit of (read seconds = latency + byte count / bandwidth), over the Files read so far.
+            /// </summary>
+            unsigned long fileCount{ 0UL };
+            double byteSum{ 0.0 };
+            double secondsSum{ 0.0 };
+            double byteSquaredSum{ 0.0 };
+            double byteSecondsProductSum{ 0.0 };
+            double latencySeconds{ 0.0 };
+
+            /// <summary>
+            /// Purpose: The elevator position (i.e. the first Cluster of the last File chosen), and the first Cluster of the last File found.
+            /// </summary>
+            unsigned long long headCluster{ 0ULL };
+            unsigned long long lastFoundCluster{ 0ULL };
+            bool hasHeadCluster{ false };
+            bool hasLastFoundCluster{ false };
+
+            /// <summary>
+            /// Purpose: The distance in Clusters between consecutive Files, in the order they were chosen, and in the order they were found.
+            /// </summary>
+            double chosenSeekSum{ 0.0 };
+            unsigned long chosenSeekCount{ 0UL };
+            double foundSeekSum{ 0.0 };
+            unsigned long foundSeekCount{ 0UL };
+
+            /// <summary>
+            /// Purpose: The throughput of the Files read in the order they were found [0], and in elevator order [1], when the orders are compared.
+            /// </summary>
+            unsigned long chosenFileCount{ 0UL };
+            bool isExtentOrderedPeriod{ true };
+            double orderByteSum[2]{};
+            double orderSecondsSum[2]{};
+
+            /// <summary>
+            /// Purpose: The pending Files added while the storage class was still UNKNOWN, in the order they were found. They are located if the Volume is learned to be ROTATIONAL.
+            /// </summary>
+            std::vector<std::wstring> unlocatedFilenames{};
+        };
+
+        mutable std::mutex m_mutex{};
+        std::condition_variable m_admissionCondition{};
+
+        VolumeAdmissionLimits m_limits{};
+        std::map<std::wstring, StorageClass> m_storageClassOverrideMap{}; // By upper-case Volume root, with a trailing backslash.
+
+        std::vector<Volume> m_volumes{};
+        std::map<std::wstring, size_t> m_volumeNameToIndexMap{};
+
+        /// <summary>
+        /// Purpose: The Volume of each Folder seen so far, so the Volume of a File is found without a File System call.
+        /// </summary>
+        std::map<std::wstring, size_t> m_folderToVolumeIndexMap{};
+
+        bool m_extentOrderingIsEnabled{ false };
+        bool m_comparisonIsEnabled{ false };
+
+        /// <summary>
+        /// Purpose: The first Cluster of each pending File on a rotational Disk.
+        /// </summary>
+        std::map<std::wstring, unsigned long long> m_fileStartingClusterMap{};
+
+        /// <summary>
+        /// Purpose: The pending Files whose physical location is NOT yet read. A File chosen meanwhile is removed, so its location is NOT added.
+        /// </summary>
+        std::set<std::wstring> m_unlocatedFileSet{};
+
+        /// <summary>
+        /// Purpose: Finds the Volume of a File, adding the Volume when it is new. The File System is read without holding the Mutex. Must be called WITHOUT the Mutex held.
+        /// </summary>
+        size_t FindVolume(const wchar_t* filenamePtr);
+
+        /// <summary>
+        /// Purpose: Finds the Volume of a File from the Folders seen so far, without a File System call. Must be called with the Mutex held.
+        /// </summary>
+        /// <returns>TRUE if the Volume was found. Otherwise, FALSE.</returns>
+        bool FindKnownVolume(const wchar_t* filenamePtr, size_t& volumeIndexRef) const;
+
+        /// <summary>
+        /// Purpose: Reads the physical location of pending Files of a rotational Disk, in the order they were found. Must be called WITHOUT the Mutex held.
+        /// </summary>
+        void LocateFiles(size_t volumeIndex, const std::vector<std::wstring>& filenamesRef);
+
+        /// <summary>
+        /// Purpose: Measures the latency of a Volume, once enough Files have been read, and classifies an UNKNOWN Volume from it. Must be called with the Mutex held.
+        /// </summary>
+        void UpdateLatency(Volume& volumeRef);
+
+        /// <summary>
+        /// Purpose: Chooses the File next in elevator order on a Volume, from the lookahead. Must be called with the Mutex held.
+        /// </summary>
+        /// <returns>The File. The given first File when NO File of the Volume has a known physical location.</returns>
+        std::list<std::wstring>::iterator FindNextExtentOrderedFile(std::list<std::wstring>& filenameListRef, size_t lookaheadCount, size_t volumeIndex, std::list<std::wstring>::iterator firstFileIterator);
+
+        unsigned long GetAdmissionLimit(StorageClass storageClass) const;
+};
+
+#endif // VOLUME_ADMISSION_H
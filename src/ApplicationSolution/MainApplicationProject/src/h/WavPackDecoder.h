@@ -4,17 +4,32 @@
 #include "PureAbstractBaseDecoder.h"
 #include "AbstractBaseDecoder.h"
 #include "StreamWrapper.h"
+#include "SampledVerificationPlan.h"
 #include "md5.h"
+#include "MultiBufferMD5Service.h"
+#include "DecoderTuning.h"
 #include <wavpack/wavpack.h>
 #include <string>
-#include <codecvt>
+#include <cstring>
+#include <vector>
+
+constexpr auto MAX_WAVPACK_ERROR = 80;
 
 /// <summary>
-/// Purpose: Used for specifying the maximum Buffer Size used for Reading Unpacked Samples.
+/// Purpose: The number of bytes read from the tail of a WavPack File, when checking the last Block for truncation.
 /// </summary>
-constexpr auto MAX_UNPACKED_SAMPLE_BUFFER_SIZE = 4096L;
+constexpr auto WAVPACK_TAIL_CHECK_SIZE = 1024UL * 1024UL;
 
-constexpr auto MAX_WAVPACK_ERROR = 80;
+/// <summary>
+/// Purpose: The size in bytes of a WavPack Block Header.
+/// URI: https://www.wavpack.com/WavPack5FileFormat.pdf
+/// </summary>
+constexpr auto WAVPACK_BLOCK_HEADER_SIZE = 32UL;
+
+/// <summary>
+/// Purpose: The number of times the Sample Buffer is filled per Window, when the File is sampled.
+/// </summary>
+constexpr auto WAVPACK_SAMPLED_WINDOW_READ_COUNT = 8UL;
 
 /// <summary>
 /// Purpose: A Derived Class implementing a WavPack Decoder. 
@@ -41,6 +56,7 @@ class WavPackDecoder : public AbstractBaseDecoder
     public:
         WavPackDecoder();
         WavPackDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled);
+        WavPackDecoder(const wchar_t* filenamePtr, bool memoryBufferIsEnabled, MultiBufferMD5Service* md5ServicePtr);
         virtual ~WavPackDecoder();
         WavPackDecoder(const WavPackDecoder& other) = delete; // Delete Copy Constructor
         WavPackDecoder& operator=(const WavPackDecoder& other) = delete; // Delete Assignment Operator (Overloaded)
@@ -50,10 +66,36 @@ class WavPackDecoder : public AbstractBaseDecoder
         #pragma region Overridden_Base_Class_Functions_Region
 
         long long Read();
+        long long Decode(unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds);
         unsigned long long GetDecodedAudioDataTotal();
-        const wchar_t* GetLastErrorMessage();
         const wchar_t* GetSupportedTypes();
 
+        /// <summary>
+        /// Purpose: Finds the last Block Header in the tail of the File, and compares the last sample of the last Block against WavpackGetNumSamples64().
+        /// </summary>
+        /// <returns>TRUE if the File is truncated. Otherwise, FALSE.</returns>
+        bool CheckForTruncation();
+
+        /// <summary>
+        /// Purpose: Chooses the Windows by sample number. Requires the total number of samples to be known.
+        /// </summary>
+        bool EnableSampledVerification(unsigned long windowCount);
+
+        /// <summary>
+        /// Purpose: DSD Audio is NOT analyzed, since its samples are NOT PCM.
+        /// </summary>
+        bool EnablePcmAnalysis();
+
+        /// <summary>
+        /// Purpose: Requires a lossless (i.e. Pure or Hybrid with the Correction File), 44.1kHz, 16-bit, stereo integer Stream (i.e. CD Audio).
+        /// </summary>
+        bool EnableAccurateRipChecksum();
+
+        /// <summary>
+        /// Purpose: Moves the MD5 Checksum, the PCM analysis, and the checksums to the Pipeline Thread. Requires an MD5 Checksum, or the PCM analysis or checksums to be enabled.
+        /// </summary>
+        bool EnablePcmPipeline();
+
         #pragma endregion Overridden_Base_Class_Functions_Region
 
         static constexpr wchar_t* DECODER_NAME = L"WAV_PACK";
@@ -89,8 +131,6 @@ class WavPackDecoder : public AbstractBaseDecoder
         #endif
         #pragma endregion WAVPACK_STREAM_READER_ADJUSTMENT_FOR_COMPILATION_TARGET
 
-        wchar_t m_errorMessage[MAX_ERROR_SIZE]{};
-
         long long m_streamTotalSampleCount{};
         unsigned long long m_totalUnpackedSampleCount{};
         int m_bytesPerSample{};
@@ -103,7 +143,7 @@ class WavPackDecoder : public AbstractBaseDecoder
         unsigned long long maximumRequiredSampleBufferSize{};
 
         /// <summary>
-        /// Purpose: Uses the formula: (MAX_UNPACKED_SAMPLE_BUFFER_SIZE / Number of Channels) to limit the number of requested Unpacked Audio Samples.
+        /// Purpose: Uses the formula: (Unpack Sample Count of the Decoder tuning profile / Number of Channels) to limit the number of requested Unpacked Audio Samples.
         /// </summary>
         unsigned long m_requestedCompleteSamples{};
         
@@ -112,25 +152,55 @@ class WavPackDecoder : public AbstractBaseDecoder
         /// </summary>
         bool m_DSDAudioFlagEnabled{ false };
 
+        /// <summary>
+        /// Purpose: The Unpacked Samples are 32-bit floating point values, instead of Integers.
+        /// </summary>
+        bool m_floatAudioFlagEnabled{ false };
+
         bool m_md5ModeIsEnabled{ false };
         md5_state_t m_stateStructMD5Algorithm{};
 
         /// <summary>
-        /// Purpose: A Buffer used for storing Unpacked Samples.
+        /// Purpose: The shared MD5 service, and the Stream of this File. When the Stream is 0, the MD5 Algorithm state above is used instead.
         /// </summary>
-        int32_t m_unpackedSampleBuffer[MAX_UNPACKED_SAMPLE_BUFFER_SIZE]{};
+        MultiBufferMD5Service* m_md5ServicePtr{ nullptr };
+        MD5StreamId m_md5StreamId{ 0UL };
 
         /// <summary>
-        /// Purpose: Prepares the Sample Buffer Data and updates Input Message Data that will be used for a final MD5 calculation.
+        /// Purpose: A Buffer used for storing Unpacked Samples. Holds (m_requestedCompleteSamples * Number of Channels) Samples.
         /// </summary>
-        /// <param name="sampleCount">The number of Samples to process for the Input Message Data.</param>
-        void UpdateMD5(long long sampleCount);
+        std::vector<int32_t> m_unpackedSampleBuffer{};
 
         /// <summary>
-        /// Purpose: A wrapper function for getting Error Messages from WavPack as the std:wstring type.
+        /// Purpose: The Windows to verify, when the File is sampled.
         /// </summary>
-        /// <returns></returns>
-        std::wstring GetLastWavPackErrorMessage();
+        SampledVerificationPlan m_sampledVerificationPlan{};
+
+        /// <summary>
+        /// Purpose: The Read() implementation used when the File is sampled. Seeks to the next Window, and unpacks its Blocks.
+        /// Each WavPack Block holds its own CRC, so damage is found by the increase in WavpackGetNumErrors().
+        /// </summary>
+        /// <returns>The Window's share of the total samples, 0 once every Window has been verified, or -1 if an error occurred.</returns>
+        long long ReadSampled();
+
+        /// <summary>
+        /// Purpose: Records a time based error, using the sample number.
+        /// </summary>
+        void RecordSampleTimeError(DecoderErrorCode code, unsigned long long sampleNumber);
+
+        /// <summary>
+        /// Purpose: Analyzes, checksums, and hashes a Buffer of Unpacked Samples. Called on the Decoder Thread, or on the Pipeline Thread when the Pipeline is enabled.
+        /// </summary>
+        /// <param name="samplePtr">The interleaved Unpacked Samples. The Samples are packed in place by UpdateMD5().</param>
+        /// <param name="sampleCountPerChannel">The number of Samples per channel.</param>
+        void ProcessUnpackedSamples(int32_t* samplePtr, long long sampleCountPerChannel);
+
+        /// <summary>
+        /// Purpose: Prepares the Sample Buffer Data and updates Input Message Data that will be used for a final MD5 calculation.
+        /// </summary>
+        /// <param name="samplePtr">The Sample Buffer. The Samples are packed in place.</param>
+        /// <param name="sampleCount">The number of Samples to process for the Input Message Data.</param>
+        void UpdateMD5(int32_t* samplePtr, long long sampleCount);
 
         void OpenFile(const wchar_t* filenamePtr, bool memoryBufferIsEnabled);
 
@@ -3,6 +3,7 @@
 
 #include <windows.h>
 #include <winioctl.h>
+#include <psapi.h>
 #include <stdio.h>
 #include <map>
 #include <list>
@@ -40,6 +41,43 @@ namespace WinAPIUtils
     /// <param name="filenamePtr"></param>
     /// <returns>TRUE if Folder/Directory Type and FALSE otherwise.</returns>
     bool IsFolderType(const wchar_t* filenamePtr);
+
+    /// <summary>
+    /// Purpose: Identifies the Volume that stores a File.
+    /// </summary>
+    /// <param name="filenamePtr">The filename.</param>
+    /// <param name="volumeNameRef">The unique name of a local Volume (e.g. "\\?\Volume{GUID}\"), which is the same for every Drive Letter and Mount Point of the Volume.
+    /// For a network share, the root of the share (e.g. "\\server\share\").</param>
+    /// <param name="volumeMountPointRef">The root of the Volume in the filename (e.g. "C:\").</param>
+    /// <param name="isRemoteRef">TRUE when the Volume is a network share.</param>
+    /// <returns>TRUE if the Volume was found. Otherwise, FALSE.</returns>
+    bool GetFileVolume(const wchar_t* filenamePtr, std::wstring& volumeNameRef, std::wstring& volumeMountPointRef, bool& isRemoteRef);
+
+    /// <summary>
+    /// Purpose: Determines whether a local Volume incurs a seek penalty (i.e. a rotational Disk), instead of being Solid State storage.
+    /// Unlike GetLogicalDriveGeometry(), this function does NOT require Administrative Privileges.
+    /// </summary>
+    /// <param name="volumeNameRef">The unique name of a local Volume, as found by GetFileVolume().</param>
+    /// <returns>TRUE if the storage reported its seek penalty. Otherwise, FALSE (e.g. a RAID Controller or a USB bridge that does NOT support the query).</returns>
+    bool GetVolumeSeekPenalty(const std::wstring& volumeNameRef, bool& incursSeekPenaltyRef);
+
+    /// <summary>
+    /// Purpose: Gets the first Logical Cluster Number (LCN) of a File, which is its physical location on the Volume. Does NOT require Administrative Privileges.
+    /// </summary>
+    /// <returns>TRUE if the location was found. Otherwise, FALSE (e.g. a File stored within the Master File Table, or a File System without Clusters).</returns>
+    bool GetFileStartingCluster(const wchar_t* filenamePtr, unsigned long long& startingClusterRef);
+
+    /// <summary>
+    /// Purpose: Gets the size of the System File Cache, in bytes. Used to measure how much of the Cache a scan occupies.
+    /// </summary>
+    /// <returns>TRUE if the size was obtained. Otherwise, FALSE.</returns>
+    bool GetSystemCacheSize(unsigned long long& systemCacheSizeRef);
+
+    /// <summary>
+    /// Purpose: Gets the size of a File in bytes, from its attributes. The File is NOT opened.
+    /// </summary>
+    /// <returns>TRUE if the size was obtained. Otherwise, FALSE (e.g. an Archive member, or a URL).</returns>
+    bool GetFileSize(const wchar_t* filenamePtr, unsigned long long& fileSizeRef);
 }
 
 #endif // WIN_API_UTILS_H
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "AccurateRipChecksum.h"
+#include "AccurateRipChecksum.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace AccurateRipChecksumUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The number of stereo samples in the generated Track (a few Sectors more than both skipped ranges), and the largest block added at once.
+    /// </summary>
+    constexpr auto TRACK_FRAME_COUNT = 25000UL;
+    constexpr auto MAXIMUM_BLOCK_FRAME_COUNT = 4700U;
+
+    /// <summary>
+    /// Purpose: Computes the checksums of a Track one sample at a time, as the AccurateRip reference implementation does.
+    /// The first Track excludes the positions before 5 Sectors - 1, and the last Track excludes the last 5 Sectors.
+    /// </summary>
+    AccurateRipChecksumResult ComputeReferenceResult(const std::vector<int32_t>& leftSamplesRef, const std::vector<int32_t>& rightSamplesRef)
+    {
+        AccurateRipChecksumResult result{};
+        const unsigned long long frameCount = leftSamplesRef.size();
+        const unsigned long long firstTrackStart = ACCURATERIP_SKIPPED_FRAME_COUNT - 1ULL;
+        const unsigned long long lastTrackEnd = frameCount - ACCURATERIP_SKIPPED_FRAME_COUNT;
+
+        uint32_t crc32 = 0xFFFFFFFFUL;
+        for (unsigned long long position = 1ULL; position <= frameCount; ++position)
+        {
+            const uint32_t left = static_cast<uint32_t>(leftSamplesRef[static_cast<size_t>(position - 1ULL)]) & 0xFFFFUL;
+            const uint32_t right = static_cast<uint32_t>(rightSamplesRef[static_cast<size_t>(position - 1ULL)]) & 0xFFFFUL;
+            const uint64_t product = static_cast<uint64_t>((right << 16) | left) * static_cast<uint32_t>(position);
+            const uint32_t v1 = static_cast<uint32_t>(product);
+            const uint32_t v2 = static_cast<uint32_t>(product) + static_cast<uint32_t>(product >> 32);
+
+            result.accurateRipV1 += v1;
+            result.accurateRipV2 += v2;
+            if (position >= firstTrackStart)
+            {
+                result.accurateRipV1FirstTrack += v1;
+                result.accurateRipV2FirstTrack += v2;
+            }
+
+            if (position <= lastTrackEnd)
+            {
+                result.accurateRipV1LastTrack += v1;
+                result.accurateRipV2LastTrack += v2;
+            }
+
+            // The CRC32 of the little-endian PCM bytes, one bit at a time.
+            const unsigned char bytes[4] = { static_cast<unsigned char>(left), static_cast<unsigned char>(left >> 8), static_cast<unsigned char>(right), static_cast<unsigned char>(right >> 8) };
+            for (const unsigned char byteValue : bytes)
+            {
+                crc32 ^= byteValue;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc32 = ((crc32 & 1UL) != 0UL) ? (crc32 >> 1) ^ 0xEDB88320UL : (crc32 >> 1);
+                }
+            }
+        }
+
+        result.frameCount = frameCount;
+        result.crc32 = ~crc32;
+        return result;
+    }
+
+    bool ResultsAreEqual(const AccurateRipChecksumResult& firstRef, const AccurateRipChecksumResult& secondRef)
+    {
+        return firstRef.frameCount == secondRef.frameCount &&
+            firstRef.accurateRipV1 == secondRef.accurateRipV1 && firstRef.accurateRipV1FirstTrack == secondRef.accurateRipV1FirstTrack && firstRef.accurateRipV1LastTrack == secondRef.accurateRipV1LastTrack &&
+            firstRef.accurateRipV2 == secondRef.accurateRipV2 && firstRef.accurateRipV2FirstTrack == secondRef.accurateRipV2FirstTrack && firstRef.accurateRipV2LastTrack == secondRef.accurateRipV2LastTrack &&
+            firstRef.crc32 == secondRef.crc32;
+    }
+
+    /// <summary>
+    /// Purpose: Creates a channel of random 16-bit samples, including full scale samples.
+    /// </summary>
+    std::vector<int32_t> CreateRandomChannel(std::mt19937& generatorRef, size_t frameCount)
+    {
+        std::vector<int32_t> samples(frameCount);
+        for (auto& sampleRef : samples)
+        {
+            sampleRef = static_cast<int32_t>(generatorRef() % 65536U) - 32768;
+        }
+
+        samples[0] = -32768;
+        samples[frameCount - 1U] = 32767;
+        return samples;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the AccurateRip v1, AccurateRip v2, and CRC32 checksums, comparing the SIMD kernels with a scalar reference.
+    /// </summary>
+    TEST_CLASS(AccurateRipChecksumUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests the CRC32 of the standard check string "123456789", split so the tail of each part is NOT a whole 16 bytes.
+        /// </summary>
+        TEST_METHOD(testUpdateCrc32CheckValue)
+        {
+            // Arrange
+            const unsigned char checkString[] = "123456789";
+            std::vector<unsigned char> repeated;
+            for (int i = 0; i < 20; ++i)
+            {
+                repeated.insert(repeated.end(), checkString, checkString + 9);
+            }
+
+            uint32_t expected = 0xCBF43926UL;
+
+            // Act
+            uint32_t actual = ~AccurateRipChecksum::UpdateCrc32(0xFFFFFFFFUL, checkString, 9U);
+            uint32_t whole = AccurateRipChecksum::UpdateCrc32(0xFFFFFFFFUL, repeated.data(), repeated.size());
+            uint32_t split = AccurateRipChecksum::UpdateCrc32(AccurateRipChecksum::UpdateCrc32(0xFFFFFFFFUL, repeated.data(), 77U), repeated.data() + 77, repeated.size() - 77U);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+            Assert::AreEqual(whole, split);
+        }
+
+        /// <summary>
+        /// Purpose: Tests the checksums of planar blocks of random sizes (e.g. decoded FLAC Frames) against the scalar reference.
+        /// </summary>
+        TEST_METHOD(testAddPlanar)
+        {
+            // Arrange
+            std::mt19937 generator(38U);
+            const std::vector<int32_t> leftSamples = AccurateRipChecksumUnitTestSupport::CreateRandomChannel(generator, AccurateRipChecksumUnitTestSupport::TRACK_FRAME_COUNT);
+            const std::vector<int32_t> rightSamples = AccurateRipChecksumUnitTestSupport::CreateRandomChannel(generator, AccurateRipChecksumUnitTestSupport::TRACK_FRAME_COUNT);
+            const AccurateRipChecksumResult expectedResult = AccurateRipChecksumUnitTestSupport::ComputeReferenceResult(leftSamples, rightSamples);
+            AccurateRipChecksum checksum;
+            bool expected = true;
+
+            // Act
+            size_t frameIndex = 0U;
+            while (frameIndex < leftSamples.size())
+            {
+                const size_t frameCount = (std::min)(leftSamples.size() - frameIndex, static_cast<size_t>(1U + generator() % AccurateRipChecksumUnitTestSupport::MAXIMUM_BLOCK_FRAME_COUNT));
+                const int32_t* const channelPtrs[] = { leftSamples.data() + frameIndex, rightSamples.data() + frameIndex };
+                checksum.AddPlanar(channelPtrs, static_cast<unsigned long>(frameCount));
+                frameIndex += frameCount;
+            }
+
+            bool actual = AccurateRipChecksumUnitTestSupport::ResultsAreEqual(expectedResult, checksum.GetResult());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests the checksums of interleaved blocks of random sizes (e.g. unpacked WavPack samples) against the scalar reference.
+        /// </summary>
+        TEST_METHOD(testAddInterleaved)
+        {
+            // Arrange
+            std::mt19937 generator(39U);
+            const std::vector<int32_t> leftSamples = AccurateRipChecksumUnitTestSupport::CreateRandomChannel(generator, AccurateRipChecksumUnitTestSupport::TRACK_FRAME_COUNT);
+            const std::vector<int32_t> rightSamples = AccurateRipChecksumUnitTestSupport::CreateRandomChannel(generator, AccurateRipChecksumUnitTestSupport::TRACK_FRAME_COUNT);
+            std::vector<int32_t> interleavedSamples;
+            for (size_t i = 0U; i < leftSamples.size(); ++i)
+            {
+                interleavedSamples.push_back(leftSamples[i]);
+                interleavedSamples.push_back(rightSamples[i]);
+            }
+
+            const AccurateRipChecksumResult expectedResult = AccurateRipChecksumUnitTestSupport::ComputeReferenceResult(leftSamples, rightSamples);
+            AccurateRipChecksum checksum;
+            bool expected = true;
+
+            // Act
+            size_t frameIndex = 0U;
+            while (frameIndex < leftSamples.size())
+            {
+                const size_t frameCount = (std::min)(leftSamples.size() - frameIndex, static_cast<size_t>(1U + generator() % AccurateRipChecksumUnitTestSupport::MAXIMUM_BLOCK_FRAME_COUNT));
+                checksum.AddInterleaved(interleavedSamples.data() + frameIndex * ACCURATERIP_CHANNEL_COUNT, static_cast<unsigned long>(frameCount));
+                frameIndex += frameCount;
+            }
+
+            bool actual = AccurateRipChecksumUnitTestSupport::ResultsAreEqual(expectedResult, checksum.GetResult());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that only 44.1kHz, 16-bit, stereo Streams are supported.
+        /// </summary>
+        TEST_METHOD(testIsSupportedFormat)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            bool actual = AccurateRipChecksum::IsSupportedFormat(44100UL, 2UL, 16UL) && !AccurateRipChecksum::IsSupportedFormat(48000UL, 2UL, 16UL) &&
+                !AccurateRipChecksum::IsSupportedFormat(44100UL, 1UL, 16UL) && !AccurateRipChecksum::IsSupportedFormat(44100UL, 2UL, 24UL);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
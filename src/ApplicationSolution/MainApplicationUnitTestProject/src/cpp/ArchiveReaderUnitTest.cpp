@@ -0,0 +1,302 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "ArchiveReader.h"
+#include "ArchiveReader.cpp"
+#include "ArchiveMemberSource.h"
+#include "ArchiveMemberSource.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ArchiveReaderUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The members of the generated ZIP Archive. The first member is stored with its sizes and offset in the ZIP64 Extra Field.
+    /// The Central Directory also holds a Folder, which is NOT listed.
+    /// </summary>
+    constexpr auto ZIP_FIRST_MEMBER_OFFSET = 0ULL;
+    constexpr auto ZIP_FIRST_MEMBER_SIZE = 5000000000ULL;
+    constexpr auto ZIP_FIRST_MEMBER_CRC32 = 0x12345678UL;
+    constexpr auto ZIP_SECOND_MEMBER_OFFSET = 300ULL;
+    constexpr auto ZIP_SECOND_MEMBER_COMPRESSED_SIZE = 700UL;
+    constexpr auto ZIP_SECOND_MEMBER_UNCOMPRESSED_SIZE = 1000UL;
+    constexpr auto ZIP_MEMBER_DATA_SIZE = 1024UL;
+
+    /// <summary>
+    /// Purpose: The sizes of the generated TAR members.
+    /// </summary>
+    constexpr auto TAR_BLOCK_SIZE = 512UL;
+    constexpr auto TAR_FIRST_MEMBER_SIZE = 1000UL;
+    constexpr auto TAR_MEMBER_SIZE = 16UL;
+
+    void AppendLittleEndian(std::vector<unsigned char>& dataRef, unsigned long long value, unsigned long byteCount)
+    {
+        for (unsigned long i = 0UL; i < byteCount; ++i)
+        {
+            dataRef.push_back(static_cast<unsigned char>(value >> (8UL * i)));
+        }
+    }
+
+    /// <summary>
+    /// Purpose: Appends a Central Directory File Header.
+    /// </summary>
+    void AppendCentralHeader(std::vector<unsigned char>& dataRef, const std::string& nameRef, unsigned long flags, unsigned long method, unsigned long crc32,
+        unsigned long compressedSize, unsigned long uncompressedSize, unsigned long offset, const std::vector<unsigned char>& extraFieldRef)
+    {
+        AppendLittleEndian(dataRef, 0x02014B50ULL, 4UL);
+        AppendLittleEndian(dataRef, 45ULL, 2UL); // Version made by
+        AppendLittleEndian(dataRef, 45ULL, 2UL); // Version needed to extract
+        AppendLittleEndian(dataRef, flags, 2UL);
+        AppendLittleEndian(dataRef, method, 2UL);
+        AppendLittleEndian(dataRef, 0ULL, 4UL); // Last modification time and date
+        AppendLittleEndian(dataRef, crc32, 4UL);
+        AppendLittleEndian(dataRef, compressedSize, 4UL);
+        AppendLittleEndian(dataRef, uncompressedSize, 4UL);
+        AppendLittleEndian(dataRef, nameRef.size(), 2UL);
+        AppendLittleEndian(dataRef, extraFieldRef.size(), 2UL);
+        AppendLittleEndian(dataRef, 0ULL, 2UL); // Comment length
+        AppendLittleEndian(dataRef, 0ULL, 2UL); // Disk number
+        AppendLittleEndian(dataRef, 0ULL, 2UL); // Internal attributes
+        AppendLittleEndian(dataRef, 0ULL, 4UL); // External attributes
+        AppendLittleEndian(dataRef, offset, 4UL);
+        dataRef.insert(dataRef.end(), nameRef.begin(), nameRef.end());
+        dataRef.insert(dataRef.end(), extraFieldRef.begin(), extraFieldRef.end());
+    }
+
+    /// <summary>
+    /// Purpose: Creates a ZIP64 Archive: the member data, the Central Directory, the ZIP64 End Record and its Locator, then an End Record with its fields set to the ZIP64 markers and a comment.
+    /// </summary>
+    std::vector<unsigned char> CreateZip64Archive()
+    {
+        std::vector<unsigned char> archive(ZIP_MEMBER_DATA_SIZE, 0x5AU);
+        const unsigned long long directoryOffset = archive.size();
+
+        std::vector<unsigned char> zip64ExtraField;
+        AppendLittleEndian(zip64ExtraField, 0x0001ULL, 2UL);
+        AppendLittleEndian(zip64ExtraField, 24ULL, 2UL);
+        AppendLittleEndian(zip64ExtraField, ZIP_FIRST_MEMBER_SIZE, 8UL);
+        AppendLittleEndian(zip64ExtraField, ZIP_FIRST_MEMBER_SIZE, 8UL);
+        AppendLittleEndian(zip64ExtraField, ZIP_FIRST_MEMBER_OFFSET, 8UL);
+
+        AppendCentralHeader(archive, "CD1/", 0x0800UL, 0UL, 0UL, 0UL, 0UL, 0UL, {});
+        AppendCentralHeader(archive, "CD1/01 Caf\xC3\xA9.flac", 0x0800UL, 0UL, ZIP_FIRST_MEMBER_CRC32, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, zip64ExtraField);
+        AppendCentralHeader(archive, "CD1/02 Track.mp3", 0x0001UL, 8UL, 0UL, ZIP_SECOND_MEMBER_COMPRESSED_SIZE, ZIP_SECOND_MEMBER_UNCOMPRESSED_SIZE, ZIP_SECOND_MEMBER_OFFSET, {});
+        AppendCentralHeader(archive, "CD1/03 Track.wv", 0x0000UL, 14UL, 0UL, 0UL, 0UL, 0UL, {});
+        const unsigned long long directorySize = archive.size() - directoryOffset;
+
+        const unsigned long long zip64EndRecordOffset = archive.size();
+        AppendLittleEndian(archive, 0x06064B50ULL, 4UL);
+        AppendLittleEndian(archive, 44ULL, 8UL); // The size of the rest of the Record
+        AppendLittleEndian(archive, 45ULL, 2UL);
+        AppendLittleEndian(archive, 45ULL, 2UL);
+        AppendLittleEndian(archive, 0ULL, 4UL);
+        AppendLittleEndian(archive, 0ULL, 4UL);
+        AppendLittleEndian(archive, 4ULL, 8UL); // Entries on this disk
+        AppendLittleEndian(archive, 4ULL, 8UL); // Entries
+        AppendLittleEndian(archive, directorySize, 8UL);
+        AppendLittleEndian(archive, directoryOffset, 8UL);
+
+        AppendLittleEndian(archive, 0x07064B50ULL, 4UL);
+        AppendLittleEndian(archive, 0ULL, 4UL);
+        AppendLittleEndian(archive, zip64EndRecordOffset, 8UL);
+        AppendLittleEndian(archive, 1ULL, 4UL);
+
+        const std::string comment = "PK\x05\x06 is NOT an End Record here";
+        AppendLittleEndian(archive, 0x06054B50ULL, 4UL);
+        AppendLittleEndian(archive, 0ULL, 4UL);
+        AppendLittleEndian(archive, 0xFFFFULL, 2UL);
+        AppendLittleEndian(archive, 0xFFFFULL, 2UL);
+        AppendLittleEndian(archive, 0xFFFFFFFFULL, 4UL);
+        AppendLittleEndian(archive, 0xFFFFFFFFULL, 4UL);
+        AppendLittleEndian(archive, comment.size(), 2UL);
+        archive.insert(archive.end(), comment.begin(), comment.end());
+        return archive;
+    }
+
+    /// <summary>
+    /// Purpose: Appends a TAR header Block, with an optional ustar prefix field, then the member data padded to a whole Block.
+    /// </summary>
+    void AppendTarMember(std::vector<unsigned char>& archiveRef, const std::string& nameRef, const std::string& prefixRef, char typeFlag, const std::string& dataRef)
+    {
+        unsigned char header[TAR_BLOCK_SIZE]{};
+        memcpy(header, nameRef.c_str(), nameRef.size());
+        memcpy(header + 100, "0000644", 7);
+        snprintf(reinterpret_cast<char*>(header + 124), 12, "%011lo", static_cast<unsigned long>(dataRef.size()));
+        header[156] = static_cast<unsigned char>(typeFlag);
+        memcpy(header + 257, "ustar\0" "00", 8);
+        memcpy(header + 345, prefixRef.c_str(), prefixRef.size());
+
+        unsigned long checksum = 8UL * ' ';
+        for (const unsigned char byteValue : header)
+        {
+            checksum += byteValue;
+        }
+
+        snprintf(reinterpret_cast<char*>(header + 148), 8, "%06lo", checksum);
+        header[155] = ' ';
+
+        archiveRef.insert(archiveRef.end(), header, header + TAR_BLOCK_SIZE);
+        archiveRef.insert(archiveRef.end(), dataRef.begin(), dataRef.end());
+        archiveRef.insert(archiveRef.end(), (TAR_BLOCK_SIZE - dataRef.size() % TAR_BLOCK_SIZE) % TAR_BLOCK_SIZE, 0U);
+    }
+
+    /// <summary>
+    /// Purpose: Creates a TAR Archive holding a "./" member, a ustar prefix, a Folder, a GNU long name, and a pax path, then the two zero-filled end Blocks.
+    /// </summary>
+    std::vector<unsigned char> CreateTarArchive()
+    {
+        const std::string longName = "Artist/Album (Remastered Deluxe Edition, Disc 1 of 2)/01 A Track Title That Needs A GNU Long Name Header.flac";
+        const std::string paxPath = "Artist/Caf\xC3\xA9/03 Track.flac";
+        const std::string paxRecord = "path=" + paxPath + "\n";
+        const std::string paxHeader = std::to_string(paxRecord.size() + 3U) + " " + paxRecord;
+
+        std::vector<unsigned char> archive;
+        AppendTarMember(archive, "./00 Intro.flac", "", '0', std::string(TAR_FIRST_MEMBER_SIZE, 'a'));
+        AppendTarMember(archive, "Album/", "Artist", '5', "");
+        AppendTarMember(archive, "Album/02 Track.flac", "Artist", '0', std::string(TAR_MEMBER_SIZE, 'b'));
+        AppendTarMember(archive, "././@LongLink", "", 'L', longName + std::string(1, '\0'));
+        AppendTarMember(archive, "Artist/Album (Remastered Deluxe Edition, Disc 1 of 2)/01 A Track", "", '0', std::string(TAR_MEMBER_SIZE, 'c'));
+        AppendTarMember(archive, "PaxHeaders/03 Track.flac", "", 'x', paxHeader);
+        AppendTarMember(archive, "Artist/Cafe/03 Track.flac", "", '0', std::string(TAR_MEMBER_SIZE, 'd'));
+        archive.insert(archive.end(), 2U * TAR_BLOCK_SIZE, 0U);
+        return archive;
+    }
+
+    bool MemberEquals(const ArchiveMember& memberRef, const wchar_t* namePtr, unsigned long long offset, unsigned long long compressedSize, unsigned long long uncompressedSize)
+    {
+        return memberRef.name == namePtr && memberRef.offset == offset && memberRef.compressedSize == compressedSize && memberRef.uncompressedSize == uncompressedSize;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the Archive Reader.
+    /// </summary>
+    TEST_CLASS(ArchiveReaderUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests listing a ZIP64 Archive, whose End Record is followed by a comment. The Folder is NOT listed, a UTF-8 name is converted,
+        /// the ZIP64 Extra Field replaces the 32-bit sizes and offset, and the compression method and encryption flag are reported.
+        /// </summary>
+        TEST_METHOD(testListZip64Members)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(ArchiveReaderUnitTestSupport::CreateZip64Archive(), L".zip");
+            std::vector<ArchiveMember> members;
+            bool expected = true;
+
+            // Act
+            bool actual = ArchiveReader::ListMembers(filename.c_str(), members) && members.size() == 3U &&
+                ArchiveReaderUnitTestSupport::MemberEquals(members[0], L"CD1/01 Caf\u00E9.flac", ArchiveReaderUnitTestSupport::ZIP_FIRST_MEMBER_OFFSET,
+                    ArchiveReaderUnitTestSupport::ZIP_FIRST_MEMBER_SIZE, ArchiveReaderUnitTestSupport::ZIP_FIRST_MEMBER_SIZE) &&
+                members[0].crc32 == ArchiveReaderUnitTestSupport::ZIP_FIRST_MEMBER_CRC32 && members[0].hasLocalHeader && !members[0].isEncrypted &&
+                members[0].compressionMethod == ArchiveCompressionMethod::STORED &&
+                ArchiveReaderUnitTestSupport::MemberEquals(members[1], L"CD1/02 Track.mp3", ArchiveReaderUnitTestSupport::ZIP_SECOND_MEMBER_OFFSET,
+                    ArchiveReaderUnitTestSupport::ZIP_SECOND_MEMBER_COMPRESSED_SIZE, ArchiveReaderUnitTestSupport::ZIP_SECOND_MEMBER_UNCOMPRESSED_SIZE) &&
+                members[1].isEncrypted && members[1].compressionMethod == ArchiveCompressionMethod::DEFLATED &&
+                members[2].name == L"CD1/03 Track.wv" && members[2].compressionMethod == ArchiveCompressionMethod::UNSUPPORTED;
+            DeleteFileW(filename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests listing a TAR Archive. The "./" is removed, the ustar prefix is joined to the name, the Folder is NOT listed,
+        /// and a GNU long name and a pax path replace the name of the member that follows them.
+        /// </summary>
+        TEST_METHOD(testListTarMembers)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(ArchiveReaderUnitTestSupport::CreateTarArchive(), L".tar");
+            const unsigned long long blockSize = ArchiveReaderUnitTestSupport::TAR_BLOCK_SIZE;
+            const unsigned long long memberSize = ArchiveReaderUnitTestSupport::TAR_MEMBER_SIZE;
+            std::vector<ArchiveMember> members;
+            bool expected = true;
+
+            // Act
+            bool actual = ArchiveReader::ListMembers(filename.c_str(), members) && members.size() == 4U &&
+                ArchiveReaderUnitTestSupport::MemberEquals(members[0], L"00 Intro.flac", blockSize, ArchiveReaderUnitTestSupport::TAR_FIRST_MEMBER_SIZE, ArchiveReaderUnitTestSupport::TAR_FIRST_MEMBER_SIZE) &&
+                ArchiveReaderUnitTestSupport::MemberEquals(members[1], L"Artist/Album/02 Track.flac", 5ULL * blockSize, memberSize, memberSize) &&
+                ArchiveReaderUnitTestSupport::MemberEquals(members[2], L"Artist/Album (Remastered Deluxe Edition, Disc 1 of 2)/01 A Track Title That Needs A GNU Long Name Header.flac", 9ULL * blockSize, memberSize, memberSize) &&
+                ArchiveReaderUnitTestSupport::MemberEquals(members[3], L"Artist/Caf\u00E9/03 Track.flac", 13ULL * blockSize, memberSize, memberSize) &&
+                !members[0].hasLocalHeader;
+            DeleteFileW(filename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests finding a member by its name, which is case sensitive.
+        /// </summary>
+        TEST_METHOD(testFindMember)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(ArchiveReaderUnitTestSupport::CreateZip64Archive(), L".zip");
+            ArchiveMember member{};
+            ArchiveMember missingMember{};
+            bool expected = true;
+
+            // Act
+            bool actual = ArchiveReader::FindMember(filename.c_str(), L"CD1/02 Track.mp3", member) && member.offset == ArchiveReaderUnitTestSupport::ZIP_SECOND_MEMBER_OFFSET &&
+                !ArchiveReader::FindMember(filename.c_str(), L"cd1/02 track.mp3", missingMember) && !ArchiveReader::FindMember(filename.c_str(), L"CD1/", missingMember);
+            DeleteFileW(filename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a File which is NOT an Archive is NOT listed.
+        /// </summary>
+        TEST_METHOD(testListInvalidArchive)
+        {
+            // Arrange
+            const std::vector<unsigned char> data(4096U, 0x5AU);
+            const std::wstring tarFilename = UnitTestFixture::CreateTemporaryFile(data, L".tar");
+            const std::wstring zipFilename = UnitTestFixture::CreateTemporaryFile(data, L".zip");
+            std::vector<ArchiveMember> members;
+            bool expected = false;
+
+            // Act
+            bool actual = ArchiveReader::ListMembers(tarFilename.c_str(), members) || ArchiveReader::ListMembers(zipFilename.c_str(), members);
+            DeleteFileW(tarFilename.c_str());
+            DeleteFileW(zipFilename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests splitting a member path at the separator that follows the Archive File Extension, and NOT at a separator within a Folder name.
+        /// </summary>
+        TEST_METHOD(testSplitMemberPath)
+        {
+            // Arrange
+            std::wstring archiveFilename;
+            std::wstring memberName;
+            std::wstring unusedArchiveFilename;
+            std::wstring unusedMemberName;
+            bool expected = true;
+
+            // Act
+            bool actual = ArchiveReader::SplitMemberPath(L"D:\\Music!\\Album.ZIP!CD1/01 Track.flac", archiveFilename, memberName) &&
+                archiveFilename == L"D:\\Music!\\Album.ZIP" && memberName == L"CD1/01 Track.flac" &&
+                !ArchiveReader::SplitMemberPath(L"D:\\Music!\\01 Track.flac", unusedArchiveFilename, unusedMemberName) &&
+                !ArchiveReader::SplitMemberPath(L"D:\\Music\\Album.tar!", unusedArchiveFilename, unusedMemberName) &&
+                ArchiveReader::IsArchiveType(L"Album.Tar") && !ArchiveReader::IsArchiveType(L"Album.7z");
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
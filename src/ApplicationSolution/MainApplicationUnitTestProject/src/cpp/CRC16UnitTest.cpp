@@ -0,0 +1,89 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <vector>
+#include "CRC16.h"
+#include "CRC16.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace CRC16UnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The standard check string, repeated so the slice-by-8 loops run for more than a few iterations.
+    /// </summary>
+    const unsigned char CHECK_STRING[] = "123456789";
+    constexpr auto CHECK_STRING_LENGTH = 9U;
+    constexpr auto REPEAT_COUNT = 20;
+
+    /// <summary>
+    /// Purpose: The length of the first part of the split data. It is NOT a multiple of 8 bytes.
+    /// </summary>
+    constexpr auto SPLIT_LENGTH = 77U;
+
+    std::vector<unsigned char> CreateRepeatedCheckString()
+    {
+        std::vector<unsigned char> repeated;
+        for (int i = 0; i < REPEAT_COUNT; ++i)
+        {
+            repeated.insert(repeated.end(), CHECK_STRING, CHECK_STRING + CHECK_STRING_LENGTH);
+        }
+
+        return repeated;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the CRC-16 calculations shared by the FLAC and MP3 Decoders.
+    /// </summary>
+    TEST_CLASS(CRC16UnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests the CRC-16 (most significant bit first) of the check string, with the Initial values used by FLAC (CRC-16/UMTS) and MPEG Audio (CRC-16/CMS),
+        /// and that the CRC of data split at a position that is NOT a whole 8 bytes matches the CRC of the whole data.
+        /// </summary>
+        TEST_METHOD(testUpdateCheckValue)
+        {
+            // Arrange
+            const std::vector<unsigned char> repeated = CRC16UnitTestSupport::CreateRepeatedCheckString();
+            unsigned long expectedFlac = 0xFEE8UL;
+            unsigned long expectedMpeg = 0xAEE7UL;
+
+            // Act
+            unsigned long actualFlac = CRC16::Update(0, CRC16UnitTestSupport::CHECK_STRING, CRC16UnitTestSupport::CHECK_STRING_LENGTH);
+            unsigned long actualMpeg = CRC16::Update(0xFFFF, CRC16UnitTestSupport::CHECK_STRING, CRC16UnitTestSupport::CHECK_STRING_LENGTH);
+            unsigned long whole = CRC16::Update(0xFFFF, repeated.data(), repeated.size());
+            unsigned long split = CRC16::Update(CRC16::Update(0xFFFF, repeated.data(), CRC16UnitTestSupport::SPLIT_LENGTH), repeated.data() + CRC16UnitTestSupport::SPLIT_LENGTH,
+                repeated.size() - CRC16UnitTestSupport::SPLIT_LENGTH);
+
+            // Assert
+            Assert::AreEqual(expectedFlac, actualFlac);
+            Assert::AreEqual(expectedMpeg, actualMpeg);
+            Assert::AreEqual(whole, split);
+        }
+
+        /// <summary>
+        /// Purpose: Tests the CRC-16 (least significant bit first) of the check string, as used by the LAME Tag (CRC-16/ARC),
+        /// and that the CRC of data split at a position that is NOT a whole 8 bytes matches the CRC of the whole data.
+        /// </summary>
+        TEST_METHOD(testUpdateReflectedCheckValue)
+        {
+            // Arrange
+            const std::vector<unsigned char> repeated = CRC16UnitTestSupport::CreateRepeatedCheckString();
+            unsigned long expected = 0xBB3DUL;
+
+            // Act
+            unsigned long actual = CRC16::UpdateReflected(0, CRC16UnitTestSupport::CHECK_STRING, CRC16UnitTestSupport::CHECK_STRING_LENGTH);
+            unsigned long whole = CRC16::UpdateReflected(0, repeated.data(), repeated.size());
+            unsigned long split = CRC16::UpdateReflected(CRC16::UpdateReflected(0, repeated.data(), CRC16UnitTestSupport::SPLIT_LENGTH), repeated.data() + CRC16UnitTestSupport::SPLIT_LENGTH,
+                repeated.size() - CRC16UnitTestSupport::SPLIT_LENGTH);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+            Assert::AreEqual(whole, split);
+        }
+    };
+}
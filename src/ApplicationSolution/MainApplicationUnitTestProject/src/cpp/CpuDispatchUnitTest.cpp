@@ -0,0 +1,113 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <string>
+#include "CpuDispatch.h"
+#include "CpuDispatch.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace CpuDispatchUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: An override of the instruction set level, and the features left when every feature is detected.
+    /// </summary>
+    struct LevelCase
+    {
+        const char* levelNamePtr;
+        bool isLimited;
+        CpuFeatures features;
+    };
+
+    /// <summary>
+    /// Purpose: Every level (in any case), and the names that must be ignored.
+    /// </summary>
+    const LevelCase LEVEL_CASES[] =
+    {
+        { "SCALAR", true, { false, false, false, false, false, false } },
+        { "sse2", true, { true, false, false, false, false, false } },
+        { "Sse4.2", true, { true, true, true, true, false, false } },
+        { "AVX2", true, { true, true, true, true, true, false } },
+        { "avx512", true, { true, true, true, true, true, true } },
+        { "AVX-512", false, { true, true, true, true, true, true } },
+        { "SSE4", false, { true, true, true, true, true, true } },
+        { "", false, { true, true, true, true, true, true } }
+    };
+
+    /// <summary>
+    /// Purpose: Compares every feature.
+    /// </summary>
+    bool AreEqual(const CpuFeatures& firstRef, const CpuFeatures& secondRef)
+    {
+        return firstRef.sse2 == secondRef.sse2 && firstRef.sse42 == secondRef.sse42 && firstRef.pclmul == secondRef.pclmul
+            && firstRef.sha == secondRef.sha && firstRef.avx2 == secondRef.avx2 && firstRef.avx512f == secondRef.avx512f;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the runtime CPU feature dispatch.
+    /// </summary>
+    TEST_CLASS(CpuDispatchUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests that an override limits the features to its level and the levels below it, and that an unknown override is ignored.
+        /// </summary>
+        TEST_METHOD(testLimitFeatures)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            bool actual = true;
+            for (const CpuDispatchUnitTestSupport::LevelCase& levelCase : CpuDispatchUnitTestSupport::LEVEL_CASES)
+            {
+                CpuDispatchSupport::DispatchState state{};
+                state.features = { true, true, true, true, true, true };
+                const bool isLimited = CpuDispatchSupport::LimitFeatures(levelCase.levelNamePtr, state);
+                actual = actual && (isLimited == levelCase.isLimited) && ((state.limitLevelNamePtr != nullptr) == levelCase.isLimited)
+                    && CpuDispatchUnitTestSupport::AreEqual(state.features, levelCase.features);
+            }
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that an override never adds a feature the CPU does NOT have.
+        /// </summary>
+        TEST_METHOD(testLimitFeaturesWithoutDetectedFeatures)
+        {
+            // Arrange
+            const CpuFeatures scalarFeatures{};
+            bool expected = true;
+
+            // Act
+            CpuDispatchSupport::DispatchState state{};
+            bool actual = CpuDispatchSupport::LimitFeatures("AVX512", state) && CpuDispatchUnitTestSupport::AreEqual(state.features, scalarFeatures);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a recorded kernel variant is listed in the report, after the CPU features.
+        /// </summary>
+        TEST_METHOD(testRecordVariant)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            CpuDispatch::RecordVariant("Unit Test", "SCALAR");
+            const std::wstring report = CpuDispatch::GetReport();
+            const size_t variantOffset = report.find(L"Unit Test: SCALAR");
+            bool actual = (variantOffset != std::wstring::npos) && (report.find(L"| ") < variantOffset);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
@@ -0,0 +1,154 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <string>
+#include "DecoderErrorLog.h"
+#include "DecoderErrorLog.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace DecoderErrorLogUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The size of the rendering buffer, in characters.
+    /// </summary>
+    constexpr auto RENDER_BUFFER_SIZE = 128U;
+
+    std::wstring Render(DecoderErrorCode code, unsigned long timeBase, unsigned long long position, long long detail)
+    {
+        DecoderErrorRecord record{};
+        record.code = code;
+        record.timeBase = timeBase;
+        record.position = position;
+        record.detail = detail;
+
+        wchar_t buffer[RENDER_BUFFER_SIZE]{};
+        DecoderErrorLog::Render(record, buffer, RENDER_BUFFER_SIZE);
+        return buffer;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the Decoder Error Log, and the text rendered in the Final Report.
+    /// </summary>
+    TEST_CLASS(DecoderErrorLogUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests rendering an error with a time (65 seconds at 44.1kHz).
+        /// </summary>
+        TEST_METHOD(testRenderTimedError)
+        {
+            // Arrange
+            std::wstring expected = L"LOST_SYNC @ 1m 05s";
+
+            // Act
+            std::wstring actual = DecoderErrorLogUnitTestSupport::Render(DecoderErrorCode::LOST_SYNC, 44100UL, 65ULL * 44100ULL + 1234ULL, 0LL);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests rendering a count based error with a time, which uses the singular name.
+        /// </summary>
+        TEST_METHOD(testRenderTimedCountError)
+        {
+            // Arrange
+            std::wstring expected = L"BAD_BLOCK @ 12m 00s";
+
+            // Act
+            std::wstring actual = DecoderErrorLogUnitTestSupport::Render(DecoderErrorCode::BAD_BLOCKS, 48000UL, 720ULL * 48000ULL, 3LL);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests rendering the plural and singular forms of a count based error.
+        /// </summary>
+        TEST_METHOD(testRenderCountError)
+        {
+            // Arrange
+            std::wstring expectedPlural = L"12 MISSING_SAMPLES";
+            std::wstring expectedSingular = L"1 EXTRA_SAMPLE";
+
+            // Act
+            std::wstring actualPlural = DecoderErrorLogUnitTestSupport::Render(DecoderErrorCode::MISSING_SAMPLES, 0UL, 0ULL, 12LL);
+            std::wstring actualSingular = DecoderErrorLogUnitTestSupport::Render(DecoderErrorCode::EXTRA_SAMPLES, 0UL, 0ULL, 1LL);
+
+            // Assert
+            Assert::AreEqual(expectedPlural, actualPlural);
+            Assert::AreEqual(expectedSingular, actualSingular);
+        }
+
+        /// <summary>
+        /// Purpose: Tests rendering the combined lost sync and ID3v1 Tag error, an error without a time or count, and NO error.
+        /// </summary>
+        TEST_METHOD(testRenderSpecialErrors)
+        {
+            // Arrange
+            std::wstring expectedCombined = L"<LOST_SYNC @ 3m 20s> <ID3v1_TAG_FOUND>";
+            std::wstring expectedPlain = L"MD5_MISMATCH";
+            std::wstring expectedNone = L"";
+
+            // Act
+            std::wstring actualCombined = DecoderErrorLogUnitTestSupport::Render(DecoderErrorCode::LOST_SYNC_ID3v1_TAG_FOUND, 44100UL, 200ULL * 44100ULL, 0LL);
+            std::wstring actualPlain = DecoderErrorLogUnitTestSupport::Render(DecoderErrorCode::MD5_MISMATCH, 0UL, 0ULL, 0LL);
+            std::wstring actualNone = DecoderErrorLogUnitTestSupport::Render(DecoderErrorCode::NONE, 44100UL, 1ULL, 0LL);
+
+            // Assert
+            Assert::AreEqual(expectedCombined, actualCombined);
+            Assert::AreEqual(expectedPlain, actualPlain);
+            Assert::AreEqual(expectedNone, actualNone);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a full Log keeps the first Records, and overwrites its last Record, so the latest error is always kept.
+        /// </summary>
+        TEST_METHOD(testLogOverwritesLastRecord)
+        {
+            // Arrange
+            DecoderErrorLog errorLog;
+            bool expected = true;
+
+            // Act
+            bool actual = (errorLog.GetLast().code == DecoderErrorCode::NONE) && (errorLog.GetCount() == 0U);
+            for (unsigned long i = 0UL; i < MAX_DECODER_ERROR_RECORD_COUNT + 3UL; ++i)
+            {
+                DecoderErrorRecord record{};
+                record.code = DecoderErrorCode::LOST_SYNC;
+                record.detail = static_cast<long long>(i);
+                errorLog.Add(record);
+            }
+
+            DecoderErrorRecord lastRecord{};
+            lastRecord.code = DecoderErrorCode::MD5_MISMATCH;
+            errorLog.Add(lastRecord);
+
+            actual = actual && (errorLog.GetCount() == MAX_DECODER_ERROR_RECORD_COUNT) && (errorLog.GetRecord(0U).detail == 0LL) &&
+                (errorLog.GetRecord(MAX_DECODER_ERROR_RECORD_COUNT - 2U).detail == static_cast<long long>(MAX_DECODER_ERROR_RECORD_COUNT - 2UL)) &&
+                (errorLog.GetLast().code == DecoderErrorCode::MD5_MISMATCH);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests the name of an Error Code, used to group the errors by type.
+        /// </summary>
+        TEST_METHOD(testGetCodeName)
+        {
+            // Arrange
+            std::wstring expected = L"FRAME_CRC_MISMATCH";
+
+            // Act
+            std::wstring actual = DecoderErrorLog::GetCodeName(DecoderErrorCode::FRAME_CRC_MISMATCH);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
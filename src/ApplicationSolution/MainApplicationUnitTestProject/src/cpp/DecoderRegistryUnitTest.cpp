@@ -0,0 +1,165 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <string>
+#include <vector>
+#include "DecoderRegistry.h"
+#include "DecoderRegistry.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace DecoderRegistryUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: A filename, and the Decoder expected for it.
+    /// </summary>
+    struct ExtensionCase
+    {
+        const wchar_t* filenamePtr;
+        DecoderType type;
+    };
+
+    /// <summary>
+    /// Purpose: Every registered File Extension (in any case), and the filenames that must NOT be found.
+    /// </summary>
+    const ExtensionCase EXTENSION_CASES[] =
+    {
+        { L"C:\\Music\\track.flac", DecoderType::FLAC },
+        { L"C:\\Music\\track.FLA", DecoderType::FLAC },
+        { L"C:\\Music\\track.Mp3", DecoderType::MP3 },
+        { L"C:\\Music\\track.mp2", DecoderType::MP3 },
+        { L"C:\\Music\\track.m2a", DecoderType::MP3 },
+        { L"C:\\Music\\track.wv", DecoderType::WAV_PACK },
+        { L"C:\\Music\\track.OGG", DecoderType::OGG_VORBIS },
+        { L"https://example.com/music/track.flac?X-Amz-Signature=0a1b.mp3", DecoderType::FLAC },
+        { L"C:\\Music\\track.wav", DecoderType::UNSUPPORTED },
+        { L"C:\\Music\\track.flacc", DecoderType::UNSUPPORTED },
+        { L"C:\\Music\\track.", DecoderType::UNSUPPORTED },
+        { L"C:\\Music\\track", DecoderType::UNSUPPORTED },
+        { L"C:\\Music\\Album.flac\\track", DecoderType::UNSUPPORTED },
+        { L"C:/Music/Album.ogg/track", DecoderType::UNSUPPORTED },
+        { L"https://example.com/music/track", DecoderType::UNSUPPORTED },
+        { L"", DecoderType::UNSUPPORTED }
+    };
+
+    /// <summary>
+    /// Purpose: The leading bytes of a File, and the Decoder expected for it.
+    /// </summary>
+    struct ContentCase
+    {
+        std::vector<unsigned char> content;
+        DecoderType type;
+    };
+
+    /// <summary>
+    /// Purpose: An ID3v2 Tag Header of a Tag holding 20 bytes (a 'syncsafe' size), followed by the 20 bytes.
+    /// </summary>
+    std::vector<unsigned char> CreateId3v2Tag()
+    {
+        std::vector<unsigned char> tag = { 'I', 'D', '3', 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x14U };
+        tag.insert(tag.end(), 20U, 0x00U);
+        return tag;
+    }
+
+    /// <summary>
+    /// Purpose: Appends bytes to the end of other bytes.
+    /// </summary>
+    std::vector<unsigned char> Concatenate(std::vector<unsigned char> firstBytes, const std::vector<unsigned char>& secondBytes)
+    {
+        firstBytes.insert(firstBytes.end(), secondBytes.begin(), secondBytes.end());
+        return firstBytes;
+    }
+
+    /// <summary>
+    /// Purpose: Every recognized magic byte sequence, and content that must NOT be recognized. The content is padded to more than the sniffed size.
+    /// </summary>
+    std::vector<ContentCase> CreateContentCases()
+    {
+        const std::vector<unsigned char> padding(32U, 0x00U);
+        const std::vector<unsigned char> flacStream = Concatenate({ 'f', 'L', 'a', 'C' }, padding);
+        const std::vector<unsigned char> mpegFrame = Concatenate({ 0xFFU, 0xFBU, 0x90U, 0x00U }, padding);
+
+        return
+        {
+            { flacStream, DecoderType::FLAC },
+            { Concatenate({ 'O', 'g', 'g', 'S' }, padding), DecoderType::OGG_VORBIS },
+            { Concatenate({ 'w', 'v', 'p', 'k' }, padding), DecoderType::WAV_PACK },
+            { mpegFrame, DecoderType::MP3 },
+            { Concatenate(CreateId3v2Tag(), mpegFrame), DecoderType::MP3 },
+            { Concatenate(CreateId3v2Tag(), flacStream), DecoderType::FLAC },
+            { Concatenate({ 0xFFU, 0xEBU, 0x90U, 0x00U }, padding), DecoderType::UNSUPPORTED }, // A reserved MPEG Version.
+            { Concatenate({ 'R', 'I', 'F', 'F' }, padding), DecoderType::UNSUPPORTED },
+            { {}, DecoderType::UNSUPPORTED }
+        };
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for finding the Decoder of a File, by its File Extension (the Perfect Hash Table) and by its content.
+    /// </summary>
+    TEST_CLASS(DecoderRegistryUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests that every registered File Extension is found in the Perfect Hash Table, and that a '.' before the last path separator is NOT taken as the File Extension.
+        /// </summary>
+        TEST_METHOD(testFindByExtension)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            bool actual = true;
+            for (const DecoderRegistryUnitTestSupport::ExtensionCase& extensionCase : DecoderRegistryUnitTestSupport::EXTENSION_CASES)
+            {
+                actual = actual && (DecoderRegistry::FindByExtension(extensionCase.filenamePtr) == extensionCase.type);
+            }
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that every Decoder is found from the magic bytes at the start of a File, whatever its File Extension, including a FLAC Stream after an ID3v2 Tag.
+        /// </summary>
+        TEST_METHOD(testFindByContent)
+        {
+            // Arrange
+            const std::vector<DecoderRegistryUnitTestSupport::ContentCase> contentCases = DecoderRegistryUnitTestSupport::CreateContentCases();
+            bool expected = true;
+
+            // Act
+            bool actual = true;
+            for (const DecoderRegistryUnitTestSupport::ContentCase& contentCase : contentCases)
+            {
+                const std::wstring filename = UnitTestFixture::CreateTemporaryFile(contentCase.content, L".bin");
+                actual = actual && (DecoderRegistry::FindByContent(filename.c_str()) == contentCase.type);
+                DeleteFileW(filename.c_str());
+            }
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a File that can NOT be opened is NOT recognized.
+        /// </summary>
+        TEST_METHOD(testFindByContentMissingFile)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(std::vector<unsigned char>{ 'f', 'L', 'a', 'C' }, L".flac");
+            DeleteFileW(filename.c_str());
+            bool expected = true;
+
+            // Act
+            bool actual = (DecoderRegistry::FindByContent(filename.c_str()) == DecoderType::UNSUPPORTED);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
@@ -0,0 +1,152 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <string>
+#include <vector>
+#include "DecoderTuning.h"
+#include "DecoderTuning.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace DecoderTuningUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: Every tunable parameter, in the order they are swept.
+    /// </summary>
+    const DecoderTuningParameter PARAMETERS[] =
+    {
+        DecoderTuningParameter::STREAM_READ_BLOCK_SIZE,
+        DecoderTuningParameter::OGG_VORBIS_READ_CHUNK_SIZE,
+        DecoderTuningParameter::WAVPACK_UNPACK_SAMPLE_COUNT
+    };
+
+    /// <summary>
+    /// Purpose: A profile File edited by hand. Only the Ogg-Vorbis read chunk size is valid: a comment, an unknown name, 
+    /// a name that only starts with a parameter name, a value outside the swept range, and a line without a value are ignored.
+    /// </summary>
+    constexpr auto EDITED_PROFILE =
+        "# STREAM_READ_BLOCK_SIZE=131072\n"
+        "READ_BLOCK_SIZE=131072\n"
+        "STREAM_READ_BLOCK_SIZE_2=131072\n"
+        "WAVPACK_UNPACK_SAMPLE_COUNT=131072\n"
+        "WAVPACK_UNPACK_SAMPLE_COUNT\n"
+        "OGG_VORBIS_READ_CHUNK_SIZE=1024\n";
+    constexpr auto EDITED_OGG_VORBIS_READ_CHUNK_SIZE = 1024UL;
+
+    /// <summary>
+    /// Purpose: Compares every parameter.
+    /// </summary>
+    bool AreEqual(const DecoderTuningProfile& firstRef, const DecoderTuningProfile& secondRef)
+    {
+        bool areEqual = true;
+        for (const DecoderTuningParameter parameter : PARAMETERS)
+        {
+            areEqual = areEqual && (DecoderTuning::GetValue(firstRef, parameter) == DecoderTuning::GetValue(secondRef, parameter));
+        }
+
+        return areEqual;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the Decoder tuning profile.
+    /// </summary>
+    TEST_CLASS(DecoderTuningUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests that setting a parameter changes only that parameter of the profile.
+        /// </summary>
+        TEST_METHOD(testSetValue)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            bool actual = true;
+            for (const DecoderTuningParameter parameter : DecoderTuningUnitTestSupport::PARAMETERS)
+            {
+                const DecoderTuningProfile defaultProfile{};
+                DecoderTuningProfile profile{};
+                const unsigned long value = DecoderTuning::GetCandidateValues(parameter).back();
+                DecoderTuning::SetValue(profile, parameter, value);
+
+                for (const DecoderTuningParameter otherParameter : DecoderTuningUnitTestSupport::PARAMETERS)
+                {
+                    const unsigned long expectedValue = (otherParameter == parameter) ? value : DecoderTuning::GetValue(defaultProfile, otherParameter);
+                    actual = actual && (DecoderTuning::GetValue(profile, otherParameter) == expectedValue);
+                }
+            }
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a saved profile is loaded with the same values.
+        /// </summary>
+        TEST_METHOD(testSaveLoadProfile)
+        {
+            // Arrange
+            DecoderTuningProfile savedProfile{};
+            for (const DecoderTuningParameter parameter : DecoderTuningUnitTestSupport::PARAMETERS)
+            {
+                DecoderTuning::SetValue(savedProfile, parameter, DecoderTuning::GetCandidateValues(parameter).front());
+            }
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(std::vector<unsigned char>{}, L".profile");
+            DecoderTuningProfile loadedProfile{};
+            bool expected = true;
+
+            // Act
+            bool actual = DecoderTuning::SaveProfile(filename.c_str(), savedProfile) && DecoderTuning::LoadProfile(filename.c_str(), loadedProfile);
+            actual = actual && DecoderTuningUnitTestSupport::AreEqual(loadedProfile, savedProfile) && !DecoderTuningUnitTestSupport::AreEqual(loadedProfile, DecoderTuningProfile{});
+            DeleteFileW(filename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that the invalid lines of a profile File keep the values already in the profile.
+        /// </summary>
+        TEST_METHOD(testLoadEditedProfile)
+        {
+            // Arrange
+            const std::string content = DecoderTuningUnitTestSupport::EDITED_PROFILE;
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(std::vector<unsigned char>(content.begin(), content.end()), L".profile");
+            DecoderTuningProfile expectedProfile{};
+            expectedProfile.oggVorbisReadChunkSize = DecoderTuningUnitTestSupport::EDITED_OGG_VORBIS_READ_CHUNK_SIZE;
+            DecoderTuningProfile loadedProfile{};
+            bool expected = true;
+
+            // Act
+            bool actual = DecoderTuning::LoadProfile(filename.c_str(), loadedProfile) && DecoderTuningUnitTestSupport::AreEqual(loadedProfile, expectedProfile);
+            DeleteFileW(filename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a missing profile File is reported, and keeps the values already in the profile.
+        /// </summary>
+        TEST_METHOD(testLoadMissingProfile)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(std::vector<unsigned char>{}, L".profile");
+            DeleteFileW(filename.c_str());
+            DecoderTuningProfile loadedProfile{};
+            bool expected = true;
+
+            // Act
+            bool actual = !DecoderTuning::LoadProfile(filename.c_str(), loadedProfile) && DecoderTuningUnitTestSupport::AreEqual(loadedProfile, DecoderTuningProfile{});
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
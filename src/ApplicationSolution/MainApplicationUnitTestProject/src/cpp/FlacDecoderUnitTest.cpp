@@ -4,13 +4,257 @@
 #include "AbstractBaseDecoder.cpp"
 #include "FlacDecoder.h"
 #include "FlacDecoder.cpp"
-#include "StreamWrapper.h"
-#include "StreamWrapper.cpp"
+#include "UnitTestFixture.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 constexpr auto TEST_FILE_PATH = L"C:\\git\\repos\\WinAudioDecodeR\\src\\ApplicationSolution\\MainApplicationUnitTestProject\\unit-test-data\\flac\\flac-test-files\\subset\\01 - blocksize 4096.flac";
 
+namespace FlacDecoderUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The format of the generated FLAC fixtures. The interleaved samples span several Pipeline Blocks.
+    /// </summary>
+    constexpr auto FIXTURE_SAMPLE_RATE = 44100ULL;
+    constexpr auto FIXTURE_CHANNEL_COUNT = 2UL;
+    constexpr auto FIXTURE_BLOCK_SIZE = 4096UL;
+    constexpr auto FIXTURE_TOTAL_SAMPLE_COUNT = 100000ULL;
+
+    /// <summary>
+    /// Purpose: The sample (per channel) whose value is changed in a corrupted fixture. The Frame CRCs are computed after the change, so only the MD5 signature detects it.
+    /// </summary>
+    constexpr auto FIXTURE_CORRUPTED_SAMPLE_NUMBER = 54321ULL;
+
+    /// <summary>
+    /// Purpose: The number of Frames decoded before a cancelled decode stops.
+    /// </summary>
+    constexpr auto CANCELLED_DECODE_FRAME_COUNT = 12;
+
+    /// <summary>
+    /// Purpose: The paths that compute the MD5 signature of the decoded samples.
+    /// </summary>
+    enum class MD5Path : unsigned char
+    {
+        INLINE = 0, // md5.c, on the Decoder Thread.
+        SERVICE, // The shared Multi-Buffer MD5 service.
+        PIPELINE // md5.c, on the Pipeline Thread.
+    };
+
+    /// <summary>
+    /// Purpose: Computes the CRC-8 of a Frame Header (polynomial x^8 + x^2 + x^1 + x^0).
+    /// </summary>
+    unsigned char ComputeCrc8(const unsigned char* dataPtr, size_t size)
+    {
+        unsigned int crc = 0U;
+        for (size_t i = 0U; i < size; ++i)
+        {
+            crc ^= dataPtr[i];
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = ((crc & 0x80U) != 0U) ? ((crc << 1) ^ 0x07U) & 0xFFU : (crc << 1) & 0xFFU;
+            }
+        }
+
+        return static_cast<unsigned char>(crc);
+    }
+
+    /// <summary>
+    /// Purpose: Computes the CRC-16 of a Frame (polynomial x^16 + x^15 + x^2 + x^0).
+    /// </summary>
+    unsigned short ComputeCrc16(const unsigned char* dataPtr, size_t size)
+    {
+        unsigned int crc = 0U;
+        for (size_t i = 0U; i < size; ++i)
+        {
+            crc ^= static_cast<unsigned int>(dataPtr[i]) << 8;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = ((crc & 0x8000U) != 0U) ? ((crc << 1) ^ 0x8005U) & 0xFFFFU : (crc << 1) & 0xFFFFU;
+            }
+        }
+
+        return static_cast<unsigned short>(crc);
+    }
+
+    /// <summary>
+    /// Purpose: Appends the big-endian low bytes of a value.
+    /// </summary>
+    void AppendBigEndian(std::vector<unsigned char>& dataRef, unsigned long long value, unsigned long byteCount)
+    {
+        for (unsigned long i = byteCount; i > 0UL; --i)
+        {
+            dataRef.push_back(static_cast<unsigned char>(value >> (8UL * (i - 1UL))));
+        }
+    }
+
+    /// <summary>
+    /// Purpose: Appends a Frame number in the UTF-8 like coding of the Frame Header.
+    /// </summary>
+    void AppendCodedNumber(std::vector<unsigned char>& dataRef, unsigned long number)
+    {
+        if (number < 0x80UL)
+        {
+            dataRef.push_back(static_cast<unsigned char>(number));
+            return;
+        }
+
+        unsigned long byteCount = 2UL;
+        while (number >= (1UL << (5UL * byteCount + 1UL)))
+        {
+            ++byteCount;
+        }
+
+        dataRef.push_back(static_cast<unsigned char>((0xFF00UL >> byteCount) | (number >> (6UL * (byteCount - 1UL)))));
+        for (unsigned long i = byteCount - 1UL; i > 0UL; --i)
+        {
+            dataRef.push_back(static_cast<unsigned char>(0x80UL | ((number >> (6UL * (i - 1UL))) & 0x3FUL)));
+        }
+    }
+
+    /// <summary>
+    /// Purpose: Creates a FLAC Stream of random samples, stored in VERBATIM Subframes, with the MD5 signature of the samples in its STREAMINFO Block.
+    /// URI: https://xiph.org/flac/format.html
+    /// </summary>
+    /// <param name="bitsPerSample">8, 16, or 24.</param>
+    /// <param name="isCorrupted">TRUE to change a sample after the MD5 signature was computed.</param>
+    std::vector<unsigned char> CreateFlacFixture(unsigned long bitsPerSample, bool isCorrupted)
+    {
+        const unsigned long bytesPerSample = bitsPerSample / 8UL;
+        const unsigned char sampleSizeCode = (bitsPerSample == 8UL) ? 1U : (bitsPerSample == 16UL) ? 4U : 6U;
+        std::mt19937 generator(bitsPerSample);
+
+        md5_state_t md5State;
+        md5_init(&md5State);
+
+        std::vector<unsigned char> frames;
+        unsigned long minimumFrameSize = 0xFFFFFFUL;
+        unsigned long maximumFrameSize = 0UL;
+        std::vector<int32_t> samples(static_cast<size_t>(FIXTURE_BLOCK_SIZE) * FIXTURE_CHANNEL_COUNT);
+        std::vector<unsigned char> packedSamples;
+        unsigned long frameNumber = 0UL;
+        for (unsigned long long firstSampleNumber = 0ULL; firstSampleNumber < FIXTURE_TOTAL_SAMPLE_COUNT; firstSampleNumber += FIXTURE_BLOCK_SIZE, ++frameNumber)
+        {
+            const unsigned long blockSize = static_cast<unsigned long>((std::min)(static_cast<unsigned long long>(FIXTURE_BLOCK_SIZE), FIXTURE_TOTAL_SAMPLE_COUNT - firstSampleNumber));
+
+            // The MD5 Input Message: the interleaved samples, each stored in the fewest whole bytes (little-endian).
+            packedSamples.clear();
+            for (unsigned long i = 0UL; i < blockSize * FIXTURE_CHANNEL_COUNT; ++i)
+            {
+                samples[i] = static_cast<int32_t>(generator() >> (32UL - bitsPerSample)) - (1L << (bitsPerSample - 1UL));
+                for (unsigned long byteIndex = 0UL; byteIndex < bytesPerSample; ++byteIndex)
+                {
+                    packedSamples.push_back(static_cast<unsigned char>(static_cast<uint32_t>(samples[i]) >> (8UL * byteIndex)));
+                }
+            }
+
+            md5_append(&md5State, packedSamples.data(), static_cast<int>(packedSamples.size()));
+
+            if (isCorrupted && FIXTURE_CORRUPTED_SAMPLE_NUMBER >= firstSampleNumber && FIXTURE_CORRUPTED_SAMPLE_NUMBER < firstSampleNumber + blockSize)
+            {
+                samples[static_cast<size_t>(FIXTURE_CORRUPTED_SAMPLE_NUMBER - firstSampleNumber) * FIXTURE_CHANNEL_COUNT] ^= 1;
+            }
+
+            // Frame Header: fixed Block Size, a 16-bit (Block Size - 1) at the end of the Header, 44.1kHz, independent channels.
+            std::vector<unsigned char> frame{ 0xFFU, 0xF8U, 0x79U, static_cast<unsigned char>(((FIXTURE_CHANNEL_COUNT - 1UL) << 4) | (sampleSizeCode << 1)) };
+            AppendCodedNumber(frame, frameNumber);
+            AppendBigEndian(frame, blockSize - 1UL, 2UL);
+            frame.push_back(ComputeCrc8(frame.data(), frame.size()));
+
+            // A VERBATIM Subframe per channel: the Subframe Header, then the big-endian samples.
+            for (unsigned long channelIndex = 0UL; channelIndex < FIXTURE_CHANNEL_COUNT; ++channelIndex)
+            {
+                frame.push_back(0x02U);
+                for (unsigned long i = 0UL; i < blockSize; ++i)
+                {
+                    AppendBigEndian(frame, static_cast<uint32_t>(samples[i * FIXTURE_CHANNEL_COUNT + channelIndex]), bytesPerSample);
+                }
+            }
+
+            AppendBigEndian(frame, ComputeCrc16(frame.data(), frame.size()), 2UL);
+
+            minimumFrameSize = (std::min)(minimumFrameSize, static_cast<unsigned long>(frame.size()));
+            maximumFrameSize = (std::max)(maximumFrameSize, static_cast<unsigned long>(frame.size()));
+            frames.insert(frames.end(), frame.begin(), frame.end());
+        }
+
+        unsigned char md5Signature[MD5_DIGEST_SIZE]{};
+        md5_finish(&md5State, md5Signature);
+
+        // The Stream marker, and the STREAMINFO Block (the last MetaData Block).
+        std::vector<unsigned char> stream{ 'f', 'L', 'a', 'C', 0x80U, 0x00U, 0x00U, 0x22U };
+        AppendBigEndian(stream, FIXTURE_BLOCK_SIZE, 2UL);
+        AppendBigEndian(stream, FIXTURE_BLOCK_SIZE, 2UL);
+        AppendBigEndian(stream, minimumFrameSize, 3UL);
+        AppendBigEndian(stream, maximumFrameSize, 3UL);
+        AppendBigEndian(stream, (FIXTURE_SAMPLE_RATE << 44) | (static_cast<unsigned long long>(FIXTURE_CHANNEL_COUNT - 1UL) << 41) | (static_cast<unsigned long long>(bitsPerSample - 1UL) << 36) | FIXTURE_TOTAL_SAMPLE_COUNT, 8UL);
+        stream.insert(stream.end(), md5Signature, md5Signature + MD5_DIGEST_SIZE);
+        stream.insert(stream.end(), frames.begin(), frames.end());
+        return stream;
+    }
+
+    /// <summary>
+    /// Purpose: Decodes a whole File, computing the MD5 signature along a path.
+    /// </summary>
+    /// <returns>The latest error code. NONE when the File was decoded without errors.</returns>
+    DecoderErrorCode DecodeFixtureFile(const wchar_t* filenamePtr, MD5Path path, MultiBufferMD5Service& md5ServiceRef)
+    {
+        FlacDecoder testDecoder(filenamePtr, true, (path == MD5Path::SERVICE) ? &md5ServiceRef : nullptr);
+        if (!testDecoder.DecoderIsOpen())
+        {
+            return DecoderErrorCode::UNABLE_TO_OPEN_DECODER;
+        }
+
+        if (path == MD5Path::PIPELINE && !testDecoder.EnablePcmPipeline())
+        {
+            return DecoderErrorCode::DECODER_ERROR;
+        }
+
+        long long loopVar = testDecoder.Read();
+        while (loopVar > 0LL)
+        {
+            loopVar = testDecoder.Read();
+        }
+
+        return testDecoder.GetLastErrorRecord().code;
+    }
+
+    /// <summary>
+    /// Purpose: Generates a fixture, and decodes it along every MD5 path.
+    /// </summary>
+    /// <returns>The error code of each path, in MD5Path order.</returns>
+    std::vector<DecoderErrorCode> DecodeFixtureAlongEveryPath(unsigned long bitsPerSample, bool isCorrupted)
+    {
+        const std::wstring filename = UnitTestFixture::CreateTemporaryFile(CreateFlacFixture(bitsPerSample, isCorrupted), L".flac");
+        if (filename.empty())
+        {
+            return std::vector<DecoderErrorCode>(3U, DecoderErrorCode::UNABLE_TO_OPEN_DECODER);
+        }
+
+        MultiBufferMD5Service md5Service;
+        std::vector<DecoderErrorCode> errorCodes;
+        for (const MD5Path path : { MD5Path::INLINE, MD5Path::SERVICE, MD5Path::PIPELINE })
+        {
+            errorCodes.push_back(DecodeFixtureFile(filename.c_str(), path, md5Service));
+        }
+
+        DeleteFileW(filename.c_str());
+        return errorCodes;
+    }
+
+    /// <summary>
+    /// Purpose: Determines whether every path reported the expected error code.
+    /// </summary>
+    bool EveryPathReported(const std::vector<DecoderErrorCode>& errorCodesRef, DecoderErrorCode expectedCode)
+    {
+        return std::all_of(errorCodesRef.begin(), errorCodesRef.end(), [expectedCode](DecoderErrorCode code) { return code == expectedCode; });
+    }
+}
+
 namespace MainApplicationUnitTest
 {
     /// <summary>
@@ -93,5 +337,101 @@ namespace MainApplicationUnitTest
             // Assert
             Assert::AreEqual(expected, actual);
         }
+
+        /// <summary>
+        /// Purpose: Tests the MD5 signature of an 8-bit Stream, computed inline, by the shared MD5 service, and on the Pipeline Thread.
+        /// </summary>
+        TEST_METHOD(testMD5Signature8Bit)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            std::vector<DecoderErrorCode> errorCodes = FlacDecoderUnitTestSupport::DecodeFixtureAlongEveryPath(8UL, false);
+            bool actual = FlacDecoderUnitTestSupport::EveryPathReported(errorCodes, DecoderErrorCode::NONE);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests the MD5 signature of a 16-bit Stream, computed inline, by the shared MD5 service, and on the Pipeline Thread.
+        /// </summary>
+        TEST_METHOD(testMD5Signature16Bit)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            std::vector<DecoderErrorCode> errorCodes = FlacDecoderUnitTestSupport::DecodeFixtureAlongEveryPath(16UL, false);
+            bool actual = FlacDecoderUnitTestSupport::EveryPathReported(errorCodes, DecoderErrorCode::NONE);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests the MD5 signature of a 24-bit Stream, computed inline, by the shared MD5 service, and on the Pipeline Thread.
+        /// </summary>
+        TEST_METHOD(testMD5Signature24Bit)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            std::vector<DecoderErrorCode> errorCodes = FlacDecoderUnitTestSupport::DecodeFixtureAlongEveryPath(24UL, false);
+            bool actual = FlacDecoderUnitTestSupport::EveryPathReported(errorCodes, DecoderErrorCode::NONE);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a changed sample with valid Frame CRCs is reported as an MD5 mismatch along every path.
+        /// </summary>
+        TEST_METHOD(testMD5SignatureMismatch)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            bool actual = true;
+            for (const unsigned long bitsPerSample : { 8UL, 16UL, 24UL })
+            {
+                std::vector<DecoderErrorCode> errorCodes = FlacDecoderUnitTestSupport::DecodeFixtureAlongEveryPath(bitsPerSample, true);
+                actual = actual && FlacDecoderUnitTestSupport::EveryPathReported(errorCodes, DecoderErrorCode::MD5_MISMATCH);
+            }
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests destroying a Decoder part way through the File, without flushing its Pipeline, then decoding the whole File using the same MD5 service.
+        /// </summary>
+        TEST_METHOD(testCancelledPipelineDecode)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(FlacDecoderUnitTestSupport::CreateFlacFixture(16UL, false), L".flac");
+            MultiBufferMD5Service md5Service;
+            bool expected = true;
+
+            // Act
+            bool actual = !filename.empty();
+            {
+                FlacDecoder testDecoder(filename.c_str(), true, &md5Service);
+                actual = actual && testDecoder.EnablePcmPipeline();
+                for (int i = 0; i < FlacDecoderUnitTestSupport::CANCELLED_DECODE_FRAME_COUNT && actual; ++i)
+                {
+                    actual = (testDecoder.Read() > 0LL);
+                }
+            }
+
+            actual = actual && (FlacDecoderUnitTestSupport::DecodeFixtureFile(filename.c_str(), FlacDecoderUnitTestSupport::MD5Path::SERVICE, md5Service) == DecoderErrorCode::NONE);
+            DeleteFileW(filename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
     };
 }
@@ -0,0 +1,326 @@
+#include "pch.h"
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdlib>
+#include "LocalHttpServer.h"
+
+#pragma comment(lib, "Ws2_32.lib")
+
+namespace LocalHttpServerSupport
+{
+    /// <summary>
+    /// Purpose: The size of each receive.
+    /// </summary>
+    constexpr auto RECEIVE_BUFFER_SIZE = 4096;
+
+    /// <summary>
+    /// Purpose: The path of the object, and a path that is NOT found.
+    /// </summary>
+    constexpr auto OBJECT_PATH = "/bucket/track.flac";
+    constexpr auto MISSING_PATH = "/bucket/missing.flac";
+
+    /// <summary>
+    /// Purpose: Gets the value of a request header. The header name is NOT case sensitive.
+    /// </summary>
+    /// <returns>TRUE if the header was found. Otherwise, FALSE.</returns>
+    bool FindHeader(const std::string& requestRef, const std::string& nameRef, std::string& valueRef)
+    {
+        size_t lineStart = requestRef.find("\r\n");
+        while (lineStart != std::string::npos)
+        {
+            lineStart += 2U;
+            const size_t lineEnd = requestRef.find("\r\n", lineStart);
+            const std::string line = requestRef.substr(lineStart, (lineEnd == std::string::npos) ? std::string::npos : lineEnd - lineStart);
+            const size_t colon = line.find(':');
+            if (colon == nameRef.size() && std::equal(nameRef.begin(), nameRef.end(), line.begin(),
+                [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b)); }))
+            {
+                const size_t valueStart = line.find_first_not_of(' ', colon + 1U);
+                valueRef = (valueStart == std::string::npos) ? std::string{} : line.substr(valueStart);
+                return true;
+            }
+
+            lineStart = lineEnd;
+        }
+
+        return false;
+    }
+
+    /// <summary>
+    /// Purpose: Parses a single range (e.g. "bytes=100-199" or "bytes=100-"). The last byte is limited to the end of the object.
+    /// </summary>
+    /// <returns>TRUE if the range is valid. Otherwise, FALSE.</returns>
+    bool ParseRange(const std::string& valueRef, size_t objectSize, size_t& firstByteRef, size_t& lastByteRef)
+    {
+        const std::string prefix = "bytes=";
+        const size_t dash = valueRef.find('-');
+        if (valueRef.compare(0U, prefix.size(), prefix) != 0 || dash == std::string::npos || dash == prefix.size())
+        {
+            return false;
+        }
+
+        firstByteRef = static_cast<size_t>(std::strtoull(valueRef.c_str() + prefix.size(), nullptr, 10));
+        lastByteRef = (dash + 1U < valueRef.size()) ? static_cast<size_t>(std::strtoull(valueRef.c_str() + dash + 1U, nullptr, 10)) : objectSize - 1U;
+        lastByteRef = (std::min)(lastByteRef, objectSize - 1U);
+        return firstByteRef < objectSize && firstByteRef <= lastByteRef;
+    }
+
+    /// <summary>
+    /// Purpose: Sends the whole response, since send() may send only part of it.
+    /// </summary>
+    bool SendAll(SOCKET connectionSocket, const std::string& responseRef)
+    {
+        size_t bytesSent = 0U;
+        while (bytesSent < responseRef.size())
+        {
+            const int chunkSize = static_cast<int>((std::min)(responseRef.size() - bytesSent, static_cast<size_t>(INT_MAX)));
+            const int result = send(connectionSocket, responseRef.data() + bytesSent, chunkSize, 0);
+            if (result == SOCKET_ERROR || result == 0)
+            {
+                return false;
+            }
+
+            bytesSent += static_cast<size_t>(result);
+        }
+
+        return true;
+    }
+}
+
+#pragma region Public_Member_Functions_Region
+
+LocalHttpServer::LocalHttpServer() : m_listenSocket(static_cast<std::uintptr_t>(INVALID_SOCKET))
+{
+}
+
+LocalHttpServer::~LocalHttpServer()
+{
+    this->Stop();
+}
+
+bool LocalHttpServer::Start(const std::vector<unsigned char>& objectRef)
+{
+    this->m_object = objectRef;
+    this->m_objectVersion = 1UL;
+
+    WSADATA winsockData{};
+    if (WSAStartup(MAKEWORD(2, 2), &winsockData) != 0)
+    {
+        return false;
+    }
+
+    this->m_winsockIsStarted = true;
+
+    // Port 0 lets the system choose a free port, so tests running in parallel do NOT collide.
+    SOCKET listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    int addressSize = sizeof(address);
+    if (listenSocket == INVALID_SOCKET ||
+        bind(listenSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == SOCKET_ERROR ||
+        getsockname(listenSocket, reinterpret_cast<sockaddr*>(&address), &addressSize) == SOCKET_ERROR ||
+        listen(listenSocket, SOMAXCONN) == SOCKET_ERROR)
+    {
+        if (listenSocket != INVALID_SOCKET)
+        {
+            closesocket(listenSocket);
+        }
+
+        return false;
+    }
+
+    this->m_listenSocket = static_cast<std::uintptr_t>(listenSocket);
+    this->m_port = ntohs(address.sin_port);
+    this->m_listenThread = std::thread(&LocalHttpServer::AcceptConnections, this);
+    return true;
+}
+
+void LocalHttpServer::Stop()
+{
+    // Closing the listening Socket ends the accept() of the listening Thread.
+    if (this->m_listenSocket != static_cast<std::uintptr_t>(INVALID_SOCKET))
+    {
+        closesocket(static_cast<SOCKET>(this->m_listenSocket));
+        this->m_listenSocket = static_cast<std::uintptr_t>(INVALID_SOCKET);
+    }
+
+    if (this->m_listenThread.joinable())
+    {
+        this->m_listenThread.join();
+    }
+
+    // The client keeps its connections alive, so they are shut down, which ends the recv() of their Threads. Each Thread closes its own Socket.
+    std::vector<std::thread> connectionThreads;
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        for (const std::uintptr_t connectionSocket : this->m_connectionSockets)
+        {
+            shutdown(static_cast<SOCKET>(connectionSocket), SD_BOTH);
+        }
+
+        connectionThreads.swap(this->m_connectionThreads);
+    }
+
+    for (std::thread& connectionThread : connectionThreads)
+    {
+        connectionThread.join();
+    }
+
+    if (this->m_winsockIsStarted)
+    {
+        WSACleanup();
+        this->m_winsockIsStarted = false;
+    }
+}
+
+std::wstring LocalHttpServer::GetObjectUrl() const
+{
+    const std::string path = LocalHttpServerSupport::OBJECT_PATH;
+    return L"http://127.0.0.1:" + std::to_wstring(this->m_port) + std::wstring(path.begin(), path.end());
+}
+
+std::wstring LocalHttpServer::GetMissingUrl() const
+{
+    const std::string path = LocalHttpServerSupport::MISSING_PATH;
+    return L"http://127.0.0.1:" + std::to_wstring(this->m_port) + std::wstring(path.begin(), path.end());
+}
+
+void LocalHttpServer::ReplaceObject(const std::vector<unsigned char>& objectRef)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_object = objectRef;
+    ++this->m_objectVersion;
+}
+
+void LocalHttpServer::SetRangeSupport(bool isSupported)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_rangeIsSupported = isSupported;
+}
+
+void LocalHttpServer::SetIfRangeSupport(bool isSupported)
+{
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_ifRangeIsSupported = isSupported;
+}
+
+unsigned long LocalHttpServer::GetPartialResponseCount() const
+{
+    return this->m_partialResponseCount.load();
+}
+
+unsigned long LocalHttpServer::GetFullResponseCount() const
+{
+    return this->m_fullResponseCount.load();
+}
+
+#pragma endregion Public_Member_Functions_Region
+
+#pragma region Private_Member_Functions_Region
+
+void LocalHttpServer::AcceptConnections()
+{
+    const SOCKET listenSocket = static_cast<SOCKET>(this->m_listenSocket);
+    for (;;)
+    {
+        const SOCKET connectionSocket = accept(listenSocket, nullptr, nullptr);
+        if (connectionSocket == INVALID_SOCKET)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_connectionSockets.insert(static_cast<std::uintptr_t>(connectionSocket));
+        this->m_connectionThreads.emplace_back(&LocalHttpServer::ServeConnection, this, static_cast<std::uintptr_t>(connectionSocket));
+    }
+}
+
+void LocalHttpServer::ServeConnection(std::uintptr_t connectionSocket)
+{
+    // The requests have NO body (i.e. GET), so each request ends with a blank line.
+    std::string receivedData;
+    char buffer[LocalHttpServerSupport::RECEIVE_BUFFER_SIZE];
+    bool connectionIsOpen = true;
+    while (connectionIsOpen)
+    {
+        const size_t requestEnd = receivedData.find("\r\n\r\n");
+        if (requestEnd != std::string::npos)
+        {
+            const std::string request = receivedData.substr(0U, requestEnd + 2U);
+            receivedData.erase(0U, requestEnd + 4U);
+            connectionIsOpen = LocalHttpServerSupport::SendAll(static_cast<SOCKET>(connectionSocket), this->BuildResponse(request));
+        }
+        else
+        {
+            const int result = recv(static_cast<SOCKET>(connectionSocket), buffer, sizeof(buffer), 0);
+            connectionIsOpen = result > 0;
+            if (connectionIsOpen)
+            {
+                receivedData.append(buffer, static_cast<size_t>(result));
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_connectionSockets.erase(connectionSocket);
+    closesocket(static_cast<SOCKET>(connectionSocket));
+}
+
+std::string LocalHttpServer::BuildResponse(const std::string& requestRef)
+{
+    std::vector<unsigned char> object;
+    std::string entityTag;
+    bool rangeIsSupported = true;
+    bool ifRangeIsSupported = true;
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        object = this->m_object;
+        entityTag = "\"object-" + std::to_string(this->m_objectVersion) + "\"";
+        rangeIsSupported = this->m_rangeIsSupported;
+        ifRangeIsSupported = this->m_ifRangeIsSupported;
+    }
+
+    // The request line is "GET <path> HTTP/1.1".
+    const size_t pathStart = requestRef.find(' ') + 1U;
+    const std::string path = requestRef.substr(pathStart, requestRef.find(' ', pathStart) - pathStart);
+    if (path != LocalHttpServerSupport::OBJECT_PATH)
+    {
+        return "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+    }
+
+    // A Range with an If-Range that does NOT match the ETag is ignored, so the client gets the whole (new) object.
+    // URI: https://www.rfc-editor.org/rfc/rfc9110#name-if-range
+    std::string rangeValue;
+    std::string ifRangeValue;
+    const bool rangeIsRequested = rangeIsSupported && LocalHttpServerSupport::FindHeader(requestRef, "Range", rangeValue) &&
+        (!ifRangeIsSupported || !LocalHttpServerSupport::FindHeader(requestRef, "If-Range", ifRangeValue) || ifRangeValue == entityTag);
+
+    size_t firstByte = 0U;
+    size_t lastByte = object.size() - 1U;
+    std::string response;
+    if (rangeIsRequested && !LocalHttpServerSupport::ParseRange(rangeValue, object.size(), firstByte, lastByte))
+    {
+        return "HTTP/1.1 416 Range Not Satisfiable\r\nContent-Range: bytes */" + std::to_string(object.size()) + "\r\nContent-Length: 0\r\n\r\n";
+    }
+    else if (rangeIsRequested)
+    {
+        response = "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " + std::to_string(firstByte) + "-" + std::to_string(lastByte) + "/" + std::to_string(object.size()) + "\r\n";
+        ++this->m_partialResponseCount;
+    }
+    else
+    {
+        response = "HTTP/1.1 200 OK\r\n";
+        ++this->m_fullResponseCount;
+    }
+
+    response += "ETag: " + entityTag + "\r\nContent-Type: application/octet-stream\r\nContent-Length: " + std::to_string(lastByte - firstByte + 1U) + "\r\n\r\n";
+    response.append(reinterpret_cast<const char*>(object.data()) + firstByte, lastByte - firstByte + 1U);
+    return response;
+}
+
+#pragma endregion Private_Member_Functions_Region
@@ -0,0 +1,515 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include "MP3Decoder.h"
+#include "MP3Decoder.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace MP3DecoderUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The generated CBR File: MPEG-1 Layer III Frames at 128 kbps and 44.1 kHz (417 or 418 bytes each), about 33 MB.
+    /// </summary>
+    constexpr auto FRAME_COUNT = 80000UL;
+    constexpr auto FRAME_SIZE = 417UL;
+
+    /// <summary>
+    /// Purpose: The crafted Frames: the same MPEG-1 Layer III Frame Header (128 kbps, 44.1 kHz, Stereo, NOT padded) as the generated CBR File.
+    /// The Side Information is zero, so a Frame holds no Audio Data, and the rest of the Frame is filled with a byte that never forms a Frame Sync.
+    /// </summary>
+    constexpr auto SIDE_INFORMATION_SIZE = 32UL;
+    constexpr auto FRAME_FILL_BYTE = 0x55U;
+
+    /// <summary>
+    /// Purpose: The number of crafted Frames on either side of a damaged region.
+    /// </summary>
+    constexpr auto CRAFTED_FRAME_COUNT = 20UL;
+
+    /// <summary>
+    /// Purpose: The number of garbage bytes inserted into a crafted File.
+    /// </summary>
+    constexpr auto GARBAGE_SIZE = 333UL;
+
+    /// <summary>
+    /// Purpose: The number of Frames missing from a File, against the Frame count of its Info Tag.
+    /// </summary>
+    constexpr auto MISSING_FRAME_COUNT = 5UL;
+
+    /// <summary>
+    /// Purpose: The batches of the Decoder Thread: one per Progress Bar step, each with a 50 ms time budget.
+    /// </summary>
+    constexpr auto DECODE_STEP_COUNT = 256ULL;
+    constexpr auto DECODE_TIME_BUDGET_MILLISECONDS = 50UL;
+
+    /// <summary>
+    /// Purpose: The number of times each loop is run. The fastest run is reported, since the others are slowed by the rest of the system.
+    /// </summary>
+    constexpr auto BENCHMARK_RUN_COUNT = 9UL;
+
+    /// <summary>
+    /// Purpose: Generates a CBR MP3 File. Every third Frame is padded, so the 128 kbps bit rate is kept.
+    /// The Side Information is zero, so every Frame passes the Bit Reservoir check, and the rest of each Frame is random.
+    /// </summary>
+    std::vector<unsigned char> CreateCbrFile()
+    {
+        std::mt19937 generator(7U);
+        std::vector<unsigned char> file;
+        file.reserve(static_cast<size_t>(FRAME_COUNT) * (FRAME_SIZE + 1UL));
+        for (unsigned long frameIndex = 0UL; frameIndex < FRAME_COUNT; ++frameIndex)
+        {
+            const bool frameIsPadded = (frameIndex % 3UL == 0UL);
+            const unsigned char header[] = { 0xFFU, 0xFBU, static_cast<unsigned char>(frameIsPadded ? 0x92U : 0x90U), 0x00U };
+            file.insert(file.end(), header, header + sizeof(header));
+            file.insert(file.end(), SIDE_INFORMATION_SIZE, 0x00U);
+            for (unsigned long i = sizeof(header) + SIDE_INFORMATION_SIZE; i < FRAME_SIZE + (frameIsPadded ? 1UL : 0UL); ++i)
+            {
+                file.push_back(static_cast<unsigned char>(generator()));
+            }
+        }
+
+        return file;
+    }
+
+    /// <summary>
+    /// Purpose: Computes the MPEG Audio Frame CRC-16 (Polynomial 0x8005, initialized with 0xFFFF) one bit at a time, as a reference for the Decoder.
+    /// </summary>
+    unsigned short ComputeCrc16(unsigned short crc, const unsigned char* dataPtr, size_t size)
+    {
+        unsigned long value = crc;
+        for (size_t index = 0U; index < size; ++index)
+        {
+            value ^= static_cast<unsigned long>(dataPtr[index]) << 8UL;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                value = ((value & 0x8000UL) != 0UL) ? ((value << 1UL) ^ 0x8005UL) : (value << 1UL);
+            }
+        }
+        return static_cast<unsigned short>(value & 0xFFFFUL);
+    }
+
+    /// <summary>
+    /// Purpose: Appends crafted Frames to a File. A CRC protected Frame holds the CRC-16 of the last 2-bytes of the Frame Header and the Side Information.
+    /// </summary>
+    void AppendFrames(std::vector<unsigned char>& fileRef, unsigned long frameCount, bool crcIsProtected)
+    {
+        for (unsigned long frameIndex = 0UL; frameIndex < frameCount; ++frameIndex)
+        {
+            const unsigned char header[] = { 0xFFU, static_cast<unsigned char>(crcIsProtected ? 0xFAU : 0xFBU), 0x90U, 0x00U };
+            const std::vector<unsigned char> sideInformation(SIDE_INFORMATION_SIZE, 0x00U);
+            fileRef.insert(fileRef.end(), header, header + sizeof(header));
+            if (crcIsProtected)
+            {
+                const unsigned short crc = ComputeCrc16(ComputeCrc16(0xFFFF, header + 2, 2U), sideInformation.data(), sideInformation.size());
+                fileRef.push_back(static_cast<unsigned char>(crc >> 8));
+                fileRef.push_back(static_cast<unsigned char>(crc & 0xFF));
+            }
+
+            fileRef.insert(fileRef.end(), sideInformation.begin(), sideInformation.end());
+            fileRef.insert(fileRef.end(), FRAME_SIZE - sizeof(header) - (crcIsProtected ? 2UL : 0UL) - SIDE_INFORMATION_SIZE, static_cast<unsigned char>(FRAME_FILL_BYTE));
+        }
+    }
+
+    /// <summary>
+    /// Purpose: Appends a crafted Info Tag Frame (i.e. a CBR Xing Tag) holding only the Frame count. There is NO LAME Tag extension.
+    ///
+    /// URI: http://gabriel.mp3-tech.org/mp3infotag.html
+    /// </summary>
+    void AppendInfoTagFrame(std::vector<unsigned char>& fileRef, unsigned long frameCount)
+    {
+        const unsigned char header[] = { 0xFFU, 0xFBU, 0x90U, 0x00U };
+        const unsigned char infoTag[] = { 'I', 'n', 'f', 'o', 0x00U, 0x00U, 0x00U, 0x01U, static_cast<unsigned char>(frameCount >> 24UL),
+            static_cast<unsigned char>(frameCount >> 16UL), static_cast<unsigned char>(frameCount >> 8UL), static_cast<unsigned char>(frameCount) };
+        fileRef.insert(fileRef.end(), header, header + sizeof(header));
+        fileRef.insert(fileRef.end(), SIDE_INFORMATION_SIZE, 0x00U);
+        fileRef.insert(fileRef.end(), infoTag, infoTag + sizeof(infoTag));
+        fileRef.insert(fileRef.end(), FRAME_SIZE - sizeof(header) - SIDE_INFORMATION_SIZE - sizeof(infoTag), 0x00U);
+    }
+
+    /// <summary>
+    /// Purpose: Writes the File, and reads it until the end of the File or the first error.
+    /// </summary>
+    /// <param name="errorRecordRef">Receives the last Error Record.</param>
+    /// <returns>The result of the last Read() (i.e. 0 at the end of the File, or -1 on error).</returns>
+    long long ReadFile(const std::vector<unsigned char>& fileRef, DecoderErrorRecord& errorRecordRef)
+    {
+        const std::wstring filename = UnitTestFixture::CreateTemporaryFile(fileRef, L".mp3");
+        long long readResult = -1LL;
+        {
+            MP3Decoder decoder(filename.c_str(), true);
+            if (decoder.DecoderIsOpen())
+            {
+                while ((readResult = decoder.Read()) > 0LL)
+                {
+                }
+            }
+            errorRecordRef = decoder.GetLastErrorRecord();
+        }
+
+        DeleteFileW(filename.c_str());
+        return readResult;
+    }
+
+    /// <summary>
+    /// Purpose: Decodes the File the way the Decoder Thread did before Decode(): a single Frame per pass of its loop,
+    /// each pass waiting (without a timeout) on the terminate event.
+    /// </summary>
+    long long ReadFrameAtATime(PureAbstractBaseDecoder& decoderRef, HANDLE terminateEventHandle)
+    {
+        long long totalAudioUnitsRead = 0LL;
+        long long audioUnitsRead = decoderRef.Read();
+        while (WaitForSingleObject(terminateEventHandle, 0) != WAIT_OBJECT_0 && audioUnitsRead > 0LL)
+        {
+            totalAudioUnitsRead += audioUnitsRead;
+            audioUnitsRead = decoderRef.Read();
+        }
+
+        return (audioUnitsRead < 0LL) ? -1LL : totalAudioUnitsRead;
+    }
+
+    /// <summary>
+    /// Purpose: Decodes the File the way the Decoder Thread does: a batch of Frames per pass of its loop, so the terminate event is waited on once per batch.
+    /// </summary>
+    long long DecodeBatches(PureAbstractBaseDecoder& decoderRef, HANDLE terminateEventHandle)
+    {
+        const unsigned long long audioUnitBudget = (decoderRef.GetDecodedAudioDataTotal() / DECODE_STEP_COUNT > 0ULL) ? (decoderRef.GetDecodedAudioDataTotal() / DECODE_STEP_COUNT) : 1ULL;
+        long long totalAudioUnitsRead = 0LL;
+        long long audioUnitsRead = decoderRef.Decode(audioUnitBudget, DECODE_TIME_BUDGET_MILLISECONDS);
+        while (WaitForSingleObject(terminateEventHandle, 0) != WAIT_OBJECT_0 && audioUnitsRead > 0LL)
+        {
+            totalAudioUnitsRead += audioUnitsRead;
+            audioUnitsRead = decoderRef.Decode(audioUnitBudget, DECODE_TIME_BUDGET_MILLISECONDS);
+        }
+
+        return (audioUnitsRead < 0LL) ? -1LL : totalAudioUnitsRead;
+    }
+
+    /// <summary>
+    /// Purpose: A batch read the way Decode() did before DecodeBatch(): the same budgets, and the end of the File is remembered, but each Read() is called through the vtable.
+    /// </summary>
+    long long ReadVirtualBatch(PureAbstractBaseDecoder& decoderRef, unsigned long long audioUnitBudget, unsigned long timeBudgetMilliseconds, bool& endOfFileReachedRef)
+    {
+        if (endOfFileReachedRef)
+        {
+            return 0LL;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeBudgetMilliseconds);
+        unsigned long long totalAudioUnitsRead = 0ULL;
+        unsigned long readCount = 0UL;
+        while (true)
+        {
+            long long audioUnitsRead = decoderRef.Read(); // A dynamically dispatched call.
+            if (audioUnitsRead < 0LL)
+            {
+                return -1LL;
+            }
+            else if (audioUnitsRead == 0LL)
+            {
+                endOfFileReachedRef = true;
+                break;
+            }
+
+            totalAudioUnitsRead += static_cast<unsigned long long>(audioUnitsRead);
+            if (totalAudioUnitsRead >= audioUnitBudget)
+            {
+                break;
+            }
+
+            if (++readCount % DECODE_TIME_CHECK_INTERVAL == 0UL && std::chrono::steady_clock::now() >= deadline)
+            {
+                break;
+            }
+        }
+
+        return static_cast<long long>(totalAudioUnitsRead);
+    }
+
+    /// <summary>
+    /// Purpose: Decodes the File in batches like DecodeBatches(), using ReadVirtualBatch() instead of Decode().
+    /// </summary>
+    long long DecodeVirtualBatches(PureAbstractBaseDecoder& decoderRef, HANDLE terminateEventHandle)
+    {
+        const unsigned long long audioUnitBudget = (decoderRef.GetDecodedAudioDataTotal() / DECODE_STEP_COUNT > 0ULL) ? (decoderRef.GetDecodedAudioDataTotal() / DECODE_STEP_COUNT) : 1ULL;
+        bool endOfFileReached = false;
+        long long totalAudioUnitsRead = 0LL;
+        long long audioUnitsRead = ReadVirtualBatch(decoderRef, audioUnitBudget, DECODE_TIME_BUDGET_MILLISECONDS, endOfFileReached);
+        while (WaitForSingleObject(terminateEventHandle, 0) != WAIT_OBJECT_0 && audioUnitsRead > 0LL)
+        {
+            totalAudioUnitsRead += audioUnitsRead;
+            audioUnitsRead = ReadVirtualBatch(decoderRef, audioUnitBudget, DECODE_TIME_BUDGET_MILLISECONDS, endOfFileReached);
+        }
+
+        return (audioUnitsRead < 0LL) ? -1LL : totalAudioUnitsRead;
+    }
+
+    /// <summary>
+    /// Purpose: Runs a decoding loop BENCHMARK_RUN_COUNT times, each on a newly opened (and Memory buffered) Decoder. Opening the File is NOT timed.
+    /// </summary>
+    /// <param name="totalAudioUnitsReadRef">The number of Audio Units decoded by the last run.</param>
+    /// <returns>The duration of the fastest run, in milliseconds.</returns>
+    template <typename DecodeFunction>
+    double Benchmark(const std::wstring& filenameRef, DecodeFunction decodeFunction, long long& totalAudioUnitsReadRef)
+    {
+        HANDLE terminateEventHandle = CreateEventW(NULL, TRUE, FALSE, NULL);
+        double fastestMilliseconds = 0.0;
+        for (unsigned long run = 0UL; run < BENCHMARK_RUN_COUNT; ++run)
+        {
+            MP3Decoder decoder(filenameRef.c_str(), true);
+            const auto startTime = std::chrono::steady_clock::now();
+            totalAudioUnitsReadRef = decodeFunction(decoder, terminateEventHandle);
+            const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            fastestMilliseconds = (run == 0UL || milliseconds < fastestMilliseconds) ? milliseconds : fastestMilliseconds;
+        }
+
+        CloseHandle(terminateEventHandle);
+        return fastestMilliseconds;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the MP3 Decoder.
+    /// </summary>
+    TEST_CLASS(MP3DecoderUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Benchmarks decoding a generated CBR MP3 File held in Memory, a single Frame per loop pass (i.e. Read()) versus batches of Frames (i.e. Decode()).
+        /// The results are written to the Test Log in milliseconds. Both loops must decode the same number of Audio Units.
+        /// </summary>
+        TEST_METHOD(benchmarkBatchedDecode)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(MP3DecoderUnitTestSupport::CreateCbrFile(), L".mp3");
+            long long frameAtATimeAudioUnits = 0LL;
+            long long batchedAudioUnits = 0LL;
+
+            // Act
+            const double frameAtATimeMilliseconds = MP3DecoderUnitTestSupport::Benchmark(filename, MP3DecoderUnitTestSupport::ReadFrameAtATime, frameAtATimeAudioUnits);
+            const double batchedMilliseconds = MP3DecoderUnitTestSupport::Benchmark(filename, MP3DecoderUnitTestSupport::DecodeBatches, batchedAudioUnits);
+            DeleteFileW(filename.c_str());
+            const std::wstring report = L"Frames: " + std::to_wstring(MP3DecoderUnitTestSupport::FRAME_COUNT) +
+                L"\nRead(), ms: " + std::to_wstring(frameAtATimeMilliseconds) + L"\nDecode(), ms: " + std::to_wstring(batchedMilliseconds) + L"\n";
+            Logger::WriteMessage(report.c_str());
+
+            // Assert
+            Assert::IsTrue(frameAtATimeAudioUnits > 0LL);
+            Assert::AreEqual(frameAtATimeAudioUnits, batchedAudioUnits);
+        }
+
+        /// <summary>
+        /// Purpose: Benchmarks the batches of Decode(), whose Read() calls are bound statically (i.e. DecodeBatch()), versus the same batches calling Read() through the vtable.
+        /// The results are written to the Test Log in milliseconds. Both loops must decode the same number of Audio Units.
+        /// </summary>
+        TEST_METHOD(benchmarkStaticDispatch)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(MP3DecoderUnitTestSupport::CreateCbrFile(), L".mp3");
+            long long virtualAudioUnits = 0LL;
+            long long staticAudioUnits = 0LL;
+
+            // Act
+            const double virtualMilliseconds = MP3DecoderUnitTestSupport::Benchmark(filename, MP3DecoderUnitTestSupport::DecodeVirtualBatches, virtualAudioUnits);
+            const double staticMilliseconds = MP3DecoderUnitTestSupport::Benchmark(filename, MP3DecoderUnitTestSupport::DecodeBatches, staticAudioUnits);
+            DeleteFileW(filename.c_str());
+            const std::wstring report = L"Frames: " + std::to_wstring(MP3DecoderUnitTestSupport::FRAME_COUNT) +
+                L"\nVirtual Read() batches, ms: " + std::to_wstring(virtualMilliseconds) + L"\nDecodeBatch(), ms: " + std::to_wstring(staticMilliseconds) + L"\n";
+            Logger::WriteMessage(report.c_str());
+
+            // Assert
+            Assert::IsTrue(virtualAudioUnits > 0LL);
+            Assert::AreEqual(virtualAudioUnits, staticAudioUnits);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that the Frames of a crafted File are walked to the end of the File.
+        /// </summary>
+        TEST_METHOD(testReadCraftedFrames)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, false);
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == 0LL && errorRecord.code == DecoderErrorCode::NONE;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that garbage between two runs of Frames is reported as a lost Frame Sync, with the time of the last Frame before the garbage.
+        /// </summary>
+        TEST_METHOD(testResynchronizeAfterGarbage)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, false);
+            file.insert(file.end(), MP3DecoderUnitTestSupport::GARBAGE_SIZE, 0x00U);
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, false);
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::LOST_SYNC;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that garbage before the first Frame (without an ID3v2 Tag) is reported as a bad starting Frame Sync.
+        /// </summary>
+        TEST_METHOD(testResynchronizeAtStart)
+        {
+            // Arrange
+            std::vector<unsigned char> file(MP3DecoderUnitTestSupport::GARBAGE_SIZE, 0x00U);
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, false);
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::BAD_STARTING_SYNC;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that CRC protected Frames pass the CRC check.
+        /// </summary>
+        TEST_METHOD(testCrcProtectedFrames)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, true);
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == 0LL && errorRecord.code == DecoderErrorCode::NONE;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a CRC protected Frame with a damaged Side Information byte is reported as a CRC error.
+        /// </summary>
+        TEST_METHOD(testCrcProtectedFramesDamaged)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, true);
+            file[(MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT / 2UL) * MP3DecoderUnitTestSupport::FRAME_SIZE + 6UL + MP3DecoderUnitTestSupport::SIDE_INFORMATION_SIZE / 2UL] ^= 0x01U;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::CRC_ERROR;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a Frame taking more bytes from the Bit Reservoir than the previous Frames left in it is reported as a Bit Reservoir error.
+        /// </summary>
+        TEST_METHOD(testBitReservoirError)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, false);
+            const size_t sideInformationOffset = (MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT / 2UL) * MP3DecoderUnitTestSupport::FRAME_SIZE + 4UL;
+            file[sideInformationOffset] = 0xFFU;
+            file[sideInformationOffset + 1U] |= 0x80U;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::BIT_RESERVOIR_ERROR;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a Frame whose Audio Data runs past the end of the Frame is reported as a Bit Reservoir error.
+        /// </summary>
+        TEST_METHOD(testBitReservoirOverrun)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, false);
+            const size_t sideInformationOffset = (MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT / 2UL) * MP3DecoderUnitTestSupport::FRAME_SIZE + 4UL;
+            file[sideInformationOffset + 2U] = 0x0FU;
+            file[sideInformationOffset + 3U] = 0xFFU;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::BIT_RESERVOIR_ERROR;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that the Audio Frames walked match the Frame count of the Info Tag.
+        /// </summary>
+        TEST_METHOD(testInfoTagFrameCount)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            MP3DecoderUnitTestSupport::AppendInfoTagFrame(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT);
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, false);
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == 0LL && errorRecord.code == DecoderErrorCode::NONE;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a File with fewer Audio Frames than the Frame count of its Info Tag is reported with the number of missing Frames.
+        /// </summary>
+        TEST_METHOD(testInfoTagFrameCountMismatch)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            MP3DecoderUnitTestSupport::AppendInfoTagFrame(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT + MP3DecoderUnitTestSupport::MISSING_FRAME_COUNT);
+            MP3DecoderUnitTestSupport::AppendFrames(file, MP3DecoderUnitTestSupport::CRAFTED_FRAME_COUNT, false);
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DecoderUnitTestSupport::ReadFile(file, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::MISSING_FRAMES &&
+                errorRecord.detail == static_cast<long long>(MP3DecoderUnitTestSupport::MISSING_FRAME_COUNT);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <string>
+#include <vector>
+#include "MP3DeepDecoder.h"
+#include "MP3DeepDecoder.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace MP3DeepDecoderUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The crafted Frames: MPEG-1 Layer III Frame Headers (128 kbps, 44.1 kHz, Stereo, NOT padded, NOT CRC protected) of 417 bytes each.
+    /// The Side Information is zero, so every Frame decodes to silence, and the rest of the Frame is filled with a byte that never forms a Frame Sync.
+    /// </summary>
+    constexpr auto FRAME_SIZE = 417UL;
+    constexpr auto SIDE_INFORMATION_SIZE = 32UL;
+    constexpr auto FRAME_FILL_BYTE = 0x55U;
+    constexpr auto CRAFTED_FRAME_COUNT = 20UL;
+
+    /// <summary>
+    /// Purpose: Sets the 'window_switching_flag' of the first Granule and Channel, leaving its 'block_type' at 0 (i.e. a normal block).
+    /// A switched Window must use one of the other block types, so the Side Information passes the Bit Reservoir check but does NOT decode.
+    /// The flag is bit 53 of the Side Information: 'main_data_begin' (9 bits), 'private_bits' (3 bits), 'scfsi' (8 bits), then 'part2_3_length' (12 bits),
+    /// 'big_values' (9 bits), 'global_gain' (8 bits), and 'scalefac_compress' (4 bits).
+    /// </summary>
+    constexpr auto WINDOW_SWITCHING_BYTE_OFFSET = 6UL;
+    constexpr auto WINDOW_SWITCHING_BIT_MASK = 0x04U;
+
+    /// <summary>
+    /// Purpose: Creates a File of crafted Frames.
+    /// </summary>
+    std::vector<unsigned char> CreateCraftedFile(unsigned long frameCount)
+    {
+        std::vector<unsigned char> file;
+        for (unsigned long frameIndex = 0UL; frameIndex < frameCount; ++frameIndex)
+        {
+            const unsigned char header[] = { 0xFFU, 0xFBU, 0x90U, 0x00U };
+            file.insert(file.end(), header, header + sizeof(header));
+            file.insert(file.end(), SIDE_INFORMATION_SIZE, 0x00U);
+            file.insert(file.end(), FRAME_SIZE - sizeof(header) - SIDE_INFORMATION_SIZE, static_cast<unsigned char>(FRAME_FILL_BYTE));
+        }
+
+        return file;
+    }
+
+    /// <summary>
+    /// Purpose: Writes the File, and decodes it until the end of the File or the first error.
+    /// </summary>
+    /// <param name="errorRecordRef">Receives the last Error Record.</param>
+    /// <returns>The result of the last Read() (i.e. 0 at the end of the File, or -1 on error).</returns>
+    long long DecodeFile(const std::vector<unsigned char>& fileRef, DecoderErrorRecord& errorRecordRef)
+    {
+        const std::wstring filename = UnitTestFixture::CreateTemporaryFile(fileRef, L".mp3");
+        long long readResult = -1LL;
+        {
+            MP3DeepDecoder decoder(filename.c_str(), true);
+            if (decoder.DecoderIsOpen())
+            {
+                while ((readResult = decoder.Read()) > 0LL)
+                {
+                }
+            }
+            errorRecordRef = decoder.GetLastErrorRecord();
+        }
+
+        DeleteFileW(filename.c_str());
+        return readResult;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    TEST_CLASS(MP3DeepDecoderUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests that every crafted Frame is decoded.
+        /// </summary>
+        TEST_METHOD(testDecodeCraftedFrames)
+        {
+            // Arrange
+            const std::vector<unsigned char> file = MP3DeepDecoderUnitTestSupport::CreateCraftedFile(MP3DeepDecoderUnitTestSupport::CRAFTED_FRAME_COUNT);
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DeepDecoderUnitTestSupport::DecodeFile(file, errorRecord);
+            bool actual = readResult == 0LL && errorRecord.code == DecoderErrorCode::NONE;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a Frame with a corrupted Side Information, which the Frame Header walk and the Bit Reservoir check accept, is reported as a decode error.
+        /// </summary>
+        TEST_METHOD(testDecodeCorruptedFrame)
+        {
+            // Arrange
+            std::vector<unsigned char> file = MP3DeepDecoderUnitTestSupport::CreateCraftedFile(MP3DeepDecoderUnitTestSupport::CRAFTED_FRAME_COUNT);
+            file[(MP3DeepDecoderUnitTestSupport::CRAFTED_FRAME_COUNT / 2UL) * MP3DeepDecoderUnitTestSupport::FRAME_SIZE + 4UL +
+                MP3DeepDecoderUnitTestSupport::WINDOW_SWITCHING_BYTE_OFFSET] |= MP3DeepDecoderUnitTestSupport::WINDOW_SWITCHING_BIT_MASK;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = MP3DeepDecoderUnitTestSupport::DecodeFile(file, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::DECODE_ERROR;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
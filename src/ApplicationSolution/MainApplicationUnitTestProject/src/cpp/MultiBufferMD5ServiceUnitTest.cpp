@@ -0,0 +1,289 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "MultiBufferMD5Service.h"
+#include "MultiBufferMD5Service.cpp"
+#include "md5.h"
+#include "md5.c"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace MultiBufferMD5ServiceUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The number of Rounds of interleaved Streams, and the largest number of Streams in a Round.
+    /// </summary>
+    constexpr auto INTERLEAVED_ROUND_COUNT = 20;
+    constexpr auto INTERLEAVED_MAXIMUM_STREAM_COUNT = 40U;
+
+    /// <summary>
+    /// Purpose: The largest Message, and the largest chunk submitted at once, in an interleaved Round.
+    /// </summary>
+    constexpr auto INTERLEAVED_MAXIMUM_MESSAGE_SIZE = 500000U;
+    constexpr auto INTERLEAVED_MAXIMUM_CHUNK_SIZE = 20000U;
+
+    /// <summary>
+    /// Purpose: The number of Threads, the number of Streams of each Thread, and the largest Message of a Thread.
+    /// </summary>
+    constexpr auto CONCURRENT_THREAD_COUNT = 8;
+    constexpr auto CONCURRENT_STREAM_COUNT = 5;
+    constexpr auto CONCURRENT_MAXIMUM_MESSAGE_SIZE = 3000000U;
+    constexpr auto CONCURRENT_MAXIMUM_CHUNK_SIZE = 16384U;
+
+    /// <summary>
+    /// Purpose: The total number of bytes hashed by each Benchmark run, and the size of each submitted chunk (about one decoded FLAC Frame).
+    /// </summary>
+    constexpr auto BENCHMARK_TOTAL_SIZE = 64ULL * 1024ULL * 1024ULL;
+    constexpr auto BENCHMARK_CHUNK_SIZE = 16384U;
+
+    /// <summary>
+    /// Purpose: Computes the reference Digest of a Message using md5.c.
+    /// </summary>
+    void ComputeReferenceDigest(const std::vector<unsigned char>& messageRef, unsigned char digest[MD5_DIGEST_SIZE])
+    {
+        md5_state_t state;
+        md5_init(&state);
+        if (!messageRef.empty())
+        {
+            md5_append(&state, messageRef.data(), static_cast<int>(messageRef.size()));
+        }
+        md5_finish(&state, digest);
+    }
+
+    /// <summary>
+    /// Purpose: Determines whether a Digest matches the reference Digest of a Message.
+    /// </summary>
+    bool DigestMatches(const std::vector<unsigned char>& messageRef, const unsigned char digest[MD5_DIGEST_SIZE])
+    {
+        unsigned char expected[MD5_DIGEST_SIZE]{};
+        ComputeReferenceDigest(messageRef, expected);
+        return std::memcmp(expected, digest, MD5_DIGEST_SIZE) == 0;
+    }
+
+    /// <summary>
+    /// Purpose: Creates a Message of random bytes.
+    /// </summary>
+    std::vector<unsigned char> CreateRandomMessage(std::mt19937& generatorRef, size_t size)
+    {
+        std::vector<unsigned char> message(size);
+        for (auto& byteRef : message)
+        {
+            byteRef = static_cast<unsigned char>(generatorRef());
+        }
+
+        return message;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the Multi-Buffer MD5 Service, comparing its Digests with md5.c.
+    /// </summary>
+    TEST_CLASS(MultiBufferMD5ServiceUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests the Digests of the RFC 1321 Test Suite.
+        /// </summary>
+        TEST_METHOD(testRfc1321TestSuite)
+        {
+            // Arrange
+            const std::string messages[] = { "", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz",
+                "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+                "12345678901234567890123456789012345678901234567890123456789012345678901234567890" };
+            MultiBufferMD5Service service;
+            bool expected = true;
+
+            // Act
+            bool actual = true;
+            for (const auto& messageRef : messages)
+            {
+                const std::vector<unsigned char> message(messageRef.begin(), messageRef.end());
+                const MD5StreamId streamId = service.Join();
+                service.Submit(streamId, message.data(), message.size());
+                unsigned char digest[MD5_DIGEST_SIZE]{};
+                service.Finish(streamId, digest);
+                actual = actual && MultiBufferMD5ServiceUnitTestSupport::DigestMatches(message, digest);
+            }
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests many Streams of random lengths, submitted in random chunks and interleaved on a single Thread, so the batches mix Streams of every length.
+        /// </summary>
+        TEST_METHOD(testInterleavedStreams)
+        {
+            // Arrange
+            std::mt19937 generator(1U);
+            MultiBufferMD5Service service;
+            int expected = 0;
+
+            // Act
+            int actual = 0;
+            for (int round = 0; round < MultiBufferMD5ServiceUnitTestSupport::INTERLEAVED_ROUND_COUNT; ++round)
+            {
+                const size_t streamCount = 1U + generator() % MultiBufferMD5ServiceUnitTestSupport::INTERLEAVED_MAXIMUM_STREAM_COUNT;
+                std::vector<std::vector<unsigned char>> messages(streamCount);
+                std::vector<size_t> submittedSizes(streamCount, 0U);
+                std::vector<MD5StreamId> streamIds(streamCount);
+                std::vector<bool> finished(streamCount, false);
+                for (size_t i = 0U; i < streamCount; ++i)
+                {
+                    // Include Messages shorter than a single Block.
+                    const size_t size = (generator() % 4U == 0U) ? generator() % 200U : generator() % MultiBufferMD5ServiceUnitTestSupport::INTERLEAVED_MAXIMUM_MESSAGE_SIZE;
+                    messages[i] = MultiBufferMD5ServiceUnitTestSupport::CreateRandomMessage(generator, size);
+                    streamIds[i] = service.Join();
+                }
+
+                size_t finishedCount = 0U;
+                while (finishedCount < streamCount)
+                {
+                    const size_t i = generator() % streamCount;
+                    if (finished[i])
+                    {
+                        continue;
+                    }
+
+                    // Include empty chunks.
+                    const size_t chunkSize = (std::min)(messages[i].size() - submittedSizes[i], static_cast<size_t>(generator() % MultiBufferMD5ServiceUnitTestSupport::INTERLEAVED_MAXIMUM_CHUNK_SIZE));
+                    service.Submit(streamIds[i], messages[i].data() + submittedSizes[i], chunkSize);
+                    submittedSizes[i] += chunkSize;
+
+                    // Keep some complete Streams open for a while, so they stay idle while other Streams are hashed.
+                    if ((submittedSizes[i] == messages[i].size()) && (generator() % 3U == 0U))
+                    {
+                        unsigned char digest[MD5_DIGEST_SIZE]{};
+                        service.Finish(streamIds[i], digest);
+                        if (!MultiBufferMD5ServiceUnitTestSupport::DigestMatches(messages[i], digest))
+                        {
+                            ++actual;
+                        }
+
+                        finished[i] = true;
+                        ++finishedCount;
+                    }
+                }
+            }
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests Streams submitted by concurrent Threads, as the Decoder Threads do, including a cancelled Stream on each Thread.
+        /// </summary>
+        TEST_METHOD(testConcurrentStreams)
+        {
+            // Arrange
+            MultiBufferMD5Service service;
+            std::atomic<int> mismatchCount{ 0 };
+            std::vector<std::thread> threads;
+            int expected = 0;
+
+            // Act
+            for (int t = 0; t < MultiBufferMD5ServiceUnitTestSupport::CONCURRENT_THREAD_COUNT; ++t)
+            {
+                threads.emplace_back([&service, &mismatchCount, t]()
+                {
+                    std::mt19937 generator(100U + static_cast<unsigned int>(t));
+                    for (int s = 0; s < MultiBufferMD5ServiceUnitTestSupport::CONCURRENT_STREAM_COUNT; ++s)
+                    {
+                        const std::vector<unsigned char> message = MultiBufferMD5ServiceUnitTestSupport::CreateRandomMessage(generator, generator() % MultiBufferMD5ServiceUnitTestSupport::CONCURRENT_MAXIMUM_MESSAGE_SIZE);
+                        const MD5StreamId streamId = service.Join();
+                        size_t submittedSize = 0U;
+                        while (submittedSize < message.size())
+                        {
+                            const size_t chunkSize = (std::min)(message.size() - submittedSize, static_cast<size_t>(1U + generator() % MultiBufferMD5ServiceUnitTestSupport::CONCURRENT_MAXIMUM_CHUNK_SIZE));
+                            service.Submit(streamId, message.data() + submittedSize, chunkSize);
+                            submittedSize += chunkSize;
+                        }
+
+                        unsigned char digest[MD5_DIGEST_SIZE]{};
+                        service.Finish(streamId, digest);
+                        if (!MultiBufferMD5ServiceUnitTestSupport::DigestMatches(message, digest))
+                        {
+                            ++mismatchCount;
+                        }
+                    }
+
+                    const std::vector<unsigned char> cancelledMessage = MultiBufferMD5ServiceUnitTestSupport::CreateRandomMessage(generator, MULTI_BUFFER_MD5_BATCH_SIZE + 3U);
+                    const MD5StreamId cancelledStreamId = service.Join();
+                    service.Submit(cancelledStreamId, cancelledMessage.data(), cancelledMessage.size());
+                    service.Cancel(cancelledStreamId);
+                });
+            }
+
+            for (auto& threadRef : threads)
+            {
+                threadRef.join();
+            }
+
+            int actual = mismatchCount;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Benchmarks the throughput of 1 to 32 Streams interleaved on a single Thread in 16 KiB chunks, and of md5.c hashing a single Message.
+        /// The results are written to the Test Log in GB/s. The Digests are NOT compared.
+        /// </summary>
+        TEST_METHOD(benchmarkInterleavedStreams)
+        {
+            // Arrange
+            std::mt19937 generator(1U);
+            const std::vector<unsigned char> chunk = MultiBufferMD5ServiceUnitTestSupport::CreateRandomMessage(generator, MultiBufferMD5ServiceUnitTestSupport::BENCHMARK_CHUNK_SIZE);
+            const std::vector<unsigned char> message(static_cast<size_t>(MultiBufferMD5ServiceUnitTestSupport::BENCHMARK_TOTAL_SIZE), 7U);
+            MultiBufferMD5Service service;
+            std::wstring report = L"Lanes: " + std::to_wstring(MultiBufferMD5Service::GetLaneCount()) + L"\n";
+
+            // Act
+            for (const size_t streamCount : { 1U, 4U, 8U, 16U, 32U })
+            {
+                const auto startTime = std::chrono::steady_clock::now();
+                std::vector<MD5StreamId> streamIds;
+                for (size_t i = 0U; i < streamCount; ++i)
+                {
+                    streamIds.push_back(service.Join());
+                }
+
+                for (unsigned long long offset = 0ULL; offset < MultiBufferMD5ServiceUnitTestSupport::BENCHMARK_TOTAL_SIZE; offset += chunk.size() * streamCount)
+                {
+                    for (const auto streamId : streamIds)
+                    {
+                        service.Submit(streamId, chunk.data(), chunk.size());
+                    }
+                }
+
+                for (const auto streamId : streamIds)
+                {
+                    unsigned char digest[MD5_DIGEST_SIZE]{};
+                    service.Finish(streamId, digest);
+                }
+
+                const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+                report += L"Streams: " + std::to_wstring(streamCount) + L", GB/s: " + std::to_wstring(MultiBufferMD5ServiceUnitTestSupport::BENCHMARK_TOTAL_SIZE / seconds / 1e9) + L"\n";
+            }
+
+            const auto startTime = std::chrono::steady_clock::now();
+            unsigned char digest[MD5_DIGEST_SIZE]{};
+            MultiBufferMD5ServiceUnitTestSupport::ComputeReferenceDigest(message, digest);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            report += L"md5.c, GB/s: " + std::to_wstring(MultiBufferMD5ServiceUnitTestSupport::BENCHMARK_TOTAL_SIZE / seconds / 1e9) + L"\n";
+
+            // Assert
+            Logger::WriteMessage(report.c_str());
+        }
+    };
+}
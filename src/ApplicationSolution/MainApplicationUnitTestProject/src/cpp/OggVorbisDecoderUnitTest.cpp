@@ -0,0 +1,399 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <random>
+#include <string>
+#include <vector>
+#include <vorbis/vorbisenc.h>
+#include "OggPageTracker.h"
+#include "OggPageTracker.cpp"
+#include "OggVorbisSegmentVerifier.h"
+#include "OggVorbisSegmentVerifier.cpp"
+#include "OggVorbisDecoder.h"
+#include "OggVorbisDecoder.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace OggVorbisDecoderUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The format of the generated Streams.
+    /// </summary>
+    constexpr auto CHANNEL_COUNT = 2L;
+    constexpr auto SAMPLE_RATE = 44100L;
+    constexpr auto SERIAL_NUMBER = 0x12345678;
+
+    /// <summary>
+    /// Purpose: The number of Samples (per channel) passed to the Encoder at a time.
+    /// </summary>
+    constexpr auto ENCODE_CHUNK_SIZE = 4096;
+
+    /// <summary>
+    /// Purpose: The minimum size in bytes of the short Stream used by the Streaming Mode tests.
+    /// </summary>
+    constexpr auto SHORT_STREAM_SIZE = 256ULL * 1024ULL;
+
+    /// <summary>
+    /// Purpose: The minimum size in bytes of the long Stream used by the Segment tests. The Stream is large enough to be cut into two Segments.
+    /// </summary>
+    constexpr auto SEGMENTED_STREAM_SIZE = 2ULL * OGG_VORBIS_MINIMUM_SEGMENT_SIZE + 1024ULL * 1024ULL;
+
+    /// <summary>
+    /// Purpose: The number of Segment Threads used by the Segment tests.
+    /// </summary>
+    constexpr auto SEGMENT_THREAD_COUNT = 2UL;
+
+    /// <summary>
+    /// Purpose: The amount added to the Granule Position of the End-Of-Stream Page, when it is damaged.
+    /// </summary>
+    constexpr auto GRANULE_POSITION_OFFSET = 1000LL;
+
+    /// <summary>
+    /// Purpose: The location of a single Page within a generated Stream.
+    /// </summary>
+    struct PageLocation
+    {
+        size_t offset{};
+        OggPageHeaderInfo headerInfo{};
+    };
+
+    void AppendPage(std::vector<unsigned char>& streamRef, const ogg_page& pageRef)
+    {
+        streamRef.insert(streamRef.end(), pageRef.header, pageRef.header + pageRef.header_len);
+        streamRef.insert(streamRef.end(), pageRef.body, pageRef.body + pageRef.body_len);
+    }
+
+    /// <summary>
+    /// Purpose: Encodes white noise into a single-Link Ogg-Vorbis Stream using 'libvorbisenc'. Noise does NOT compress well, so the Stream grows quickly.
+    ///
+    /// URI: https://xiph.org/vorbis/doc/vorbisenc/overview.html
+    /// </summary>
+    /// <param name="minimumStreamSize">Samples are encoded until the Stream is at least this many bytes.</param>
+    /// <param name="sampleCountRef">Receives the number of Samples (per channel) that were encoded.</param>
+    /// <returns>The Stream, or an empty Stream if the Encoder could NOT be initialized.</returns>
+    std::vector<unsigned char> EncodeNoise(unsigned long long minimumStreamSize, unsigned long long& sampleCountRef)
+    {
+        std::vector<unsigned char> stream;
+        sampleCountRef = 0ULL;
+
+        vorbis_info info;
+        vorbis_info_init(&info);
+        if (vorbis_encode_init_vbr(&info, CHANNEL_COUNT, SAMPLE_RATE, 1.0f) != 0)
+        {
+            vorbis_info_clear(&info);
+            return stream;
+        }
+
+        vorbis_comment comment;
+        vorbis_comment_init(&comment);
+        vorbis_dsp_state dspState;
+        vorbis_analysis_init(&dspState, &info);
+        vorbis_block block;
+        vorbis_block_init(&dspState, &block);
+        ogg_stream_state streamState;
+        ogg_stream_init(&streamState, SERIAL_NUMBER);
+
+        // The three Header Packets are flushed to Pages of their own, so the audio starts on a fresh Page.
+        ogg_packet headerPackets[3]{};
+        vorbis_analysis_headerout(&dspState, &comment, &headerPackets[0], &headerPackets[1], &headerPackets[2]);
+        for (ogg_packet& headerPacketRef : headerPackets)
+        {
+            ogg_stream_packetin(&streamState, &headerPacketRef);
+        }
+
+        ogg_page page{};
+        while (ogg_stream_flush(&streamState, &page) != 0)
+        {
+            AppendPage(stream, page);
+        }
+
+        std::mt19937 generator(26U);
+        std::uniform_real_distribution<float> distribution(-0.25f, 0.25f);
+        bool endOfInput = false;
+        bool endOfStream = false;
+        while (!endOfStream)
+        {
+            if (!endOfInput && stream.size() < minimumStreamSize)
+            {
+                float** bufferPtr = vorbis_analysis_buffer(&dspState, ENCODE_CHUNK_SIZE);
+                for (long channel = 0L; channel < CHANNEL_COUNT; ++channel)
+                {
+                    for (int i = 0; i < ENCODE_CHUNK_SIZE; ++i)
+                    {
+                        bufferPtr[channel][i] = distribution(generator);
+                    }
+                }
+                vorbis_analysis_wrote(&dspState, ENCODE_CHUNK_SIZE);
+                sampleCountRef += ENCODE_CHUNK_SIZE;
+            }
+            else if (!endOfInput)
+            {
+                // Signal the end of the input. The last Packet is flagged as End-Of-Stream.
+                vorbis_analysis_wrote(&dspState, 0);
+                endOfInput = true;
+            }
+
+            while (vorbis_analysis_blockout(&dspState, &block) == 1)
+            {
+                vorbis_analysis(&block, nullptr);
+                vorbis_bitrate_addblock(&block);
+
+                ogg_packet packet{};
+                while (vorbis_bitrate_flushpacket(&dspState, &packet) == 1)
+                {
+                    ogg_stream_packetin(&streamState, &packet);
+                    while (ogg_stream_pageout(&streamState, &page) != 0)
+                    {
+                        AppendPage(stream, page);
+                        endOfStream = endOfStream || (ogg_page_eos(&page) != 0);
+                    }
+                }
+            }
+        }
+
+        ogg_stream_clear(&streamState);
+        vorbis_block_clear(&block);
+        vorbis_dsp_clear(&dspState);
+        vorbis_comment_clear(&comment);
+        vorbis_info_clear(&info);
+        return stream;
+    }
+
+    /// <summary>
+    /// Purpose: Walks the Pages of a generated Stream. The Stream has no garbage between its Pages.
+    /// </summary>
+    std::vector<PageLocation> IndexPages(const std::vector<unsigned char>& streamRef)
+    {
+        std::vector<PageLocation> pages;
+        PageLocation page{};
+        while (page.offset < streamRef.size() && OggPageTracker::ParsePageHeader(streamRef.data() + page.offset, streamRef.size() - page.offset, page.headerInfo))
+        {
+            pages.push_back(page);
+            page.offset += page.headerInfo.headerSize + page.headerInfo.bodySize;
+        }
+
+        return pages;
+    }
+
+    /// <summary>
+    /// Purpose: Recomputes the CRC of a Page that was changed, so only the changed field is wrong.
+    ///
+    /// URI: https://xiph.org/ogg/doc/libogg/ogg_page_checksum_set.html
+    /// </summary>
+    void SetPageChecksum(std::vector<unsigned char>& streamRef, const PageLocation& pageRef)
+    {
+        ogg_page page{};
+        page.header = streamRef.data() + pageRef.offset;
+        page.header_len = static_cast<long>(pageRef.headerInfo.headerSize);
+        page.body = page.header + pageRef.headerInfo.headerSize;
+        page.body_len = static_cast<long>(pageRef.headerInfo.bodySize);
+        ogg_page_checksum_set(&page);
+    }
+
+    /// <summary>
+    /// Purpose: Writes the Stream to a File, and decodes it until the end of the File or the first error.
+    /// </summary>
+    /// <param name="streamingModeIsEnabled">TRUE to decode in a single forward pass (Page verification). FALSE to decode from the Memory Buffer.</param>
+    /// <param name="segmentThreadCount">The maximum number of Segment Threads, when the File is decoded from the Memory Buffer.</param>
+    /// <param name="sampleCountRef">Receives the number of Samples (per channel) that were decoded.</param>
+    /// <param name="errorRecordRef">Receives the last Error Record.</param>
+    /// <returns>The result of the last Read() (i.e. 0 at the end of the File, or -1 on error).</returns>
+    long long DecodeStream(const std::vector<unsigned char>& streamRef, bool streamingModeIsEnabled, unsigned long segmentThreadCount, unsigned long long& sampleCountRef, DecoderErrorRecord& errorRecordRef)
+    {
+        const std::wstring filename = UnitTestFixture::CreateTemporaryFile(streamRef, L".ogg");
+        long long readResult = -1LL;
+        sampleCountRef = 0ULL;
+        {
+            OggVorbisDecoder decoder(filename.c_str(), !streamingModeIsEnabled, streamingModeIsEnabled, segmentThreadCount);
+            if (decoder.DecoderIsOpen())
+            {
+                while ((readResult = decoder.Read()) > 0LL)
+                {
+                    sampleCountRef += static_cast<unsigned long long>(readResult);
+                }
+            }
+            errorRecordRef = decoder.GetLastErrorRecord();
+        }
+
+        DeleteFileW(filename.c_str());
+        return readResult;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the Ogg-Vorbis Decoder, and the Ogg Page Tracker it verifies a Stream with.
+    /// </summary>
+    TEST_CLASS(OggVorbisDecoderUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests that the Page Tracker finds the End-Of-Stream Page and its Granule Position when the Stream is fed in uneven pieces,
+        /// with garbage between two of its Pages.
+        /// </summary>
+        TEST_METHOD(testPageTracker)
+        {
+            // Arrange
+            unsigned long long sampleCount = 0ULL;
+            std::vector<unsigned char> stream = OggVorbisDecoderUnitTestSupport::EncodeNoise(OggVorbisDecoderUnitTestSupport::SHORT_STREAM_SIZE, sampleCount);
+            const std::vector<OggVorbisDecoderUnitTestSupport::PageLocation> pages = OggVorbisDecoderUnitTestSupport::IndexPages(stream);
+            const unsigned char garbage[] = { 'O', 'g', 'g', 'O', 'g', 'x', 0x00U, 'O' };
+            stream.insert(stream.begin() + pages[pages.size() / 2U].offset, garbage, garbage + sizeof(garbage));
+            OggPageTracker pageTracker;
+            bool expected = true;
+
+            // Act
+            for (size_t offset = 0U; offset < stream.size(); offset += 1000U)
+            {
+                pageTracker.Consume(stream.data() + offset, (stream.size() - offset < 1000U) ? stream.size() - offset : 1000U);
+            }
+
+            bool actual = pageTracker.IsEndOfStreamSeen(OggVorbisDecoderUnitTestSupport::SERIAL_NUMBER) &&
+                pageTracker.GetLastGranulePosition(OggVorbisDecoderUnitTestSupport::SERIAL_NUMBER) == static_cast<long long>(sampleCount) &&
+                pageTracker.GetAnchorPageCount(OggVorbisDecoderUnitTestSupport::SERIAL_NUMBER) > 0UL &&
+                pageTracker.GetLastGranulePosition(OggVorbisDecoderUnitTestSupport::SERIAL_NUMBER + 1) == -1LL;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a valid Stream decoded in Streaming Mode passes the Page verification, and decodes every Sample.
+        /// </summary>
+        TEST_METHOD(testStreamingDecode)
+        {
+            // Arrange
+            unsigned long long sampleCount = 0ULL;
+            const std::vector<unsigned char> stream = OggVorbisDecoderUnitTestSupport::EncodeNoise(OggVorbisDecoderUnitTestSupport::SHORT_STREAM_SIZE, sampleCount);
+            unsigned long long decodedSampleCount = 0ULL;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = OggVorbisDecoderUnitTestSupport::DecodeStream(stream, true, 1UL, decodedSampleCount, errorRecord);
+            bool actual = readResult == 0LL && decodedSampleCount == sampleCount && errorRecord.code == DecoderErrorCode::NONE;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a Page with a damaged Body (i.e. a bad Page CRC) is reported as a hole in Streaming Mode.
+        /// </summary>
+        TEST_METHOD(testStreamingDecodeDamagedPage)
+        {
+            // Arrange
+            unsigned long long sampleCount = 0ULL;
+            std::vector<unsigned char> stream = OggVorbisDecoderUnitTestSupport::EncodeNoise(OggVorbisDecoderUnitTestSupport::SHORT_STREAM_SIZE, sampleCount);
+            const std::vector<OggVorbisDecoderUnitTestSupport::PageLocation> pages = OggVorbisDecoderUnitTestSupport::IndexPages(stream);
+            const OggVorbisDecoderUnitTestSupport::PageLocation& damagedPageRef = pages[pages.size() / 2U];
+            stream[damagedPageRef.offset + damagedPageRef.headerInfo.headerSize + damagedPageRef.headerInfo.bodySize / 2U] ^= 0xFFU;
+            unsigned long long decodedSampleCount = 0ULL;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = OggVorbisDecoderUnitTestSupport::DecodeStream(stream, true, 1UL, decodedSampleCount, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::OGG_VORBIS_HOLE;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a Stream without its End-Of-Stream Page is reported as truncated in Streaming Mode.
+        /// </summary>
+        TEST_METHOD(testStreamingDecodeTruncated)
+        {
+            // Arrange
+            unsigned long long sampleCount = 0ULL;
+            std::vector<unsigned char> stream = OggVorbisDecoderUnitTestSupport::EncodeNoise(OggVorbisDecoderUnitTestSupport::SHORT_STREAM_SIZE, sampleCount);
+            stream.resize(OggVorbisDecoderUnitTestSupport::IndexPages(stream).back().offset);
+            unsigned long long decodedSampleCount = 0ULL;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = OggVorbisDecoderUnitTestSupport::DecodeStream(stream, true, 1UL, decodedSampleCount, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::TRUNCATED;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that an End-Of-Stream Page whose Granule Position claims more Samples than the Stream holds is reported in Streaming Mode.
+        /// The Page CRC is recomputed, so only the Page Tracker can find the difference.
+        /// </summary>
+        TEST_METHOD(testStreamingDecodeGranulePositionMismatch)
+        {
+            // Arrange
+            unsigned long long sampleCount = 0ULL;
+            std::vector<unsigned char> stream = OggVorbisDecoderUnitTestSupport::EncodeNoise(OggVorbisDecoderUnitTestSupport::SHORT_STREAM_SIZE, sampleCount);
+            const OggVorbisDecoderUnitTestSupport::PageLocation lastPage = OggVorbisDecoderUnitTestSupport::IndexPages(stream).back();
+            const unsigned long long granulePosition = static_cast<unsigned long long>(lastPage.headerInfo.granulePosition + OggVorbisDecoderUnitTestSupport::GRANULE_POSITION_OFFSET);
+            for (size_t i = 0U; i < 8U; ++i)
+            {
+                stream[lastPage.offset + 6U + i] = static_cast<unsigned char>(granulePosition >> (8U * i));
+            }
+            OggVorbisDecoderUnitTestSupport::SetPageChecksum(stream, lastPage);
+            unsigned long long decodedSampleCount = 0ULL;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = OggVorbisDecoderUnitTestSupport::DecodeStream(stream, true, 1UL, decodedSampleCount, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::MISSING_SAMPLES && errorRecord.detail == OggVorbisDecoderUnitTestSupport::GRANULE_POSITION_OFFSET;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a valid Stream decoded from the Memory Buffer in Segments passes the Segment verification, and that the stitched
+        /// Segments decode every Sample.
+        /// </summary>
+        TEST_METHOD(testSegmentDecode)
+        {
+            // Arrange
+            unsigned long long sampleCount = 0ULL;
+            const std::vector<unsigned char> stream = OggVorbisDecoderUnitTestSupport::EncodeNoise(OggVorbisDecoderUnitTestSupport::SEGMENTED_STREAM_SIZE, sampleCount);
+            unsigned long long decodedSampleCount = 0ULL;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = OggVorbisDecoderUnitTestSupport::DecodeStream(stream, false, OggVorbisDecoderUnitTestSupport::SEGMENT_THREAD_COUNT, decodedSampleCount, errorRecord);
+            bool actual = readResult == 0LL && decodedSampleCount == sampleCount && errorRecord.code == DecoderErrorCode::NONE;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a Page with a damaged Body in the last Segment is reported as a hole, when the Stream is decoded in Segments.
+        /// </summary>
+        TEST_METHOD(testSegmentDecodeDamagedPage)
+        {
+            // Arrange
+            unsigned long long sampleCount = 0ULL;
+            std::vector<unsigned char> stream = OggVorbisDecoderUnitTestSupport::EncodeNoise(OggVorbisDecoderUnitTestSupport::SEGMENTED_STREAM_SIZE, sampleCount);
+            const std::vector<OggVorbisDecoderUnitTestSupport::PageLocation> pages = OggVorbisDecoderUnitTestSupport::IndexPages(stream);
+            const OggVorbisDecoderUnitTestSupport::PageLocation& damagedPageRef = pages[(pages.size() * 3U) / 4U];
+            stream[damagedPageRef.offset + damagedPageRef.headerInfo.headerSize + damagedPageRef.headerInfo.bodySize / 2U] ^= 0xFFU;
+            unsigned long long decodedSampleCount = 0ULL;
+            DecoderErrorRecord errorRecord{};
+            bool expected = true;
+
+            // Act
+            long long readResult = OggVorbisDecoderUnitTestSupport::DecodeStream(stream, false, OggVorbisDecoderUnitTestSupport::SEGMENT_THREAD_COUNT, decodedSampleCount, errorRecord);
+            bool actual = readResult == -1LL && errorRecord.code == DecoderErrorCode::OGG_VORBIS_HOLE;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
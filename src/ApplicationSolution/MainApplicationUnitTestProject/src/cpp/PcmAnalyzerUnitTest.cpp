@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "PcmAnalyzer.h"
+#include "PcmAnalyzer.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace PcmAnalyzerUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The layout of the generated 16-bit stereo signal: a silent lead-in, then a DC level holding a clipped run that spans two blocks,
+    /// a single full scale sample (NOT a run), and a negative full scale sample on the left channel only.
+    /// </summary>
+    constexpr auto SAMPLE_RATE = 44100UL;
+    constexpr auto BITS_PER_SAMPLE = 16UL;
+    constexpr auto FRAME_COUNT = 1000UL;
+    constexpr auto SILENT_FRAME_COUNT = 100UL;
+    constexpr auto DC_LEVEL = 1000;
+    constexpr auto CLIPPED_RUN_START = 330UL;
+    constexpr auto CLIPPED_RUN_LENGTH = 6UL;
+    constexpr auto SINGLE_FULL_SCALE_FRAME = 500UL;
+    constexpr auto NEGATIVE_FULL_SCALE_FRAME = 700UL;
+
+    /// <summary>
+    /// Purpose: The number of frames per block. The clipped run starts before the end of the first block.
+    /// </summary>
+    constexpr auto BLOCK_FRAME_COUNT = 333UL;
+
+    /// <summary>
+    /// Purpose: The largest difference accepted between two levels, since the levels are sums of doubles.
+    /// </summary>
+    constexpr auto LEVEL_TOLERANCE = 1e-9;
+
+    void CreateSignal(std::vector<int32_t>& leftSamplesRef, std::vector<int32_t>& rightSamplesRef)
+    {
+        leftSamplesRef.assign(FRAME_COUNT, 0);
+        for (unsigned long frameIndex = SILENT_FRAME_COUNT; frameIndex < FRAME_COUNT; ++frameIndex)
+        {
+            leftSamplesRef[frameIndex] = DC_LEVEL;
+        }
+
+        for (unsigned long frameIndex = CLIPPED_RUN_START; frameIndex < CLIPPED_RUN_START + CLIPPED_RUN_LENGTH; ++frameIndex)
+        {
+            leftSamplesRef[frameIndex] = 32767;
+        }
+
+        leftSamplesRef[SINGLE_FULL_SCALE_FRAME] = 32767;
+        rightSamplesRef = leftSamplesRef;
+        leftSamplesRef[NEGATIVE_FULL_SCALE_FRAME] = -32768;
+    }
+
+    /// <summary>
+    /// Purpose: The DC offset of a channel, relative to full scale.
+    /// </summary>
+    double ComputeDcOffset(const std::vector<int32_t>& samplesRef)
+    {
+        double sum = 0.0;
+        for (const int32_t sample : samplesRef)
+        {
+            sum += sample;
+        }
+
+        return std::fabs(sum / samplesRef.size() / 32768.0);
+    }
+
+    /// <summary>
+    /// Purpose: Checks the metrics of the generated signal.
+    /// </summary>
+    bool IsExpectedResult(const PcmAnalysisResult& resultRef, const std::vector<int32_t>& leftSamplesRef, const std::vector<int32_t>& rightSamplesRef)
+    {
+        const double dcOffset = (std::max)(ComputeDcOffset(leftSamplesRef), ComputeDcOffset(rightSamplesRef));
+        return resultRef.sampleRate == SAMPLE_RATE && resultRef.channelCount == 2UL && resultRef.frameCount == FRAME_COUNT &&
+            std::fabs(resultRef.peak - 1.0) < LEVEL_TOLERANCE && std::fabs(resultRef.dcOffset - dcOffset) < LEVEL_TOLERANCE &&
+            resultRef.clippedRunCount == 2ULL && resultRef.clippedSampleCount == 2ULL * CLIPPED_RUN_LENGTH &&
+            resultRef.silentFrameCount == SILENT_FRAME_COUNT && resultRef.longestSilentRunFrameCount == SILENT_FRAME_COUNT &&
+            !resultRef.isDualMono;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the PCM Analyzer.
+    /// </summary>
+    TEST_CLASS(PcmAnalyzerUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests the peak, DC offset, clipped runs, and silence of planar blocks. A clipped run spanning two blocks is counted once per channel.
+        /// </summary>
+        TEST_METHOD(testAddPlanarMetrics)
+        {
+            // Arrange
+            std::vector<int32_t> leftSamples;
+            std::vector<int32_t> rightSamples;
+            PcmAnalyzerUnitTestSupport::CreateSignal(leftSamples, rightSamples);
+            PcmAnalyzer analyzer(PcmAnalyzerUnitTestSupport::SAMPLE_RATE);
+            bool expected = true;
+
+            // Act
+            for (unsigned long frameIndex = 0UL; frameIndex < PcmAnalyzerUnitTestSupport::FRAME_COUNT; frameIndex += PcmAnalyzerUnitTestSupport::BLOCK_FRAME_COUNT)
+            {
+                const unsigned long frameCount = (std::min)(PcmAnalyzerUnitTestSupport::BLOCK_FRAME_COUNT, PcmAnalyzerUnitTestSupport::FRAME_COUNT - frameIndex);
+                const int32_t* const channelPtrs[] = { leftSamples.data() + frameIndex, rightSamples.data() + frameIndex };
+                analyzer.AddPlanar(channelPtrs, 2UL, frameCount, PcmAnalyzerUnitTestSupport::BITS_PER_SAMPLE);
+            }
+
+            bool actual = PcmAnalyzerUnitTestSupport::IsExpectedResult(analyzer.GetResult(), leftSamples, rightSamples);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that interleaved blocks give the same metrics as planar blocks.
+        /// </summary>
+        TEST_METHOD(testAddInterleavedMetrics)
+        {
+            // Arrange
+            std::vector<int32_t> leftSamples;
+            std::vector<int32_t> rightSamples;
+            PcmAnalyzerUnitTestSupport::CreateSignal(leftSamples, rightSamples);
+            std::vector<int32_t> interleavedSamples;
+            for (unsigned long frameIndex = 0UL; frameIndex < PcmAnalyzerUnitTestSupport::FRAME_COUNT; ++frameIndex)
+            {
+                interleavedSamples.push_back(leftSamples[frameIndex]);
+                interleavedSamples.push_back(rightSamples[frameIndex]);
+            }
+
+            PcmAnalyzer analyzer(PcmAnalyzerUnitTestSupport::SAMPLE_RATE);
+            bool expected = true;
+
+            // Act
+            for (unsigned long frameIndex = 0UL; frameIndex < PcmAnalyzerUnitTestSupport::FRAME_COUNT; frameIndex += PcmAnalyzerUnitTestSupport::BLOCK_FRAME_COUNT)
+            {
+                const unsigned long frameCount = (std::min)(PcmAnalyzerUnitTestSupport::BLOCK_FRAME_COUNT, PcmAnalyzerUnitTestSupport::FRAME_COUNT - frameIndex);
+                analyzer.AddInterleaved(interleavedSamples.data() + 2UL * frameIndex, 2UL, frameCount, PcmAnalyzerUnitTestSupport::BITS_PER_SAMPLE);
+            }
+
+            bool actual = PcmAnalyzerUnitTestSupport::IsExpectedResult(analyzer.GetResult(), leftSamples, rightSamples);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that equal channels are reported as dual mono, but a silent File is NOT.
+        /// </summary>
+        TEST_METHOD(testDualMono)
+        {
+            // Arrange
+            const std::vector<float> samples{ 0.0f, 0.25f, -0.5f, 0.125f, 0.0f, -0.75f };
+            const std::vector<float> silence(samples.size(), 0.0f);
+            const float* const dualMonoChannelPtrs[] = { samples.data(), samples.data() };
+            const float* const silentChannelPtrs[] = { silence.data(), silence.data() };
+            PcmAnalyzer dualMonoAnalyzer(PcmAnalyzerUnitTestSupport::SAMPLE_RATE);
+            PcmAnalyzer silentAnalyzer(PcmAnalyzerUnitTestSupport::SAMPLE_RATE);
+            bool expected = true;
+
+            // Act
+            dualMonoAnalyzer.AddPlanar(dualMonoChannelPtrs, 2UL, static_cast<unsigned long>(samples.size()));
+            silentAnalyzer.AddPlanar(silentChannelPtrs, 2UL, static_cast<unsigned long>(silence.size()));
+            PcmAnalysisResult dualMonoResult = dualMonoAnalyzer.GetResult();
+            PcmAnalysisResult silentResult = silentAnalyzer.GetResult();
+            bool actual = dualMonoResult.isDualMono && std::fabs(dualMonoResult.peak - 0.75) < PcmAnalyzerUnitTestSupport::LEVEL_TOLERANCE &&
+                dualMonoResult.silentFrameCount == 2ULL && dualMonoResult.longestSilentRunFrameCount == 1ULL &&
+                !silentResult.isDualMono && silentResult.silentFrameCount == silence.size();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
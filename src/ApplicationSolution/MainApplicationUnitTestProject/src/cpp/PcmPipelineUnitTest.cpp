@@ -0,0 +1,251 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "PcmPipeline.h"
+#include "PcmPipeline.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace PcmPipelineUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The number of interleaved channels written to the Pipeline.
+    /// </summary>
+    constexpr auto CHANNEL_COUNT = 2UL;
+
+    /// <summary>
+    /// Purpose: The number of Frames written per call, in turn. Includes a Frame larger than a Pipeline Block.
+    /// </summary>
+    constexpr unsigned long FRAME_SIZES[] = { 4096UL, 1152UL, 16UL, 65535UL, 4608UL, 40000UL };
+
+    /// <summary>
+    /// Purpose: The number of Blocks written before a Pipeline is destroyed without being flushed, and the time the consumer function takes per Block.
+    /// </summary>
+    constexpr auto CANCELLED_BLOCK_COUNT = 6UL;
+    constexpr auto SLOW_CONSUMER_DELAY_MILLISECONDS = 20;
+
+    /// <summary>
+    /// Purpose: Creates numbered interleaved samples.
+    /// </summary>
+    std::vector<int32_t> CreateSamples(size_t sampleCount, int32_t firstValue)
+    {
+        std::vector<int32_t> samples(sampleCount);
+        for (size_t i = 0U; i < sampleCount; ++i)
+        {
+            samples[i] = firstValue + static_cast<int32_t>(i);
+        }
+
+        return samples;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the PCM Pipeline.
+    /// </summary>
+    TEST_CLASS(PcmPipelineUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests that Flush() waits until every written sample has been consumed, in order, on the Pipeline Thread.
+        /// </summary>
+        TEST_METHOD(testFlushConsumesEverySample)
+        {
+            // Arrange
+            std::vector<int32_t> consumedSamples;
+            bool consumedOnCallingThread = false;
+            const std::thread::id callingThreadId = std::this_thread::get_id();
+            std::vector<int32_t> writtenSamples;
+            bool expected = true;
+
+            // Act
+            {
+                PcmPipeline pipeline([&consumedSamples, &consumedOnCallingThread, callingThreadId](int32_t* samplePtr, size_t sampleCount)
+                {
+                    consumedOnCallingThread = consumedOnCallingThread || (std::this_thread::get_id() == callingThreadId);
+                    consumedSamples.insert(consumedSamples.end(), samplePtr, samplePtr + sampleCount);
+                });
+
+                for (const unsigned long frameCount : PcmPipelineUnitTestSupport::FRAME_SIZES)
+                {
+                    const std::vector<int32_t> samples = PcmPipelineUnitTestSupport::CreateSamples(frameCount * PcmPipelineUnitTestSupport::CHANNEL_COUNT, static_cast<int32_t>(writtenSamples.size()));
+                    pipeline.Write(samples.data(), samples.size());
+                    writtenSamples.insert(writtenSamples.end(), samples.begin(), samples.end());
+                }
+
+                pipeline.Flush();
+            }
+
+            bool actual = (consumedSamples == writtenSamples) && !consumedOnCallingThread;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that planar samples are interleaved in channel order.
+        /// </summary>
+        TEST_METHOD(testWritePlanar)
+        {
+            // Arrange
+            const std::vector<int32_t> leftSamples{ 1, 3, 5, 7 };
+            const std::vector<int32_t> rightSamples{ 2, 4, 6, 8 };
+            const int32_t* const channelPtrs[] = { leftSamples.data(), rightSamples.data() };
+            std::vector<int32_t> consumedSamples;
+            const std::vector<int32_t> interleavedSamples{ 1, 2, 3, 4, 5, 6, 7, 8 };
+            bool expected = true;
+
+            // Act
+            {
+                PcmPipeline pipeline([&consumedSamples](int32_t* samplePtr, size_t sampleCount) { consumedSamples.insert(consumedSamples.end(), samplePtr, samplePtr + sampleCount); });
+                pipeline.WritePlanar(channelPtrs, PcmPipelineUnitTestSupport::CHANNEL_COUNT, static_cast<unsigned long>(leftSamples.size()));
+                pipeline.Flush();
+            }
+
+            bool actual = (consumedSamples == interleavedSamples);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests destroying a Pipeline without Flush(), while its consumer function is still busy (e.g. a decode that was stopped part way through the File).
+        /// The destructor must return, the samples NOT yet consumed are discarded, and the consumer function is NOT called afterwards.
+        /// </summary>
+        TEST_METHOD(testDestructionWithoutFlush)
+        {
+            // Arrange
+            std::atomic<size_t> consumedSampleCount{ 0U };
+            const std::vector<int32_t> samples = PcmPipelineUnitTestSupport::CreateSamples(PCM_PIPELINE_BLOCK_SAMPLE_COUNT, 0);
+            bool expected = true;
+
+            // Act
+            {
+                PcmPipeline pipeline([&consumedSampleCount](int32_t* samplePtr, size_t sampleCount)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(PcmPipelineUnitTestSupport::SLOW_CONSUMER_DELAY_MILLISECONDS));
+                    consumedSampleCount += sampleCount;
+                });
+
+                for (unsigned long i = 0UL; i < PcmPipelineUnitTestSupport::CANCELLED_BLOCK_COUNT; ++i)
+                {
+                    pipeline.Write(samples.data(), samples.size());
+                }
+            }
+
+            const size_t consumedSampleCountAtDestruction = consumedSampleCount;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2 * PcmPipelineUnitTestSupport::SLOW_CONSUMER_DELAY_MILLISECONDS));
+            bool actual = (consumedSampleCountAtDestruction < PcmPipelineUnitTestSupport::CANCELLED_BLOCK_COUNT * samples.size())
+                && (consumedSampleCountAtDestruction % samples.size() == 0U)
+                && (consumedSampleCount == consumedSampleCountAtDestruction);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests destroying a Pipeline that was never written to.
+        /// </summary>
+        TEST_METHOD(testDestructionWithoutWrite)
+        {
+            // Arrange
+            bool consumerWasCalled = false;
+            bool expected = false;
+
+            // Act
+            {
+                PcmPipeline pipeline([&consumerWasCalled](int32_t* samplePtr, size_t sampleCount) { consumerWasCalled = true; });
+            }
+
+            bool actual = consumerWasCalled;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that the Pipelines created in turn on a Thread with a registered Worker share its Pipeline Thread, 
+        /// and that a Pipeline created while the Worker is used gets its own Pipeline Thread.
+        /// </summary>
+        TEST_METHOD(testWorkerIsReused)
+        {
+            // Arrange
+            const std::vector<int32_t> samples = PcmPipelineUnitTestSupport::CreateSamples(PcmPipelineUnitTestSupport::CHANNEL_COUNT, 0);
+            std::thread::id consumingThreadIds[3]{};
+            bool expected = true;
+
+            // Act
+            {
+                PcmPipelineWorker worker;
+                PcmPipelineWorker::SetCurrentThreadWorker(&worker);
+                for (std::thread::id& consumingThreadIdRef : consumingThreadIds)
+                {
+                    PcmPipeline pipeline([&consumingThreadIdRef](int32_t* samplePtr, size_t sampleCount) { consumingThreadIdRef = std::this_thread::get_id(); });
+                    pipeline.Write(samples.data(), samples.size());
+                    pipeline.Flush();
+
+                    if (&consumingThreadIdRef == &consumingThreadIds[1])
+                    {
+                        // The Worker is still used by the first Pipeline.
+                        PcmPipeline otherPipeline([&consumingThreadIds](int32_t* samplePtr, size_t sampleCount) { consumingThreadIds[2] = std::this_thread::get_id(); });
+                        otherPipeline.Write(samples.data(), samples.size());
+                        otherPipeline.Flush();
+                        break;
+                    }
+                }
+                PcmPipelineWorker::SetCurrentThreadWorker(nullptr);
+            }
+
+            bool actual = (consumingThreadIds[0] == consumingThreadIds[1]) && (consumingThreadIds[2] != consumingThreadIds[1]) && (consumingThreadIds[2] != std::thread::id());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that the samples discarded by a Pipeline destroyed without Flush() are NOT passed to the next Pipeline using the same Worker.
+        /// </summary>
+        TEST_METHOD(testWorkerIsReusedAfterDestructionWithoutFlush)
+        {
+            // Arrange
+            const std::vector<int32_t> discardedSamples = PcmPipelineUnitTestSupport::CreateSamples(PCM_PIPELINE_BLOCK_SAMPLE_COUNT, 0);
+            const std::vector<int32_t> writtenSamples = PcmPipelineUnitTestSupport::CreateSamples(PcmPipelineUnitTestSupport::FRAME_SIZES[0] * PcmPipelineUnitTestSupport::CHANNEL_COUNT, -1);
+            std::vector<int32_t> consumedSamples;
+            bool expected = true;
+
+            // Act
+            {
+                PcmPipelineWorker worker;
+                PcmPipelineWorker::SetCurrentThreadWorker(&worker);
+                {
+                    PcmPipeline pipeline([](int32_t* samplePtr, size_t sampleCount)
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(PcmPipelineUnitTestSupport::SLOW_CONSUMER_DELAY_MILLISECONDS));
+                    });
+
+                    for (unsigned long i = 0UL; i < PcmPipelineUnitTestSupport::CANCELLED_BLOCK_COUNT; ++i)
+                    {
+                        pipeline.Write(discardedSamples.data(), discardedSamples.size());
+                    }
+                }
+                {
+                    PcmPipeline pipeline([&consumedSamples](int32_t* samplePtr, size_t sampleCount) { consumedSamples.insert(consumedSamples.end(), samplePtr, samplePtr + sampleCount); });
+                    pipeline.Write(writtenSamples.data(), writtenSamples.size());
+                    pipeline.Flush();
+                }
+                PcmPipelineWorker::SetCurrentThreadWorker(nullptr);
+            }
+
+            bool actual = (consumedSamples == writtenSamples);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
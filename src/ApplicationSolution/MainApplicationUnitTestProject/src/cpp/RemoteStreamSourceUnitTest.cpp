@@ -0,0 +1,275 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "LocalHttpServer.h"
+#include "RemoteStreamSource.h"
+#include "RemoteStreamSource.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace RemoteStreamSourceUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The size of the object, which is NOT a multiple of the range size, so its last range is shorter.
+    /// </summary>
+    constexpr auto OBJECT_SIZE = 1000003UL;
+
+    /// <summary>
+    /// Purpose: The range request settings. The injected latency makes the loopback server behave like a distant object gateway,
+    /// so the ranges are still in flight when they are read.
+    /// </summary>
+    constexpr auto RANGE_SIZE = 65536UL;
+    constexpr auto PREFETCH_RANGE_COUNT = 4UL;
+    constexpr auto WINDOW_RANGE_COUNT = 6UL;
+    constexpr auto INJECTED_LATENCY_MILLISECONDS = 20UL;
+
+    /// <summary>
+    /// Purpose: The size of each Read(), which is NOT a divisor of the range size, so reads span two ranges.
+    /// </summary>
+    constexpr auto READ_SIZE = 10007UL;
+
+    /// <summary>
+    /// Purpose: Generates the bytes of an object. Each seed gives different bytes.
+    /// </summary>
+    std::vector<unsigned char> CreateObject(unsigned long seed)
+    {
+        std::vector<unsigned char> object(OBJECT_SIZE);
+        unsigned long state = seed;
+        for (unsigned char& byteRef : object)
+        {
+            state = state * 1664525UL + 1013904223UL;
+            byteRef = static_cast<unsigned char>(state >> 24);
+        }
+
+        return object;
+    }
+
+    void Configure()
+    {
+        RemoteStreamSettings settings{};
+        settings.rangeSize = RANGE_SIZE;
+        settings.prefetchRangeCount = PREFETCH_RANGE_COUNT;
+        settings.windowRangeCount = WINDOW_RANGE_COUNT;
+        settings.injectedLatencyMilliseconds = INJECTED_LATENCY_MILLISECONDS;
+        RemoteStreamSource::Configure(settings);
+    }
+
+    /// <summary>
+    /// Purpose: Reads from the position to the end of the File, one Read() at a time.
+    /// </summary>
+    std::vector<unsigned char> ReadToEnd(RemoteStreamSource& sourceRef)
+    {
+        std::vector<unsigned char> data;
+        std::vector<unsigned char> buffer(READ_SIZE);
+        size_t bytesRead = 0U;
+        do
+        {
+            bytesRead = sourceRef.Read(buffer.data(), buffer.size());
+            data.insert(data.end(), buffer.begin(), buffer.begin() + bytesRead);
+        } while (bytesRead == buffer.size());
+
+        return data;
+    }
+
+    /// <summary>
+    /// Purpose: Seeks, then reads a part of the File, and compares it with the object.
+    /// </summary>
+    bool SeekAndRead(RemoteStreamSource& sourceRef, const std::vector<unsigned char>& objectRef, long long offset, int origin, size_t size, size_t expectedPosition)
+    {
+        std::vector<unsigned char> buffer(size);
+        const size_t expectedSize = (expectedPosition + size <= objectRef.size()) ? size : objectRef.size() - expectedPosition;
+        return sourceRef.Seek(offset, origin) == 0 && sourceRef.Tell() == static_cast<long long>(expectedPosition) &&
+            sourceRef.Read(buffer.data(), size) == expectedSize &&
+            std::equal(buffer.begin(), buffer.begin() + expectedSize, objectRef.begin() + expectedPosition);
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the Remote Stream Source, read from a local stand-in server.
+    /// </summary>
+    TEST_CLASS(RemoteStreamSourceUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests reading the File from start to end. Every range is requested with a Range header, and the File ends at its length.
+        /// </summary>
+        TEST_METHOD(testSequentialRead)
+        {
+            // Arrange
+            RemoteStreamSourceUnitTestSupport::Configure();
+            const std::vector<unsigned char> object = RemoteStreamSourceUnitTestSupport::CreateObject(1UL);
+            LocalHttpServer server;
+            RemoteStreamSource source;
+            bool expected = true;
+
+            // Act
+            bool actual = server.Start(object) && source.Open(server.GetObjectUrl().c_str()) && source.Length() == static_cast<long long>(object.size());
+            actual = actual && RemoteStreamSourceUnitTestSupport::ReadToEnd(source) == object && source.EndOfFile() && source.Tell() == source.Length() &&
+                server.GetFullResponseCount() == 0UL && server.GetPartialResponseCount() >= (object.size() + RemoteStreamSourceUnitTestSupport::RANGE_SIZE - 1UL) / RemoteStreamSourceUnitTestSupport::RANGE_SIZE;
+            source.Close();
+            server.Stop();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests seeking forwards beyond the window, backwards to a dropped range, and from the end. A seek beyond the end fails.
+        /// </summary>
+        TEST_METHOD(testSeekAndRead)
+        {
+            // Arrange
+            RemoteStreamSourceUnitTestSupport::Configure();
+            const std::vector<unsigned char> object = RemoteStreamSourceUnitTestSupport::CreateObject(2UL);
+            LocalHttpServer server;
+            RemoteStreamSource source;
+            bool expected = true;
+
+            // Act
+            bool actual = server.Start(object) && source.Open(server.GetObjectUrl().c_str()) &&
+                RemoteStreamSourceUnitTestSupport::SeekAndRead(source, object, 900000LL, SEEK_SET, 70000U, 900000U) &&
+                RemoteStreamSourceUnitTestSupport::SeekAndRead(source, object, -870000LL, SEEK_CUR, 5000U, 100000U) &&
+                RemoteStreamSourceUnitTestSupport::SeekAndRead(source, object, -10LL, SEEK_END, 100U, object.size() - 10U) &&
+                source.EndOfFile() && source.Seek(1LL, SEEK_END) != 0 && source.Seek(-1LL, SEEK_SET) != 0 &&
+                RemoteStreamSourceUnitTestSupport::SeekAndRead(source, object, 0LL, SEEK_SET, 3U, 0U) && !source.EndOfFile();
+            source.Close();
+            server.Stop();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests fetching the entire File into a Buffer.
+        /// </summary>
+        TEST_METHOD(testReadAll)
+        {
+            // Arrange
+            RemoteStreamSourceUnitTestSupport::Configure();
+            const std::vector<unsigned char> object = RemoteStreamSourceUnitTestSupport::CreateObject(3UL);
+            LocalHttpServer server;
+            RemoteStreamSource source;
+            std::vector<unsigned char> data(object.size());
+            bool expected = true;
+
+            // Act
+            bool actual = server.Start(object) && source.Open(server.GetObjectUrl().c_str()) && source.ReadAll(data.data()) && data == object;
+            source.Close();
+            server.Stop();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests a server that ignores the Range header. The whole File, returned by the first request (200), is kept as a single range.
+        /// </summary>
+        TEST_METHOD(testRangeIgnored)
+        {
+            // Arrange
+            RemoteStreamSourceUnitTestSupport::Configure();
+            const std::vector<unsigned char> object = RemoteStreamSourceUnitTestSupport::CreateObject(4UL);
+            LocalHttpServer server;
+            RemoteStreamSource source;
+            std::vector<unsigned char> data(object.size());
+            bool expected = true;
+
+            // Act
+            server.SetRangeSupport(false);
+            bool actual = server.Start(object) && source.Open(server.GetObjectUrl().c_str()) && source.Length() == static_cast<long long>(object.size()) &&
+                source.ReadAll(data.data()) && data == object &&
+                RemoteStreamSourceUnitTestSupport::SeekAndRead(source, object, 500000LL, SEEK_SET, 200000U, 500000U) &&
+                RemoteStreamSourceUnitTestSupport::SeekAndRead(source, object, 0LL, SEEK_SET, 1000U, 0U) &&
+                server.GetFullResponseCount() == 1UL && server.GetPartialResponseCount() == 0UL;
+            source.Close();
+            server.Stop();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests a File replaced on the server (with the same length) while it is read. The ranges requested afterwards do NOT match the If-Range validator,
+        /// so they fail instead of mixing the bytes of two versions. The File opened again reads the new version.
+        /// </summary>
+        TEST_METHOD(testReplacedObject)
+        {
+            // Arrange
+            RemoteStreamSourceUnitTestSupport::Configure();
+            const std::vector<unsigned char> object = RemoteStreamSourceUnitTestSupport::CreateObject(5UL);
+            const std::vector<unsigned char> newObject = RemoteStreamSourceUnitTestSupport::CreateObject(6UL);
+            LocalHttpServer server;
+            RemoteStreamSource source;
+            std::vector<unsigned char> buffer(RemoteStreamSourceUnitTestSupport::READ_SIZE);
+            std::vector<unsigned char> data(object.size());
+            bool expected = true;
+
+            // Act
+            bool actual = server.Start(object) && source.Open(server.GetObjectUrl().c_str()) &&
+                RemoteStreamSourceUnitTestSupport::SeekAndRead(source, object, 0LL, SEEK_SET, 1000U, 0U);
+            server.ReplaceObject(newObject);
+            actual = actual && source.Seek(800000LL, SEEK_SET) == 0 && source.Read(buffer.data(), buffer.size()) == 0U && source.EndOfFile() &&
+                !source.ReadAll(data.data()) && source.Open(server.GetObjectUrl().c_str()) && RemoteStreamSourceUnitTestSupport::ReadToEnd(source) == newObject;
+            source.Close();
+            server.Stop();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests a File replaced on a server that ignores If-Range, which still returns ranges (206) of the new version.
+        /// Their ETag does NOT match the validator, so they fail.
+        /// </summary>
+        TEST_METHOD(testReplacedObjectIfRangeIgnored)
+        {
+            // Arrange
+            RemoteStreamSourceUnitTestSupport::Configure();
+            const std::vector<unsigned char> object = RemoteStreamSourceUnitTestSupport::CreateObject(8UL);
+            LocalHttpServer server;
+            RemoteStreamSource source;
+            std::vector<unsigned char> buffer(RemoteStreamSourceUnitTestSupport::READ_SIZE);
+            bool expected = true;
+
+            // Act
+            server.SetIfRangeSupport(false);
+            bool actual = server.Start(object) && source.Open(server.GetObjectUrl().c_str());
+            server.ReplaceObject(RemoteStreamSourceUnitTestSupport::CreateObject(9UL));
+            const unsigned long partialResponseCount = server.GetPartialResponseCount();
+            actual = actual && source.Seek(600000LL, SEEK_SET) == 0 && source.Read(buffer.data(), buffer.size()) == 0U &&
+                server.GetPartialResponseCount() > partialResponseCount && server.GetFullResponseCount() == 0UL;
+            source.Close();
+            server.Stop();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a File that is NOT found on the server is NOT opened, and can NOT be read.
+        /// </summary>
+        TEST_METHOD(testMissingObject)
+        {
+            // Arrange
+            RemoteStreamSourceUnitTestSupport::Configure();
+            LocalHttpServer server;
+            RemoteStreamSource source;
+            unsigned char buffer[16]{};
+            bool expected = false;
+
+            // Act
+            bool actual = !server.Start(RemoteStreamSourceUnitTestSupport::CreateObject(7UL)) || source.Open(server.GetMissingUrl().c_str()) ||
+                source.Read(buffer, sizeof(buffer)) != 0U;
+            server.Stop();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
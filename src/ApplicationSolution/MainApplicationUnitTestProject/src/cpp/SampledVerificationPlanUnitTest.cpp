@@ -0,0 +1,128 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <vector>
+#include "SampledVerificationPlan.h"
+#include "SampledVerificationPlan.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SampledVerificationPlanUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The range the Windows are chosen from, and the number of Windows.
+    /// </summary>
+    constexpr auto RANGE_START = 1000ULL;
+    constexpr auto RANGE_END = 1000000ULL;
+    constexpr auto WINDOW_COUNT = 59UL;
+
+    /// <summary>
+    /// Purpose: Takes every Window of a plan.
+    /// </summary>
+    std::vector<unsigned long long> TakeWindows(SampledVerificationPlan& planRef)
+    {
+        std::vector<unsigned long long> positions;
+        unsigned long long position = 0ULL;
+        while (planRef.NextWindow(position))
+        {
+            positions.push_back(position);
+        }
+
+        return positions;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for choosing the Windows of a sampled File.
+    /// </summary>
+    TEST_CLASS(SampledVerificationPlanUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests the number of Windows needed to find damage to 5% of a File with 95% confidence, and the limits.
+        /// </summary>
+        TEST_METHOD(testCalculateWindowCount)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            bool actual = (SampledVerificationPlan::CalculateWindowCount(0.95, 0.05) == SampledVerificationPlanUnitTestSupport::WINDOW_COUNT)
+                && (SampledVerificationPlan::CalculateWindowCount(0.0, 0.05) == 1UL)
+                && (SampledVerificationPlan::CalculateWindowCount(0.95, 1.0) == 1UL)
+                && (SampledVerificationPlan::CalculateWindowCount(1.0, 0.05) == 0xFFFFFFFFUL);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that one Window is chosen within each stratum, in ascending order, starting at the start of the range.
+        /// </summary>
+        TEST_METHOD(testConfigure)
+        {
+            // Arrange
+            SampledVerificationPlan plan;
+            const unsigned long long rangeSize = SampledVerificationPlanUnitTestSupport::RANGE_END - SampledVerificationPlanUnitTestSupport::RANGE_START;
+            bool expected = true;
+
+            // Act
+            bool actual = plan.Configure(SampledVerificationPlanUnitTestSupport::WINDOW_COUNT, SampledVerificationPlanUnitTestSupport::RANGE_START, SampledVerificationPlanUnitTestSupport::RANGE_END) && plan.IsEnabled();
+            const std::vector<unsigned long long> positions = SampledVerificationPlanUnitTestSupport::TakeWindows(plan);
+            actual = actual && (positions.size() == SampledVerificationPlanUnitTestSupport::WINDOW_COUNT) && (positions.front() == SampledVerificationPlanUnitTestSupport::RANGE_START);
+            for (size_t windowIndex = 0U; actual && windowIndex < positions.size(); ++windowIndex)
+            {
+                const unsigned long long stratumStart = SampledVerificationPlanUnitTestSupport::RANGE_START + rangeSize * windowIndex / SampledVerificationPlanUnitTestSupport::WINDOW_COUNT;
+                const unsigned long long stratumEnd = SampledVerificationPlanUnitTestSupport::RANGE_START + rangeSize * (windowIndex + 1U) / SampledVerificationPlanUnitTestSupport::WINDOW_COUNT;
+                actual = (positions[windowIndex] >= stratumStart) && (positions[windowIndex] < stratumEnd);
+            }
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that the number of Windows is limited to the size of the range, and that an empty range is NOT sampled.
+        /// </summary>
+        TEST_METHOD(testConfigureSmallRange)
+        {
+            // Arrange
+            SampledVerificationPlan plan;
+            const std::vector<unsigned long long> everyPosition{ 10ULL, 11ULL, 12ULL };
+            bool expected = true;
+
+            // Act
+            bool actual = plan.Configure(SampledVerificationPlanUnitTestSupport::WINDOW_COUNT, 10ULL, 13ULL) && (SampledVerificationPlanUnitTestSupport::TakeWindows(plan) == everyPosition);
+            actual = actual && !plan.Configure(SampledVerificationPlanUnitTestSupport::WINDOW_COUNT, 10ULL, 10ULL) && !plan.IsEnabled();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that the progress of all of the Windows adds up to the total.
+        /// </summary>
+        TEST_METHOD(testGetWindowProgressUnits)
+        {
+            // Arrange
+            SampledVerificationPlan plan;
+            const unsigned long long total = 1000003ULL;
+            unsigned long long progress = 0ULL;
+            bool expected = true;
+
+            // Act
+            plan.Configure(SampledVerificationPlanUnitTestSupport::WINDOW_COUNT, SampledVerificationPlanUnitTestSupport::RANGE_START, SampledVerificationPlanUnitTestSupport::RANGE_END);
+            unsigned long long position = 0ULL;
+            while (plan.NextWindow(position))
+            {
+                progress += plan.GetWindowProgressUnits(total);
+            }
+            bool actual = (progress == total);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
@@ -0,0 +1,208 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <string>
+#include <vector>
+#include "FileHasher.h"
+#include "FileHasher.cpp"
+#include "SidecarManifest.h"
+#include "SidecarManifest.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SidecarManifestUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The contents of the listed File, and its checksums: the standard check string, whose MD5 and CRC32 are well known.
+    /// </summary>
+    constexpr auto FILE_CONTENTS = "123456789";
+    constexpr auto FILE_MD5 = "25f9e794323b453885f5181f1b624d0b";
+    constexpr auto FILE_CRC32 = "CBF43926";
+
+    /// <summary>
+    /// Purpose: A FLAC MD5 signature, as listed in a .ffp manifest.
+    /// </summary>
+    constexpr auto FLAC_SIGNATURE = "00112233445566778899aabbccddeeff";
+
+    /// <summary>
+    /// Purpose: Writes a manifest to the Temporary Folder.
+    /// </summary>
+    std::wstring CreateManifest(const std::string& textRef, const wchar_t* extensionPtr)
+    {
+        return UnitTestFixture::CreateTemporaryFile(std::vector<unsigned char>(textRef.begin(), textRef.end()), extensionPtr);
+    }
+
+    /// <summary>
+    /// Purpose: Gets the Folder of a File, including its trailing separator.
+    /// </summary>
+    std::wstring GetFolderPath(const std::wstring& filenameRef)
+    {
+        return filenameRef.substr(0, filenameRef.find_last_of(L"\\/") + 1);
+    }
+
+    /// <summary>
+    /// Purpose: Computes the checksums of FILE_CONTENTS.
+    /// </summary>
+    FileDigests ComputeDigests(unsigned int algorithmMask)
+    {
+        FileHasher hasher(algorithmMask);
+        const std::string contents(FILE_CONTENTS);
+        hasher.Update(reinterpret_cast<const unsigned char*>(contents.data()), contents.size());
+        return hasher.Finish();
+    }
+
+    /// <summary>
+    /// Purpose: Converts the bytes of a checksum to lower case hexadecimal digits.
+    /// </summary>
+    std::string ToHex(const unsigned char* digestPtr, size_t digestSize)
+    {
+        constexpr char HEX_DIGITS[] = "0123456789abcdef";
+        std::string text;
+        for (size_t i = 0U; i < digestSize; ++i)
+        {
+            text.push_back(HEX_DIGITS[digestPtr[i] >> 4]);
+            text.push_back(HEX_DIGITS[digestPtr[i] & 0x0FU]);
+        }
+
+        return text;
+    }
+
+    bool ResultEquals(const SidecarEntryResult& resultRef, const std::wstring& filenameRef, const std::wstring& manifestFilenameRef, FileHashAlgorithm algorithm, SidecarVerdict verdict)
+    {
+        return resultRef.filename == filenameRef && resultRef.manifestFilename == manifestFilenameRef && resultRef.algorithm == algorithm && resultRef.verdict == verdict;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the sidecar manifests.
+    /// </summary>
+    TEST_CLASS(SidecarManifestUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests parsing a .md5 manifest, holding GNU binary and text mode lines, a BSD line, comments, and a line that is NOT valid.
+        /// The filenames are relative to the Folder of the manifest, and the results are sorted by filename (NOT case sensitive).
+        /// </summary>
+        TEST_METHOD(testParseMd5Manifest)
+        {
+            // Arrange
+            SidecarManifest::Clear();
+            const std::string md5 = SidecarManifestUnitTestSupport::FILE_MD5;
+            const std::string text = std::string("\xEF\xBB\xBF# md5sum\r\n; comment\r\n") +
+                md5 + " *album/01 Track.flac\r\n" +
+                "  " + md5 + "  02 Track.flac  \r\n" +
+                "MD5 (./03 Track.flac) = " + md5 + "\r\n" +
+                "NOT A CHECKSUM  04 Track.flac\r\n" +
+                md5.substr(2) + "  05 Track.flac\n\n";
+            const std::wstring manifestFilename = SidecarManifestUnitTestSupport::CreateManifest(text, L".md5");
+            const std::wstring folderPath = SidecarManifestUnitTestSupport::GetFolderPath(manifestFilename);
+            bool expected = true;
+
+            // Act
+            bool actual = SidecarManifest::AddManifest(manifestFilename.c_str()) && SidecarManifest::AddManifest(manifestFilename.c_str());
+            std::vector<SidecarEntryResult> results = SidecarManifest::GetResults();
+            actual = actual && results.size() == 3U &&
+                SidecarManifestUnitTestSupport::ResultEquals(results[0], folderPath + L"02 Track.flac", manifestFilename, FileHashAlgorithm::MD5, SidecarVerdict::NOT_VERIFIED) &&
+                SidecarManifestUnitTestSupport::ResultEquals(results[1], folderPath + L"03 Track.flac", manifestFilename, FileHashAlgorithm::MD5, SidecarVerdict::NOT_VERIFIED) &&
+                SidecarManifestUnitTestSupport::ResultEquals(results[2], folderPath + L"album\\01 Track.flac", manifestFilename, FileHashAlgorithm::MD5, SidecarVerdict::NOT_VERIFIED);
+            SidecarManifest::Clear();
+            DeleteFileW(manifestFilename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests verifying a File listed by a .md5 and a .sfv manifest. Its pending checksums are found without regard to case,
+        /// and are NOT pending once recorded. A File whose CRC32 differs is a mismatch.
+        /// </summary>
+        TEST_METHOD(testRecordDigests)
+        {
+            // Arrange
+            SidecarManifest::Clear();
+            const std::string md5Text = std::string(SidecarManifestUnitTestSupport::FILE_MD5) + " *01 Track.flac\n";
+            const std::string sfvText = std::string("; Generated by a CRC tool\n01 track.flac ") + SidecarManifestUnitTestSupport::FILE_CRC32 + "\nSecond Track.flac 00000000\n";
+            const std::wstring md5Filename = SidecarManifestUnitTestSupport::CreateManifest(md5Text, L".md5");
+            const std::wstring sfvFilename = SidecarManifestUnitTestSupport::CreateManifest(sfvText, L".sfv");
+            const std::wstring folderPath = SidecarManifestUnitTestSupport::GetFolderPath(md5Filename);
+            const std::wstring filename = folderPath + L"01 TRACK.FLAC";
+            const unsigned int expectedMask = FileHasher::GetAlgorithmMask(FileHashAlgorithm::MD5) | FileHasher::GetAlgorithmMask(FileHashAlgorithm::CRC32);
+            bool expected = true;
+
+            // Act
+            bool actual = SidecarManifest::AddManifest(md5Filename.c_str()) && SidecarManifest::AddManifest(sfvFilename.c_str());
+            const unsigned int pendingMask = SidecarManifest::GetPendingAlgorithmMask(filename.c_str());
+            const FileDigests digests = SidecarManifestUnitTestSupport::ComputeDigests(pendingMask);
+            SidecarManifest::RecordDigests(filename.c_str(), digests);
+            SidecarManifest::RecordDigests((folderPath + L"Second Track.flac").c_str(), digests);
+            std::vector<SidecarEntryResult> results = SidecarManifest::GetResults();
+            actual = actual && pendingMask == expectedMask && SidecarManifest::GetPendingAlgorithmMask(filename.c_str()) == 0U &&
+                SidecarManifestUnitTestSupport::ToHex(digests.md5, sizeof(digests.md5)) == SidecarManifestUnitTestSupport::FILE_MD5 && results.size() == 3U &&
+                results[0].verdict == SidecarVerdict::MATCH && results[1].verdict == SidecarVerdict::MATCH &&
+                results[0].algorithm != results[1].algorithm &&
+                SidecarManifestUnitTestSupport::ResultEquals(results[2], folderPath + L"Second Track.flac", sfvFilename, FileHashAlgorithm::CRC32, SidecarVerdict::MISMATCH);
+            SidecarManifest::Clear();
+            DeleteFileW(md5Filename.c_str());
+            DeleteFileW(sfvFilename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests a .ffp manifest. A File without a FLAC STREAMINFO Block leaves its entry NOT verified (and still pending), so the Decoder reports it.
+        /// </summary>
+        TEST_METHOD(testFlacSignatureManifest)
+        {
+            // Arrange
+            SidecarManifest::Clear();
+            const std::string ffpText = std::string("01 Track.flac:") + SidecarManifestUnitTestSupport::FLAC_SIGNATURE + "\r\n";
+            const std::wstring ffpFilename = SidecarManifestUnitTestSupport::CreateManifest(ffpText, L".ffp");
+            const std::wstring filename = SidecarManifestUnitTestSupport::GetFolderPath(ffpFilename) + L"01 Track.flac";
+            FileDigests unknownDigests{};
+            FileDigests knownDigests{};
+            knownDigests.flacSignatureIsKnown = true;
+            for (size_t i = 0U; i < sizeof(knownDigests.flacSignature); ++i)
+            {
+                knownDigests.flacSignature[i] = static_cast<unsigned char>(0x11U * i);
+            }
+
+            bool expected = true;
+
+            // Act
+            bool actual = SidecarManifest::AddManifest(ffpFilename.c_str());
+            SidecarManifest::RecordDigests(filename.c_str(), unknownDigests);
+            actual = actual && SidecarManifest::GetResults().size() == 1U && SidecarManifest::GetResults()[0].verdict == SidecarVerdict::NOT_VERIFIED &&
+                SidecarManifest::GetPendingAlgorithmMask(filename.c_str()) == FileHasher::GetAlgorithmMask(FileHashAlgorithm::FLAC_SIGNATURE);
+            SidecarManifest::RecordDigests(filename.c_str(), knownDigests);
+            actual = actual && SidecarManifest::GetResults()[0].verdict == SidecarVerdict::MATCH;
+            SidecarManifest::Clear();
+            actual = actual && SidecarManifest::GetResults().empty() && SidecarManifest::GetPendingAlgorithmMask(filename.c_str()) == 0U;
+            DeleteFileW(ffpFilename.c_str());
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests the manifest File Extensions, which are NOT case sensitive.
+        /// </summary>
+        TEST_METHOD(testIsManifestType)
+        {
+            // Arrange
+            bool expected = true;
+
+            // Act
+            bool actual = SidecarManifest::IsManifestType(L"Album.MD5") && SidecarManifest::IsManifestType(L"Album.sfv") &&
+                SidecarManifest::IsManifestType(L"Album.xxh64") && SidecarManifest::IsManifestType(L"Album.ffp") &&
+                !SidecarManifest::IsManifestType(L"Album.flac") && !SidecarManifest::IsManifestType(L".md5");
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
@@ -0,0 +1,246 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "SparseLoadProbe.h"
+#include "SparseLoadProbe.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace SparseLoadProbeUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The sizes of the generated containers. The TXXX Frame and the padding fill the ID3v2 Tag exactly.
+    /// </summary>
+    constexpr auto ID3V2_FRAME_BODY_SIZE = 990UL;
+    constexpr auto ID3V2_PADDING_SIZE = 1024UL;
+    constexpr auto FLAC_PICTURE_BODY_SIZE = 5000UL;
+    constexpr auto FLAC_PADDING_BODY_SIZE = 8192UL;
+    constexpr auto AUDIO_SIZE = 4096UL;
+
+    /// <summary>
+    /// Purpose: A smaller range is loaded anyway.
+    /// </summary>
+    constexpr auto MINIMUM_RANGE_LENGTH = 512ULL;
+
+    void AppendBigEndian(std::vector<unsigned char>& dataRef, unsigned long value, unsigned long byteCount)
+    {
+        for (unsigned long i = byteCount; i > 0UL; --i)
+        {
+            dataRef.push_back(static_cast<unsigned char>(value >> (8UL * (i - 1UL))));
+        }
+    }
+
+    void AppendLittleEndian32(std::vector<unsigned char>& dataRef, unsigned long value)
+    {
+        for (unsigned long i = 0UL; i < 4UL; ++i)
+        {
+            dataRef.push_back(static_cast<unsigned char>(value >> (8UL * i)));
+        }
+    }
+
+    /// <summary>
+    /// Purpose: Appends an ID3v2.3 Tag holding a single TXXX Frame, followed by padding.
+    /// </summary>
+    void AppendID3v2Tag(std::vector<unsigned char>& dataRef)
+    {
+        const unsigned long tagBodySize = 10UL + ID3V2_FRAME_BODY_SIZE + ID3V2_PADDING_SIZE;
+        const unsigned char header[] = { 'I', 'D', '3', 3U, 0U, 0U,
+            static_cast<unsigned char>((tagBodySize >> 21) & 0x7FUL), static_cast<unsigned char>((tagBodySize >> 14) & 0x7FUL),
+            static_cast<unsigned char>((tagBodySize >> 7) & 0x7FUL), static_cast<unsigned char>(tagBodySize & 0x7FUL) };
+        dataRef.insert(dataRef.end(), header, header + sizeof(header));
+
+        const unsigned char frameId[] = { 'T', 'X', 'X', 'X' };
+        dataRef.insert(dataRef.end(), frameId, frameId + sizeof(frameId));
+        AppendBigEndian(dataRef, ID3V2_FRAME_BODY_SIZE, 4UL);
+        AppendBigEndian(dataRef, 0UL, 2UL);
+        dataRef.insert(dataRef.end(), ID3V2_FRAME_BODY_SIZE, 'x');
+        dataRef.insert(dataRef.end(), ID3V2_PADDING_SIZE, 0U);
+    }
+
+    /// <summary>
+    /// Purpose: Appends a FLAC Stream: STREAMINFO, PICTURE, and PADDING Metadata Blocks, then the start of the first Frame (or NOT, when the framing is broken).
+    /// </summary>
+    void AppendFlacStream(std::vector<unsigned char>& dataRef, bool frameFollowsMetadata)
+    {
+        const unsigned char marker[] = { 'f', 'L', 'a', 'C' };
+        dataRef.insert(dataRef.end(), marker, marker + sizeof(marker));
+
+        dataRef.push_back(0x00U); // STREAMINFO
+        AppendBigEndian(dataRef, 34UL, 3UL);
+        dataRef.insert(dataRef.end(), 34U, 0x11U);
+
+        dataRef.push_back(0x06U); // PICTURE
+        AppendBigEndian(dataRef, FLAC_PICTURE_BODY_SIZE, 3UL);
+        dataRef.insert(dataRef.end(), FLAC_PICTURE_BODY_SIZE, 0x22U);
+
+        dataRef.push_back(0x81U); // PADDING (the last Metadata Block)
+        AppendBigEndian(dataRef, FLAC_PADDING_BODY_SIZE, 3UL);
+        dataRef.insert(dataRef.end(), FLAC_PADDING_BODY_SIZE, 0x00U);
+
+        dataRef.push_back(frameFollowsMetadata ? 0xFFU : 0x00U);
+        dataRef.push_back(0xF8U);
+        dataRef.insert(dataRef.end(), AUDIO_SIZE, 0x5AU);
+    }
+
+    /// <summary>
+    /// Purpose: Appends an APEv2 Tag (with a header) holding two items, followed by an ID3v1 Tag.
+    /// </summary>
+    void AppendApeAndID3v1Tags(std::vector<unsigned char>& dataRef, unsigned long long& itemsOffsetRef, unsigned long long& itemsSizeRef)
+    {
+        std::vector<unsigned char> items;
+        const std::string keys[] = { "Title", "Cover Art (Front)" };
+        const unsigned long valueSizes[] = { 20UL, 3000UL };
+        for (size_t i = 0U; i < 2U; ++i)
+        {
+            AppendLittleEndian32(items, valueSizes[i]);
+            AppendLittleEndian32(items, 0UL);
+            items.insert(items.end(), keys[i].begin(), keys[i].end());
+            items.push_back(0U);
+            items.insert(items.end(), valueSizes[i], 'v');
+        }
+
+        const unsigned long tagSize = static_cast<unsigned long>(items.size()) + 32UL;
+        for (int part = 0; part < 2; ++part)
+        {
+            const unsigned char id[] = { 'A', 'P', 'E', 'T', 'A', 'G', 'E', 'X' };
+            dataRef.insert(dataRef.end(), id, id + sizeof(id));
+            AppendLittleEndian32(dataRef, 2000UL);
+            AppendLittleEndian32(dataRef, tagSize);
+            AppendLittleEndian32(dataRef, 2UL);
+            AppendLittleEndian32(dataRef, (part == 0) ? 0xA0000000UL : 0x80000000UL); // Contains a header. The header has bit 29 set.
+            dataRef.insert(dataRef.end(), 8U, 0U);
+            if (part == 0)
+            {
+                itemsOffsetRef = dataRef.size();
+                itemsSizeRef = items.size();
+                dataRef.insert(dataRef.end(), items.begin(), items.end());
+            }
+        }
+
+        const unsigned char id3v1Id[] = { 'T', 'A', 'G' };
+        dataRef.insert(dataRef.end(), id3v1Id, id3v1Id + sizeof(id3v1Id));
+        dataRef.insert(dataRef.end(), 125U, 0U);
+    }
+
+    /// <summary>
+    /// Purpose: Writes the File, and probes it.
+    /// </summary>
+    bool Probe(const std::vector<unsigned char>& fileRef, bool framingValidationIsEnabled, std::vector<SparseLoadRange>& skippedRangesRef)
+    {
+        skippedRangesRef.clear();
+        const std::wstring filename = UnitTestFixture::CreateTemporaryFile(fileRef, L".bin");
+        FILE* fileStreamPtr = nullptr;
+        if (filename.empty() || _wfopen_s(&fileStreamPtr, filename.c_str(), L"rb") != 0 || fileStreamPtr == nullptr)
+        {
+            return false;
+        }
+
+        const bool rangesWereFound = SparseLoadProbe::FindSkippedRanges(fileStreamPtr, fileRef.size(), MINIMUM_RANGE_LENGTH, framingValidationIsEnabled, skippedRangesRef);
+        fclose(fileStreamPtr);
+        DeleteFileW(filename.c_str());
+        return rangesWereFound;
+    }
+
+    bool RangeEquals(const SparseLoadRange& rangeRef, unsigned long long offset, unsigned long long length)
+    {
+        return rangeRef.offset == offset && rangeRef.length == length;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the Sparse Load Probe.
+    /// </summary>
+    TEST_CLASS(SparseLoadProbeUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests a FLAC File with a leading ID3v2 Tag. The Tag body, and the PICTURE and PADDING bodies are skipped. STREAMINFO and the Block headers are loaded.
+        /// </summary>
+        TEST_METHOD(testFlacWithID3v2Tag)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            SparseLoadProbeUnitTestSupport::AppendID3v2Tag(file);
+            const unsigned long long streamOffset = file.size();
+            SparseLoadProbeUnitTestSupport::AppendFlacStream(file, true);
+            std::vector<SparseLoadRange> skippedRanges;
+            bool expected = true;
+
+            // Act
+            bool actual = SparseLoadProbeUnitTestSupport::Probe(file, true, skippedRanges) && skippedRanges.size() == 3U &&
+                SparseLoadProbeUnitTestSupport::RangeEquals(skippedRanges[0], 10ULL, streamOffset - 10ULL) &&
+                SparseLoadProbeUnitTestSupport::RangeEquals(skippedRanges[1], streamOffset + 4ULL + 4ULL + 34ULL + 4ULL, SparseLoadProbeUnitTestSupport::FLAC_PICTURE_BODY_SIZE) &&
+                SparseLoadProbeUnitTestSupport::RangeEquals(skippedRanges[2], streamOffset + 4ULL + 4ULL + 34ULL + 4ULL + SparseLoadProbeUnitTestSupport::FLAC_PICTURE_BODY_SIZE + 4ULL, SparseLoadProbeUnitTestSupport::FLAC_PADDING_BODY_SIZE);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests a FLAC File whose last Metadata Block is NOT followed by a Frame. Its Metadata Blocks are only skipped when the framing is NOT validated.
+        /// </summary>
+        TEST_METHOD(testFlacWithBrokenFraming)
+        {
+            // Arrange
+            std::vector<unsigned char> file;
+            SparseLoadProbeUnitTestSupport::AppendFlacStream(file, false);
+            std::vector<SparseLoadRange> validatedRanges;
+            std::vector<SparseLoadRange> unvalidatedRanges;
+            bool expected = true;
+
+            // Act
+            bool actual = !SparseLoadProbeUnitTestSupport::Probe(file, true, validatedRanges) && validatedRanges.empty() &&
+                SparseLoadProbeUnitTestSupport::Probe(file, false, unvalidatedRanges) && unvalidatedRanges.size() == 2U;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests an MP3 File with a trailing APEv2 Tag and ID3v1 Tag. Only the APEv2 items are skipped.
+        /// </summary>
+        TEST_METHOD(testMp3WithApeTag)
+        {
+            // Arrange
+            std::vector<unsigned char> file{ 0xFFU, 0xFBU, 0x90U, 0x64U };
+            file.insert(file.end(), SparseLoadProbeUnitTestSupport::AUDIO_SIZE, 0x5AU);
+            unsigned long long itemsOffset = 0ULL;
+            unsigned long long itemsSize = 0ULL;
+            SparseLoadProbeUnitTestSupport::AppendApeAndID3v1Tags(file, itemsOffset, itemsSize);
+            std::vector<SparseLoadRange> skippedRanges;
+            bool expected = true;
+
+            // Act
+            bool actual = SparseLoadProbeUnitTestSupport::Probe(file, true, skippedRanges) && skippedRanges.size() == 1U &&
+                SparseLoadProbeUnitTestSupport::RangeEquals(skippedRanges[0], itemsOffset, itemsSize);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that an Ogg File is NOT probed, since its Decoder reads its tags.
+        /// </summary>
+        TEST_METHOD(testOggIsNotProbed)
+        {
+            // Arrange
+            std::vector<unsigned char> file{ 'O', 'g', 'g', 'S' };
+            file.insert(file.end(), SparseLoadProbeUnitTestSupport::AUDIO_SIZE, 0x00U);
+            std::vector<SparseLoadRange> skippedRanges;
+            bool expected = false;
+
+            // Act
+            bool actual = SparseLoadProbeUnitTestSupport::Probe(file, true, skippedRanges) || !skippedRanges.empty();
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
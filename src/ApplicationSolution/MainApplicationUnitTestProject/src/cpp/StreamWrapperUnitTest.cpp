@@ -0,0 +1,139 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <windows.h>
+#include <string>
+#include <vector>
+#include "StreamWrapper.h"
+#include "StreamWrapper.cpp"
+#include "UnitTestFixture.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace StreamWrapperUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The size of the File. Several read Blocks, and NOT a multiple of the sector size, so the last aligned read is partial.
+    /// </summary>
+    constexpr auto FILE_SIZE = 200017UL;
+
+    /// <summary>
+    /// Purpose: Creates numbered bytes.
+    /// </summary>
+    std::vector<unsigned char> CreateContent()
+    {
+        std::vector<unsigned char> content(FILE_SIZE);
+        for (size_t i = 0U; i < content.size(); ++i)
+        {
+            content[i] = static_cast<unsigned char>(i % 251U);
+        }
+
+        return content;
+    }
+
+    /// <summary>
+    /// Purpose: Opens the File with the process-wide Cache Policy, and reads it to the end through the StreamWrapper.
+    /// </summary>
+    /// <param name="fileCachePolicyRef">Receives the Cache Policy of the open File.</param>
+    /// <returns>The bytes read. Empty if the File could NOT be opened.</returns>
+    std::vector<unsigned char> ReadFile(const std::wstring& filenameRef, bool useMemoryBufferEnabled, StreamCachePolicy& fileCachePolicyRef)
+    {
+        std::vector<unsigned char> bytes;
+        StreamWrapper streamWrapper;
+        if (streamWrapper.Open(filenameRef.c_str(), useMemoryBufferEnabled))
+        {
+            fileCachePolicyRef = streamWrapper.GetFileCachePolicy();
+            unsigned char buffer[4096]{};
+            size_t bytesRead = 0U;
+            while ((bytesRead = streamWrapper.Read(buffer, sizeof(buffer))) > 0U)
+            {
+                bytes.insert(bytes.end(), buffer, buffer + bytesRead);
+            }
+        }
+
+        return bytes;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the File Cache Policy of the StreamWrapper.
+    /// </summary>
+    TEST_CLASS(StreamWrapperUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests that every Cache Policy is used as set with the Memory Buffer, and reads the whole File.
+        /// NO_BUFFERING may fall back to SEQUENTIAL_SCAN, when the Volume of the Temporary Folder rejects the aligned reads.
+        /// </summary>
+        TEST_METHOD(testCachePolicyWithMemoryBuffer)
+        {
+            // Arrange
+            const std::vector<unsigned char> content = StreamWrapperUnitTestSupport::CreateContent();
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(content, L".bin");
+            const StreamCachePolicy cachePolicies[] = { StreamCachePolicy::DEFAULT, StreamCachePolicy::SEQUENTIAL_SCAN, StreamCachePolicy::NO_BUFFERING };
+            bool expected = true;
+
+            // Act
+            bool actual = true;
+            for (const StreamCachePolicy cachePolicy : cachePolicies)
+            {
+                StreamWrapper::SetCachePolicy(cachePolicy);
+                StreamCachePolicy fileCachePolicy = StreamCachePolicy::DEFAULT;
+                const std::vector<unsigned char> bytes = StreamWrapperUnitTestSupport::ReadFile(filename, true, fileCachePolicy);
+                const bool policyIsUsed = (fileCachePolicy == cachePolicy) || (cachePolicy == StreamCachePolicy::NO_BUFFERING && fileCachePolicy == StreamCachePolicy::SEQUENTIAL_SCAN);
+                actual = actual && policyIsUsed && (bytes == content);
+            }
+            DeleteFileW(filename.c_str());
+            StreamWrapper::SetCachePolicy(StreamCachePolicy::DEFAULT);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that NO_BUFFERING falls back to SEQUENTIAL_SCAN without the Memory Buffer, since only the Memory Buffer makes aligned reads.
+        /// </summary>
+        TEST_METHOD(testNoBufferingWithoutMemoryBuffer)
+        {
+            // Arrange
+            const std::vector<unsigned char> content = StreamWrapperUnitTestSupport::CreateContent();
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(content, L".bin");
+            StreamCachePolicy fileCachePolicy = StreamCachePolicy::DEFAULT;
+            bool expected = true;
+
+            // Act
+            StreamWrapper::SetCachePolicy(StreamCachePolicy::NO_BUFFERING);
+            const std::vector<unsigned char> bytes = StreamWrapperUnitTestSupport::ReadFile(filename, false, fileCachePolicy);
+            bool actual = (fileCachePolicy == StreamCachePolicy::SEQUENTIAL_SCAN) && (bytes == content);
+            DeleteFileW(filename.c_str());
+            StreamWrapper::SetCachePolicy(StreamCachePolicy::DEFAULT);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that closing the File resets its Cache Policy, while the process-wide Cache Policy is kept for the next File.
+        /// </summary>
+        TEST_METHOD(testCachePolicyIsResetOnClose)
+        {
+            // Arrange
+            const std::wstring filename = UnitTestFixture::CreateTemporaryFile(StreamWrapperUnitTestSupport::CreateContent(), L".bin");
+            StreamWrapper streamWrapper;
+            bool expected = true;
+
+            // Act
+            StreamWrapper::SetCachePolicy(StreamCachePolicy::SEQUENTIAL_SCAN);
+            bool actual = streamWrapper.Open(filename.c_str(), true) && (streamWrapper.GetFileCachePolicy() == StreamCachePolicy::SEQUENTIAL_SCAN);
+            streamWrapper.Close();
+            actual = actual && (streamWrapper.GetFileCachePolicy() == StreamCachePolicy::DEFAULT) && (StreamWrapper::GetCachePolicy() == StreamCachePolicy::SEQUENTIAL_SCAN);
+            DeleteFileW(filename.c_str());
+            StreamWrapper::SetCachePolicy(StreamCachePolicy::DEFAULT);
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
@@ -0,0 +1,41 @@
+#include "pch.h"
+#include "UnitTestFixture.h"
+#include <windows.h>
+#include <atomic>
+#include <cstdio>
+
+namespace UnitTestFixtureSupport
+{
+    /// <summary>
+    /// Purpose: Numbers the Temporary Files created by this Process.
+    /// </summary>
+    std::atomic<unsigned long> g_temporaryFileCount{ 0UL };
+}
+
+std::wstring UnitTestFixture::CreateTemporaryFile(const std::vector<unsigned char>& contentRef, const wchar_t* extensionPtr)
+{
+    wchar_t folder[MAX_PATH + 1]{};
+    if (GetTempPathW(MAX_PATH + 1, folder) == 0UL)
+    {
+        return L"";
+    }
+
+    const std::wstring filename = std::wstring(folder) + L"WinAudioDecodeR_UnitTest_" + std::to_wstring(GetCurrentProcessId()) + L"_" +
+        std::to_wstring(UnitTestFixtureSupport::g_temporaryFileCount++) + extensionPtr;
+
+    FILE* fileStreamPtr = nullptr;
+    if (_wfopen_s(&fileStreamPtr, filename.c_str(), L"wb") != 0 || fileStreamPtr == nullptr)
+    {
+        return L"";
+    }
+
+    const size_t writtenSize = contentRef.empty() ? 0U : fwrite(contentRef.data(), 1U, contentRef.size(), fileStreamPtr);
+    fclose(fileStreamPtr);
+    if (writtenSize != contentRef.size())
+    {
+        DeleteFileW(filename.c_str());
+        return L"";
+    }
+
+    return filename;
+}
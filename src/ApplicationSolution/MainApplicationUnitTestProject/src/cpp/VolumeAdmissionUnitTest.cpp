@@ -0,0 +1,119 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include <list>
+#include <string>
+#include "VolumeAdmission.h"
+#include "VolumeAdmission.cpp"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace VolumeAdmissionUnitTestSupport
+{
+    /// <summary>
+    /// Purpose: The Files of two web servers. The Volume of a URL is named by its origin, so the Volumes are found without calling the File System.
+    /// </summary>
+    const wchar_t* const FIRST_SERVER_FIRST_FILE = L"https://a.example/music/01.flac";
+    const wchar_t* const FIRST_SERVER_SECOND_FILE = L"https://a.example/music/02.flac";
+    const wchar_t* const SECOND_SERVER_FILE = L"https://b.example/music/01.flac";
+
+    /// <summary>
+    /// Purpose: The number of Files read before the latency of a Volume is measured.
+    /// </summary>
+    constexpr auto LEARNING_FILE_COUNT = 8UL;
+
+    /// <summary>
+    /// Purpose: Creates the Limits, with a single read for each web server.
+    /// </summary>
+    VolumeAdmissionLimits CreateLimits()
+    {
+        VolumeAdmissionLimits limits{};
+        limits.networkLimit = 1UL;
+        return limits;
+    }
+}
+
+namespace MainApplicationUnitTest
+{
+    /// <summary>
+    /// Purpose: A Test Class for the per-Volume admission of the reads.
+    /// </summary>
+    TEST_CLASS(VolumeAdmissionUnitTest)
+    {
+    public:
+
+        /// <summary>
+        /// Purpose: Tests that a File on a busy Volume is passed over for a File on another Volume, and is chosen once the Volume is released.
+        /// </summary>
+        TEST_METHOD(testFindAdmissibleFileSkipsBusyVolume)
+        {
+            // Arrange
+            VolumeAdmission volumeAdmission{};
+            volumeAdmission.Configure(VolumeAdmissionUnitTestSupport::CreateLimits(), nullptr);
+            volumeAdmission.AddFile(VolumeAdmissionUnitTestSupport::FIRST_SERVER_SECOND_FILE);
+            volumeAdmission.AddFile(VolumeAdmissionUnitTestSupport::SECOND_SERVER_FILE);
+            std::list<std::wstring> filenameList = { VolumeAdmissionUnitTestSupport::FIRST_SERVER_SECOND_FILE, VolumeAdmissionUnitTestSupport::SECOND_SERVER_FILE };
+            bool expected = true;
+
+            // Act
+            VolumeAdmissionTicket ticket = volumeAdmission.Admit(VolumeAdmissionUnitTestSupport::FIRST_SERVER_FIRST_FILE);
+            bool busyVolumeIsSkipped = *volumeAdmission.FindAdmissibleFile(filenameList, filenameList.size()) == VolumeAdmissionUnitTestSupport::SECOND_SERVER_FILE;
+            volumeAdmission.Release(ticket);
+            bool releasedVolumeIsChosen = *volumeAdmission.FindAdmissibleFile(filenameList, filenameList.size()) == VolumeAdmissionUnitTestSupport::FIRST_SERVER_SECOND_FILE;
+            bool actual = busyVolumeIsSkipped && releasedVolumeIsChosen;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that a configured storage class (NOT case sensitive) replaces the class of the Volume, and sets its number of concurrent reads.
+        /// </summary>
+        TEST_METHOD(testStorageClassOverride)
+        {
+            // Arrange
+            VolumeAdmissionLimits limits = VolumeAdmissionUnitTestSupport::CreateLimits();
+            limits.solidStateLimit = 2UL;
+            VolumeAdmission volumeAdmission{};
+            volumeAdmission.Configure(limits, L"C:\\=ROTATIONAL;HTTPS://A.EXAMPLE:443/=solid_state");
+            bool expected = true;
+
+            // Act
+            VolumeAdmissionTicket firstTicket = volumeAdmission.Admit(VolumeAdmissionUnitTestSupport::FIRST_SERVER_FIRST_FILE);
+            VolumeAdmissionTicket secondTicket = volumeAdmission.Admit(VolumeAdmissionUnitTestSupport::FIRST_SERVER_SECOND_FILE);
+            volumeAdmission.Release(secondTicket);
+            volumeAdmission.Release(firstTicket);
+            std::wstring report = volumeAdmission.GetReport();
+            bool actual = report.find(L"https://a.example:443/\tSOLID_STATE x2 (2 Files") != std::wstring::npos;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+
+        /// <summary>
+        /// Purpose: Tests that the latency of a Volume is measured after the learning Files, and that a class NOT learned (i.e. NETWORK) is kept, however slow the Volume.
+        /// </summary>
+        TEST_METHOD(testLatencyKeepsNetworkClass)
+        {
+            // Arrange
+            VolumeAdmission volumeAdmission{};
+            volumeAdmission.Configure(VolumeAdmissionUnitTestSupport::CreateLimits(), nullptr);
+            bool expected = true;
+
+            // Act
+            for (unsigned long fileIndex = 0UL; fileIndex < VolumeAdmissionUnitTestSupport::LEARNING_FILE_COUNT; ++fileIndex)
+            {
+                VolumeAdmissionTicket ticket = volumeAdmission.Admit(VolumeAdmissionUnitTestSupport::FIRST_SERVER_FIRST_FILE);
+                ticket.byteCount = 1000000ULL;
+                ticket.admittedTime -= std::chrono::milliseconds(50);
+                volumeAdmission.Release(ticket);
+            }
+
+            std::wstring report = volumeAdmission.GetReport();
+            bool actual = report.find(L"\tNETWORK x1 (8 Files") != std::wstring::npos && report.find(L"latency 0.0 ms") == std::wstring::npos;
+
+            // Assert
+            Assert::AreEqual(expected, actual);
+        }
+    };
+}
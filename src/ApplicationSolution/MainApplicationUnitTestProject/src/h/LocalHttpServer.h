@@ -0,0 +1,104 @@
+#ifndef LOCAL_HTTP_SERVER_H
+#define LOCAL_HTTP_SERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Purpose: A minimal HTTP/1.1 server on the loopback interface, standing in for an object gateway, so the range requests of a RemoteStreamSource are tested without a network.
+///
+/// It serves a single object, with a strong ETag that changes whenever the object is replaced. A GET with a Range header is answered with 206 (Partial Content),
+/// unless range support is disabled, or its If-Range header does NOT match the ETag (when If-Range is supported), in which case the whole object is returned with 200.
+/// Each connection is served on its own Thread, and is kept alive, like a real server.
+/// </summary>
+class LocalHttpServer
+{
+    public:
+        LocalHttpServer();
+        virtual ~LocalHttpServer();
+        LocalHttpServer(const LocalHttpServer& other) = delete; // Delete Copy Constructor
+        LocalHttpServer& operator=(const LocalHttpServer& other) = delete; // Delete Assignment Operator (Overloaded)
+        LocalHttpServer(LocalHttpServer&& other) noexcept = delete; // Delete The Move Constructor
+        LocalHttpServer& operator=(LocalHttpServer&& other) noexcept = delete; // Delete Move Assignment Operator (Overloaded)
+
+        /// <summary>
+        /// Purpose: Listens on a free port of 127.0.0.1.
+        /// </summary>
+        /// <returns>TRUE if the server is listening. Otherwise, FALSE.</returns>
+        bool Start(const std::vector<unsigned char>& objectRef);
+
+        /// <summary>
+        /// Purpose: Closes the listening Socket and every connection, and waits for their Threads.
+        /// </summary>
+        void Stop();
+
+        /// <summary>
+        /// Purpose: Gets the URL of the object. Any other path is NOT found (404).
+        /// </summary>
+        std::wstring GetObjectUrl() const;
+
+        /// <summary>
+        /// Purpose: Gets a URL on the server that is NOT found (404).
+        /// </summary>
+        std::wstring GetMissingUrl() const;
+
+        /// <summary>
+        /// Purpose: Replaces the object, as if it was uploaded again. Its ETag changes.
+        /// </summary>
+        void ReplaceObject(const std::vector<unsigned char>& objectRef);
+
+        /// <summary>
+        /// Purpose: Makes the server ignore the Range header, like a server that does NOT support range requests.
+        /// </summary>
+        void SetRangeSupport(bool isSupported);
+
+        /// <summary>
+        /// Purpose: Makes the server ignore the If-Range header, so a range of a replaced object is still returned (206), with its new ETag.
+        /// </summary>
+        void SetIfRangeSupport(bool isSupported);
+
+        /// <summary>
+        /// Purpose: Gets the number of requests answered with 206, and with 200.
+        /// </summary>
+        unsigned long GetPartialResponseCount() const;
+        unsigned long GetFullResponseCount() const;
+
+    private:
+        std::uintptr_t m_listenSocket; // A SOCKET, so the header does NOT depend on the Winsock header.
+        unsigned short m_port{};
+        bool m_winsockIsStarted{ false };
+        std::thread m_listenThread{};
+
+        mutable std::mutex m_mutex{};
+        std::vector<unsigned char> m_object{};
+        unsigned long m_objectVersion{};
+        bool m_rangeIsSupported{ true };
+        bool m_ifRangeIsSupported{ true };
+        std::set<std::uintptr_t> m_connectionSockets{}; // The open connections, shut down by Stop().
+        std::vector<std::thread> m_connectionThreads{};
+
+        std::atomic<unsigned long> m_partialResponseCount{};
+        std::atomic<unsigned long> m_fullResponseCount{};
+
+        /// <summary>
+        /// Purpose: Accepts connections until the listening Socket is closed.
+        /// </summary>
+        void AcceptConnections();
+
+        /// <summary>
+        /// Purpose: Answers the requests of a connection until the client closes it, or the server is stopped.
+        /// </summary>
+        void ServeConnection(std::uintptr_t connectionSocket);
+
+        /// <summary>
+        /// Purpose: Builds the response to a request: its status line and headers, followed by its body.
+        /// </summary>
+        std::string BuildResponse(const std::string& requestRef);
+};
+
+#endif // LOCAL_HTTP_SERVER_H
@@ -0,0 +1,21 @@
+#ifndef UNIT_TEST_FIXTURE_H
+#define UNIT_TEST_FIXTURE_H
+
+#include <string>
+#include <vector>
+
+/// <summary>
+/// Purpose: Writes the fixtures generated by the Test Classes to Files.
+/// </summary>
+namespace UnitTestFixture
+{
+    /// <summary>
+    /// Purpose: Writes a generated fixture to a new File in the Temporary Folder. The caller deletes the File (i.e. DeleteFileW()).
+    /// </summary>
+    /// <param name="contentRef">The bytes of the File.</param>
+    /// <param name="extensionPtr">The File Extension, including the '.' (e.g. L".zip"), since some readers choose the format by File Extension.</param>
+    /// <returns>The filename, or an empty string if the File could NOT be written.</returns>
+    std::wstring CreateTemporaryFile(const std::vector<unsigned char>& contentRef, const wchar_t* extensionPtr);
+}
+
+#endif // UNIT_TEST_FIXTURE_H